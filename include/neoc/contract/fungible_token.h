@@ -27,6 +27,39 @@ typedef struct neoc_fungible_token {
     uint64_t total_supply;              // Total supply (fractions)
 } neoc_fungible_token_t;
 
+/**
+ * One recipient of a batch transfer
+ */
+typedef struct neoc_fungible_token_transfer_request {
+    neoc_hash160_t to;                  /**< Recipient script hash */
+    uint64_t amount;                    /**< Transfer amount (token fractions) */
+    const uint8_t *data;                /**< Optional onPayment data payload */
+    size_t data_len;                    /**< Length of data payload */
+} neoc_fungible_token_transfer_request_t;
+
+/**
+ * A run of consecutive transfers that fits in one transaction script
+ */
+typedef struct {
+    size_t first_transfer;              /**< Index of the first transfer in the request array */
+    size_t transfer_count;              /**< Number of transfers in this chunk */
+    size_t script_offset;               /**< Offset of this chunk's script in the batch script */
+    size_t script_len;                  /**< Length of this chunk's script */
+} neoc_fungible_token_batch_chunk_t;
+
+/**
+ * Batch transfer scripts and the plan splitting them across transactions
+ *
+ * The chunk scripts are stored back to back in script; chunk i is
+ * script[chunks[i].script_offset .. + chunks[i].script_len).
+ */
+typedef struct {
+    uint8_t *script;                    /**< All chunk scripts, in request order */
+    size_t script_len;                  /**< Total length of script */
+    neoc_fungible_token_batch_chunk_t *chunks; /**< One entry per transaction */
+    size_t chunk_count;                 /**< Number of chunks */
+} neoc_fungible_token_batch_t;
+
 /**
  * Create fungible token instance
  * @param contract_hash Token contract hash
@@ -77,6 +110,38 @@ neoc_error_t neoc_fungible_token_transfer(neoc_fungible_token_t *token,
                                            uint8_t *data,
                                            size_t data_len);
 
+/**
+ * Build NEP-17 transfer scripts for many recipients, split across transactions
+ *
+ * Every transfer is encoded from the shared NEP-17 template straight into one
+ * exactly sized buffer. Transfers are packed greedily, in order, into chunks whose
+ * script does not exceed max_script_size; each chunk is meant to become one
+ * transaction. A single transfer larger than the limit fails with
+ * NEOC_ERROR_INVALID_SIZE.
+ *
+ * @param token_hash Token contract hash
+ * @param from Sender script hash
+ * @param transfers Recipients (amounts must be non-zero)
+ * @param transfer_count Number of recipients
+ * @param max_script_size Script limit per transaction; 0 selects
+ *        NEOC_MAX_TRANSACTION_SCRIPT_SIZE, the largest script a node accepts,
+ *        and SIZE_MAX disables splitting
+ * @param batch Output batch (caller must free with neoc_fungible_token_batch_free)
+ * @return Error code
+ */
+neoc_error_t neoc_fungible_token_build_batch_transfer(const neoc_hash160_t *token_hash,
+                                                      const neoc_hash160_t *from,
+                                                      const neoc_fungible_token_transfer_request_t *transfers,
+                                                      size_t transfer_count,
+                                                      size_t max_script_size,
+                                                      neoc_fungible_token_batch_t **batch);
+
+/**
+ * Free a batch built by neoc_fungible_token_build_batch_transfer
+ * @param batch Batch to free
+ */
+void neoc_fungible_token_batch_free(neoc_fungible_token_batch_t *batch);
+
 /**
  * Get token decimals
  * @param token The token
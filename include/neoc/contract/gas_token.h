@@ -35,12 +35,7 @@ typedef struct neoc_gas_token {
 /**
  * @brief Transfer parameters used for multi-transfer script generation.
  */
-typedef struct neoc_gas_token_transfer_request {
-    neoc_hash160_t to;                  /**< Recipient script hash */
-    uint64_t amount;                    /**< Transfer amount (token fractions) */
-    const uint8_t *data;                /**< Optional onPayment data payload */
-    size_t data_len;                    /**< Length of data payload */
-} neoc_gas_token_transfer_request_t;
+typedef neoc_fungible_token_transfer_request_t neoc_gas_token_transfer_request_t;
 
 /**
  * Create GAS token instance
@@ -23,6 +23,7 @@ extern "C" {
 #define BIP32_CHAIN_CODE_SIZE 32
 #define BIP32_FINGERPRINT_SIZE 4
 #define BIP32_SERIALIZED_SIZE 82
+#define BIP32_MAX_PATH_DEPTH 32
 
 // Default Neo derivation path: m/44'/888'/0'/0/0
 #define BIP32_NEO_PURPOSE 44
@@ -100,6 +101,65 @@ neoc_error_t neoc_bip32_derive_path_indices_alloc(const neoc_bip32_key_t *master
                                                   size_t indices_count,
                                                   neoc_bip32_key_t **derived);
 
+/**
+ * @brief Derive consecutive children of one parent
+ *
+ * Derives children start .. start + count - 1 into out_keys. The parent's
+ * public key and fingerprint are computed once for the whole range, and
+ * large ranges are spread over worker threads. A public parent (see
+ * neoc_bip32_get_public_key) yields public children without any private
+ * key, which suits watch-only deposit address generation.
+ *
+ * @param parent Parent key
+ * @param start First child index; hardened indices need a private parent
+ * @param count Number of children
+ * @param out_keys Output array of count keys, cleared on failure
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_bip32_derive_range(const neoc_bip32_key_t *parent,
+                                     uint32_t start,
+                                     size_t count,
+                                     neoc_bip32_key_t *out_keys);
+
+/**
+ * @brief Derivation context caching intermediate nodes below a root key
+ *
+ * Paths sharing a prefix, such as m/44'/888'/0'/0/i, derive the prefix once;
+ * afterwards each key costs a single child step. Created from a public
+ * root it works in public-only mode and rejects hardened steps. A context
+ * is not thread-safe; the keys it holds are wiped by
+ * neoc_bip32_context_free.
+ */
+typedef struct neoc_bip32_context neoc_bip32_context_t;
+
+neoc_error_t neoc_bip32_context_create(const neoc_bip32_key_t *root,
+                                       neoc_bip32_context_t **context);
+
+/**
+ * @brief Derive the key at a path below the context root
+ *
+ * Same result as neoc_bip32_derive_path_indices from the root.
+ */
+neoc_error_t neoc_bip32_context_derive(neoc_bip32_context_t *context,
+                                       const uint32_t *indices,
+                                       size_t indices_count,
+                                       neoc_bip32_key_t *derived);
+
+/**
+ * @brief Derive consecutive children of the node at parent_indices
+ *
+ * Same as neoc_bip32_derive_range on that node, with the node taken from
+ * the cache when possible.
+ */
+neoc_error_t neoc_bip32_context_derive_range(neoc_bip32_context_t *context,
+                                             const uint32_t *parent_indices,
+                                             size_t parent_depth,
+                                             uint32_t start,
+                                             size_t count,
+                                             neoc_bip32_key_t *out_keys);
+
+void neoc_bip32_context_free(neoc_bip32_context_t *context);
+
 /**
  * @brief Get public key from extended key
  * 
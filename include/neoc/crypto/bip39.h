@@ -101,6 +101,29 @@ neoc_error_t neoc_bip39_mnemonic_to_seed_len(const char *mnemonic,
                                              uint8_t *seed,
                                              size_t seed_len);
 
+/**
+ * @brief Derive seeds for many mnemonics in parallel
+ *
+ * Each seed is what neoc_bip39_mnemonic_to_seed_buffer would produce, with
+ * the PBKDF2 runs spread across a pool of worker threads. Like the single
+ * call, mnemonics are not validated; use neoc_bip39_validate_mnemonic.
+ *
+ * @param mnemonics Mnemonic phrases
+ * @param passphrases Passphrase per mnemonic, or NULL for none at all;
+ *                    NULL entries also mean no passphrase
+ * @param count Number of mnemonics
+ * @param threads Maximum worker threads (0 for one per CPU)
+ * @param seeds Output, 64 bytes per mnemonic
+ * @param results Output status of each mnemonic
+ * @return NEOC_SUCCESS if the batch ran, error code otherwise
+ */
+neoc_error_t neoc_bip39_mnemonic_to_seed_batch(const char *const *mnemonics,
+                                               const char *const *passphrases,
+                                               size_t count,
+                                               size_t threads,
+                                               uint8_t *seeds,
+                                               neoc_error_t *results);
+
 /**
  * @brief Validate a mnemonic phrase
  * 
@@ -28,7 +28,7 @@ typedef struct {
  */
 typedef struct neoc_ec_public_key {
     EC_POINT *point;          // OpenSSL EC_POINT
-    EC_GROUP *group;          // OpenSSL EC_GROUP for secp256r1
+    const EC_GROUP *group;    // Shared secp256r1 group (see neoc_ec_secp256r1_group)
     uint8_t compressed[33];   // Compressed public key (33 bytes)
     uint8_t uncompressed[65]; // Uncompressed public key (65 bytes)
     bool is_compressed;       // Whether to use compressed format by default
@@ -42,6 +42,16 @@ typedef struct {
     neoc_ec_public_key_t *public_key;
 } neoc_ec_key_pair_t;
 
+/**
+ * @brief Get the process-wide secp256r1 curve group
+ * 
+ * The group is created once, with precomputed generator multiples, and is
+ * safe to share between threads. It must not be modified or freed.
+ * 
+ * @return The shared group, or NULL if OpenSSL could not create it
+ */
+const EC_GROUP *neoc_ec_secp256r1_group(void);
+
 /**
  * @brief Create a new EC key pair from a private key
  * 
@@ -3,8 +3,8 @@
  * @brief Cryptographic hash functions
  */
 
-#ifndef NEOC_HASH_H
-#define NEOC_HASH_H
+#ifndef NEOC_CRYPTO_HASH_H
+#define NEOC_CRYPTO_HASH_H
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -63,8 +63,58 @@ neoc_error_t neoc_hash_hmac_sha512(const uint8_t *data, size_t data_len,
 bool neoc_hash_verify(const uint8_t *data, size_t data_len,
                       const uint8_t *hash, size_t hash_len);
 
+/**
+ * SHA-256 implementations used by the batch functions
+ */
+typedef enum {
+    NEOC_HASH_BACKEND_AUTO = 0,  ///< Fastest backend the CPU supports
+    NEOC_HASH_BACKEND_SCALAR,    ///< Portable C, one message at a time
+    NEOC_HASH_BACKEND_SSE2,      ///< Four messages side by side in SSE2 lanes
+    NEOC_HASH_BACKEND_AVX2,      ///< Eight messages side by side in AVX2 lanes
+    NEOC_HASH_BACKEND_SHANI      ///< x86 SHA extensions, one message at a time
+} neoc_hash_backend_t;
+
+/**
+ * Check whether a batch backend can run on this CPU
+ */
+bool neoc_hash_backend_supported(neoc_hash_backend_t backend);
+
+/**
+ * Force the batch backend for the whole process (AUTO restores detection).
+ * Fails with NEOC_ERROR_NOT_SUPPORTED if the CPU lacks the instructions.
+ */
+neoc_error_t neoc_hash_set_backend(neoc_hash_backend_t backend);
+
+/**
+ * Backend the batch functions currently use, with AUTO resolved
+ */
+neoc_hash_backend_t neoc_hash_get_backend(void);
+
+/**
+ * Backend name for logs and benchmarks
+ */
+const char *neoc_hash_backend_name(neoc_hash_backend_t backend);
+
+/**
+ * Compute the SHA256 hash of count independent messages.
+ *
+ * Message i is data[i] of lens[i] bytes (data[i] may be NULL when lens[i]
+ * is 0) and its digest goes to hashes + 32 * i. The lane backends keep
+ * several messages in flight and refill a lane as soon as its message is
+ * done, so mixed lengths do not leave lanes idle.
+ */
+neoc_error_t neoc_hash_sha256_batch(const uint8_t *const *data, const size_t *lens,
+                                    size_t count, uint8_t *hashes);
+
+/**
+ * Compute the Hash160 of count independent messages into hashes + 20 * i.
+ * The SHA256 step goes through neoc_hash_sha256_batch.
+ */
+neoc_error_t neoc_hash_hash160_batch(const uint8_t *const *data, const size_t *lens,
+                                     size_t count, uint8_t *hashes);
+
 #ifdef __cplusplus
 }
 #endif
 
-#endif // NEOC_HASH_H
+#endif // NEOC_CRYPTO_HASH_H
@@ -0,0 +1,100 @@
+#ifndef NEOC_MERKLE_TREE_H
+#define NEOC_MERKLE_TREE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "neoc/neoc_error.h"
+#include "neoc/types/neoc_hash256.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Compute a Merkle root, reducing the hashes in place
+ *
+ * Uses the Neo tree rules: each parent is the double SHA-256 of its two
+ * children, an odd node at the end of a level is paired with itself, and
+ * the root of a single leaf is the leaf. Each level overwrites the front
+ * of hashes, so small trees need no memory beyond the input. Levels wide
+ * enough to be worth it are split across worker threads, which use one
+ * scratch buffer of half the leaf count.
+ *
+ * @param hashes Leaf hashes, clobbered on return
+ * @param count Number of leaves (0 gives an all-zero root)
+ * @param root Output root
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_merkle_root_in_place(neoc_hash256_t *hashes,
+                                       size_t count,
+                                       neoc_hash256_t *root);
+
+/**
+ * @brief Compute a Merkle root without modifying the leaves
+ *
+ * Same as neoc_merkle_root_in_place on a working copy of the leaves.
+ *
+ * @param leaves Leaf hashes
+ * @param count Number of leaves (0 gives an all-zero root)
+ * @param root Output root
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_merkle_compute_root(const neoc_hash256_t *leaves,
+                                      size_t count,
+                                      neoc_hash256_t *root);
+
+/**
+ * @brief Number of sibling hashes in a proof for a tree of count leaves
+ *
+ * @param count Number of leaves
+ * @return Proof length (0 for trees of at most one leaf)
+ */
+size_t neoc_merkle_proof_length(size_t count);
+
+/**
+ * @brief Build the inclusion proof for one leaf
+ *
+ * path[0] is the sibling of the leaf and each following entry the sibling
+ * one level up; a node paired with itself appears as its own sibling.
+ *
+ * @param leaves Leaf hashes
+ * @param count Number of leaves
+ * @param index Index of the leaf to prove
+ * @param path Output sibling hashes
+ * @param path_capacity Capacity of path (at least neoc_merkle_proof_length(count))
+ * @param path_len Output number of sibling hashes written
+ * @param root Output root (optional)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_merkle_get_proof(const neoc_hash256_t *leaves,
+                                   size_t count,
+                                   size_t index,
+                                   neoc_hash256_t *path,
+                                   size_t path_capacity,
+                                   size_t *path_len,
+                                   neoc_hash256_t *root);
+
+/**
+ * @brief Check an inclusion proof against a root
+ *
+ * @param leaf Hash of the proven leaf
+ * @param index Index of the leaf
+ * @param count Number of leaves in the tree
+ * @param path Sibling hashes from neoc_merkle_get_proof
+ * @param path_len Number of sibling hashes
+ * @param root Expected root
+ * @return true if the proof is well formed and leads to root
+ */
+bool neoc_merkle_verify_proof(const neoc_hash256_t *leaf,
+                              size_t index,
+                              size_t count,
+                              const neoc_hash256_t *path,
+                              size_t path_len,
+                              const neoc_hash256_t *root);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NEOC_MERKLE_TREE_H
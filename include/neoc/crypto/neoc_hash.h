@@ -49,6 +49,48 @@ neoc_error_t neoc_sha256(const uint8_t* data, size_t data_length, uint8_t digest
  */
 neoc_error_t neoc_sha256_double(const uint8_t* data, size_t data_length, uint8_t digest[NEOC_SHA256_DIGEST_LENGTH]);
 
+/**
+ * @brief Incremental SHA-256 state
+ * 
+ * Lives on the caller's stack; the storage holds the OpenSSL context so
+ * streaming a message through it never allocates.
+ */
+typedef struct {
+    union {
+        uint64_t align;
+        uint8_t bytes[128];
+    } state;
+} neoc_sha256_ctx_t;
+
+/**
+ * @brief Start an incremental SHA-256 computation
+ * 
+ * @param ctx Context to initialize
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_sha256_init(neoc_sha256_ctx_t* ctx);
+
+/**
+ * @brief Absorb more message bytes
+ * 
+ * @param ctx Context from neoc_sha256_init
+ * @param data Input data (may be NULL when data_length is 0)
+ * @param data_length Length of input data
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_sha256_update(neoc_sha256_ctx_t* ctx, const uint8_t* data, size_t data_length);
+
+/**
+ * @brief Finish the computation and write the digest
+ * 
+ * The context must be initialized again before reuse.
+ * 
+ * @param ctx Context from neoc_sha256_init
+ * @param digest Output buffer for 32-byte digest
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_sha256_final(neoc_sha256_ctx_t* ctx, uint8_t digest[NEOC_SHA256_DIGEST_LENGTH]);
+
 /**
  * @brief Compute RIPEMD-160 hash of input data
  * 
@@ -67,6 +67,50 @@ neoc_error_t neoc_nep2_decrypt(const char *encrypted_key,
                                 uint8_t *private_key,
                                 size_t private_key_len);
 
+/**
+ * @brief Memory budget for scrypt working buffers in a decryption batch
+ *
+ * Each worker needs about N * r * 128 bytes (16 MiB with the default
+ * parameters); batches use no more workers than fit in this budget.
+ */
+#define NEOC_NEP2_BATCH_MEMORY_LIMIT (256u * 1024u * 1024u)
+
+/**
+ * @brief Progress callback for batch decryption
+ *
+ * Called once per finished key with the number of keys done so far. Calls
+ * are serialized, but may come from any worker thread.
+ */
+typedef void (*neoc_nep2_progress_fn)(size_t completed, size_t total, void *user_data);
+
+/**
+ * @brief Decrypt many NEP-2 keys that share a password
+ *
+ * Each key is decrypted as neoc_nep2_decrypt would decrypt it, with the
+ * scrypt derivations spread across a pool of worker threads.
+ *
+ * @param encrypted_keys NEP-2 encrypted key strings
+ * @param password The password to decrypt with
+ * @param params Scrypt parameters (use NULL for defaults)
+ * @param count Number of keys
+ * @param threads Maximum worker threads (0 for one per CPU); further
+ *                limited by NEOC_NEP2_BATCH_MEMORY_LIMIT
+ * @param private_keys Output, 32 bytes per key
+ * @param results Output status of each key
+ * @param progress Optional progress callback
+ * @param user_data Passed to the progress callback
+ * @return NEOC_SUCCESS if the batch ran, error code otherwise
+ */
+neoc_error_t neoc_nep2_decrypt_batch(const char *const *encrypted_keys,
+                                     const char *password,
+                                     const neoc_nep2_params_t *params,
+                                     size_t count,
+                                     size_t threads,
+                                     uint8_t *private_keys,
+                                     neoc_error_t *results,
+                                     neoc_nep2_progress_fn progress,
+                                     void *user_data);
+
 /**
  * @brief Verify if a password is correct for an encrypted key
  * 
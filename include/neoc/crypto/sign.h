@@ -15,7 +15,9 @@ extern "C" {
 /**
  * @brief Sign a message with the private key
  * 
- * The message will be hashed with SHA256 before signing.
+ * The message will be hashed with SHA256 before signing. Finding the
+ * recovery ID takes up to four public key recoveries; use
+ * neoc_sign_hash_fast when only r || s is needed.
  * 
  * @param message The message to sign
  * @param message_len Length of the message
@@ -27,6 +29,22 @@ neoc_error_t neoc_sign_message(const uint8_t *message, size_t message_len,
                                 const neoc_ec_key_pair_t *key_pair,
                                 neoc_signature_data_t **sig_data);
 
+/**
+ * @brief Sign a 32-byte hash without computing a recovery ID
+ * 
+ * Produces the canonical (low-s) r || s signature used in witnesses straight
+ * from ECDSA signing. Unlike neoc_sign_message it skips public key recovery,
+ * so use neoc_sign_message when the v value is needed.
+ * 
+ * @param hash The 32-byte hash to sign (signed as is)
+ * @param key_pair The key pair containing the private key
+ * @param signature Output buffer for the 64-byte signature
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_sign_hash_fast(const uint8_t *hash,
+                                 const neoc_ec_key_pair_t *key_pair,
+                                 uint8_t *signature);
+
 /**
  * @brief Sign a hex-encoded message
  * 
@@ -95,6 +113,50 @@ bool neoc_verify_signature(const uint8_t *message, size_t message_len,
                             const neoc_signature_data_t *sig_data,
                             const neoc_ec_public_key_t *public_key);
 
+/**
+ * @brief Verify many signatures in one call
+ *
+ * Each entry is checked as neoc_verify_signature would check it. Public keys
+ * that occur more than once are prepared once per batch, and large batches
+ * are spread across worker threads.
+ *
+ * @param messages Messages to verify (hashed with SHA256)
+ * @param message_lens Length of each message
+ * @param signatures Signature for each message
+ * @param public_keys Public key for each message
+ * @param count Number of entries
+ * @param results Output validity of each entry
+ * @return NEOC_SUCCESS if the batch ran, error code otherwise
+ */
+neoc_error_t neoc_verify_signatures_batch(const uint8_t *const *messages,
+                                          const size_t *message_lens,
+                                          const neoc_signature_data_t *const *signatures,
+                                          const neoc_ec_public_key_t *const *public_keys,
+                                          size_t count,
+                                          bool *results);
+
+/**
+ * @brief Verify many signatures over precomputed 32-byte digests
+ *
+ * Same as neoc_verify_signatures_batch, but the digests are verified as
+ * given (as witnesses sign the transaction hash) and public keys are taken
+ * in encoded form, straight from verification scripts.
+ *
+ * @param digests 32-byte digest for each entry
+ * @param signatures 64-byte r || s signature for each entry
+ * @param public_keys Encoded public key (33 or 65 bytes) for each entry
+ * @param public_key_lens Length of each encoded public key
+ * @param count Number of entries
+ * @param results Output validity of each entry
+ * @return NEOC_SUCCESS if the batch ran, error code otherwise
+ */
+neoc_error_t neoc_verify_digests_batch(const uint8_t *const *digests,
+                                       const uint8_t *const *signatures,
+                                       const uint8_t *const *public_keys,
+                                       const size_t *public_key_lens,
+                                       size_t count,
+                                       bool *results);
+
 /**
  * @brief Get public key from private key
  * 
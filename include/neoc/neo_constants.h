@@ -37,6 +37,10 @@ extern "C" {
 #define NEOC_MAX_WITNESSES 16
 #define NEOC_MAX_SIGNERS 16
 #define NEOC_MAX_SIGNER_SUBITEMS 16
+#define NEOC_MAX_TRANSACTION_SCRIPT_SIZE 65535
+#define NEOC_MAX_INVOCATION_SCRIPT_SIZE 1024
+#define NEOC_MAX_VERIFICATION_SCRIPT_SIZE 1024
+#define NEOC_MAX_ORACLE_RESULT_SIZE 65535
 
 // Contract and manifest limits
 #define NEOC_MAX_MANIFEST_SIZE 0xFFFF
@@ -59,6 +59,7 @@ extern "C" {
 #include "neoc/script/opcode.h"
 #include "neoc/script/interop_service.h"
 #include "neoc/script/script_helper.h"
+#include "neoc/script/script_template.h"
 
 /* Wallet */
 #include "neoc/wallet/bip39_account.h"
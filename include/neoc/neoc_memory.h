@@ -50,6 +50,14 @@ typedef struct {
     neoc_free_func_t free_func;       ///< Memory deallocation function
 } neoc_allocator_t;
 
+/**
+ * @brief Bump-pointer region allocator
+ *
+ * Objects allocated from an arena are released together by
+ * neoc_arena_reset() or neoc_arena_free() instead of individually.
+ */
+typedef struct neoc_arena neoc_arena_t;
+
 typedef struct {
     size_t total_allocated;      ///< Total bytes allocated since start
     size_t current_allocated;    ///< Currently allocated bytes
@@ -177,6 +185,80 @@ size_t neoc_get_allocation_count(void);
  */
 void neoc_print_memory_leaks(void);
 
+/**
+ * @brief Create an arena
+ *
+ * @param chunk_size Size of the first chunk in bytes (0 selects 64 KiB);
+ *                   later chunks double in size
+ * @param arena Pointer to store the created arena
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_arena_create(size_t chunk_size, neoc_arena_t **arena);
+
+/**
+ * @brief Allocate uninitialized memory from an arena
+ *
+ * @param arena Arena to allocate from
+ * @param size Number of bytes to allocate
+ * @return Pointer aligned for any type, or NULL on failure
+ */
+void* neoc_arena_alloc(neoc_arena_t *arena, size_t size);
+
+/**
+ * @brief Duplicate a string into an arena
+ *
+ * @param arena Arena to allocate from
+ * @param str String to duplicate
+ * @return Pointer to the arena copy, or NULL on failure
+ */
+char* neoc_arena_strdup(neoc_arena_t *arena, const char *str);
+
+/**
+ * @brief Release every allocation made from an arena
+ *
+ * The largest chunk is kept for reuse so a parse/reset loop reaches a
+ * steady state without touching the system allocator.
+ *
+ * @param arena Arena to reset
+ */
+void neoc_arena_reset(neoc_arena_t *arena);
+
+/**
+ * @brief Destroy an arena and all memory allocated from it
+ *
+ * @param arena Arena to destroy (can be NULL)
+ */
+void neoc_arena_free(neoc_arena_t *arena);
+
+/**
+ * @brief Get the number of bytes currently handed out by an arena
+ *
+ * @param arena Arena to query
+ * @return Bytes in use, including per-allocation headers and padding
+ */
+size_t neoc_arena_bytes_used(const neoc_arena_t *arena);
+
+/**
+ * @brief Route the calling thread's neoc_malloc family through an arena
+ *
+ * While an arena is active, neoc_malloc, neoc_calloc, neoc_realloc and
+ * neoc_strdup allocate from it. Memory owned by any live arena is never
+ * passed to the heap: neoc_free ignores it on every thread, and
+ * neoc_realloc returns NULL for it unless its arena is the one active on
+ * the calling thread. Release it with neoc_arena_reset() instead.
+ *
+ * @param arena Arena to activate, or NULL to restore heap allocation
+ * @return The previously active arena (restore it when done)
+ */
+neoc_arena_t* neoc_arena_set_active(neoc_arena_t *arena);
+
+/**
+ * @brief Get the arena active on the calling thread
+ *
+ * @return Active arena, or NULL when allocating from the heap
+ */
+neoc_arena_t* neoc_arena_get_active(void);
+
 /* Memory debugging support (enabled in debug builds) */
 
 #ifdef NEOC_DEBUG_MEMORY
@@ -211,6 +293,16 @@ neoc_error_t neoc_memory_debug_get_stats(size_t* allocated_bytes, size_t* alloca
 
 #endif /* NEOC_DEBUG_MEMORY */
 
+/**
+ * @brief Get allocation statistics for neoc_malloc/neoc_free
+ *
+ * Byte counters rely on live allocation tracking; when the library is built
+ * with NEOC_DISABLE_ALLOC_TRACKING only the call counters are maintained and
+ * current_allocated stays zero.
+ *
+ * @param memory_stats Pointer to store the statistics
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
 neoc_error_t neoc_get_memory_stats(neoc_memory_stats_t* memory_stats);
 
 /* Convenience macros */
@@ -102,6 +102,23 @@ neoc_error_t neoc_neo_get_block_by_hash(neoc_neo_client_t *client, const neoc_ha
  */
 neoc_error_t neoc_neo_get_block_by_index(neoc_neo_client_t *client, uint32_t block_index, bool full_transactions, neoc_block_t **block);
 
+/**
+ * @brief Get a range of consecutive blocks using batched RPC calls
+ *
+ * Blocks that could not be fetched are left NULL; the rest are returned
+ * even when some fail.
+ *
+ * @param client The Neo client
+ * @param start_index Index of the first block
+ * @param count Number of blocks
+ * @param full_transactions Whether to return full transaction objects
+ * @param blocks Array of count pointers to store the blocks
+ * @param errors Optional array of count per-block error codes
+ * @return NEOC_SUCCESS if every block was fetched, error code otherwise
+ */
+neoc_error_t neoc_neo_get_blocks_by_index(neoc_neo_client_t *client, uint32_t start_index, size_t count,
+                                          bool full_transactions, neoc_block_t **blocks, neoc_error_t *errors);
+
 /**
  * @brief Get block count
  * @param client The Neo client
@@ -28,6 +28,7 @@ typedef struct {
     int current_block_index;            /**< Current known block index (-1 if not set) */
     bool is_initialized;                /**< Whether polling has been initialized */
     int polling_interval_ms;            /**< Polling interval in milliseconds */
+    void *worker;                       /**< Background poller while started (internal) */
 } neoc_block_index_polling_t;
 
 /**
@@ -84,8 +85,10 @@ void neoc_block_index_polling_free(
 /**
  * @brief Start block index polling
  * 
- * Begins polling for new block indices. The callback will be invoked
- * when new blocks are detected.
+ * Begins polling for new block indices on a background thread. The first
+ * poll reports the latest index (unless a current index was set); every
+ * later poll reports the indices added since, in order. Callbacks run on
+ * the polling thread until neoc_block_index_polling_stop is called.
  * 
  * @param polling Polling instance
  * @param neo_c NeoC instance for blockchain queries
@@ -104,6 +107,9 @@ neoc_error_t neoc_block_index_polling_start(
 
 /**
  * @brief Stop block index polling
+ *
+ * Waits for the polling thread to exit unless called from one of its
+ * callbacks. No callback runs after this returns.
  * 
  * @param polling Polling instance
  * @return NEOC_SUCCESS on success, error code on failure
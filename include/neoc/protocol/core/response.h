@@ -12,6 +12,7 @@
 #include "neoc/neoc_error.h"
 #include "neoc/neoc_memory.h"
 #include "neoc/types/neoc_types.h"
+#include "neoc/utils/json.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -41,6 +42,7 @@ struct neoc_response_t {
     int id;                             /**< Request ID */
     char *jsonrpc;                      /**< JSON-RPC version ("2.0") */
     void *result;                       /**< Response result (typed per request) */
+    neoc_json_t *result_json;           /**< Parsed result node owned by the response (nullable) */
     neoc_rpc_error_t *error;            /**< Error information (nullable) */
     char *raw_response;                 /**< Raw JSON response (nullable) */
     bool has_error;                     /**< Quick error check flag */
@@ -95,6 +97,20 @@ bool neoc_response_has_error(const neoc_response_t *response);
  */
 neoc_error_t neoc_response_get_result(const neoc_response_t *response, void **result_out);
 
+/**
+ * @brief Get the result as JSON text
+ *
+ * Responses from neoc_service_parse_response carry both the text in result
+ * and the parsed result_json node. When only result_json is set, the node
+ * is printed on the first call and the text is kept in result. Typed
+ * decoders should read result_json instead.
+ *
+ * @param response Response structure
+ * @param text Output JSON text owned by the response (NULL when there is no result)
+ * @return NEOC_SUCCESS on success, error code if response has error
+ */
+neoc_error_t neoc_response_get_result_text(neoc_response_t *response, const char **text);
+
 /**
  * @brief Set raw response string
  * @param response Response structure
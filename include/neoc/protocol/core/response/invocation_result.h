@@ -7,6 +7,8 @@
 #include "../stack_item.h"
 #include "notification.h"
 #include "diagnostics.h"
+#include "../../../neoc_memory.h"
+#include "../../../utils/json.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -66,6 +68,12 @@ void neoc_invocation_result_add_notification(neoc_invocation_result_t* result, n
 // Parse from JSON
 neoc_invocation_result_t* neoc_invocation_result_from_json(const char* json_str);
 
+// Parse from an already parsed result node (e.g. from neoc_rpc_call_json)
+neoc_invocation_result_t* neoc_invocation_result_from_json_node(const neoc_json_t* json);
+
+// Parse from JSON with every allocation taken from arena (release with neoc_arena_reset)
+neoc_invocation_result_t* neoc_invocation_result_from_json_arena(const char* json_str, neoc_arena_t* arena);
+
 // Convert to JSON
 char* neoc_invocation_result_to_json(const neoc_invocation_result_t* result);
 
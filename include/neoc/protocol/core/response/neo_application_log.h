@@ -15,6 +15,7 @@
 #include "neoc/types/neoc_vm_state_type.h"
 #include "neoc/protocol/stack_item.h"
 #include "neoc/protocol/core/response/notification.h"
+#include "neoc/utils/json.h"
 #include <stddef.h>
 #include <stdbool.h>
 
@@ -133,6 +134,73 @@ neoc_error_t neoc_get_application_log_response_from_json(
     neoc_get_application_log_response_t **response
 );
 
+/**
+ * @brief Parse JSON into GetApplicationLog response allocated from an arena
+ * 
+ * The whole response tree lives in the arena; do not call
+ * neoc_get_application_log_response_free() on it, reset the arena instead.
+ * 
+ * @param json_str JSON string to parse
+ * @param arena Arena that owns the parsed response
+ * @param response Pointer to store the parsed response
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_get_application_log_response_from_json_arena(
+    const char *json_str,
+    neoc_arena_t *arena,
+    neoc_get_application_log_response_t **response
+);
+
+/**
+ * @brief Incremental decoder for getapplicationlog responses
+ * 
+ * The response is fed in chunks through the decoder's stream; each entry of
+ * result.executions is converted as soon as its JSON is complete, so only
+ * one execution is held as a JSON tree at a time.
+ */
+typedef struct neoc_application_log_decoder neoc_application_log_decoder_t;
+
+/**
+ * @brief Create a GetApplicationLog response decoder
+ * 
+ * @param decoder Pointer to store the decoder
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_application_log_decoder_create(
+    neoc_application_log_decoder_t **decoder
+);
+
+/**
+ * @brief Stream to feed the response JSON into
+ * 
+ * @param decoder Decoder
+ * @return Stream owned by the decoder
+ */
+neoc_json_stream_t *neoc_application_log_decoder_stream(
+    neoc_application_log_decoder_t *decoder
+);
+
+/**
+ * @brief Finish decoding and take the parsed response
+ * 
+ * @param decoder Decoder that has been fed the whole response
+ * @param response Pointer to store the parsed response (caller must free)
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_application_log_decoder_finish(
+    neoc_application_log_decoder_t *decoder,
+    neoc_get_application_log_response_t **response
+);
+
+/**
+ * @brief Free a GetApplicationLog response decoder
+ * 
+ * @param decoder Decoder to free
+ */
+void neoc_application_log_decoder_free(
+    neoc_application_log_decoder_t *decoder
+);
+
 /**
  * @brief Convert GetApplicationLog response to JSON string
  * 
@@ -8,6 +8,9 @@
 #include "../../../types/neoc_hash160.h"
 #include "neo_witness.h"
 #include "../../../transaction/transaction.h"
+#include "../../../neoc_memory.h"
+#include "../../../neoc_error.h"
+#include "../../../utils/json.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -57,9 +60,16 @@ void neoc_neo_block_set_next_consensus(neoc_neo_block_t* block, const neoc_hash1
 // Add transaction
 void neoc_neo_block_add_transaction(neoc_neo_block_t* block, neoc_transaction_t* tx);
 
-// Calculate merkle root
+// Calculate merkle root (uses each transaction's cached hash when set)
 neoc_hash256_t neoc_neo_block_calculate_merkle_root(const neoc_neo_block_t* block);
 
+// Get the merkle proof for transaction tx_index; check it with neoc_merkle_verify_proof
+neoc_error_t neoc_neo_block_get_merkle_proof(const neoc_neo_block_t* block,
+                                             size_t tx_index,
+                                             neoc_hash256_t* path,
+                                             size_t path_capacity,
+                                             size_t* path_len);
+
 // Calculate block hash
 neoc_hash256_t neoc_neo_block_calculate_hash(const neoc_neo_block_t* block);
 
@@ -69,6 +79,28 @@ bool neoc_neo_block_verify(const neoc_neo_block_t* block);
 // Parse from JSON
 neoc_neo_block_t* neoc_neo_block_from_json(const char* json_str);
 
+// Parse from an already parsed block node, e.g. a detached RPC result
+neoc_neo_block_t* neoc_neo_block_from_json_node(const neoc_json_t* json);
+
+// Parse from JSON with every allocation taken from arena (release with neoc_arena_reset)
+neoc_neo_block_t* neoc_neo_block_from_json_arena(const char* json_str, neoc_arena_t* arena);
+
+// Incremental decoder for block JSON arriving in chunks, e.g. from neoc_rpc_call_streamed.
+// Each transaction is parsed as soon as its JSON is complete, so only one is held as a tree.
+typedef struct neoc_neo_block_decoder neoc_neo_block_decoder_t;
+
+// Create decoder; with rpc_envelope the input is a whole getblock response and the block is its "result"
+neoc_error_t neoc_neo_block_decoder_create(bool rpc_envelope, neoc_neo_block_decoder_t** decoder);
+
+// Stream to feed the JSON into (owned by the decoder)
+neoc_json_stream_t* neoc_neo_block_decoder_stream(neoc_neo_block_decoder_t* decoder);
+
+// Finish decoding; the caller owns the returned block
+neoc_error_t neoc_neo_block_decoder_finish(neoc_neo_block_decoder_t* decoder, neoc_neo_block_t** block);
+
+// Free decoder
+void neoc_neo_block_decoder_free(neoc_neo_block_decoder_t* decoder);
+
 // Convert to JSON
 char* neoc_neo_block_to_json(const neoc_neo_block_t* block);
 
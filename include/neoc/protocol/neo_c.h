@@ -133,6 +133,11 @@ neoc_error_t neoc_neo_c_send_request(neoc_neo_c_t *neo_c,
 
 /**
  * @brief Send a generic request asynchronously
+ *
+ * Runs on the service's asynchronous HTTP engine; the callback receives the
+ * neoc_response_t (caller frees) on the engine thread. See
+ * neoc_service_perform_io_async for delivery rules.
+ *
  * @param neo_c NeoC client
  * @param request_data Serialized request data
  * @param callback Completion callback
@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include "../stack_item.h"
 #include "../../types/neoc_hash160.h"
+#include "../../utils/json.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,6 +40,9 @@ bool neoc_notification_equals(
 // Parse from JSON
 neoc_notification_t* neoc_notification_from_json(const char* json_str);
 
+// Parse from an already parsed JSON object
+neoc_notification_t* neoc_notification_from_json_node(const neoc_json_t* json);
+
 // Convert to JSON
 char* neoc_notification_to_json(const neoc_notification_t* notification);
 
@@ -75,7 +75,7 @@ uint64_t neoc_transaction_calculate_network_fee(const neoc_transaction_t* tx);
 uint64_t neoc_transaction_calculate_system_fee(const neoc_transaction_t* tx);
 
 // Verify transaction
-bool neoc_transaction_verify(const neoc_transaction_t* tx);
+bool neoc_transaction_verify(const neoc_transaction_t* tx, uint32_t network_magic);
 
 // Parse from JSON
 neoc_transaction_t* neoc_transaction_from_json(const char* json_str);
@@ -12,6 +12,9 @@
 #include "neoc/neoc_error.h"
 #include "neoc/types/neoc_hash160.h"
 #include "neoc/types/neoc_hash256.h"
+#include "neoc/utils/json.h"
+#include "neoc/protocol/core/response/neo_block.h"
+#include "neoc/protocol/core/response/neo_application_log.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,6 +27,10 @@ typedef struct neoc_rpc_client_t neoc_rpc_client_t;
 #endif
 typedef struct neoc_rpc_request_t neoc_rpc_request_t;
 typedef struct neoc_rpc_response_t neoc_rpc_response_t;
+typedef struct neoc_rpc_batch_t neoc_rpc_batch_t;
+
+/** Calls per HTTP POST when a batch is created with max_batch_size 0 */
+#define NEOC_RPC_BATCH_DEFAULT_MAX_SIZE 64
 
 // RPC Methods
 #define RPC_GET_BEST_BLOCK_HASH "getbestblockhash"
@@ -151,6 +158,45 @@ neoc_error_t neoc_rpc_get_block_hash(neoc_rpc_client_t *client,
                                      uint32_t block_index,
                                      neoc_hash256_t *hash);
 
+/**
+ * @brief Execute a JSON-RPC call with structured parameters and result
+ *
+ * The request body is written straight into a buffer owned by the client
+ * and reused across calls, and the response is parsed exactly once; the
+ * result node is detached from the response envelope and handed over
+ * without being printed or re-parsed.
+ *
+ * @param client RPC client handle
+ * @param method Method name
+ * @param params Parameter array (pass NULL for an empty array)
+ * @param result Output result node (caller must free with neoc_json_free())
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_rpc_call_json(neoc_rpc_client_t *client,
+                                const char *method,
+                                const neoc_json_t *params,
+                                neoc_json_t **result);
+
+/**
+ * @brief Make a JSON-RPC call and stream the response into a parser
+ *
+ * The response body is never buffered: each chunk is fed to the stream as
+ * it arrives from the network, and the stream is finished once the
+ * transfer completes. The stream sees the whole response envelope, so the
+ * consumer must check its "error" member; typed decoders such as
+ * neoc_neo_block_decoder_t and neoc_application_log_decoder_t do.
+ *
+ * @param client RPC client handle
+ * @param method Method name
+ * @param params Parameters as JSON text (pass NULL for an empty array)
+ * @param stream Streaming parser that receives the response body
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_rpc_call_streamed(neoc_rpc_client_t *client,
+                                    const char *method,
+                                    const char *params,
+                                    neoc_json_stream_t *stream);
+
 /**
  * @brief Execute a raw JSON-RPC call
  *
@@ -304,6 +350,36 @@ neoc_error_t neoc_rpc_get_application_log(neoc_rpc_client_t *client,
                                            const neoc_hash256_t *tx_hash,
                                            char **log);
 
+/**
+ * @brief Get and decode an application log
+ *
+ * The response is streamed through neoc_application_log_decoder_t, so each
+ * execution is decoded as it arrives instead of buffering the whole body.
+ *
+ * @param client RPC client handle
+ * @param tx_hash Transaction hash
+ * @param response Output response (free with neoc_get_application_log_response_free)
+ * @return NEOC_SUCCESS on success, NEOC_ERROR_RPC if the node returned an error
+ */
+neoc_error_t neoc_rpc_get_application_log_decoded(neoc_rpc_client_t *client,
+                                                   const neoc_hash256_t *tx_hash,
+                                                   neoc_get_application_log_response_t **response);
+
+/**
+ * @brief Get a block with its full transactions
+ *
+ * The response is streamed through neoc_neo_block_decoder_t, so each
+ * transaction is decoded as it arrives instead of buffering the whole body.
+ *
+ * @param client RPC client handle
+ * @param hash Block hash
+ * @param block Output block (free with neoc_neo_block_free)
+ * @return NEOC_SUCCESS on success, NEOC_ERROR_RPC if the node returned an error
+ */
+neoc_error_t neoc_rpc_get_neo_block(neoc_rpc_client_t *client,
+                                    const neoc_hash256_t *hash,
+                                    neoc_neo_block_t **block);
+
 /**
  * @brief Get version information
  * 
@@ -388,6 +464,152 @@ neoc_error_t neoc_rpc_get_state_height(neoc_rpc_client_t *client, uint32_t *heig
  */
 neoc_error_t neoc_rpc_get_native_contracts(neoc_rpc_client_t *client, char **contracts);
 
+/**
+ * @brief Create a batch of JSON-RPC calls
+ *
+ * Calls added to the batch are sent as JSON-RPC 2.0 batch requests, up to
+ * max_batch_size calls per HTTP POST, and their responses are matched back
+ * to the calls by id. The batch borrows the client, which must outlive it.
+ *
+ * @param client RPC client handle
+ * @param max_batch_size Maximum calls per POST (0 for NEOC_RPC_BATCH_DEFAULT_MAX_SIZE)
+ * @param batch Output batch handle
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_create(neoc_rpc_client_t *client,
+                                   size_t max_batch_size,
+                                   neoc_rpc_batch_t **batch);
+
+/**
+ * @brief Add a raw call to a batch
+ *
+ * params is copied into the request as given, without being parsed, so it
+ * must be valid JSON; a malformed value makes the node reject the whole POST.
+ *
+ * @param batch Batch handle
+ * @param method Method name (must not contain quotes, backslashes or control characters)
+ * @param params JSON string representing parameters (pass NULL for empty array)
+ * @param index Output position of the call in the batch (may be NULL)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_add(neoc_rpc_batch_t *batch,
+                                const char *method,
+                                const char *params,
+                                size_t *index);
+
+/**
+ * @brief Add a getblock call by block index to a batch
+ *
+ * @param batch Batch handle
+ * @param block_index Block index
+ * @param verbose Include transaction details
+ * @param index Output position of the call in the batch (may be NULL)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_add_get_block_by_index(neoc_rpc_batch_t *batch,
+                                                   uint32_t block_index,
+                                                   bool verbose,
+                                                   size_t *index);
+
+/**
+ * @brief Add a getapplicationlog call to a batch
+ *
+ * @param batch Batch handle
+ * @param tx_hash Transaction hash
+ * @param index Output position of the call in the batch (may be NULL)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_add_get_application_log(neoc_rpc_batch_t *batch,
+                                                    const neoc_hash256_t *tx_hash,
+                                                    size_t *index);
+
+/**
+ * @brief Get the number of calls in a batch
+ *
+ * @param batch Batch handle
+ * @return Number of calls added
+ */
+size_t neoc_rpc_batch_count(const neoc_rpc_batch_t *batch);
+
+/**
+ * @brief Send every call in a batch
+ *
+ * Failures are reported per call: an RPC error, a missing response or a
+ * failed POST only fails the calls it affects. Use neoc_rpc_batch_get_status
+ * to inspect them.
+ *
+ * @param batch Batch handle
+ * @param failed_count Output number of failed calls (may be NULL)
+ * @return NEOC_SUCCESS if every POST got a batch response, otherwise the
+ *         first transport or batch-level error
+ */
+neoc_error_t neoc_rpc_batch_send(neoc_rpc_batch_t *batch, size_t *failed_count);
+
+/**
+ * @brief Get the outcome of one call in a sent batch
+ *
+ * @param batch Batch handle
+ * @param index Position of the call
+ * @param message Output error message, NULL on success (may be NULL)
+ * @return NEOC_SUCCESS if the call succeeded, its error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_get_status(const neoc_rpc_batch_t *batch,
+                                       size_t index,
+                                       const char **message);
+
+/**
+ * @brief Get the raw result of one call in a sent batch
+ *
+ * The text is printed from the stored result on the first call and cached,
+ * so this is not safe to call concurrently for the same index.
+ *
+ * @param batch Batch handle
+ * @param index Position of the call
+ * @param result Output JSON string (owned by the batch)
+ * @return NEOC_SUCCESS on success, the call's error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_get_result(const neoc_rpc_batch_t *batch,
+                                       size_t index,
+                                       const char **result);
+
+/**
+ * @brief Get one getblock result of a sent batch
+ *
+ * @param batch Batch handle
+ * @param index Position of the call
+ * @param block Output block information (free with neoc_rpc_block_free)
+ * @return NEOC_SUCCESS on success, the call's error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_get_block(const neoc_rpc_batch_t *batch,
+                                      size_t index,
+                                      neoc_block_t **block);
+
+/**
+ * @brief Get one getapplicationlog result of a sent batch
+ *
+ * @param batch Batch handle
+ * @param index Position of the call
+ * @param log Output log (JSON string, caller must free)
+ * @return NEOC_SUCCESS on success, the call's error code otherwise
+ */
+neoc_error_t neoc_rpc_batch_get_application_log(const neoc_rpc_batch_t *batch,
+                                                size_t index,
+                                                char **log);
+
+/**
+ * @brief Remove every call from a batch so it can be reused
+ *
+ * @param batch Batch handle
+ */
+void neoc_rpc_batch_reset(neoc_rpc_batch_t *batch);
+
+/**
+ * @brief Free a batch
+ *
+ * @param batch Batch handle
+ */
+void neoc_rpc_batch_free(neoc_rpc_batch_t *batch);
+
 /**
  * @brief Free RPC client
  * 
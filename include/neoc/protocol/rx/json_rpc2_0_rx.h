@@ -26,10 +26,23 @@ extern "C" {
 typedef struct neoc_json_rpc2_0_rx_t neoc_json_rpc2_0_rx_t;
 typedef struct neoc_neo_get_block_t neoc_neo_get_block_t;
 typedef struct neoc_subscription_t neoc_subscription_t;
+struct neoc_neo_block;
+
+/** Default number of blocks a publisher fetches ahead of its consumer */
+#define NEOC_RX_DEFAULT_PREFETCH 16
+
+/**
+ * @brief Block delivered to a block callback
+ */
+struct neoc_neo_get_block_t {
+    int index;                          /**< Block index */
+    struct neoc_neo_block *block;       /**< Parsed block (see core/response/neo_block.h) */
+};
 
 /**
  * @brief Block callback function
- * @param block Block data (do not free)
+ * @param block Block data (do not free); on a failed fetch only index is set,
+ *              and it is NULL for failures not tied to a block
  * @param error Error code (NEOC_SUCCESS on success)
  * @param user_data User-provided data
  * @return true to continue subscription, false to stop
@@ -47,6 +60,10 @@ typedef bool (*neoc_block_index_callback_t)(int block_index, neoc_error_t error,
 
 /**
  * @brief Subscription handle for managing active subscriptions
+ *
+ * Publishers run on a background thread per subscription and invoke their
+ * callback from it. A callback may cancel its own subscription (or return
+ * false) but must not free it.
  */
 struct neoc_subscription_t {
     void *impl_data;                        /**< Implementation-specific data */
@@ -65,6 +82,7 @@ struct neoc_json_rpc2_0_rx_t {
     void *executor_service;                 /**< Executor for scheduling */
     neoc_subscription_t **subscriptions;   /**< Active subscriptions */
     size_t subscription_count;              /**< Number of active subscriptions */
+    size_t max_prefetch;                    /**< Blocks fetched ahead of the consumer */
 };
 
 /**
@@ -75,8 +93,25 @@ struct neoc_json_rpc2_0_rx_t {
  */
 neoc_json_rpc2_0_rx_t *neoc_json_rpc2_0_rx_create(neoc_neo_c_t *neo_c, void *executor_service);
 
+/**
+ * @brief Set how many blocks publishers fetch ahead of the consumer
+ *
+ * Blocks are fetched in parallel up to this many ahead of the one being
+ * delivered. A consumer that falls behind stalls fetching and polling
+ * instead of letting fetched blocks pile up.
+ *
+ * @param rx Reactive client
+ * @param max_prefetch Blocks in flight or buffered (0 resets the default)
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_json_rpc2_0_rx_set_max_prefetch(neoc_json_rpc2_0_rx_t *rx, size_t max_prefetch);
+
 /**
  * @brief Start block index polling
+ *
+ * The first poll reports the latest index; later polls report every index
+ * added since, in order.
+ *
  * @param rx Reactive client
  * @param polling_interval Polling interval in milliseconds
  * @param callback Block index callback
@@ -92,6 +127,9 @@ neoc_error_t neoc_json_rpc2_0_rx_block_index_publisher(neoc_json_rpc2_0_rx_t *rx
 
 /**
  * @brief Start block polling
+ *
+ * Delivers the latest block, then every new block in order.
+ *
  * @param rx Reactive client
  * @param full_transaction_objects Whether to include full transaction objects
  * @param polling_interval Polling interval in milliseconds
@@ -130,6 +168,10 @@ neoc_error_t neoc_json_rpc2_0_rx_replay_blocks_publisher(neoc_json_rpc2_0_rx_t *
 
 /**
  * @brief Catch up to latest block and then start subscription
+ *
+ * Replays blocks from start_block up to the latest one, fetching them in
+ * parallel but delivering them in order, and then polls for new blocks.
+ *
  * @param rx Reactive client
  * @param start_block Start block number
  * @param full_transaction_objects Whether to include full transaction objects
@@ -185,6 +227,10 @@ neoc_error_t neoc_json_rpc2_0_rx_get_latest_block_index_async(neoc_json_rpc2_0_r
 
 /**
  * @brief Cancel a subscription
+ *
+ * Stops the publisher and, unless called from its own callback, waits for
+ * its thread to exit. No callback runs after this returns.
+ *
  * @param subscription Subscription to cancel
  * @return NEOC_SUCCESS on success, error code on failure
  */
@@ -199,6 +245,10 @@ bool neoc_subscription_is_active(const neoc_subscription_t *subscription);
 
 /**
  * @brief Free subscription handle
+ *
+ * Cancels the subscription first. Subscriptions still registered when the
+ * reactive client is freed are freed with it.
+ *
  * @param subscription Subscription to free
  */
 void neoc_subscription_free(neoc_subscription_t *subscription);
@@ -13,6 +13,7 @@
 #include "neoc/neoc_memory.h"
 #include "neoc/utils/array.h"
 #include "neoc/protocol/core/request.h"
+#include "neoc/utils/http_engine.h"
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
@@ -90,8 +91,27 @@ struct neoc_service_t {
     neoc_service_config_t config;       /**< Service configuration */
     neoc_service_vtable_t *vtable;      /**< Virtual function table */
     void *impl_data;                    /**< Implementation-specific data */
+    neoc_http_engine_t *async_engine;   /**< Engine for async calls, created on first use */
 };
 
+/**
+ * @brief Completion callback for neoc_service_perform_io_async
+ *
+ * Receives ownership of result, which is NULL unless err is NEOC_SUCCESS.
+ */
+typedef void (*neoc_service_io_callback_t)(neoc_byte_array_t *result,
+                                           neoc_error_t err,
+                                           void *user_data);
+
+/**
+ * @brief Completion callback for neoc_service_send_request_async
+ *
+ * Receives ownership of response, which is NULL unless err is NEOC_SUCCESS.
+ */
+typedef void (*neoc_service_callback_t)(neoc_response_t *response,
+                                        neoc_error_t err,
+                                        void *user_data);
+
 /**
  * @brief Create a default service configuration
  * 
@@ -159,6 +179,26 @@ neoc_error_t neoc_service_send_request(neoc_service_t *service,
                                        const neoc_request_t *request,
                                        neoc_response_t **response);
 
+/**
+ * @brief Parse a raw JSON-RPC reply into a response
+ *
+ * The reply is parsed once. A buffer with a terminating zero byte inside
+ * its capacity, as returned by neoc_service_perform_io, is parsed in place;
+ * the raw text is copied onto the response only when include_raw_responses
+ * is set. The result node is detached onto the response's result_json and
+ * is not printed; use neoc_response_get_result_text for text.
+ *
+ * @param service Service instance
+ * @param request_id Id stored on the response when the reply carries none
+ * @param result Raw response data from perform_io
+ * @param response Output response (caller must free)
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_service_parse_response(const neoc_service_t *service,
+                                         int request_id,
+                                         const neoc_byte_array_t *result,
+                                         neoc_response_t **response);
+
 /**
  * @brief Perform low-level IO operation
  * 
@@ -174,6 +214,61 @@ neoc_error_t neoc_service_perform_io(neoc_service_t *service,
                                       const neoc_byte_array_t *payload,
                                       neoc_byte_array_t **result);
 
+/**
+ * @brief Perform low-level IO without blocking
+ *
+ * The payload is sent through the service's asynchronous HTTP engine,
+ * which is started on first use and shared by all async calls on the
+ * service. The callback runs on the engine thread. Services with a custom
+ * perform_io transport have no engine; their IO runs synchronously and the
+ * callback is invoked before this function returns.
+ *
+ * Once this function returns NEOC_SUCCESS the callback is invoked exactly
+ * once, with NEOC_ERROR_CANCELLED if the call is cancelled or the service
+ * is freed first.
+ *
+ * @param service Service instance
+ * @param payload Request payload (copied)
+ * @param callback Completion callback
+ * @param user_data User data passed to the callback
+ * @param call_id Output identifier for neoc_service_cancel_async (nullable, 0 for inline calls)
+ * @return NEOC_SUCCESS if the call was started, error code otherwise
+ */
+neoc_error_t neoc_service_perform_io_async(neoc_service_t *service,
+                                            const neoc_byte_array_t *payload,
+                                            neoc_service_io_callback_t callback,
+                                            void *user_data,
+                                            neoc_http_call_id_t *call_id);
+
+/**
+ * @brief Send a JSON-RPC request without blocking
+ *
+ * Asynchronous counterpart of neoc_service_send_request with the delivery
+ * rules of neoc_service_perform_io_async. The request may be freed as soon
+ * as this function returns.
+ *
+ * @param service Service instance
+ * @param request JSON-RPC request
+ * @param callback Completion callback
+ * @param user_data User data passed to the callback
+ * @param call_id Output identifier for neoc_service_cancel_async (nullable)
+ * @return NEOC_SUCCESS if the call was started, error code otherwise
+ */
+neoc_error_t neoc_service_send_request_async(neoc_service_t *service,
+                                              const neoc_request_t *request,
+                                              neoc_service_callback_t callback,
+                                              void *user_data,
+                                              neoc_http_call_id_t *call_id);
+
+/**
+ * @brief Cancel an asynchronous call
+ *
+ * @param service Service instance
+ * @param call_id Identifier returned when the call was started
+ * @return NEOC_SUCCESS if the call was pending, NEOC_ERROR_NOT_FOUND if it already completed
+ */
+neoc_error_t neoc_service_cancel_async(neoc_service_t *service, neoc_http_call_id_t call_id);
+
 /**
  * @brief Check if service includes raw responses
  * 
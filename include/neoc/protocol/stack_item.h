@@ -21,6 +21,7 @@ extern "C" {
 #include <stddef.h>
 #include "neoc/neoc_error.h"
 #include "neoc/types/neoc_types.h"
+#include "neoc/utils/json.h"
 
 /**
  * Stack item types in Neo VM
@@ -406,6 +407,13 @@ stack_item_t* stack_item_deserialize(const uint8_t* data, size_t length);
  */
 char* stack_item_to_json(const stack_item_t* item);
 
+/**
+ * @brief Convert stack item to a JSON node in the RPC stack item format
+ * @param item Stack item
+ * @return JSON node (free with neoc_json_free) or NULL on error
+ */
+neoc_json_t* stack_item_to_json_node(const stack_item_t* item);
+
 /**
  * @brief Create stack item from JSON string
  * @param json JSON string
@@ -413,6 +421,13 @@ char* stack_item_to_json(const stack_item_t* item);
  */
 stack_item_t* stack_item_from_json(const char* json);
 
+/**
+ * @brief Create stack item from an already parsed JSON node
+ * @param json Node in the RPC stack item format ({"type": ..., "value": ...})
+ * @return Stack item or NULL on error
+ */
+stack_item_t* stack_item_from_json_node(const neoc_json_t* json);
+
 /**
  * @brief Get human-readable type name
  * @param type Stack item type
@@ -425,7 +440,9 @@ const char* stack_item_type_name(stack_item_type_t type);
 #define neoc_stack_item_clone stack_item_clone
 #define neoc_stack_item_equals stack_item_equals
 #define neoc_stack_item_to_json stack_item_to_json
+#define neoc_stack_item_to_json_node stack_item_to_json_node
 #define neoc_stack_item_from_json stack_item_from_json
+#define neoc_stack_item_from_json_node stack_item_from_json_node
 #define neoc_stack_item_create_any stack_item_create_any
 #define neoc_stack_item_create_boolean stack_item_create_boolean
 #define neoc_stack_item_create_integer stack_item_create_integer
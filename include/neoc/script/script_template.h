@@ -0,0 +1,175 @@
+/**
+ * @file script_template.h
+ * @brief Precompiled contract invocation scripts with patchable argument slots
+ *
+ * A template fixes the contract hash, method name, argument shape and call flags of a
+ * System.Contract.Call script once. Instantiating it only encodes the argument pushes and
+ * copies the precompiled tail, so scripts that differ only in their arguments (for
+ * example, thousands of NEP-17 transfers from one payout account) can be produced
+ * without going through neoc_script_builder for every call.
+ */
+
+#ifndef NEOC_SCRIPT_TEMPLATE_H
+#define NEOC_SCRIPT_TEMPLATE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "neoc/neoc_error.h"
+#include "neoc/types/neoc_hash160.h"
+#include "neoc/script/script_builder_full.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of argument slots in a template */
+#define NEOC_SCRIPT_TEMPLATE_MAX_SLOTS 16
+
+/**
+ * @brief Encoding of one template argument slot
+ */
+typedef enum {
+    NEOC_SCRIPT_SLOT_HASH160 = 0,  ///< 20-byte script hash, pushed as raw bytes
+    NEOC_SCRIPT_SLOT_INTEGER,      ///< Signed 64-bit integer, shortest PUSHINT form
+    NEOC_SCRIPT_SLOT_BYTES         ///< Byte string, or PUSHNULL when no data is given
+} neoc_script_slot_type_t;
+
+/**
+ * @brief Value for one argument slot
+ *
+ * Only the member matching the slot type is read. A BYTES slot with a NULL data
+ * pointer pushes null; a non-NULL pointer with zero length pushes an empty string.
+ */
+typedef struct {
+    const neoc_hash160_t *hash160;  ///< HASH160 slots
+    int64_t integer;                ///< INTEGER slots
+    const uint8_t *data;            ///< BYTES slots
+    size_t data_len;                ///< BYTES slots
+} neoc_script_arg_t;
+
+/**
+ * @brief Layout options for neoc_script_template_create
+ *
+ * Passing NULL is equivalent to pushing NEOC_CALL_FLAGS_ALL without an ASSERT, which is
+ * the layout produced by neoc_script_builder_contract_call.
+ */
+typedef struct {
+    bool push_call_flags;          ///< Push call_flags before the method name
+    neoc_call_flags_t call_flags;  ///< Flags pushed when push_call_flags is set
+    bool append_assert;            ///< Append ASSERT after the SYSCALL
+} neoc_script_template_options_t;
+
+/**
+ * @brief Opaque compiled invocation template
+ *
+ * A template is immutable after creation and may be instantiated concurrently.
+ */
+typedef struct neoc_script_template neoc_script_template_t;
+
+/**
+ * @brief Compile an invocation template
+ *
+ * @param contract_hash Contract to call
+ * @param method Method name
+ * @param slot_types Argument encodings in method parameter order
+ * @param slot_count Number of arguments (at most NEOC_SCRIPT_TEMPLATE_MAX_SLOTS)
+ * @param options Layout options (may be NULL)
+ * @param tmpl Output template (caller must free with neoc_script_template_free)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_script_template_create(const neoc_hash160_t *contract_hash,
+                                         const char *method,
+                                         const neoc_script_slot_type_t *slot_types,
+                                         size_t slot_count,
+                                         const neoc_script_template_options_t *options,
+                                         neoc_script_template_t **tmpl);
+
+/**
+ * @brief Number of argument slots in a template
+ */
+size_t neoc_script_template_slot_count(const neoc_script_template_t *tmpl);
+
+/**
+ * @brief Exact script size for a set of arguments
+ *
+ * @param tmpl Template
+ * @param args One value per slot, in method parameter order
+ * @param script_len Output script length
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_script_template_size(const neoc_script_template_t *tmpl,
+                                       const neoc_script_arg_t *args,
+                                       size_t *script_len);
+
+/**
+ * @brief Instantiate a template into a caller-provided buffer
+ *
+ * Performs no allocation. Returns NEOC_ERROR_BUFFER_TOO_SMALL, leaving the buffer
+ * untouched, when capacity is smaller than neoc_script_template_size.
+ *
+ * @param tmpl Template
+ * @param args One value per slot, in method parameter order
+ * @param buffer Output buffer
+ * @param capacity Size of buffer
+ * @param script_len Output number of bytes written
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_script_template_write(const neoc_script_template_t *tmpl,
+                                        const neoc_script_arg_t *args,
+                                        uint8_t *buffer,
+                                        size_t capacity,
+                                        size_t *script_len);
+
+/**
+ * @brief Instantiate a template against a different contract
+ *
+ * Same as neoc_script_template_write, but patches contract_hash over the hash the
+ * template was compiled with. Useful for calling one method shape (such as NEP-17
+ * transfer) on many contracts.
+ */
+neoc_error_t neoc_script_template_write_for_contract(const neoc_script_template_t *tmpl,
+                                                     const neoc_hash160_t *contract_hash,
+                                                     const neoc_script_arg_t *args,
+                                                     uint8_t *buffer,
+                                                     size_t capacity,
+                                                     size_t *script_len);
+
+/**
+ * @brief Instantiate a template into a newly allocated script
+ *
+ * @param tmpl Template
+ * @param contract_hash Contract override (NULL keeps the compiled hash)
+ * @param args One value per slot, in method parameter order
+ * @param script Output script (caller must free with neoc_free)
+ * @param script_len Output script length
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_script_template_instantiate(const neoc_script_template_t *tmpl,
+                                              const neoc_hash160_t *contract_hash,
+                                              const neoc_script_arg_t *args,
+                                              uint8_t **script,
+                                              size_t *script_len);
+
+/**
+ * @brief Shared template for NEP-17 transfer(from, to, amount, data)
+ *
+ * Produces the same bytes as neoc_script_create_nep17_transfer: no call flags push and a
+ * trailing ASSERT. The template is compiled on first use against a zero contract hash,
+ * so instantiate it with neoc_script_template_write_for_contract. It lives in static
+ * storage, is unaffected by an active arena and must not be freed.
+ *
+ * @return The shared template (never NULL)
+ */
+const neoc_script_template_t *neoc_script_template_nep17_transfer(void);
+
+/**
+ * @brief Free a template
+ */
+void neoc_script_template_free(neoc_script_template_t *tmpl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NEOC_SCRIPT_TEMPLATE_H
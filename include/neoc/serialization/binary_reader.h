@@ -25,6 +25,7 @@ struct neoc_binary_reader {
     size_t position;      // Current read position
     size_t marker;        // Marked position for reset (-1 if not set)
     uint8_t *owned_data;  // Optional owned copy of data
+    bool mapped;          // data is a file mapping released by neoc_binary_reader_free
 };
 
 /**
@@ -39,6 +40,37 @@ neoc_error_t neoc_binary_reader_create(const uint8_t *data,
                                         size_t size,
                                         neoc_binary_reader_t **reader);
 
+/**
+ * @brief Initialize a reader that borrows its data
+ * 
+ * Nothing is allocated or copied; the reader reads straight from data,
+ * which must stay valid and unchanged while the reader is in use. The
+ * reader is usually a local variable and must not be passed to
+ * neoc_binary_reader_free().
+ * 
+ * @param reader Reader to initialize
+ * @param data Data to read from (may be NULL when size is 0)
+ * @param size Size of data
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_binary_reader_init_view(neoc_binary_reader_t *reader,
+                                           const uint8_t *data,
+                                           size_t size);
+
+/**
+ * @brief Create a reader over a read-only memory mapping of a file
+ * 
+ * Pages are loaded on demand, so files larger than memory can be decoded.
+ * Slices returned by the *_view functions point into the mapping and stay
+ * valid until the reader is freed, which also unmaps the file.
+ * 
+ * @param path File to map
+ * @param reader Output reader (caller must free)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_binary_reader_map_file(const char *path,
+                                          neoc_binary_reader_t **reader);
+
 /**
  * @brief Read a single byte
  * 
@@ -153,6 +185,30 @@ neoc_error_t neoc_binary_reader_read_var_bytes(neoc_binary_reader_t *reader,
                                                 uint8_t **data,
                                                 size_t *len);
 
+/**
+ * @brief Read bytes without copying
+ * 
+ * @param reader The reader
+ * @param len Number of bytes to read
+ * @param data Output pointer into the reader's data
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_binary_reader_read_bytes_view(neoc_binary_reader_t *reader,
+                                                 size_t len,
+                                                 const uint8_t **data);
+
+/**
+ * @brief Read variable-length bytes without copying
+ * 
+ * @param reader The reader
+ * @param data Output pointer into the reader's data
+ * @param len Output length
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_binary_reader_read_var_bytes_view(neoc_binary_reader_t *reader,
+                                                     const uint8_t **data,
+                                                     size_t *len);
+
 /**
  * @brief Read variable-length string
  * 
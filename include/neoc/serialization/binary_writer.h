@@ -19,11 +19,21 @@ typedef struct neoc_binary_reader neoc_binary_reader_t;
 typedef struct neoc_binary_writer neoc_binary_writer_t;
 #endif
 
+/**
+ * @brief Receives bytes drained from a sink writer's staging buffer
+ *
+ * Returning an error aborts the write that triggered the flush.
+ */
+typedef neoc_error_t (*neoc_binary_writer_sink_t)(void *ctx, const uint8_t *data, size_t len);
+
 struct neoc_binary_writer {
     uint8_t *data;      // Buffer for written data
     size_t capacity;    // Allocated capacity
     size_t position;    // Current write position
     bool auto_grow;     // Auto-grow buffer when needed
+    neoc_binary_writer_sink_t sink; // Drains the buffer when full (NULL if none)
+    void *sink_ctx;     // Passed to sink
+    size_t flushed;     // Bytes already handed to sink
 };
 
 /**
@@ -38,6 +48,54 @@ neoc_error_t neoc_binary_writer_create(size_t initial_capacity,
                                         bool auto_grow,
                                         neoc_binary_writer_t **writer);
 
+/**
+ * @brief Initialize a writer over a caller-owned fixed buffer
+ *
+ * No memory is allocated: writes past capacity fail with
+ * NEOC_ERROR_BUFFER_OVERFLOW. The writer must not be passed to
+ * neoc_binary_writer_free.
+ *
+ * @param writer Writer to initialize (usually on the stack)
+ * @param buffer Destination buffer
+ * @param capacity Size of buffer
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_binary_writer_init_buffer(neoc_binary_writer_t *writer,
+                                             uint8_t *buffer,
+                                             size_t capacity);
+
+/**
+ * @brief Initialize a writer that streams its output to a sink
+ *
+ * The caller-owned buffer only stages small writes; whenever it fills, its
+ * contents are passed to sink and it is reused, so output of any length is
+ * produced without allocating. Call neoc_binary_writer_flush after the last
+ * write. get_position counts every byte written, flushed or not. The writer
+ * must not be passed to neoc_binary_writer_free.
+ *
+ * @param writer Writer to initialize (usually on the stack)
+ * @param buffer Staging buffer (at least 16 bytes)
+ * @param capacity Size of buffer
+ * @param sink Receives drained bytes in order
+ * @param sink_ctx Passed to sink
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_binary_writer_init_sink(neoc_binary_writer_t *writer,
+                                           uint8_t *buffer,
+                                           size_t capacity,
+                                           neoc_binary_writer_sink_t sink,
+                                           void *sink_ctx);
+
+/**
+ * @brief Pass buffered bytes of a sink writer to its sink
+ *
+ * A no-op for writers without a sink.
+ *
+ * @param writer The writer
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_binary_writer_flush(neoc_binary_writer_t *writer);
+
 /**
  * @brief Write a single byte
  * 
@@ -8,6 +8,7 @@
 #include "neoc/types/neoc_hash160.h"
 #include "neoc/transaction/witness_scope.h"
 #include "neoc/serialization/binary_writer.h"
+#include "neoc/serialization/binary_reader.h"
 #include "neoc/witnessrule/witness_rule.h"
 
 #ifdef __cplusplus
@@ -150,6 +151,18 @@ neoc_error_t neoc_signer_get_account(const neoc_signer_t *signer, neoc_hash160_t
  */
 neoc_error_t neoc_signer_serialize(const neoc_signer_t *signer, neoc_binary_writer_t *writer);
 
+/**
+ * @brief Deserialize signer from binary reader
+ * 
+ * Reads the account, scopes and whichever allowed contracts, groups and
+ * witness rules the scopes call for, enforcing the protocol item limits.
+ * 
+ * @param reader Binary reader positioned at the signer
+ * @param signer Output signer (caller must free)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_signer_deserialize(neoc_binary_reader_t *reader, neoc_signer_t **signer);
+
 /**
  * @brief Free a signer
  * 
@@ -10,6 +10,9 @@
 #include "neoc/transaction/signer.h"
 #include "neoc/transaction/witness.h"
 #include "neoc/wallet/account.h"
+#include "neoc/serialization/binary_reader.h"
+#include "neoc/serialization/binary_writer.h"
+#include "neoc/utils/json.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,6 +30,10 @@ typedef enum {
 
 /**
  * @brief Transaction attribute structure
+ *
+ * data holds the type-specific payload exactly as it follows the type byte
+ * on the wire: empty for HighPriority, the uint32 height for NotValidBefore,
+ * the 32-byte hash for Conflicts and id, code and result for OracleResponse.
  */
 typedef struct {
     neoc_tx_attribute_type_t type;
@@ -54,6 +61,60 @@ typedef struct {
     neoc_hash256_t hash;                 // Transaction hash (computed)
 } neoc_transaction_t;
 
+/**
+ * @brief Signer inside a transaction view
+ */
+typedef struct {
+    const uint8_t *account;              // 20-byte script hash (little endian)
+    uint8_t scopes;                      // Witness scopes
+    const uint8_t *data;                 // Whole encoded signer
+    size_t size;                         // Encoded signer size
+} neoc_signer_view_t;
+
+/**
+ * @brief Attribute inside a transaction view
+ */
+typedef struct {
+    neoc_tx_attribute_type_t type;       // Attribute type
+    const uint8_t *payload;              // Type-specific payload
+    size_t payload_len;                  // Payload length
+} neoc_tx_attribute_view_t;
+
+/**
+ * @brief Witness inside a transaction view
+ */
+typedef struct {
+    const uint8_t *invocation_script;    // Invocation script
+    size_t invocation_script_len;        // Invocation script length
+    const uint8_t *verification_script;  // Verification script
+    size_t verification_script_len;      // Verification script length
+} neoc_witness_view_t;
+
+/**
+ * @brief Zero-copy view of a serialized transaction
+ *
+ * Every pointer refers into the buffer the view was parsed from, so the view
+ * is only valid while that buffer is. Parsing allocates nothing.
+ */
+typedef struct {
+    const uint8_t *data;                 // Start of the serialized transaction
+    size_t size;                         // Total serialized size
+    size_t unsigned_size;                // Size of the hashed (unsigned) part
+    uint8_t version;                     // Transaction version
+    uint32_t nonce;                      // Random nonce
+    uint64_t system_fee;                 // System fee in GAS
+    uint64_t network_fee;                // Network fee in GAS
+    uint32_t valid_until_block;          // Valid until block height
+    neoc_signer_view_t signers[NEOC_MAX_SIGNERS];
+    size_t signer_count;                 // Number of signers
+    neoc_tx_attribute_view_t attributes[NEOC_MAX_TRANSACTION_ATTRIBUTES];
+    size_t attribute_count;              // Number of attributes
+    const uint8_t *script;               // Transaction script
+    size_t script_len;                   // Script length
+    neoc_witness_view_t witnesses[NEOC_MAX_WITNESSES];
+    size_t witness_count;                // Number of witnesses
+} neoc_transaction_view_t;
+
 /**
  * @brief Create a new empty transaction
  * 
@@ -157,6 +218,9 @@ neoc_error_t neoc_transaction_add_witness(neoc_transaction_t *transaction,
 /**
  * @brief Calculate transaction hash
  * 
+ * The unsigned fields are streamed through SHA-256 from a small stack
+ * buffer, so hashing does not allocate.
+ * 
  * @param transaction The transaction
  * @param hash Output hash
  * @return NEOC_SUCCESS on success, error code otherwise
@@ -167,6 +231,9 @@ neoc_error_t neoc_transaction_calculate_hash(neoc_transaction_t *transaction,
 /**
  * @brief Get transaction hash
  * 
+ * Returns the cached hash, calculating it on first use. The setters above
+ * clear the cache when they change a hashed field.
+ * 
  * @param transaction The transaction
  * @param hash Output hash
  * @return NEOC_SUCCESS on success, error code otherwise
@@ -175,7 +242,10 @@ neoc_error_t neoc_transaction_get_hash(const neoc_transaction_t *transaction,
                                         neoc_hash256_t *hash);
 
 /**
- * @brief Sign transaction with account
+ * @brief Sign transaction with account for the default network
+ * 
+ * Same as neoc_transaction_sign_for_network with
+ * NEOC_CONFIG_DEFAULT_NETWORK_MAGIC (N3 MainNet).
  * 
  * @param transaction The transaction to sign
  * @param account The account to sign with
@@ -184,14 +254,33 @@ neoc_error_t neoc_transaction_get_hash(const neoc_transaction_t *transaction,
 neoc_error_t neoc_transaction_sign(neoc_transaction_t *transaction,
                                     neoc_account_t *account);
 
+/**
+ * @brief Sign transaction with account for a network
+ * 
+ * Signs SHA-256(network_magic as little-endian uint32 || transaction hash)
+ * and appends a single-signature witness.
+ * 
+ * @param transaction The transaction to sign
+ * @param account The account to sign with
+ * @param network_magic Magic number of the target network
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_transaction_sign_for_network(neoc_transaction_t *transaction,
+                                                neoc_account_t *account,
+                                                uint32_t network_magic);
+
 /**
  * @brief Serialize transaction to bytes
  * 
+ * Writes directly into buffer without intermediate allocations; a buffer
+ * of neoc_transaction_get_size bytes is always large enough.
+ * 
  * @param transaction The transaction
  * @param buffer Output buffer
  * @param buffer_size Buffer size
  * @param serialized_size Output serialized size
- * @return NEOC_SUCCESS on success, error code otherwise
+ * @return NEOC_SUCCESS on success, NEOC_ERROR_BUFFER_TOO_SMALL if buffer_size
+ *         is less than neoc_transaction_get_size, error code otherwise
  */
 neoc_error_t neoc_transaction_serialize(const neoc_transaction_t *transaction,
                                          uint8_t *buffer,
@@ -199,17 +288,65 @@ neoc_error_t neoc_transaction_serialize(const neoc_transaction_t *transaction,
                                          size_t *serialized_size);
 
 /**
- * @brief Deserialize transaction from bytes
+ * @brief Write the serialized transaction, witnesses included, to a writer
  * 
- * @param bytes Transaction bytes
- * @param bytes_len Length of bytes
+ * Use with a sink writer to stream a transaction of any size into a file,
+ * socket or digest without materializing it.
+ * 
+ * @param transaction The transaction
+ * @param writer Destination writer
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_transaction_write(const neoc_transaction_t *transaction,
+                                     neoc_binary_writer_t *writer);
+
+/**
+ * @brief Deserialize transaction from a binary reader
+ * 
+ * Reads a complete Neo N3 transaction (header, signers with their witness
+ * rules, attributes, script and witnesses) and applies the protocol limits.
+ * The hash is taken from the consumed bytes, so it is set on return.
+ * 
+ * @param reader Binary reader positioned at the transaction
  * @param transaction Output transaction (caller must free)
  * @return NEOC_SUCCESS on success, error code otherwise
  */
-neoc_error_t neoc_transaction_deserialize(const uint8_t *bytes,
-                                           size_t bytes_len,
+neoc_error_t neoc_transaction_deserialize(neoc_binary_reader_t *reader,
                                            neoc_transaction_t **transaction);
 
+/**
+ * @brief Parse a transaction view from a binary reader
+ * 
+ * Validates the same layout and limits as neoc_transaction_deserialize but
+ * only records where each field lies in the reader's buffer.
+ * 
+ * @param reader Binary reader positioned at the transaction
+ * @param view Output view
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_transaction_view_parse(neoc_binary_reader_t *reader,
+                                          neoc_transaction_view_t *view);
+
+/**
+ * @brief Calculate the hash of a transaction view
+ * 
+ * @param view The view
+ * @param hash Output hash
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_transaction_view_get_hash(const neoc_transaction_view_t *view,
+                                             neoc_hash256_t *hash);
+
+/**
+ * @brief Materialize a transaction from a view
+ * 
+ * @param view The view (its buffer must still be valid)
+ * @param transaction Output transaction (caller must free)
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_transaction_from_view(const neoc_transaction_view_t *view,
+                                         neoc_transaction_t **transaction);
+
 /**
  * @brief Sign transaction with multiple accounts
  * 
@@ -233,10 +370,17 @@ size_t neoc_transaction_get_size(const neoc_transaction_t *transaction);
 /**
  * @brief Verify transaction signatures
  * 
+ * Witness i must belong to signer i: there must be one witness per signer
+ * and each verification script must hash to its signer's account. Only the
+ * N3 single-sig (CheckSig) and multi-sig (CheckMultisig) scripts are
+ * accepted. Signatures are checked against SHA-256(network_magic ||
+ * transaction hash), all together with neoc_verify_digests_batch.
+ * 
  * @param transaction The transaction
+ * @param network_magic Magic number of the network the transaction was signed for
  * @return true if all signatures are valid, false otherwise
  */
-bool neoc_transaction_verify(const neoc_transaction_t *transaction);
+bool neoc_transaction_verify(const neoc_transaction_t *transaction, uint32_t network_magic);
 
 /**
  * @brief Free a transaction
@@ -250,8 +394,19 @@ neoc_error_t neoc_transaction_clone(const neoc_transaction_t *source,
 
 neoc_transaction_t* neoc_transaction_from_json(const char* json_str);
 
+/* Same as neoc_transaction_from_json, reading an already parsed node */
+neoc_transaction_t* neoc_transaction_from_json_node(const neoc_json_t* json);
+
 char* neoc_transaction_to_json(const neoc_transaction_t* tx);
 
+/**
+ * @brief Deserialize one transaction from the start of a buffer
+ * 
+ * @param bytes Buffer holding one or more serialized transactions
+ * @param bytes_len Buffer length
+ * @param consumed Output number of bytes used by the transaction (optional)
+ * @return Transaction (caller must free), or NULL if the bytes are invalid
+ */
 neoc_transaction_t* neoc_transaction_deserialize_simple(const uint8_t *bytes,
                                                         size_t bytes_len,
                                                         size_t *consumed);
@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "neoc/neoc_error.h"
+#include "neoc/serialization/binary_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -72,6 +73,18 @@ neoc_error_t neoc_witness_serialize(const neoc_witness_t *witness,
                                      uint8_t **bytes,
                                      size_t *bytes_len);
 
+/**
+ * @brief Write a witness to a binary writer
+ *
+ * Writes exactly neoc_witness_get_size bytes.
+ *
+ * @param witness The witness
+ * @param writer Destination writer
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_witness_write(const neoc_witness_t *witness,
+                                 neoc_binary_writer_t *writer);
+
 /**
  * @brief Deserialize witness from bytes
  * 
@@ -0,0 +1,165 @@
+/**
+ * @file http_engine.h
+ * @brief Asynchronous HTTP engine for concurrent JSON-RPC traffic
+ *
+ * Runs many HTTP POSTs concurrently on a single event-loop thread driven
+ * by libcurl's multi interface. Completions are delivered either to a
+ * per-call callback or to a completion queue the caller drains.
+ */
+
+#ifndef NEOC_UTILS_HTTP_ENGINE_H
+#define NEOC_UTILS_HTTP_ENGINE_H
+
+#include "neoc/neoc_error.h"
+#include "neoc/utils/array.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default limit of connections the engine opens to one host */
+#define NEOC_HTTP_ENGINE_DEFAULT_HOST_CONNECTIONS 8
+/** Default per-call deadline in milliseconds */
+#define NEOC_HTTP_ENGINE_DEFAULT_TIMEOUT_MS 60000
+
+/**
+ * @brief Identifier of a submitted call, unique per engine (never 0)
+ */
+typedef uint64_t neoc_http_call_id_t;
+
+/**
+ * @brief Outcome of one call
+ *
+ * error is NEOC_SUCCESS when a response arrived (whatever its status code),
+ * NEOC_ERROR_TIMEOUT when the deadline passed, NEOC_ERROR_CANCELLED when
+ * the call was cancelled or the engine was freed, and NEOC_ERROR_NETWORK
+ * for other transport failures.
+ */
+typedef struct {
+    neoc_http_call_id_t call_id;    /**< Call this completion belongs to */
+    neoc_error_t error;             /**< Transport outcome */
+    long status_code;               /**< HTTP status code (0 without a response) */
+    neoc_byte_array_t *body;        /**< Response body, owned by the receiver (nullable) */
+    void *user_data;                /**< User data given at submission */
+} neoc_http_completion_t;
+
+/**
+ * @brief Completion callback, invoked on the engine thread
+ *
+ * The callback takes ownership of completion->body and must not block or
+ * free the engine.
+ */
+typedef void (*neoc_http_engine_callback_t)(neoc_http_completion_t *completion);
+
+/**
+ * @brief Engine configuration
+ */
+typedef struct {
+    size_t max_connections_per_host;    /**< Connections per host (0 = unlimited) */
+    long default_timeout_ms;            /**< Deadline for calls submitted with 0 */
+    bool verify_ssl;                    /**< Verify TLS certificates */
+} neoc_http_engine_config_t;
+
+/**
+ * @brief Asynchronous HTTP engine
+ *
+ * Calls may be submitted and cancelled from any thread. Requests to one
+ * host beyond max_connections_per_host queue inside the engine rather than
+ * blocking the submitter.
+ */
+typedef struct neoc_http_engine_t neoc_http_engine_t;
+
+/**
+ * @brief Fill a configuration with defaults
+ *
+ * @param config Configuration to fill
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_http_engine_get_default_config(neoc_http_engine_config_t *config);
+
+/**
+ * @brief Create an engine and start its event-loop thread
+ *
+ * @param config Engine configuration (NULL for defaults)
+ * @param engine Output engine handle (caller must free)
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_http_engine_create(const neoc_http_engine_config_t *config,
+                                     neoc_http_engine_t **engine);
+
+/**
+ * @brief Submit a JSON POST
+ *
+ * The body is copied. With a callback the completion is delivered to it;
+ * with a NULL callback it is queued for neoc_http_engine_next_completion.
+ *
+ * @param engine Engine handle
+ * @param url Request URL
+ * @param body Request body
+ * @param body_len Request body length
+ * @param timeout_ms Deadline for the whole call (0 for the engine default)
+ * @param callback Completion callback (nullable)
+ * @param user_data User data passed back with the completion
+ * @param call_id Output call identifier (nullable)
+ * @return NEOC_SUCCESS if the call was queued, error code otherwise
+ */
+neoc_error_t neoc_http_engine_post(neoc_http_engine_t *engine,
+                                   const char *url,
+                                   const uint8_t *body,
+                                   size_t body_len,
+                                   long timeout_ms,
+                                   neoc_http_engine_callback_t callback,
+                                   void *user_data,
+                                   neoc_http_call_id_t *call_id);
+
+/**
+ * @brief Cancel a call
+ *
+ * The call completes with NEOC_ERROR_CANCELLED unless it finished first.
+ *
+ * @param engine Engine handle
+ * @param call_id Call to cancel
+ * @return NEOC_SUCCESS if the call was still pending, NEOC_ERROR_NOT_FOUND otherwise
+ */
+neoc_error_t neoc_http_engine_cancel(neoc_http_engine_t *engine, neoc_http_call_id_t call_id);
+
+/**
+ * @brief Take the next queued completion
+ *
+ * Only calls submitted without a callback are queued.
+ *
+ * @param engine Engine handle
+ * @param wait_ms Time to wait for a completion (0 polls, negative waits forever)
+ * @param completion Output completion (caller owns body)
+ * @return NEOC_SUCCESS on success, NEOC_ERROR_TIMEOUT if none arrived in time
+ */
+neoc_error_t neoc_http_engine_next_completion(neoc_http_engine_t *engine,
+                                              long wait_ms,
+                                              neoc_http_completion_t *completion);
+
+/**
+ * @brief Number of submitted calls that have not completed yet
+ *
+ * @param engine Engine handle
+ * @return In-flight call count
+ */
+size_t neoc_http_engine_in_flight(neoc_http_engine_t *engine);
+
+/**
+ * @brief Stop the engine and free it
+ *
+ * Calls still in flight complete with NEOC_ERROR_CANCELLED first; queued
+ * completions that were never taken are discarded.
+ *
+ * @param engine Engine to free
+ */
+void neoc_http_engine_free(neoc_http_engine_t *engine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEOC_UTILS_HTTP_ENGINE_H */
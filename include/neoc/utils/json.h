@@ -201,6 +201,150 @@ bool neoc_json_is_array(const neoc_json_t *json);
  */
 bool neoc_json_is_object(const neoc_json_t *json);
 
+/* ===== Streaming parser ===== */
+
+/**
+ * @brief Maximum container nesting accepted by the streaming parser
+ */
+#define NEOC_JSON_STREAM_MAX_DEPTH 1024
+
+/**
+ * @brief Streaming parser event types
+ */
+typedef enum {
+    NEOC_JSON_EVENT_OBJECT_START,
+    NEOC_JSON_EVENT_OBJECT_END,
+    NEOC_JSON_EVENT_ARRAY_START,
+    NEOC_JSON_EVENT_ARRAY_END,
+    NEOC_JSON_EVENT_KEY,
+    NEOC_JSON_EVENT_STRING,
+    NEOC_JSON_EVENT_NUMBER,
+    NEOC_JSON_EVENT_TRUE,
+    NEOC_JSON_EVENT_FALSE,
+    NEOC_JSON_EVENT_NULL
+} neoc_json_event_type_t;
+
+/**
+ * @brief One streaming parser event
+ *
+ * For keys and strings, text is the unescaped value. For numbers it is the
+ * number as written. It is NULL for every other event. The text is only
+ * valid for the duration of the handler call.
+ */
+typedef struct {
+    neoc_json_event_type_t type;
+    const char *text;   ///< NUL-terminated text, or NULL
+    size_t length;      ///< Length of text in bytes
+    size_t depth;       ///< Containers enclosing the event (0 for the root value)
+} neoc_json_event_t;
+
+/**
+ * @brief Streaming parser event handler
+ *
+ * Returning anything but NEOC_SUCCESS stops the parse; the stream then
+ * reports that error from every later feed or finish call.
+ */
+typedef neoc_error_t (*neoc_json_event_handler_t)(const neoc_json_event_t *event, void *user_data);
+
+/**
+ * @brief Incremental JSON tokenizer
+ *
+ * Input is fed in arbitrary chunks, e.g. straight from an HTTP write
+ * callback, and events are delivered as soon as each token completes.
+ * Memory use is bounded by the longest single string or number plus the
+ * nesting depth, independent of the document size.
+ */
+typedef struct neoc_json_stream neoc_json_stream_t;
+
+/**
+ * @brief Create a streaming parser
+ * @param handler Event handler
+ * @param user_data Passed to every handler call
+ * @param stream Output stream (free with neoc_json_stream_free)
+ * @return NEOC_SUCCESS or error code
+ */
+neoc_error_t neoc_json_stream_create(neoc_json_event_handler_t handler,
+                                     void *user_data,
+                                     neoc_json_stream_t **stream);
+
+/**
+ * @brief Feed the next chunk of the document
+ * @param stream Streaming parser
+ * @param data Chunk bytes (need not be terminated)
+ * @param length Chunk length
+ * @return NEOC_SUCCESS, NEOC_ERROR_INVALID_FORMAT on malformed input, or the handler's error
+ */
+neoc_error_t neoc_json_stream_feed(neoc_json_stream_t *stream, const char *data, size_t length);
+
+/**
+ * @brief Signal the end of input
+ * @param stream Streaming parser
+ * @return NEOC_SUCCESS when exactly one complete value was fed
+ */
+neoc_error_t neoc_json_stream_finish(neoc_json_stream_t *stream);
+
+/**
+ * @brief Free a streaming parser
+ * @param stream Streaming parser
+ */
+void neoc_json_stream_free(neoc_json_stream_t *stream);
+
+/**
+ * @brief Handler for one element split out of a streamed document
+ *
+ * The element is freed when the handler returns.
+ */
+typedef neoc_error_t (*neoc_json_element_handler_t)(size_t path_index,
+                                                    const neoc_json_t *element,
+                                                    void *user_data);
+
+/**
+ * @brief Builds a streamed document one array element at a time
+ *
+ * Each path names an array by its dotted object keys from the root, e.g.
+ * "result.tx". Every element of those arrays is built as a standalone tree,
+ * passed to the handler and freed; the rest of the document is kept as a
+ * skeleton in which the split arrays are present but empty. Peak memory is
+ * the skeleton plus the largest single element.
+ */
+typedef struct neoc_json_splitter neoc_json_splitter_t;
+
+/**
+ * @brief Create an element splitter
+ * @param paths Dotted paths of the arrays to split
+ * @param path_count Number of paths
+ * @param handler Called once per element with the index of its path
+ * @param user_data Passed to every handler call
+ * @param splitter Output splitter (free with neoc_json_splitter_free)
+ * @return NEOC_SUCCESS or error code
+ */
+neoc_error_t neoc_json_splitter_create(const char *const *paths,
+                                       size_t path_count,
+                                       neoc_json_element_handler_t handler,
+                                       void *user_data,
+                                       neoc_json_splitter_t **splitter);
+
+/**
+ * @brief Stream that feeds the splitter
+ * @param splitter Element splitter
+ * @return Stream owned by the splitter
+ */
+neoc_json_stream_t *neoc_json_splitter_stream(neoc_json_splitter_t *splitter);
+
+/**
+ * @brief Finish the document and return its skeleton
+ * @param splitter Element splitter
+ * @param skeleton Output skeleton, owned by the splitter
+ * @return NEOC_SUCCESS or error code
+ */
+neoc_error_t neoc_json_splitter_finish(neoc_json_splitter_t *splitter, const neoc_json_t **skeleton);
+
+/**
+ * @brief Free an element splitter and its skeleton
+ * @param splitter Element splitter
+ */
+void neoc_json_splitter_free(neoc_json_splitter_t *splitter);
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,16 @@ extern "C" {
  */
 #define NEOC_BASE58_CHECKSUM_LENGTH 4
 
+/**
+ * @brief Length of an address payload (version byte + 20-byte script hash)
+ */
+#define NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH 21
+
+/**
+ * @brief Longest Base58Check address string, excluding the null terminator
+ */
+#define NEOC_BASE58_ADDRESS_MAX_LENGTH 35
+
 /**
  * @brief Base58 alphabet used for encoding
  */
@@ -176,6 +186,40 @@ char* neoc_base58_check_encode_alloc(const uint8_t* data, size_t data_length);
  */
 uint8_t* neoc_base58_check_decode_alloc(const char* base58_string, size_t* decoded_length);
 
+/* Address functions */
+
+/**
+ * @brief Encode version + script hash as a Base58Check address
+ * 
+ * Fixed-size path for the 25-byte address payload; it does not allocate.
+ * The script hash is taken in payload byte order, as it appears in the
+ * encoded address.
+ * 
+ * @param version Address version byte
+ * @param script_hash 20-byte script hash
+ * @param buffer Output buffer for the address
+ * @param buffer_size Size of output buffer (NEOC_BASE58_ADDRESS_MAX_LENGTH + 1 always suffices)
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_base58_check_encode_address(uint8_t version,
+                                             const uint8_t script_hash[NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH - 1],
+                                             char* buffer, size_t buffer_size);
+
+/**
+ * @brief Decode a Base58Check address into version + script hash
+ * 
+ * Fixed-size counterpart of neoc_base58_check_encode_address. Fails with
+ * NEOC_ERROR_INVALID_BASE58 on a bad character or checksum and with
+ * NEOC_ERROR_INVALID_FORMAT if the string does not hold a 21-byte payload.
+ * 
+ * @param address Base58Check address string
+ * @param version Pointer to store the version byte (can be NULL)
+ * @param script_hash Output for the 20-byte script hash, in payload byte order
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_base58_check_decode_address(const char* address, uint8_t* version,
+                                             uint8_t script_hash[NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH - 1]);
+
 #ifdef __cplusplus
 }
 #endif
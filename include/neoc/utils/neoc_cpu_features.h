@@ -0,0 +1,32 @@
+/**
+ * @file neoc_cpu_features.h
+ * @brief Runtime detection of the x86 instruction sets used by the SIMD paths
+ */
+
+#ifndef NEOC_CPU_FEATURES_H
+#define NEOC_CPU_FEATURES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NEOC_CPU_FEATURE_SSE2  (1u << 0)   ///< SSE2
+#define NEOC_CPU_FEATURE_AVX2  (1u << 1)   ///< AVX2 with YMM state enabled by the OS
+#define NEOC_CPU_FEATURE_SHANI (1u << 2)   ///< SHA extensions plus SSSE3 and SSE4.1
+
+/**
+ * @brief Instruction sets usable on this CPU
+ *
+ * CPUID (and XGETBV for the AVX state check) runs once; the result is
+ * cached in an atomic, so concurrent first calls are safe. Always 0 on
+ * non-x86 targets.
+ *
+ * @return Bitwise OR of NEOC_CPU_FEATURE_* flags
+ */
+unsigned int neoc_cpu_features(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEOC_CPU_FEATURES_H */
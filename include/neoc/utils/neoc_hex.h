@@ -18,6 +18,12 @@ extern "C" {
 #include <stdbool.h>
 #include "neoc/neoc_error.h"
 
+#ifndef NEOC_FORWARD_DECLARATIONS
+#define NEOC_FORWARD_DECLARATIONS
+typedef struct neoc_binary_reader neoc_binary_reader_t;
+typedef struct neoc_binary_writer neoc_binary_writer_t;
+#endif
+
 /**
  * @brief Check if a character is a valid hexadecimal digit
  * 
@@ -97,6 +103,63 @@ neoc_error_t neoc_hex_decode(const char* hex_string,
                             uint8_t* buffer, size_t buffer_size,
                             size_t* decoded_length);
 
+/**
+ * @brief Encode binary data to hexadecimal in the same buffer
+ *
+ * The data_length bytes at the start of buffer are replaced by their
+ * lowercase or uppercase hex digits and a null terminator.
+ *
+ * @param buffer Data on input, hex string on output
+ * @param data_length Number of data bytes at the start of buffer
+ * @param buffer_size Size of buffer (at least 2 * data_length + 1)
+ * @param uppercase Use uppercase letters if true
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_hex_encode_in_place(uint8_t* buffer, size_t data_length,
+                                      size_t buffer_size, bool uppercase);
+
+/**
+ * @brief Decode a hexadecimal string over itself
+ *
+ * The decoded bytes are written from the start of hex_string (a "0x"
+ * prefix is skipped). The string is not terminated afterwards.
+ *
+ * @param hex_string Hexadecimal string, decoded bytes on output
+ * @param decoded_length Pointer to store decoded length (can be NULL)
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_hex_decode_in_place(char* hex_string, size_t* decoded_length);
+
+/**
+ * @brief Append the hex digits of binary data to a writer
+ *
+ * No prefix or terminator is written. The digits go out in fixed-size
+ * chunks, so a sink writer streams them without holding the whole string.
+ *
+ * @param writer Destination writer
+ * @param data Binary data to encode
+ * @param data_length Length of binary data
+ * @param uppercase Use uppercase letters if true
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_hex_encode_to_writer(neoc_binary_writer_t* writer,
+                                       const uint8_t* data, size_t data_length,
+                                       bool uppercase);
+
+/**
+ * @brief Decode hexadecimal characters straight into a writer
+ *
+ * hex need not be null-terminated; a leading "0x" is skipped. The input is
+ * validated before anything is written.
+ *
+ * @param writer Destination writer
+ * @param hex Hexadecimal characters
+ * @param hex_length Number of characters
+ * @return NEOC_SUCCESS on success, error code on failure
+ */
+neoc_error_t neoc_hex_decode_to_writer(neoc_binary_writer_t* writer,
+                                       const char* hex, size_t hex_length);
+
 /**
  * @brief Allocate and encode binary data to hexadecimal string
  * 
@@ -0,0 +1,64 @@
+/**
+ * @file neoc_parallel.h
+ * @brief Fork-join loop over an index range for the batch APIs
+ *
+ * The calling thread works alongside short-lived helper threads that pull
+ * chunks of the range from a shared cursor until it runs out.
+ */
+
+#ifndef NEOC_PARALLEL_H
+#define NEOC_PARALLEL_H
+
+#include <stddef.h>
+#include "neoc/neoc_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Upper bound on threads used by one neoc_parallel_for call, the caller included */
+#define NEOC_PARALLEL_MAX_THREADS 64u
+
+/**
+ * @brief Work function for neoc_parallel_for
+ *
+ * Processes items [begin, end). Called concurrently from several threads
+ * with disjoint ranges.
+ *
+ * @param begin First item
+ * @param end One past the last item
+ * @param ctx Pointer given to neoc_parallel_for
+ * @return NEOC_SUCCESS to continue; any other code stops further chunks from being handed out
+ */
+typedef neoc_error_t (*neoc_parallel_fn)(size_t begin, size_t end, void *ctx);
+
+/**
+ * @brief Number of online CPUs (at least 1)
+ */
+size_t neoc_parallel_cpu_count(void);
+
+/**
+ * @brief Run fn over [0, count) in chunks on up to max_threads threads
+ *
+ * The number of threads is further limited to NEOC_PARALLEL_MAX_THREADS and
+ * to the number of chunks. Failing to start a helper thread only reduces
+ * parallelism; every chunk is still run unless fn fails.
+ *
+ * @param count Number of items
+ * @param max_threads Thread limit including the caller (0 for neoc_parallel_cpu_count)
+ * @param chunk Items handed out per cursor step (0 is treated as 1)
+ * @param fn Work function
+ * @param ctx Passed to fn
+ * @return NEOC_SUCCESS, or the first error returned by fn
+ */
+neoc_error_t neoc_parallel_for(size_t count,
+                               size_t max_threads,
+                               size_t chunk,
+                               neoc_parallel_fn fn,
+                               void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEOC_PARALLEL_H */
@@ -66,6 +66,11 @@ typedef struct {
     char *error_message;                    /**< Error message (nullable) */
 } neoc_http_response_t;
 
+/** Default number of idle easy handles a session keeps for reuse */
+#define NEOC_URL_SESSION_DEFAULT_IDLE_HANDLES 8
+/** Default limit of concurrent requests (and so connections) per host */
+#define NEOC_URL_SESSION_DEFAULT_HOST_CONNECTIONS 8
+
 /**
  * @brief URL session configuration
  */
@@ -76,10 +81,18 @@ typedef struct {
     char *user_agent;                       /**< User agent string */
     neoc_http_header_t *default_headers;    /**< Default headers for all requests */
     size_t default_header_count;            /**< Number of default headers */
+    size_t max_idle_handles;                /**< Idle handles kept for reuse (0 = none) */
+    size_t max_connections_per_host;        /**< Concurrent requests per host (0 = unlimited) */
 } neoc_url_session_config_t;
 
 /**
  * @brief URL session for making HTTP requests
+ *
+ * A session reuses connections across requests: it shares one connection,
+ * DNS and TLS session cache between its requests and keeps up to
+ * max_idle_handles easy handles for reuse. Sessions may be used from
+ * several threads at once; requests to the same host beyond
+ * max_connections_per_host wait for a slot.
  */
 typedef struct neoc_url_session_t neoc_url_session_t;
 
@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include "neoc/neoc_error.h"
+#include "neoc/crypto/nep2.h"
 #include "neoc/wallet/account.h"
 #include "neoc/wallet/nep6_wallet.h"
 
@@ -22,6 +23,8 @@ typedef struct {
     size_t account_count;        // Number of accounts
     size_t account_capacity;     // Capacity of accounts array
     neoc_account_t *default_account; // Default account
+    size_t *account_index;       // Open-addressing index by script hash (slot -> position + 1, 0 = empty)
+    size_t index_capacity;       // Number of index slots, a power of two
     void *extra;                 // Extra data for extensions
 } neoc_wallet_t;
 
@@ -61,9 +64,21 @@ neoc_error_t neoc_wallet_save(const neoc_wallet_t *wallet, const char *path);
  */
 neoc_error_t neoc_wallet_add_account(neoc_wallet_t *wallet, neoc_account_t *account);
 
+/**
+ * @brief Reserve room for a number of accounts ahead of a bulk import
+ * 
+ * @param wallet The wallet
+ * @param count Total number of accounts the wallet should hold without growing
+ * @return NEOC_SUCCESS on success, error code otherwise
+ */
+neoc_error_t neoc_wallet_reserve_accounts(neoc_wallet_t *wallet, size_t count);
+
 /**
  * @brief Remove an account from the wallet
  * 
+ * The last account takes the removed account's position, so removal is
+ * constant time but does not preserve account order.
+ * 
  * @param wallet The wallet
  * @param address Address of account to remove
  * @return NEOC_SUCCESS on success, error code otherwise
@@ -200,6 +215,31 @@ neoc_error_t neoc_wallet_lock_all(neoc_wallet_t *wallet, const char *passphrase)
  */
 neoc_error_t neoc_wallet_unlock_all(neoc_wallet_t *wallet, const char *passphrase);
 
+/**
+ * @brief Decrypt the NEP-2 keys of all encrypted accounts
+ * 
+ * The scrypt derivations run in parallel through neoc_nep2_decrypt_batch.
+ * Accounts without an encrypted key are left as they are. Every account
+ * that decrypts gets its key pair and is unlocked, even when others fail.
+ * 
+ * @param wallet The wallet
+ * @param password Password shared by the encrypted accounts
+ * @param params Scrypt parameters (use NULL for defaults)
+ * @param threads Maximum worker threads (0 for one per CPU)
+ * @param progress Optional progress callback, counting encrypted accounts only
+ * @param user_data Passed to the progress callback
+ * @param results Optional output status per account, in account order
+ * @return NEOC_SUCCESS if every encrypted account was unlocked, otherwise
+ *         the error of the first account that failed
+ */
+neoc_error_t neoc_wallet_unlock_all_parallel(neoc_wallet_t *wallet,
+                                             const char *password,
+                                             const neoc_nep2_params_t *params,
+                                             size_t threads,
+                                             neoc_nep2_progress_fn progress,
+                                             void *user_data,
+                                             neoc_error_t *results);
+
 neoc_error_t neoc_wallet_to_nep6(const neoc_wallet_t *wallet, neoc_nep6_wallet_t **nep6_wallet);
 neoc_error_t neoc_wallet_from_nep6(const neoc_nep6_wallet_t *nep6_wallet, neoc_wallet_t **wallet);
 
@@ -6,10 +6,15 @@
 #include "neoc/contract/fungible_token.h"
 #include "neoc/neoc_memory.h"
 #include "neoc/script/script_builder_full.h"
+#include "neoc/script/script_template.h"
+#include "neoc/neo_constants.h"
 #include "neoc/protocol/rpc_client.h"
 #include <string.h>
 #include <stdlib.h>
 
+/* Transfer scripts without a large data payload are built on the stack */
+#define FUNGIBLE_TRANSFER_STACK_SCRIPT 256
+
 neoc_error_t neoc_fungible_token_create(neoc_hash160_t *contract_hash,
                                          neoc_fungible_token_t **token) {
     if (!contract_hash || !token) {
@@ -118,52 +123,143 @@ neoc_error_t neoc_fungible_token_transfer(neoc_fungible_token_t *token,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Amount must be positive");
     }
     
-    // Build transfer script
-    neoc_script_builder_t *builder = NULL;
-    neoc_error_t err = neoc_script_builder_create(&builder);
-    if (err != NEOC_SUCCESS) {
-        return err;
+    if (!token->base.contract_hash) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Token has no contract hash");
     }
     
-    // Push data parameter
+    const neoc_script_template_t *tmpl = neoc_script_template_nep17_transfer();
+    
+    // Build transfer script; empty data is pushed as null
+    neoc_script_arg_t args[4] = {0};
+    args[0].hash160 = from;
+    args[1].hash160 = to;
+    args[2].integer = amount;
     if (data && data_len > 0) {
-        err = neoc_script_builder_push_data(builder, data, data_len);
-    } else {
-        err = neoc_script_builder_push_null(builder);
+        args[3].data = data;
+        args[3].data_len = data_len;
     }
+    
+    uint8_t buffer[FUNGIBLE_TRANSFER_STACK_SCRIPT];
+    size_t script_len = 0;
+    neoc_error_t err = neoc_script_template_size(tmpl, args, &script_len);
     if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
         return err;
     }
+    if (script_len <= sizeof(buffer)) {
+        return neoc_script_template_write_for_contract(tmpl, token->base.contract_hash, args,
+                                                       buffer, sizeof(buffer), &script_len);
+    }
     
-    // Push amount
-    err = neoc_script_builder_push_integer(builder, amount);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
+    uint8_t *script = NULL;
+    err = neoc_script_template_instantiate(tmpl, token->base.contract_hash, args,
+                                           &script, &script_len);
+    neoc_free(script);
+    return err;
+}
+
+/* transfer(from, to, amount, data) arguments; empty data is pushed as null */
+static void fungible_transfer_args(const neoc_hash160_t *from,
+                                   const neoc_fungible_token_transfer_request_t *request,
+                                   neoc_script_arg_t args[4]) {
+    memset(args, 0, 4 * sizeof(*args));
+    args[0].hash160 = from;
+    args[1].hash160 = &request->to;
+    args[2].integer = (int64_t)request->amount;
+    if (request->data && request->data_len > 0) {
+        args[3].data = request->data;
+        args[3].data_len = request->data_len;
+    }
+}
+
+neoc_error_t neoc_fungible_token_build_batch_transfer(const neoc_hash160_t *token_hash,
+                                                      const neoc_hash160_t *from,
+                                                      const neoc_fungible_token_transfer_request_t *transfers,
+                                                      size_t transfer_count,
+                                                      size_t max_script_size,
+                                                      neoc_fungible_token_batch_t **batch) {
+    if (!token_hash || !from || !transfers || transfer_count == 0 || !batch) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid batch transfer arguments");
+    }
+    *batch = NULL;
+    if (max_script_size == 0) {
+        max_script_size = NEOC_MAX_TRANSACTION_SCRIPT_SIZE;
     }
     
-    // Push to address
-    err = neoc_script_builder_push_hash160(builder, to);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
+    const neoc_script_template_t *tmpl = neoc_script_template_nep17_transfer();
+    
+    // Size every transfer and plan the split so the script is allocated exactly once
+    neoc_script_arg_t args[4];
+    size_t total_len = 0;
+    size_t chunk_count = 0;
+    size_t chunk_len = 0;
+    for (size_t i = 0; i < transfer_count; i++) {
+        if (transfers[i].amount == 0) {
+            return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Transfer amount must be greater than zero");
+        }
+        fungible_transfer_args(from, &transfers[i], args);
+        size_t single_len = 0;
+        neoc_error_t err = neoc_script_template_size(tmpl, args, &single_len);
+        if (err != NEOC_SUCCESS) {
+            return err;
+        }
+        if (single_len > max_script_size) {
+            return neoc_error_set(NEOC_ERROR_INVALID_SIZE, "Transfer does not fit in one transaction script");
+        }
+        if (chunk_count == 0 || chunk_len + single_len > max_script_size) {
+            chunk_count++;
+            chunk_len = 0;
+        }
+        chunk_len += single_len;
+        total_len += single_len;
     }
     
-    // Push from address
-    err = neoc_script_builder_push_hash160(builder, from);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
+    neoc_fungible_token_batch_t *result = neoc_calloc(1, sizeof(*result));
+    if (!result) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate batch transfer");
+    }
+    result->script = neoc_malloc(total_len);
+    result->chunks = neoc_calloc(chunk_count, sizeof(*result->chunks));
+    if (!result->script || !result->chunks) {
+        neoc_fungible_token_batch_free(result);
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate batch transfer");
     }
     
-    // Call transfer method
-    uint8_t contract_hash[20];
-    neoc_hash160_to_bytes(token->base.contract_hash, contract_hash, sizeof(contract_hash));
-    err = neoc_script_builder_emit_app_call(builder, token->base.contract_hash, "transfer", 4);
+    // Encode in place, repeating the same greedy split
+    neoc_fungible_token_batch_chunk_t *chunk = NULL;
+    size_t offset = 0;
+    for (size_t i = 0; i < transfer_count; i++) {
+        fungible_transfer_args(from, &transfers[i], args);
+        size_t single_len = 0;
+        neoc_error_t err = neoc_script_template_write_for_contract(tmpl, token_hash, args,
+                                                                   result->script + offset,
+                                                                   total_len - offset,
+                                                                   &single_len);
+        if (err != NEOC_SUCCESS) {
+            neoc_fungible_token_batch_free(result);
+            return err;
+        }
+        if (!chunk || chunk->script_len + single_len > max_script_size) {
+            chunk = &result->chunks[result->chunk_count++];
+            chunk->first_transfer = i;
+            chunk->script_offset = offset;
+        }
+        chunk->transfer_count++;
+        chunk->script_len += single_len;
+        offset += single_len;
+    }
+    result->script_len = total_len;
     
-    neoc_script_builder_free(builder);
-    return err;
+    *batch = result;
+    return NEOC_SUCCESS;
+}
+
+void neoc_fungible_token_batch_free(neoc_fungible_token_batch_t *batch) {
+    if (!batch) {
+        return;
+    }
+    neoc_free(batch->script);
+    neoc_free(batch->chunks);
+    neoc_free(batch);
 }
 
 uint8_t neoc_fungible_token_get_decimals(neoc_fungible_token_t *token) {
@@ -8,6 +8,7 @@
 #include "neoc/neoc_error.h"
 #include "neoc/script/script_helper.h"
 #include "neoc/contract/contract_parameter.h"
+#include <stdint.h>
 #include <string.h>
 
 /**
@@ -289,46 +290,18 @@ neoc_error_t neoc_gas_token_build_multi_transfer_script(
         return err;
     }
 
-    uint8_t *combined = NULL;
-    size_t combined_len = 0;
-
-    for (size_t i = 0; i < transfer_count; i++) {
-        const neoc_gas_token_transfer_request_t *request = &transfers[i];
-        if (request->amount == 0) {
-            neoc_free(combined);
-            return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Transfer amount must be greater than zero");
-        }
-
-        uint8_t *single_script = NULL;
-        size_t single_len = 0;
-        err = neoc_script_create_nep17_transfer(&NEOC_GAS_TOKEN_HASH,
-                                                from,
-                                                &request->to,
-                                                request->amount,
-                                                request->data,
-                                                request->data_len,
-                                                &single_script,
-                                                &single_len);
-        if (err != NEOC_SUCCESS) {
-            neoc_free(combined);
-            return err;
-        }
-
-        uint8_t *resized = neoc_realloc(combined, combined_len + single_len);
-        if (!resized) {
-            neoc_free(single_script);
-            neoc_free(combined);
-            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to expand multi-transfer script buffer");
-        }
-
-        memcpy(resized + combined_len, single_script, single_len);
-        combined = resized;
-        combined_len += single_len;
-        neoc_free(single_script);
+    neoc_fungible_token_batch_t *batch = NULL;
+    err = neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, from, transfers,
+                                                   transfer_count, SIZE_MAX, &batch);
+    if (err != NEOC_SUCCESS) {
+        return err;
     }
 
-    *script = combined;
-    *script_len = combined_len;
+    /* Splitting is disabled, so the batch holds exactly one script to hand over */
+    *script = batch->script;
+    *script_len = batch->script_len;
+    batch->script = NULL;
+    neoc_fungible_token_batch_free(batch);
     return NEOC_SUCCESS;
 }
 
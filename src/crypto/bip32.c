@@ -4,13 +4,16 @@
  */
 
 #include "neoc/crypto/bip32.h"
+#include "neoc/crypto/ec_key_pair.h"
 #include "neoc/crypto/sha256.h"
 #include "neoc/crypto/neoc_hash.h"
 #include "neoc/utils/neoc_base58.h"
+#include "neoc/utils/neoc_parallel.h"
 #include "neoc/neoc_memory.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <openssl/evp.h>
 #include <openssl/hmac.h>
 #include <openssl/ec.h>
 #include <openssl/obj_mac.h>
@@ -22,6 +25,42 @@ static const uint8_t MAINNET_PUBLIC[4] = {0x04, 0x88, 0xB2, 0x1E};  // xpub
 static const uint8_t TESTNET_PRIVATE[4] = {0x04, 0x35, 0x83, 0x94}; // tprv
 static const uint8_t TESTNET_PUBLIC[4] = {0x04, 0x35, 0x87, 0xCF};  // tpub
 
+// Ranges smaller than BIP32_RANGE_MIN_PER_THREAD children stay on the calling thread
+#define BIP32_RANGE_MAX_THREADS 16u
+#define BIP32_RANGE_MIN_PER_THREAD 64u
+#define BIP32_RANGE_CHUNK 16u
+#define BIP32_CONTEXT_CACHE_SIZE 16u
+#define BIP32_HMAC_BLOCK_SIZE 128u  // SHA-512 block size
+
+// Compute the compressed public key for a 32-byte private key
+static neoc_error_t bip32_public_from_private(const uint8_t private_key[32],
+                                             uint8_t public_key[33]) {
+    const EC_GROUP *group = neoc_ec_secp256r1_group();
+    if (!group) {
+        return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create EC group");
+    }
+    
+    BIGNUM *priv_bn = BN_bin2bn(private_key, 32, NULL);
+    EC_POINT *pub_point = EC_POINT_new(group);
+    if (!priv_bn || !pub_point || !EC_POINT_mul(group, pub_point, priv_bn, NULL, NULL, NULL)) {
+        EC_POINT_free(pub_point);
+        BN_clear_free(priv_bn);
+        return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to compute public key");
+    }
+    
+    size_t pub_len = EC_POINT_point2oct(group, pub_point,
+                                       POINT_CONVERSION_COMPRESSED,
+                                       public_key, 33, NULL);
+    
+    EC_POINT_free(pub_point);
+    BN_clear_free(priv_bn);
+    
+    if (pub_len != 33) {
+        return neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid public key length");
+    }
+    return NEOC_SUCCESS;
+}
+
 // Helper function to compute HMAC-SHA512
 static int hmac_sha512(const uint8_t *key, size_t key_len,
                         const uint8_t *data, size_t data_len,
@@ -85,214 +124,523 @@ neoc_error_t neoc_bip32_from_seed_alloc(const uint8_t *seed,
     return err;
 }
 
-neoc_error_t neoc_bip32_derive_child(const neoc_bip32_key_t *parent,
-                                      uint32_t index,
-                                      neoc_bip32_key_t *child) {
-    if (!parent || !child) {
-        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+// Fingerprint = first 4 bytes of HASH160(public_key)
+static neoc_error_t bip32_fingerprint_from_public(const uint8_t public_key[33],
+                                                 uint8_t fingerprint[BIP32_FINGERPRINT_SIZE]) {
+    neoc_hash160_t hash;
+    neoc_error_t err = neoc_hash160_from_data(&hash, public_key, 33);
+    if (err != NEOC_SUCCESS) {
+        return err;
     }
     
-    uint8_t data[37];
-    uint8_t hmac_result[64];
-    
-    // Check if hardened derivation
-    bool hardened = (index & BIP32_HARDENED_KEY_START) != 0;
-    
-    if (hardened && !parent->is_private) {
-        return neoc_error_set(NEOC_ERROR_INVALID_STATE, 
-                            "Cannot derive hardened child from public key");
+    memcpy(fingerprint, hash.data, BIP32_FINGERPRINT_SIZE);
+    return NEOC_SUCCESS;
+}
+
+/*
+ * Everything about a parent that its children reuse: the compressed public
+ * key (hashed into non-hardened children), the fingerprint stamped on each
+ * child, SHA-512 states already keyed with the chain code and, for public
+ * parents, the decoded point.
+ */
+typedef struct {
+    neoc_bip32_key_t key;
+    uint8_t public_key[33];
+    uint8_t fingerprint[BIP32_FINGERPRINT_SIZE];
+    bool has_fingerprint;
+    EVP_MD_CTX *hmac_inner;   // After absorbing chain_code ^ ipad
+    EVP_MD_CTX *hmac_outer;   // After absorbing chain_code ^ opad
+    EC_POINT *point;
+} bip32_node_t;
+
+// Per-thread working state for bip32_derive_from_node
+typedef struct {
+    BN_CTX *bn_ctx;
+    EVP_MD_CTX *md_ctx;
+} bip32_scratch_t;
+
+static neoc_error_t bip32_scratch_init(bip32_scratch_t *scratch) {
+    scratch->bn_ctx = BN_CTX_new();
+    scratch->md_ctx = EVP_MD_CTX_new();
+    if (!scratch->bn_ctx || !scratch->md_ctx) {
+        BN_CTX_free(scratch->bn_ctx);
+        EVP_MD_CTX_free(scratch->md_ctx);
+        memset(scratch, 0, sizeof(*scratch));
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate derivation state");
     }
-    
-    // Prepare data for HMAC
-    if (hardened) {
-        // Hardened: 0x00 || private_key || index
-        memcpy(data, parent->key, 33);
-    } else {
-        // Non-hardened: public_key || index
-        if (parent->is_private) {
-            // Derive public key from private key
-            EC_KEY *ec_key = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
-            if (!ec_key) {
-                return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create EC key");
-            }
-            
-            BIGNUM *priv_bn = BN_bin2bn(&parent->key[1], 32, NULL);
-            if (!priv_bn || !EC_KEY_set_private_key(ec_key, priv_bn)) {
-                BN_free(priv_bn);
-                EC_KEY_free(ec_key);
-                return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to set private key");
-            }
-            
-            const EC_GROUP *group = EC_KEY_get0_group(ec_key);
-            EC_POINT *pub_point = EC_POINT_new(group);
-            if (!pub_point || !EC_POINT_mul(group, pub_point, priv_bn, NULL, NULL, NULL)) {
-                EC_POINT_free(pub_point);
-                BN_free(priv_bn);
-                EC_KEY_free(ec_key);
-                return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to compute public key");
-            }
-            
-            size_t pub_len = EC_POINT_point2oct(group, pub_point,
-                                               POINT_CONVERSION_COMPRESSED,
-                                               data, 33, NULL);
-            
-            EC_POINT_free(pub_point);
-            BN_free(priv_bn);
-            EC_KEY_free(ec_key);
-            
-            if (pub_len != 33) {
-                return neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid public key length");
-            }
-        } else {
-            memcpy(data, parent->key, 33);
+    return NEOC_SUCCESS;
+}
+
+static void bip32_scratch_free(bip32_scratch_t *scratch) {
+    BN_CTX_free(scratch->bn_ctx);
+    EVP_MD_CTX_free(scratch->md_ctx);
+    memset(scratch, 0, sizeof(*scratch));
+}
+
+static void bip32_node_release(bip32_node_t *node) {
+    EVP_MD_CTX_free(node->hmac_inner);
+    EVP_MD_CTX_free(node->hmac_outer);
+    EC_POINT_free(node->point);
+    neoc_secure_memzero(node, sizeof(*node));
+}
+
+/*
+ * Keys the node's HMAC-SHA512 once. Siblings share the parent chain code
+ * as HMAC key, so each child then costs only the inner and outer hashes of
+ * its own data instead of a full one-shot HMAC.
+ */
+static neoc_error_t bip32_node_prepare_hmac(bip32_node_t *node) {
+    uint8_t pad[BIP32_HMAC_BLOCK_SIZE];
+    node->hmac_inner = EVP_MD_CTX_new();
+    node->hmac_outer = EVP_MD_CTX_new();
+    if (!node->hmac_inner || !node->hmac_outer) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate HMAC state");
+    }
+
+    bool ok = true;
+    for (size_t pass = 0; pass < 2 && ok; pass++) {
+        uint8_t mask = pass == 0 ? 0x36 : 0x5c;
+        EVP_MD_CTX *md = pass == 0 ? node->hmac_inner : node->hmac_outer;
+        memset(pad, mask, sizeof(pad));
+        for (size_t i = 0; i < BIP32_CHAIN_CODE_SIZE; i++) {
+            pad[i] ^= node->key.chain_code[i];
         }
+        ok = EVP_DigestInit_ex(md, EVP_sha512(), NULL) == 1 &&
+             EVP_DigestUpdate(md, pad, sizeof(pad)) == 1;
     }
-    
-    // Append index (big-endian)
+    neoc_secure_memzero(pad, sizeof(pad));
+    return ok ? NEOC_SUCCESS : neoc_error_set(NEOC_ERROR_CRYPTO, "HMAC-SHA512 failed");
+}
+
+static int bip32_node_hmac(const bip32_node_t *node, EVP_MD_CTX *md,
+                           const uint8_t data[37], uint8_t output[64]) {
+    unsigned int out_len = 0;
+    if (EVP_MD_CTX_copy_ex(md, node->hmac_inner) != 1 ||
+        EVP_DigestUpdate(md, data, 37) != 1 ||
+        EVP_DigestFinal_ex(md, output, &out_len) != 1 ||
+        EVP_MD_CTX_copy_ex(md, node->hmac_outer) != 1 ||
+        EVP_DigestUpdate(md, output, out_len) != 1 ||
+        EVP_DigestFinal_ex(md, output, &out_len) != 1) {
+        return -1;
+    }
+    return out_len == 64 ? 0 : -1;
+}
+
+/* need_public can be false only when every child will be hardened and depth is 0 */
+static neoc_error_t bip32_node_prepare(bip32_node_t *node,
+                                       const neoc_bip32_key_t *key,
+                                       bool need_public) {
+    memset(node, 0, sizeof(*node));
+    node->key = *key;
+    if (!key->is_private) {
+        const EC_GROUP *group = neoc_ec_secp256r1_group();
+        node->point = group ? EC_POINT_new(group) : NULL;
+        if (!node->point ||
+            EC_POINT_oct2point(group, node->point, key->key, 33, NULL) != 1) {
+            bip32_node_release(node);
+            return neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid parent public key");
+        }
+        memcpy(node->public_key, key->key, 33);
+    } else if (need_public || key->depth > 0) {
+        neoc_error_t err = bip32_public_from_private(&key->key[1], node->public_key);
+        if (err != NEOC_SUCCESS) {
+            bip32_node_release(node);
+            return err;
+        }
+    }
+
+    // As before, children keep the inherited bytes when this fails
+    node->has_fingerprint = key->depth > 0 &&
+        bip32_fingerprint_from_public(node->public_key, node->fingerprint) == NEOC_SUCCESS;
+
+    neoc_error_t err = bip32_node_prepare_hmac(node);
+    if (err != NEOC_SUCCESS) {
+        bip32_node_release(node);
+    }
+    return err;
+}
+
+/*
+ * Derives one child of a prepared node. A private child costs one
+ * HMAC-SHA512 and a modular addition; a public child adds IL*G + P. The
+ * node is only read, so threads may share it as long as each brings its
+ * own scratch state.
+ */
+static neoc_error_t bip32_derive_from_node(const bip32_node_t *node,
+                                           uint32_t index,
+                                           neoc_bip32_key_t *child,
+                                           bip32_scratch_t *scratch) {
+    const neoc_bip32_key_t *parent = &node->key;
+    bool hardened = (index & BIP32_HARDENED_KEY_START) != 0;
+    if (hardened && !parent->is_private) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE,
+                              "Cannot derive hardened child from public key");
+    }
+
+    // Hardened: 0x00 || private_key || index, otherwise public_key || index
+    uint8_t data[37];
+    uint8_t hmac_result[64];
+    memcpy(data, hardened ? parent->key : node->public_key, 33);
     data[33] = (index >> 24) & 0xFF;
     data[34] = (index >> 16) & 0xFF;
     data[35] = (index >> 8) & 0xFF;
     data[36] = index & 0xFF;
-    
-    // Compute HMAC-SHA512
-    if (hmac_sha512(parent->chain_code, 32, data, 37, hmac_result) != 0) {
+
+    if (bip32_node_hmac(node, scratch->md_ctx, data, hmac_result) != 0) {
+        neoc_secure_memzero(data, sizeof(data));
         return neoc_error_set(NEOC_ERROR_CRYPTO, "HMAC-SHA512 failed");
     }
-    
-    // Initialize child key
-    memcpy(child, parent, sizeof(neoc_bip32_key_t));
-    child->depth = parent->depth + 1;
-    child->child_number = index;
-    
-    // Get parent fingerprint
-    if (parent->depth > 0) {
-        neoc_bip32_get_fingerprint(parent, child->parent_fingerprint);
+    neoc_secure_memzero(data, sizeof(data));
+
+    const EC_GROUP *group = neoc_ec_secp256r1_group();
+    if (!group) {
+        neoc_secure_memzero(hmac_result, sizeof(hmac_result));
+        return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create EC group");
     }
-    
-    // Derive child private key
-    if (parent->is_private) {
-        // Add parent private key to IL (mod n)
-        EC_GROUP *group = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
-        BIGNUM *order = BN_new();
-        BIGNUM *parent_key = BN_bin2bn(&parent->key[1], 32, NULL);
-        BIGNUM *il = BN_bin2bn(hmac_result, 32, NULL);
-        BIGNUM *child_key = BN_new();
-        BN_CTX *ctx = BN_CTX_new();
-        
-        EC_GROUP_get_order(group, order, ctx);
-        BN_mod_add(child_key, parent_key, il, order, ctx);
-        
-        // Check if result is valid
-        if (BN_is_zero(child_key) || BN_cmp(child_key, order) >= 0) {
-            BN_CTX_free(ctx);
-            BN_free(child_key);
-            BN_free(il);
-            BN_free(parent_key);
-            BN_free(order);
-            EC_GROUP_free(group);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid child key");
+    const BIGNUM *order = EC_GROUP_get0_order(group);
+
+    neoc_bip32_key_t derived = *parent;
+    derived.depth = parent->depth + 1;
+    derived.child_number = index;
+    if (node->has_fingerprint) {
+        memcpy(derived.parent_fingerprint, node->fingerprint, BIP32_FINGERPRINT_SIZE);
+    }
+
+    neoc_error_t err = NEOC_SUCCESS;
+    BN_CTX *ctx = scratch->bn_ctx;
+    BN_CTX_start(ctx);
+    BIGNUM *il = BN_CTX_get(ctx);
+    BIGNUM *value = BN_CTX_get(ctx);
+    if (!value || !BN_bin2bn(hmac_result, 32, il)) {
+        err = neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate BIGNUM");
+    } else if (BN_cmp(il, order) >= 0) {
+        err = neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid child key");
+    } else if (parent->is_private) {
+        // Child private key = IL + parent key (mod n)
+        if (!BN_bin2bn(&parent->key[1], 32, value) ||
+            !BN_mod_add(value, value, il, order, ctx) ||
+            BN_is_zero(value) ||
+            BN_bn2binpad(value, &derived.key[1], 32) != 32) {
+            err = neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid child key");
         }
-        
-        // Store child private key
-        child->key[0] = 0x00;
-        BN_bn2binpad(child_key, &child->key[1], 32);
-        child->is_private = true;
-        
-        BN_CTX_free(ctx);
-        BN_free(child_key);
-        BN_free(il);
-        BN_free(parent_key);
-        BN_free(order);
-        EC_GROUP_free(group);
+        derived.key[0] = 0x00;
+        BN_clear(value);
     } else {
-        // Derive child public key (point addition)
-        EC_GROUP *group = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
-        if (!group) {
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create EC group");
+        // Child public key = IL*G + parent point; a generator-only mul keeps
+        // OpenSSL on its precomputed fixed-base path
+        EC_POINT *point = EC_POINT_new(group);
+        if (!point ||
+            EC_POINT_mul(group, point, il, NULL, NULL, ctx) != 1 ||
+            EC_POINT_add(group, point, point, node->point, ctx) != 1 ||
+            EC_POINT_is_at_infinity(group, point) ||
+            EC_POINT_point2oct(group, point, POINT_CONVERSION_COMPRESSED,
+                               derived.key, 33, ctx) != 33) {
+            err = neoc_error_set(NEOC_ERROR_CRYPTO, "Point derivation failed");
         }
-        BIGNUM *il = BN_bin2bn(hmac_result, 32, NULL);
-        EC_POINT *parent_point = EC_POINT_new(group);
-        EC_POINT *child_point = EC_POINT_new(group);
-        EC_POINT *generator_point = EC_POINT_new(group);
-        BN_CTX *ctx = BN_CTX_new();
-        
-        // Get parent public key point
-        if (EC_POINT_oct2point(group, parent_point, &parent->key[0], 33, ctx) != 1) {
-            EC_POINT_free(parent_point);
-            EC_POINT_free(child_point);
-            EC_POINT_free(generator_point);
-            BN_CTX_free(ctx);
-            BN_free(il);
-            EC_GROUP_free(group);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid parent public key");
+        EC_POINT_free(point);
+    }
+    BN_clear(il);
+    BN_CTX_end(ctx);
+
+    if (err == NEOC_SUCCESS) {
+        memcpy(derived.chain_code, &hmac_result[32], 32);
+        *child = derived;
+    }
+    neoc_secure_memzero(&derived, sizeof(derived));
+    neoc_secure_memzero(hmac_result, sizeof(hmac_result));
+    return err;
+}
+
+neoc_error_t neoc_bip32_derive_child(const neoc_bip32_key_t *parent,
+                                      uint32_t index,
+                                      neoc_bip32_key_t *child) {
+    if (!parent || !child) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    bool hardened = (index & BIP32_HARDENED_KEY_START) != 0;
+    if (hardened && !parent->is_private) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, 
+                            "Cannot derive hardened child from public key");
+    }
+
+    bip32_node_t node;
+    neoc_error_t err = bip32_node_prepare(&node, parent, !hardened);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    bip32_scratch_t scratch;
+    err = bip32_scratch_init(&scratch);
+    if (err == NEOC_SUCCESS) {
+        err = bip32_derive_from_node(&node, index, child, &scratch);
+        bip32_scratch_free(&scratch);
+    }
+    bip32_node_release(&node);
+    return err;
+}
+
+typedef struct {
+    const bip32_node_t *parent;
+    uint32_t start;
+    neoc_bip32_key_t *out_keys;
+} bip32_range_t;
+
+static neoc_error_t bip32_range_derive(size_t begin, size_t end, void *ctx) {
+    bip32_range_t *range = (bip32_range_t *)ctx;
+    bip32_scratch_t scratch;
+    neoc_error_t err = bip32_scratch_init(&scratch);
+    for (size_t i = begin; i < end && err == NEOC_SUCCESS; i++) {
+        err = bip32_derive_from_node(range->parent, range->start + (uint32_t)i,
+                                     &range->out_keys[i], &scratch);
+    }
+    bip32_scratch_free(&scratch);
+    return err;
+}
+
+static size_t bip32_range_thread_count(size_t count) {
+    size_t threads = neoc_parallel_cpu_count();
+    if (threads > BIP32_RANGE_MAX_THREADS) {
+        threads = BIP32_RANGE_MAX_THREADS;
+    }
+    size_t by_work = count / BIP32_RANGE_MIN_PER_THREAD;
+    if (threads > by_work) {
+        threads = by_work;
+    }
+    return threads > 0 ? threads : 1;
+}
+
+/* Validates the index range; need_public reports whether any child is non-hardened */
+static neoc_error_t bip32_range_check(const neoc_bip32_key_t *parent,
+                                      uint32_t start,
+                                      size_t count,
+                                      bool *need_public) {
+    if ((uint64_t)count - 1 > (uint64_t)UINT32_MAX - start) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Child index range overflows");
+    }
+    uint64_t last = (uint64_t)start + count - 1;
+    if (last >= BIP32_HARDENED_KEY_START && !parent->is_private) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE,
+                              "Cannot derive hardened child from public key");
+    }
+    *need_public = start < BIP32_HARDENED_KEY_START;
+    return NEOC_SUCCESS;
+}
+
+/*
+ * Derives siblings with the calling thread plus helper threads for large
+ * ranges. Thread creation failures only reduce parallelism.
+ */
+static neoc_error_t bip32_derive_range_from_node(const bip32_node_t *parent,
+                                                 uint32_t start,
+                                                 size_t count,
+                                                 neoc_bip32_key_t *out_keys) {
+    bip32_range_t range = { .parent = parent, .start = start, .out_keys = out_keys };
+    neoc_error_t err = neoc_parallel_for(count, bip32_range_thread_count(count), BIP32_RANGE_CHUNK,
+                                         bip32_range_derive, &range);
+    if (err != NEOC_SUCCESS) {
+        neoc_secure_memzero(out_keys, count * sizeof(neoc_bip32_key_t));
+        return neoc_error_set(err, "Failed to derive child key range");
+    }
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_bip32_derive_range(const neoc_bip32_key_t *parent,
+                                     uint32_t start,
+                                     size_t count,
+                                     neoc_bip32_key_t *out_keys) {
+    if (!parent || (!out_keys && count > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+
+    bool need_public = false;
+    neoc_error_t err = bip32_range_check(parent, start, count, &need_public);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    bip32_node_t node;
+    err = bip32_node_prepare(&node, parent, need_public);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    err = bip32_derive_range_from_node(&node, start, count, out_keys);
+    bip32_node_release(&node);
+    return err;
+}
+
+typedef struct {
+    bip32_node_t node;
+    size_t length;                          // Path length below the root, 0 when unused
+    uint32_t path[BIP32_MAX_PATH_DEPTH];
+    uint64_t last_used;
+} bip32_cache_entry_t;
+
+struct neoc_bip32_context {
+    bip32_node_t root;
+    bip32_cache_entry_t entries[BIP32_CONTEXT_CACHE_SIZE];
+    uint64_t clock;
+    bip32_scratch_t scratch;
+};
+
+neoc_error_t neoc_bip32_context_create(const neoc_bip32_key_t *root,
+                                       neoc_bip32_context_t **context) {
+    if (!root || !context) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *context = NULL;
+
+    neoc_bip32_context_t *ctx = neoc_calloc(1, sizeof(neoc_bip32_context_t));
+    if (!ctx) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate BIP-32 context");
+    }
+    neoc_error_t err = bip32_scratch_init(&ctx->scratch);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(ctx);
+        return err;
+    }
+    err = bip32_node_prepare(&ctx->root, root, true);
+    if (err != NEOC_SUCCESS) {
+        bip32_scratch_free(&ctx->scratch);
+        neoc_free(ctx);
+        return err;
+    }
+
+    *context = ctx;
+    return NEOC_SUCCESS;
+}
+
+void neoc_bip32_context_free(neoc_bip32_context_t *context) {
+    if (!context) {
+        return;
+    }
+    for (size_t i = 0; i < BIP32_CONTEXT_CACHE_SIZE; i++) {
+        bip32_node_release(&context->entries[i].node);
+    }
+    bip32_node_release(&context->root);
+    bip32_scratch_free(&context->scratch);
+    neoc_secure_memzero(context, sizeof(*context));
+    neoc_free(context);
+}
+
+/* Empty slot if there is one, otherwise the least recently used */
+static bip32_cache_entry_t *bip32_context_victim(neoc_bip32_context_t *context) {
+    bip32_cache_entry_t *victim = &context->entries[0];
+    for (size_t i = 0; i < BIP32_CONTEXT_CACHE_SIZE; i++) {
+        bip32_cache_entry_t *entry = &context->entries[i];
+        if (entry->length == 0) {
+            return entry;
         }
-        
-        // Get generator point and multiply by il
-        const EC_POINT *generator = EC_GROUP_get0_generator(group);
-        if (!generator) {
-            EC_POINT_free(parent_point);
-            EC_POINT_free(child_point);
-            EC_POINT_free(generator_point);
-            BN_CTX_free(ctx);
-            BN_free(il);
-            EC_GROUP_free(group);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Cannot get generator point");
+        if (entry->last_used < victim->last_used) {
+            victim = entry;
         }
+    }
+    bip32_node_release(&victim->node);
+    victim->length = 0;
+    return victim;
+}
 
-        EC_POINT_copy(generator_point, generator);
-        if (EC_POINT_mul(group, generator_point, il, NULL, NULL, ctx) != 1) {
-            EC_POINT_free(parent_point);
-            EC_POINT_free(child_point);
-            EC_POINT_free(generator_point);
-            BN_CTX_free(ctx);
-            BN_free(il);
-            EC_GROUP_free(group);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Point multiplication failed");
+/*
+ * Returns the prepared node at path, deriving from the longest cached
+ * prefix and caching every node it has to derive on the way.
+ */
+static neoc_error_t bip32_context_node(neoc_bip32_context_t *context,
+                                       const uint32_t *path,
+                                       size_t length,
+                                       const bip32_node_t **node) {
+    const bip32_node_t *best = &context->root;
+    size_t best_length = 0;
+    bip32_cache_entry_t *best_entry = NULL;
+    for (size_t i = 0; i < BIP32_CONTEXT_CACHE_SIZE; i++) {
+        bip32_cache_entry_t *entry = &context->entries[i];
+        if (entry->length > best_length && entry->length <= length &&
+            memcmp(entry->path, path, entry->length * sizeof(uint32_t)) == 0) {
+            best = &entry->node;
+            best_length = entry->length;
+            best_entry = entry;
         }
-        
-        // Add parent point to generator*il to get child point
-        if (EC_POINT_add(group, child_point, parent_point, generator_point, ctx) != 1) {
-            EC_POINT_free(parent_point);
-            EC_POINT_free(child_point);
-            EC_POINT_free(generator_point);
-            BN_CTX_free(ctx);
-            BN_free(il);
-            EC_GROUP_free(group);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Point addition failed");
+    }
+    if (best_entry) {
+        best_entry->last_used = ++context->clock;
+    }
+
+    neoc_bip32_key_t key;
+    for (size_t depth = best_length; depth < length; depth++) {
+        neoc_error_t err = bip32_derive_from_node(best, path[depth], &key, &context->scratch);
+        if (err != NEOC_SUCCESS) {
+            neoc_secure_memzero(&key, sizeof(key));
+            return err;
         }
-        
-        // Convert child point back to compressed public key
-        if (EC_POINT_point2oct(group, child_point, POINT_CONVERSION_COMPRESSED,
-                              child->key, 33, ctx) != 33) {
-            EC_POINT_free(parent_point);
-            EC_POINT_free(child_point);
-            EC_POINT_free(generator_point);
-            BN_CTX_free(ctx);
-            BN_free(il);
-            EC_GROUP_free(group);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Point to octets conversion failed");
+        // The victim is never best: best was used last
+        bip32_cache_entry_t *entry = bip32_context_victim(context);
+        err = bip32_node_prepare(&entry->node, &key, true);
+        neoc_secure_memzero(&key, sizeof(key));
+        if (err != NEOC_SUCCESS) {
+            return err;
         }
-        
-        child->is_private = false;
-        
-        EC_POINT_free(parent_point);
-        EC_POINT_free(child_point);
-        EC_POINT_free(generator_point);
-        BN_CTX_free(ctx);
-        BN_free(il);
-        EC_GROUP_free(group);
+        entry->length = depth + 1;
+        memcpy(entry->path, path, entry->length * sizeof(uint32_t));
+        entry->last_used = ++context->clock;
+        best = &entry->node;
     }
-    
-    // Set child chain code
-    memcpy(child->chain_code, &hmac_result[32], 32);
-    
-    // Clear sensitive data
-    neoc_secure_memzero(hmac_result, sizeof(hmac_result));
-    neoc_secure_memzero(data, sizeof(data));
-    
+
+    *node = best;
     return NEOC_SUCCESS;
 }
 
+neoc_error_t neoc_bip32_context_derive(neoc_bip32_context_t *context,
+                                       const uint32_t *indices,
+                                       size_t indices_count,
+                                       neoc_bip32_key_t *derived) {
+    if (!context || (!indices && indices_count > 0) || !derived) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (indices_count > BIP32_MAX_PATH_DEPTH) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Derivation path too deep");
+    }
+    if (indices_count == 0) {
+        *derived = context->root.key;
+        return NEOC_SUCCESS;
+    }
+
+    const bip32_node_t *parent = NULL;
+    neoc_error_t err = bip32_context_node(context, indices, indices_count - 1, &parent);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    return bip32_derive_from_node(parent, indices[indices_count - 1], derived, &context->scratch);
+}
+
+neoc_error_t neoc_bip32_context_derive_range(neoc_bip32_context_t *context,
+                                             const uint32_t *parent_indices,
+                                             size_t parent_depth,
+                                             uint32_t start,
+                                             size_t count,
+                                             neoc_bip32_key_t *out_keys) {
+    if (!context || (!parent_indices && parent_depth > 0) || (!out_keys && count > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (parent_depth >= BIP32_MAX_PATH_DEPTH) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Derivation path too deep");
+    }
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+
+    const bip32_node_t *parent = NULL;
+    bool need_public = false;
+    neoc_error_t err = bip32_context_node(context, parent_indices, parent_depth, &parent);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    err = bip32_range_check(&parent->key, start, count, &need_public);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    return bip32_derive_range_from_node(parent, start, count, out_keys);
+}
+
 neoc_error_t neoc_bip32_derive_path_raw(const neoc_bip32_key_t *master,
                                         const char *path,
                                         neoc_bip32_key_t *derived) {
@@ -300,10 +648,10 @@ neoc_error_t neoc_bip32_derive_path_raw(const neoc_bip32_key_t *master,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    uint32_t indices[32];
+    uint32_t indices[BIP32_MAX_PATH_DEPTH];
     size_t indices_count;
     
-    neoc_error_t err = neoc_bip32_parse_path(path, indices, 32, &indices_count);
+    neoc_error_t err = neoc_bip32_parse_path(path, indices, BIP32_MAX_PATH_DEPTH, &indices_count);
     if (err != NEOC_SUCCESS) {
         return err;
     }
@@ -364,37 +712,9 @@ neoc_error_t neoc_bip32_get_public_key(const neoc_bip32_key_t *key,
     
     if (key->is_private) {
         // Convert private to public
-        EC_KEY *ec_key = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
-        if (!ec_key) {
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create EC key");
-        }
-        
-        BIGNUM *priv_bn = BN_bin2bn(&key->key[1], 32, NULL);
-        if (!priv_bn || !EC_KEY_set_private_key(ec_key, priv_bn)) {
-            BN_free(priv_bn);
-            EC_KEY_free(ec_key);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to set private key");
-        }
-        
-        const EC_GROUP *group = EC_KEY_get0_group(ec_key);
-        EC_POINT *pub_point = EC_POINT_new(group);
-        if (!pub_point || !EC_POINT_mul(group, pub_point, priv_bn, NULL, NULL, NULL)) {
-            EC_POINT_free(pub_point);
-            BN_free(priv_bn);
-            EC_KEY_free(ec_key);
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to compute public key");
-        }
-        
-        size_t pub_len = EC_POINT_point2oct(group, pub_point,
-                                           POINT_CONVERSION_COMPRESSED,
-                                           public_key->key, 33, NULL);
-        
-        EC_POINT_free(pub_point);
-        BN_free(priv_bn);
-        EC_KEY_free(ec_key);
-        
-        if (pub_len != 33) {
-            return neoc_error_set(NEOC_ERROR_CRYPTO, "Invalid public key length");
+        neoc_error_t err = bip32_public_from_private(&key->key[1], public_key->key);
+        if (err != NEOC_SUCCESS) {
+            return err;
         }
         
         // Update version to public
@@ -460,15 +780,7 @@ neoc_error_t neoc_bip32_get_fingerprint(const neoc_bip32_key_t *key,
         memcpy(public_key, key->key, 33);
     }
     
-    // Fingerprint = first 4 bytes of HASH160(public_key)
-    neoc_hash160_t hash;
-    neoc_error_t err = neoc_hash160_from_data(&hash, public_key, 33);
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
-    
-    memcpy(fingerprint, hash.data, BIP32_FINGERPRINT_SIZE);
-    return NEOC_SUCCESS;
+    return bip32_fingerprint_from_public(public_key, fingerprint);
 }
 
 neoc_error_t neoc_bip32_parse_path(const char *path,
@@ -6,13 +6,24 @@
 #include "neoc/crypto/bip39.h"
 #include "neoc/crypto/sha256.h"
 #include "neoc/neoc_memory.h"
+#include "neoc/utils/neoc_parallel.h"
 #ifdef neoc_bip39_mnemonic_to_seed
 #undef neoc_bip39_mnemonic_to_seed
 #endif
 #include <string.h>
 #include <stdlib.h>
+#include <pthread.h>
 #include <openssl/rand.h>
 #include <openssl/evp.h>
+#include <openssl/sha.h>
+
+#define BIP39_WORDLIST_SIZE 2048
+#define BIP39_MAX_WORDS 24
+#define BIP39_PBKDF2_ROUNDS 2048
+
+// Word index slots: a power of two, twice the wordlist size
+#define BIP39_INDEX_SLOTS 4096u
+#define BIP39_INDEX_SHIFT 20
 
 // Complete BIP-39 English wordlist (2048 words)
 static const char* const bip39_wordlist_en[] = {
@@ -315,35 +326,80 @@ const char* neoc_bip39_get_word(neoc_bip39_language_t language, uint16_t index)
     return wordlist[index];
 }
 
+/*
+ * Open-addressing table keyed by the first four bytes of each word, built
+ * once per wordlist. BIP-39 lists are chosen so that four letters identify
+ * a word, so a lookup almost always settles on its first probe; the full
+ * word is still compared before a match is returned.
+ */
+typedef struct {
+    const char *const *words;
+    uint16_t slots[BIP39_INDEX_SLOTS];       // Word index + 1, 0 when empty
+    uint8_t lengths[BIP39_WORDLIST_SIZE];
+} bip39_word_index_t;
+
+static bip39_word_index_t bip39_index_en;
+static pthread_once_t bip39_index_en_once = PTHREAD_ONCE_INIT;
+
+static size_t bip39_index_slot(const char *word, size_t len) {
+    uint32_t key = 0;
+    for (size_t i = 0; i < 4; i++) {
+        key = (key << 8) | (i < len ? (uint8_t)word[i] : 0);
+    }
+    return (size_t)((key * 2654435761u) >> BIP39_INDEX_SHIFT);
+}
+
+static void bip39_build_index(bip39_word_index_t *index, const char *const *words) {
+    index->words = words;
+    for (uint16_t i = 0; i < BIP39_WORDLIST_SIZE; i++) {
+        size_t len = strlen(words[i]);
+        size_t slot = bip39_index_slot(words[i], len);
+        while (index->slots[slot] != 0) {
+            slot = (slot + 1) & (BIP39_INDEX_SLOTS - 1);
+        }
+        index->slots[slot] = (uint16_t)(i + 1);
+        index->lengths[i] = (uint8_t)len;
+    }
+}
+
+static void bip39_build_index_en(void) {
+    bip39_build_index(&bip39_index_en, bip39_wordlist_en);
+}
+
+static const bip39_word_index_t *bip39_get_index(neoc_bip39_language_t language) {
+    const char *const *words = neoc_bip39_get_wordlist(language);
+    if (words != bip39_wordlist_en) {
+        return NULL;
+    }
+    pthread_once(&bip39_index_en_once, bip39_build_index_en);
+    return &bip39_index_en;
+}
+
+// Index of the len-byte word at word, or -1; word need not be terminated
+static int bip39_index_lookup(const bip39_word_index_t *index, const char *word, size_t len) {
+    size_t slot = bip39_index_slot(word, len);
+    for (uint16_t entry = index->slots[slot]; entry != 0; entry = index->slots[slot]) {
+        uint16_t i = (uint16_t)(entry - 1);
+        if (index->lengths[i] == len && memcmp(index->words[i], word, len) == 0) {
+            return i;
+        }
+        slot = (slot + 1) & (BIP39_INDEX_SLOTS - 1);
+    }
+    return -1;
+}
+
 // Find word index in wordlist
 int neoc_bip39_find_word(neoc_bip39_language_t language, const char *word) {
     if (!word) {
         return -1;
     }
     
-    const char* const* wordlist = neoc_bip39_get_wordlist(language);
-    if (!wordlist) {
+    const bip39_word_index_t *index = bip39_get_index(language);
+    if (!index) {
         return -1;
     }
     
-    // Binary search since wordlist is sorted
-    int left = 0;
-    int right = 2047;
-    
-    while (left <= right) {
-        int mid = left + (right - left) / 2;
-        int cmp = strcmp(word, wordlist[mid]);
-        
-        if (cmp == 0) {
-            return mid;
-        } else if (cmp < 0) {
-            right = mid - 1;
-        } else {
-            left = mid + 1;
-        }
-    }
-    
-    return -1;
+    return bip39_index_lookup(index, word, strlen(word));
 }
 
 // Get word count for entropy strength
@@ -497,117 +553,126 @@ neoc_error_t neoc_bip39_mnemonic_from_entropy(const uint8_t *entropy,
     return NEOC_SUCCESS;
 }
 
-// Convert mnemonic to entropy
-neoc_error_t neoc_bip39_mnemonic_to_entropy(const char *mnemonic,
-                                             neoc_bip39_language_t language,
-                                             uint8_t **entropy,
-                                             size_t *entropy_len) {
-    if (!mnemonic || !entropy || !entropy_len) {
-        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
-    }
-
-    char *mnemonic_copy = neoc_strdup(mnemonic);
-    if (!mnemonic_copy) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate mnemonic copy");
-    }
-
-    char *words[24];
-    int word_count = 0;
-    char *token = strtok(mnemonic_copy, " ");
-    while (token != NULL && word_count < 24) {
-        words[word_count++] = token;
-        token = strtok(NULL, " ");
+/*
+ * Decodes a mnemonic into entropy and checks its checksum without
+ * allocating: words are split on spaces in place and looked up in the word
+ * index, and their 11-bit indices are packed straight into a stack buffer.
+ */
+static neoc_error_t bip39_decode_mnemonic(const char *mnemonic,
+                                          neoc_bip39_language_t language,
+                                          uint8_t entropy[32],
+                                          size_t *entropy_len) {
+    const char *words[BIP39_MAX_WORDS];
+    size_t lengths[BIP39_MAX_WORDS];
+    size_t word_count = 0;
+    const char *p = mnemonic;
+    for (;;) {
+        while (*p == ' ') {
+            p++;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        if (word_count == BIP39_MAX_WORDS) {
+            return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid word count");
+        }
+        words[word_count] = p;
+        while (*p != ' ' && *p != '\0') {
+            p++;
+        }
+        lengths[word_count] = (size_t)(p - words[word_count]);
+        word_count++;
     }
 
-    if (token != NULL ||
-        (word_count != 12 && word_count != 15 && word_count != 18 &&
-         word_count != 21 && word_count != 24)) {
-        neoc_free(mnemonic_copy);
+    if (word_count != 12 && word_count != 15 && word_count != 18 &&
+        word_count != 21 && word_count != 24) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid word count");
     }
 
-    size_t total_bits = (size_t)word_count * 11;
-    size_t checksum_bits = total_bits / 33;
-    size_t entropy_bits = total_bits - checksum_bits;
-
-    if (entropy_bits % 8 != 0) {
-        neoc_free(mnemonic_copy);
-        return neoc_error_set(NEOC_ERROR_INTERNAL, "Invalid entropy bit length");
-    }
-
-    size_t total_bytes = (total_bits + 7) / 8;
-    size_t entropy_bytes = entropy_bits / 8;
-
-    uint8_t *bitstream = neoc_calloc(total_bytes, 1);
-    if (!bitstream) {
-        neoc_free(mnemonic_copy);
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate bitstream");
-    }
-
-    size_t bit_position = 0;
-    for (int i = 0; i < word_count; ++i) {
-        int index = neoc_bip39_find_word(language, words[i]);
-        if (index < 0) {
-            neoc_free(bitstream);
-            neoc_free(mnemonic_copy);
+    const bip39_word_index_t *index = bip39_get_index(language);
+    uint8_t bits[BIP39_MAX_WORDS * 11 / 8] = {0};
+    size_t out = 0;
+    uint32_t acc = 0;
+    unsigned acc_bits = 0;
+    for (size_t i = 0; i < word_count; ++i) {
+        int word_index = index ? bip39_index_lookup(index, words[i], lengths[i]) : -1;
+        if (word_index < 0) {
+            neoc_secure_memzero(bits, sizeof(bits));
             return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid word in mnemonic");
         }
-
-        for (int bit = 10; bit >= 0; --bit, ++bit_position) {
-            if (((uint32_t)index >> bit) & 0x01U) {
-                size_t byte_index = bit_position / 8;
-                int bit_offset = 7 - (int)(bit_position % 8);
-                bitstream[byte_index] |= (uint8_t)(1U << bit_offset);
-            }
+        acc = (acc << 11) | (uint32_t)word_index;
+        acc_bits += 11;
+        while (acc_bits >= 8) {
+            acc_bits -= 8;
+            bits[out++] = (uint8_t)(acc >> acc_bits);
         }
+        acc &= (1u << acc_bits) - 1;
     }
-
-    uint8_t *entropy_bytes_ptr = neoc_malloc(entropy_bytes);
-    if (!entropy_bytes_ptr) {
-        neoc_free(bitstream);
-        neoc_free(mnemonic_copy);
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate entropy buffer");
+    if (acc_bits > 0) {
+        bits[out] = (uint8_t)(acc << (8 - acc_bits));
     }
 
-    memcpy(entropy_bytes_ptr, bitstream, entropy_bytes);
-
-    uint8_t checksum_accum = 0;
-    for (size_t i = 0; i < checksum_bits; ++i) {
-        size_t pos = entropy_bits + i;
-        size_t byte_index = pos / 8;
-        int bit_offset = 7 - (int)(pos % 8);
-        uint8_t bit = (bitstream[byte_index] >> bit_offset) & 0x01U;
-        checksum_accum = (uint8_t)((checksum_accum << 1) | bit);
-    }
+    // The checksum (one bit per three words) follows the entropy bytes
+    size_t checksum_bits = word_count / 3;
+    size_t entropy_bytes = (word_count * 11 - checksum_bits) / 8;
+    uint8_t checksum = (uint8_t)(bits[entropy_bytes] >> (8 - checksum_bits));
 
     uint8_t hash[32];
-    neoc_error_t err = neoc_sha256(entropy_bytes_ptr, entropy_bytes, hash);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(entropy_bytes_ptr);
-        neoc_free(bitstream);
-        neoc_free(mnemonic_copy);
-        return err;
+    neoc_error_t err = neoc_sha256(bits, entropy_bytes, hash);
+    if (err == NEOC_SUCCESS && checksum != (uint8_t)(hash[0] >> (8 - checksum_bits))) {
+        err = neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid mnemonic checksum");
+    }
+    if (err == NEOC_SUCCESS) {
+        memcpy(entropy, bits, entropy_bytes);
+        *entropy_len = entropy_bytes;
     }
+    neoc_secure_memzero(bits, sizeof(bits));
+    neoc_secure_memzero(&acc, sizeof(acc));
+    return err;
+}
 
-    uint8_t expected_checksum = 0;
-    if (checksum_bits > 0) {
-        expected_checksum = (uint8_t)(hash[0] >> (8 - checksum_bits));
+// Convert mnemonic to entropy
+neoc_error_t neoc_bip39_mnemonic_to_entropy(const char *mnemonic,
+                                             neoc_bip39_language_t language,
+                                             uint8_t **entropy,
+                                             size_t *entropy_len) {
+    if (!mnemonic || !entropy || !entropy_len) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
 
-    neoc_free(bitstream);
-    neoc_free(mnemonic_copy);
+    uint8_t decoded[32];
+    size_t decoded_len = 0;
+    neoc_error_t err = bip39_decode_mnemonic(mnemonic, language, decoded, &decoded_len);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
 
-    if (checksum_accum != expected_checksum) {
-        neoc_free(entropy_bytes_ptr);
-        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid mnemonic checksum");
+    uint8_t *entropy_bytes_ptr = neoc_malloc(decoded_len);
+    if (!entropy_bytes_ptr) {
+        neoc_secure_memzero(decoded, sizeof(decoded));
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate entropy buffer");
     }
+    memcpy(entropy_bytes_ptr, decoded, decoded_len);
+    neoc_secure_memzero(decoded, sizeof(decoded));
 
     *entropy = entropy_bytes_ptr;
-    *entropy_len = entropy_bytes;
+    *entropy_len = decoded_len;
     return NEOC_SUCCESS;
 }
 
-// Generate seed from mnemonic
+static void bip39_store_be64(uint8_t *out, uint64_t value) {
+    for (int i = 7; i >= 0; i--) {
+        out[i] = (uint8_t)value;
+        value >>= 8;
+    }
+}
+
+/*
+ * PBKDF2-HMAC-SHA512 with salt "mnemonic" || passphrase. The HMAC pads are
+ * absorbed once; after the first round every round hashes a single
+ * pre-padded block, so it costs exactly two SHA-512 compressions and
+ * allocates nothing.
+ */
 static neoc_error_t neoc_bip39_pbkdf2(const char *mnemonic,
                                       const char *passphrase,
                                       uint8_t *seed,
@@ -616,32 +681,95 @@ static neoc_error_t neoc_bip39_pbkdf2(const char *mnemonic,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
 
-    const char *salt_prefix = "mnemonic";
-    size_t salt_len = strlen(salt_prefix);
+    static const char salt_prefix[] = "mnemonic";
+    size_t mnemonic_len = strlen(mnemonic);
     size_t pass_len = passphrase ? strlen(passphrase) : 0;
 
-    char *salt = neoc_malloc(salt_len + pass_len + 1);
-    if (!salt) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate salt");
-    }
-
-    memcpy(salt, salt_prefix, salt_len);
-    if (passphrase && pass_len > 0) {
-        memcpy(salt + salt_len, passphrase, pass_len);
-    }
-    salt[salt_len + pass_len] = '\0';
+    // HMAC keys longer than a block are hashed first
+    uint8_t key[SHA512_CBLOCK] = {0};
+    uint8_t pad[SHA512_CBLOCK];
+    SHA512_CTX inner, outer, work;
+    bool ok = true;
+    if (mnemonic_len > SHA512_CBLOCK) {
+        ok = SHA512((const unsigned char *)mnemonic, mnemonic_len, key) != NULL;
+    } else {
+        memcpy(key, mnemonic, mnemonic_len);
+    }
+    for (size_t i = 0; i < SHA512_CBLOCK; i++) {
+        pad[i] = key[i] ^ 0x36;
+    }
+    ok = ok && SHA512_Init(&inner) && SHA512_Update(&inner, pad, sizeof(pad));
+    for (size_t i = 0; i < SHA512_CBLOCK; i++) {
+        pad[i] = key[i] ^ 0x5c;
+    }
+    ok = ok && SHA512_Init(&outer) && SHA512_Update(&outer, pad, sizeof(pad));
+
+    // U || 0x80 || zeros || bit length of ipad/opad block plus U
+    uint8_t block[SHA512_CBLOCK];
+    uint8_t u[SHA512_DIGEST_LENGTH];
+    uint64_t acc[8];
+    size_t offset = 0;
+    for (uint32_t block_index = 1; ok && offset < seed_len; block_index++) {
+        const uint8_t counter[4] = {
+            (uint8_t)(block_index >> 24), (uint8_t)(block_index >> 16),
+            (uint8_t)(block_index >> 8), (uint8_t)block_index
+        };
+        work = inner;
+        ok = SHA512_Update(&work, salt_prefix, sizeof(salt_prefix) - 1) &&
+             SHA512_Update(&work, passphrase ? passphrase : "", pass_len) &&
+             SHA512_Update(&work, counter, sizeof(counter)) &&
+             SHA512_Final(u, &work);
+        work = outer;
+        ok = ok && SHA512_Update(&work, u, sizeof(u)) && SHA512_Final(u, &work);
+        if (!ok) {
+            break;
+        }
 
-    int result = PKCS5_PBKDF2_HMAC(
-        mnemonic, (int)strlen(mnemonic),
-        (unsigned char *)salt, (int)(salt_len + pass_len),
-        2048,
-        EVP_sha512(),
-        (int)seed_len,
-        seed);
+        memset(block, 0, sizeof(block));
+        memcpy(block, u, sizeof(u));
+        block[sizeof(u)] = 0x80;
+        bip39_store_be64(block + SHA512_CBLOCK - 8, (uint64_t)(SHA512_CBLOCK + sizeof(u)) * 8);
+        for (size_t j = 0; j < 8; j++) {
+            uint64_t value = 0;
+            for (size_t b = 0; b < 8; b++) {
+                value = (value << 8) | u[j * 8 + b];
+            }
+            acc[j] = value;
+        }
 
-    neoc_free(salt);
+        for (int round = 1; round < BIP39_PBKDF2_ROUNDS; round++) {
+            work = inner;
+            SHA512_Transform(&work, block);
+            for (size_t j = 0; j < 8; j++) {
+                bip39_store_be64(block + 8 * j, work.h[j]);
+            }
+            work = outer;
+            SHA512_Transform(&work, block);
+            for (size_t j = 0; j < 8; j++) {
+                acc[j] ^= work.h[j];
+                bip39_store_be64(block + 8 * j, work.h[j]);
+            }
+        }
 
-    if (result != 1) {
+        for (size_t j = 0; j < 8; j++) {
+            bip39_store_be64(u + 8 * j, acc[j]);
+        }
+        size_t take = seed_len - offset < sizeof(u) ? seed_len - offset : sizeof(u);
+        memcpy(seed + offset, u, take);
+        offset += take;
+    }
+
+    neoc_secure_memzero(key, sizeof(key));
+    neoc_secure_memzero(pad, sizeof(pad));
+    neoc_secure_memzero(block, sizeof(block));
+    neoc_secure_memzero(u, sizeof(u));
+    neoc_secure_memzero(acc, sizeof(acc));
+    neoc_secure_memzero(&inner, sizeof(inner));
+    neoc_secure_memzero(&outer, sizeof(outer));
+    neoc_secure_memzero(&work, sizeof(work));
+
+    if (!ok) {
+        neoc_secure_memzero(seed, seed_len);
         return neoc_error_set(NEOC_ERROR_CRYPTO, "PBKDF2 failed");
     }
 
@@ -665,6 +793,51 @@ neoc_error_t neoc_bip39_mnemonic_to_seed_len(const char *mnemonic,
     return neoc_bip39_pbkdf2(mnemonic, passphrase, seed, seed_len);
 }
 
+typedef struct {
+    const char *const *mnemonics;
+    const char *const *passphrases;
+    uint8_t *seeds;
+    neoc_error_t *results;
+} bip39_seed_batch_t;
+
+/* Mnemonics are taken one at a time: each one is a full PBKDF2 run */
+static neoc_error_t bip39_seed_batch_derive(size_t begin, size_t end, void *ctx) {
+    bip39_seed_batch_t *batch = (bip39_seed_batch_t *)ctx;
+    for (size_t i = begin; i < end; i++) {
+        const char *passphrase = batch->passphrases ? batch->passphrases[i] : NULL;
+        uint8_t *seed = batch->seeds + 64 * i;
+        batch->results[i] = neoc_bip39_pbkdf2(batch->mnemonics[i], passphrase, seed, 64);
+        if (batch->results[i] != NEOC_SUCCESS) {
+            neoc_secure_memzero(seed, 64);
+        }
+    }
+    /* Failures are per mnemonic, reported through results */
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_bip39_mnemonic_to_seed_batch(const char *const *mnemonics,
+                                               const char *const *passphrases,
+                                               size_t count,
+                                               size_t threads,
+                                               uint8_t *seeds,
+                                               neoc_error_t *results) {
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+    if (!mnemonics || !seeds || !results) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    bip39_seed_batch_t batch = {
+        .mnemonics = mnemonics,
+        .passphrases = passphrases,
+        .seeds = seeds,
+        .results = results
+    };
+    neoc_parallel_for(count, threads, 1, bip39_seed_batch_derive, &batch);
+    return NEOC_SUCCESS;
+}
+
 // Validate mnemonic
 bool neoc_bip39_validate_mnemonic(const char *mnemonic,
                                    neoc_bip39_language_t language) {
@@ -672,17 +845,9 @@ bool neoc_bip39_validate_mnemonic(const char *mnemonic,
         return false;
     }
     
-    // Try to convert to entropy - if successful, mnemonic is valid
-    uint8_t *entropy = NULL;
+    uint8_t entropy[32];
     size_t entropy_len = 0;
-    
-    neoc_error_t err = neoc_bip39_mnemonic_to_entropy(mnemonic, language, 
-                                                       &entropy, &entropy_len);
-    
-    if (err == NEOC_SUCCESS && entropy) {
-        neoc_free(entropy);
-        return true;
-    }
-    
-    return false;
+    neoc_error_t err = bip39_decode_mnemonic(mnemonic, language, entropy, &entropy_len);
+    neoc_secure_memzero(entropy, sizeof(entropy));
+    return err == NEOC_SUCCESS;
 }
@@ -12,6 +12,7 @@
 #include <openssl/bn.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdatomic.h>
 
 // NEO uses secp256r1 (NIST P-256)
 #define SECP256R1_NID NID_X9_62_prime256v1
@@ -26,9 +27,30 @@ static void init_openssl(void) {
     }
 }
 
-// Create EC_GROUP for secp256r1
-static EC_GROUP* create_secp256r1_group(void) {
-    return EC_GROUP_new_by_curve_name(SECP256R1_NID);
+// Process-wide secp256r1 group, published once and never modified afterwards
+static _Atomic(EC_GROUP *) shared_secp256r1_group = NULL;
+
+const EC_GROUP *neoc_ec_secp256r1_group(void) {
+    EC_GROUP *group = atomic_load_explicit(&shared_secp256r1_group, memory_order_acquire);
+    if (group) {
+        return group;
+    }
+
+    EC_GROUP *created = EC_GROUP_new_by_curve_name(SECP256R1_NID);
+    if (!created) {
+        return NULL;
+    }
+    // Generator tables make every k*G (key derivation, signing) cheaper
+    EC_GROUP_precompute_mult(created, NULL);
+
+    // Racing initializers keep whichever group was published first
+    EC_GROUP *expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&shared_secp256r1_group, &expected, created,
+                                                 memory_order_acq_rel, memory_order_acquire)) {
+        EC_GROUP_free(created);
+        return expected;
+    }
+    return created;
 }
 
 // Alias for compatibility (old name)
@@ -76,9 +98,8 @@ neoc_error_t neoc_ec_key_pair_create_from_private_key(const uint8_t *private_key
         return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create EC_KEY");
     }
     
-    EC_GROUP *group = create_secp256r1_group();
+    const EC_GROUP *group = neoc_ec_secp256r1_group();
     if (!group || EC_KEY_set_group(ec_key, group) != 1) {
-        EC_GROUP_free(group);
         EC_KEY_free(ec_key);
         neoc_ec_key_pair_free(*key_pair);
         *key_pair = NULL;
@@ -89,7 +110,6 @@ neoc_error_t neoc_ec_key_pair_create_from_private_key(const uint8_t *private_key
     BIGNUM *priv_bn = BN_bin2bn(private_key_bytes, 32, NULL);
     if (!priv_bn || EC_KEY_set_private_key(ec_key, priv_bn) != 1) {
         BN_free(priv_bn);
-        EC_GROUP_free(group);
         EC_KEY_free(ec_key);
         neoc_ec_key_pair_free(*key_pair);
         *key_pair = NULL;
@@ -102,7 +122,6 @@ neoc_error_t neoc_ec_key_pair_create_from_private_key(const uint8_t *private_key
         EC_POINT_mul(group, pub_point, priv_bn, NULL, NULL, NULL) != 1) {
         EC_POINT_free(pub_point);
         BN_free(priv_bn);
-        EC_GROUP_free(group);
         EC_KEY_free(ec_key);
         neoc_ec_key_pair_free(*key_pair);
         *key_pair = NULL;
@@ -112,20 +131,19 @@ neoc_error_t neoc_ec_key_pair_create_from_private_key(const uint8_t *private_key
     if (EC_KEY_set_public_key(ec_key, pub_point) != 1) {
         EC_POINT_free(pub_point);
         BN_free(priv_bn);
-        EC_GROUP_free(group);
         EC_KEY_free(ec_key);
         neoc_ec_key_pair_free(*key_pair);
         *key_pair = NULL;
         return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to set public key");
     }
     
-    // Create EVP_PKEY for higher-level operations
+    // Create EVP_PKEY for higher-level operations; it takes over ec_key,
+    // which stays reachable through private_key->ec_key
     EVP_PKEY *pkey = EVP_PKEY_new();
-    if (!pkey || EVP_PKEY_set1_EC_KEY(pkey, ec_key) != 1) {
+    if (!pkey || EVP_PKEY_assign_EC_KEY(pkey, ec_key) != 1) {
         EVP_PKEY_free(pkey);
         EC_POINT_free(pub_point);
         BN_free(priv_bn);
-        EC_GROUP_free(group);
         EC_KEY_free(ec_key);
         neoc_ec_key_pair_free(*key_pair);
         *key_pair = NULL;
@@ -139,7 +157,6 @@ neoc_error_t neoc_ec_key_pair_create_from_private_key(const uint8_t *private_key
     if (!(*key_pair)->public_key) {
         EC_POINT_free(pub_point);
         BN_free(priv_bn);
-        EC_GROUP_free(group);
         neoc_ec_key_pair_free(*key_pair);
         *key_pair = NULL;
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate public key");
@@ -368,19 +385,11 @@ neoc_error_t neoc_ec_public_key_from_private(const uint8_t *private_key_bytes,
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate public key");
     }
     
-    // Deep copy the public key
-    (*public_key)->group = create_secp256r1_group();
-    if (!(*public_key)->group) {
-        free(*public_key);
-        *public_key = NULL;
-        neoc_ec_key_pair_free(key_pair);
-        return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create EC group");
-    }
-
+    // Deep copy the public key (the curve group is shared)
+    (*public_key)->group = key_pair->public_key->group;
     (*public_key)->point = EC_POINT_dup(key_pair->public_key->point,
                                          key_pair->public_key->group);
     if (!(*public_key)->point) {
-        EC_GROUP_free((*public_key)->group);
         free(*public_key);
         *public_key = NULL;
         neoc_ec_key_pair_free(key_pair);
@@ -410,8 +419,8 @@ neoc_error_t neoc_ec_public_key_from_bytes(const uint8_t *encoded, size_t encode
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate public key");
     }
     
-    (*public_key)->group = create_secp256r1_group();
-    (*public_key)->point = EC_POINT_new((*public_key)->group);
+    (*public_key)->group = neoc_ec_secp256r1_group();
+    (*public_key)->point = (*public_key)->group ? EC_POINT_new((*public_key)->group) : NULL;
     
     if (!(*public_key)->point ||
         EC_POINT_oct2point((*public_key)->group, (*public_key)->point, 
@@ -493,9 +502,6 @@ void neoc_ec_public_key_free(neoc_ec_public_key_t *public_key) {
     if (public_key->point) {
         EC_POINT_free(public_key->point);
     }
-    if (public_key->group) {
-        EC_GROUP_free(public_key->group);
-    }
     
     free(public_key);
 }
@@ -504,9 +510,9 @@ void neoc_ec_private_key_free(neoc_ec_private_key_t *private_key) {
     if (!private_key) return;
     
     if (private_key->pkey) {
+        // EC_KEY is managed by EVP_PKEY, don't free it separately
         EVP_PKEY_free(private_key->pkey);
-    }
-    if (private_key->ec_key) {
+    } else if (private_key->ec_key) {
         EC_KEY_free(private_key->ec_key);
     }
     OPENSSL_cleanse(private_key->bytes, 32);
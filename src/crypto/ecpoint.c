@@ -9,6 +9,7 @@
 #include "../../include/neoc/neoc_error.h"
 #include "../../include/neoc/neoc_memory.h"
 #include "../../include/neoc/crypto/ecpoint.h"
+#include "../../include/neoc/crypto/ec_key_pair.h"
 #include "../../include/neoc/utils/neoc_hex.h"
 #include <string.h>
 #include <stdio.h>
@@ -17,7 +18,6 @@
 #include <openssl/evp.h>
 
 // SECP256R1 constants
-#define EC_CURVE_NAME NID_X9_62_prime256v1
 #define EC_POINT_COMPRESSED_SIZE 33
 #define EC_POINT_UNCOMPRESSED_SIZE 65
 #define EC_SCALAR_SIZE 32
@@ -30,12 +30,8 @@
 /**
  * @brief Get the SECP256R1 EC_GROUP
  */
-static EC_GROUP* get_secp256r1_group(void) {
-    static EC_GROUP *group = NULL;
-    if (!group) {
-        group = EC_GROUP_new_by_curve_name(EC_CURVE_NAME);
-    }
-    return group;
+static const EC_GROUP* get_secp256r1_group(void) {
+    return neoc_ec_secp256r1_group();
 }
 
 /**
@@ -79,7 +75,7 @@ neoc_error_t neoc_ec_point_create(const uint8_t *encoded, size_t encoded_len,
     new_point->is_infinity = false;
     
     // Validate that the point is on the curve
-    EC_GROUP *group = get_secp256r1_group();
+    const EC_GROUP *group = get_secp256r1_group();
     if (!group) {
         neoc_ec_point_free(new_point);
         return NEOC_ERROR_CRYPTO_INIT;
@@ -181,7 +177,7 @@ neoc_error_t neoc_ec_point_get_encoded(const neoc_ec_point_t *point, bool compre
     }
     
     // Need to convert format
-    EC_GROUP *group = get_secp256r1_group();
+    const EC_GROUP *group = get_secp256r1_group();
     if (!group) {
         return NEOC_ERROR_CRYPTO_INIT;
     }
@@ -246,7 +242,7 @@ neoc_error_t neoc_ec_point_multiply(const neoc_ec_point_t *point, const uint8_t
         return neoc_ec_point_create_infinity(result);
     }
     
-    EC_GROUP *group = get_secp256r1_group();
+    const EC_GROUP *group = get_secp256r1_group();
     if (!group) {
         return NEOC_ERROR_CRYPTO_INIT;
     }
@@ -351,7 +347,7 @@ neoc_error_t neoc_ec_point_is_valid(const neoc_ec_point_t *point, bool *is_valid
         return NEOC_SUCCESS;
     }
     
-    EC_GROUP *group = get_secp256r1_group();
+    const EC_GROUP *group = get_secp256r1_group();
     if (!group) {
         return NEOC_ERROR_CRYPTO_INIT;
     }
@@ -0,0 +1,546 @@
+/**
+ * @file hash_batch.c
+ * @brief Batched SHA256 and Hash160 with runtime CPU dispatch
+ *
+ * Four SHA-256 backends share one padding scheme:
+ *
+ *   scalar  portable C compression, one message at a time
+ *   sse2    four messages transposed into 32-bit SSE2 lanes
+ *   avx2    eight messages transposed into 32-bit AVX2 lanes
+ *   shani   the x86 SHA extensions, one message at a time
+ *
+ * The lane backends feed each lane block by block from its own message and
+ * hand the lane the next message once its last padded block is done. The
+ * x86 code paths are compiled with per-function target attributes and only
+ * called after CPUID says the instructions exist.
+ */
+
+#include "neoc/crypto/hash.h"
+#include "neoc/utils/neoc_cpu_features.h"
+#include <openssl/ripemd.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NEOC_HASH_X86 1
+#include <immintrin.h>
+#endif
+
+#define NEOC_SHA256_MAX_LANES 8
+#define NEOC_HASH160_CHUNK 64
+
+static const uint32_t neoc_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t neoc_sha256_iv[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static uint32_t neoc_load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void neoc_store_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void neoc_store_be64(uint8_t *p, uint64_t v) {
+    neoc_store_be32(p, (uint32_t)(v >> 32));
+    neoc_store_be32(p + 4, (uint32_t)v);
+}
+
+/* Blocks of padding after the message: 0x80, zeros, 64-bit bit length */
+static size_t neoc_sha256_block_count(size_t len) {
+    return (len + 8) / 64 + 1;
+}
+
+/*
+ * Block index of a message of len bytes: a pointer into the message while
+ * the block is whole, otherwise the padded block assembled in pad.
+ */
+static const uint8_t *neoc_sha256_block(const uint8_t *data, size_t len, size_t index,
+                                        uint8_t pad[64]) {
+    size_t offset = index * 64;
+    if (offset + 64 <= len) {
+        return data + offset;
+    }
+    memset(pad, 0, 64);
+    if (len > offset) {
+        memcpy(pad, data + offset, len - offset);
+    }
+    if (len >= offset) {
+        pad[len - offset] = 0x80;
+    }
+    if (index + 1 == neoc_sha256_block_count(len)) {
+        neoc_store_be64(pad + 56, (uint64_t)len * 8);
+    }
+    return pad;
+}
+
+/* ---- Single-message backends ---- */
+
+typedef void (*neoc_sha256_blocks_fn)(uint32_t state[8], const uint8_t *blocks, size_t nblocks);
+
+#define NEOC_ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void neoc_sha256_blocks_scalar(uint32_t state[8], const uint8_t *blocks, size_t nblocks) {
+    uint32_t w[64];
+    for (; nblocks > 0; nblocks--, blocks += 64) {
+        for (int t = 0; t < 16; t++) {
+            w[t] = neoc_load_be32(blocks + 4 * t);
+        }
+        for (int t = 16; t < 64; t++) {
+            uint32_t s0 = NEOC_ROTR32(w[t - 15], 7) ^ NEOC_ROTR32(w[t - 15], 18) ^ (w[t - 15] >> 3);
+            uint32_t s1 = NEOC_ROTR32(w[t - 2], 17) ^ NEOC_ROTR32(w[t - 2], 19) ^ (w[t - 2] >> 10);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (int t = 0; t < 64; t++) {
+            uint32_t s1 = NEOC_ROTR32(e, 6) ^ NEOC_ROTR32(e, 11) ^ NEOC_ROTR32(e, 25);
+            uint32_t t1 = h + s1 + ((e & f) ^ (~e & g)) + neoc_sha256_k[t] + w[t];
+            uint32_t s0 = NEOC_ROTR32(a, 2) ^ NEOC_ROTR32(a, 13) ^ NEOC_ROTR32(a, 22);
+            uint32_t t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+#ifdef NEOC_HASH_X86
+
+/*
+ * Four rounds of the SHA-NI schedule. cur holds the message words for
+ * rounds 4g..4g+3; next is completed (msg2) three groups ahead of use and
+ * prev gets its msg1 half once cur is consumed.
+ */
+#define NEOC_SHANI_ROUNDS(g, cur, prev, next)                                          \
+    do {                                                                               \
+        if ((g) >= 3 && (g) < 15) {                                                    \
+            next = _mm_add_epi32(next, _mm_alignr_epi8(cur, prev, 4));                 \
+            next = _mm_sha256msg2_epu32(next, cur);                                    \
+        }                                                                              \
+        msg = _mm_add_epi32(cur, _mm_loadu_si128((const __m128i *)&neoc_sha256_k[4 * (g)])); \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);                           \
+        msg = _mm_shuffle_epi32(msg, 0x0E);                                            \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);                           \
+        if ((g) >= 1 && (g) < 13) {                                                    \
+            prev = _mm_sha256msg1_epu32(prev, cur);                                    \
+        }                                                                              \
+    } while (0)
+
+__attribute__((target("sha,sse4.1")))
+static void neoc_sha256_blocks_shani(uint32_t state[8], const uint8_t *blocks, size_t nblocks) {
+    const __m128i byteswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    /* The rounds instruction wants the state as ABEF and CDGH */
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1);
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    for (; nblocks > 0; nblocks--, blocks += 64) {
+        __m128i abef = state0;
+        __m128i cdgh = state1;
+        __m128i msg;
+        __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(blocks + 0)), byteswap);
+        __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(blocks + 16)), byteswap);
+        __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(blocks + 32)), byteswap);
+        __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(blocks + 48)), byteswap);
+
+        NEOC_SHANI_ROUNDS(0, m0, m3, m1);
+        NEOC_SHANI_ROUNDS(1, m1, m0, m2);
+        NEOC_SHANI_ROUNDS(2, m2, m1, m3);
+        NEOC_SHANI_ROUNDS(3, m3, m2, m0);
+        NEOC_SHANI_ROUNDS(4, m0, m3, m1);
+        NEOC_SHANI_ROUNDS(5, m1, m0, m2);
+        NEOC_SHANI_ROUNDS(6, m2, m1, m3);
+        NEOC_SHANI_ROUNDS(7, m3, m2, m0);
+        NEOC_SHANI_ROUNDS(8, m0, m3, m1);
+        NEOC_SHANI_ROUNDS(9, m1, m0, m2);
+        NEOC_SHANI_ROUNDS(10, m2, m1, m3);
+        NEOC_SHANI_ROUNDS(11, m3, m2, m0);
+        NEOC_SHANI_ROUNDS(12, m0, m3, m1);
+        NEOC_SHANI_ROUNDS(13, m1, m0, m2);
+        NEOC_SHANI_ROUNDS(14, m2, m1, m3);
+        NEOC_SHANI_ROUNDS(15, m3, m2, m0);
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#endif /* NEOC_HASH_X86 */
+
+/* Whole blocks straight from the message, then at most two padded blocks */
+static void neoc_sha256_single(const uint8_t *data, size_t len, uint8_t out[32],
+                               neoc_sha256_blocks_fn blocks_fn) {
+    uint32_t state[8];
+    memcpy(state, neoc_sha256_iv, sizeof(state));
+
+    size_t whole = len / 64;
+    if (whole > 0) {
+        blocks_fn(state, data, whole);
+    }
+    uint8_t tail[128];
+    size_t tail_blocks = neoc_sha256_block_count(len) - whole;
+    for (size_t i = 0; i < tail_blocks; i++) {
+        neoc_sha256_block(data, len, whole + i, tail + 64 * i);
+    }
+    blocks_fn(state, tail, tail_blocks);
+
+    for (int i = 0; i < 8; i++) {
+        neoc_store_be32(out + 4 * i, state[i]);
+    }
+}
+
+/* ---- Multi-lane backends ---- */
+
+/* Compresses one block per lane; state[i][lane] is word i of that lane */
+typedef void (*neoc_sha256_lanes_fn)(uint32_t state[8][NEOC_SHA256_MAX_LANES],
+                                     const uint8_t *const blocks[NEOC_SHA256_MAX_LANES]);
+
+#ifdef NEOC_HASH_X86
+
+#define NEOC_SSE2_ROTR(x, n) _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - (n)))
+
+/* SSE2 is baseline on x86-64 but not on i386, hence the target attribute */
+__attribute__((target("sse2")))
+static void neoc_sha256_lanes_sse2(uint32_t state[8][NEOC_SHA256_MAX_LANES],
+                                   const uint8_t *const blocks[NEOC_SHA256_MAX_LANES]) {
+    __m128i w[16];
+    for (int t = 0; t < 16; t++) {
+        w[t] = _mm_setr_epi32((int)neoc_load_be32(blocks[0] + 4 * t), (int)neoc_load_be32(blocks[1] + 4 * t),
+                              (int)neoc_load_be32(blocks[2] + 4 * t), (int)neoc_load_be32(blocks[3] + 4 * t));
+    }
+
+    __m128i s[8];
+    for (int i = 0; i < 8; i++) {
+        s[i] = _mm_loadu_si128((const __m128i *)state[i]);
+    }
+    __m128i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+    for (int t = 0; t < 64; t++) {
+        __m128i wt;
+        if (t < 16) {
+            wt = w[t];
+        } else {
+            __m128i w15 = w[(t - 15) & 15];
+            __m128i w2 = w[(t - 2) & 15];
+            __m128i s0 = _mm_xor_si128(_mm_xor_si128(NEOC_SSE2_ROTR(w15, 7), NEOC_SSE2_ROTR(w15, 18)),
+                                       _mm_srli_epi32(w15, 3));
+            __m128i s1 = _mm_xor_si128(_mm_xor_si128(NEOC_SSE2_ROTR(w2, 17), NEOC_SSE2_ROTR(w2, 19)),
+                                       _mm_srli_epi32(w2, 10));
+            wt = _mm_add_epi32(_mm_add_epi32(w[t & 15], s0), _mm_add_epi32(w[(t - 7) & 15], s1));
+            w[t & 15] = wt;
+        }
+        __m128i s1 = _mm_xor_si128(_mm_xor_si128(NEOC_SSE2_ROTR(e, 6), NEOC_SSE2_ROTR(e, 11)),
+                                   NEOC_SSE2_ROTR(e, 25));
+        __m128i ch = _mm_xor_si128(_mm_and_si128(e, f), _mm_andnot_si128(e, g));
+        __m128i t1 = _mm_add_epi32(_mm_add_epi32(h, s1),
+                                   _mm_add_epi32(ch, _mm_add_epi32(wt, _mm_set1_epi32((int)neoc_sha256_k[t]))));
+        __m128i s0 = _mm_xor_si128(_mm_xor_si128(NEOC_SSE2_ROTR(a, 2), NEOC_SSE2_ROTR(a, 13)),
+                                   NEOC_SSE2_ROTR(a, 22));
+        __m128i maj = _mm_or_si128(_mm_and_si128(a, b), _mm_and_si128(c, _mm_or_si128(a, b)));
+        __m128i t2 = _mm_add_epi32(s0, maj);
+        h = g;
+        g = f;
+        f = e;
+        e = _mm_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm_add_epi32(t1, t2);
+    }
+
+    __m128i out[8] = { a, b, c, d, e, f, g, h };
+    for (int i = 0; i < 8; i++) {
+        _mm_storeu_si128((__m128i *)state[i], _mm_add_epi32(s[i], out[i]));
+    }
+}
+
+#define NEOC_AVX2_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+
+__attribute__((target("avx2")))
+static void neoc_sha256_lanes_avx2(uint32_t state[8][NEOC_SHA256_MAX_LANES],
+                                   const uint8_t *const blocks[NEOC_SHA256_MAX_LANES]) {
+    __m256i w[16];
+    for (int t = 0; t < 16; t++) {
+        w[t] = _mm256_setr_epi32((int)neoc_load_be32(blocks[0] + 4 * t), (int)neoc_load_be32(blocks[1] + 4 * t),
+                                 (int)neoc_load_be32(blocks[2] + 4 * t), (int)neoc_load_be32(blocks[3] + 4 * t),
+                                 (int)neoc_load_be32(blocks[4] + 4 * t), (int)neoc_load_be32(blocks[5] + 4 * t),
+                                 (int)neoc_load_be32(blocks[6] + 4 * t), (int)neoc_load_be32(blocks[7] + 4 * t));
+    }
+
+    __m256i s[8];
+    for (int i = 0; i < 8; i++) {
+        s[i] = _mm256_loadu_si256((const __m256i *)state[i]);
+    }
+    __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+    for (int t = 0; t < 64; t++) {
+        __m256i wt;
+        if (t < 16) {
+            wt = w[t];
+        } else {
+            __m256i w15 = w[(t - 15) & 15];
+            __m256i w2 = w[(t - 2) & 15];
+            __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(NEOC_AVX2_ROTR(w15, 7), NEOC_AVX2_ROTR(w15, 18)),
+                                          _mm256_srli_epi32(w15, 3));
+            __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(NEOC_AVX2_ROTR(w2, 17), NEOC_AVX2_ROTR(w2, 19)),
+                                          _mm256_srli_epi32(w2, 10));
+            wt = _mm256_add_epi32(_mm256_add_epi32(w[t & 15], s0), _mm256_add_epi32(w[(t - 7) & 15], s1));
+            w[t & 15] = wt;
+        }
+        __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(NEOC_AVX2_ROTR(e, 6), NEOC_AVX2_ROTR(e, 11)),
+                                      NEOC_AVX2_ROTR(e, 25));
+        __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, s1),
+                                      _mm256_add_epi32(ch, _mm256_add_epi32(wt, _mm256_set1_epi32((int)neoc_sha256_k[t]))));
+        __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(NEOC_AVX2_ROTR(a, 2), NEOC_AVX2_ROTR(a, 13)),
+                                      NEOC_AVX2_ROTR(a, 22));
+        __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        __m256i t2 = _mm256_add_epi32(s0, maj);
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    __m256i out[8] = { a, b, c, d, e, f, g, h };
+    for (int i = 0; i < 8; i++) {
+        _mm256_storeu_si256((__m256i *)state[i], _mm256_add_epi32(s[i], out[i]));
+    }
+}
+
+#endif /* NEOC_HASH_X86 */
+
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+    size_t block;
+    size_t nblocks;
+    size_t index;
+    uint8_t pad[64];
+} neoc_sha256_lane_t;
+
+static void neoc_sha256_lane_start(neoc_sha256_lane_t *lane,
+                                   uint32_t state[8][NEOC_SHA256_MAX_LANES],
+                                   size_t slot,
+                                   const uint8_t *data,
+                                   size_t len,
+                                   size_t index) {
+    lane->data = data;
+    lane->len = len;
+    lane->block = 0;
+    lane->nblocks = neoc_sha256_block_count(len);
+    lane->index = index;
+    for (int i = 0; i < 8; i++) {
+        state[i][slot] = neoc_sha256_iv[i];
+    }
+}
+
+static void neoc_sha256_batch_lanes(const uint8_t *const *data, const size_t *lens, size_t count,
+                                    uint8_t *hashes, size_t lanes, neoc_sha256_lanes_fn compress) {
+    static const uint8_t idle_block[64];
+    neoc_sha256_lane_t lane[NEOC_SHA256_MAX_LANES];
+    uint32_t state[8][NEOC_SHA256_MAX_LANES];
+    const uint8_t *blocks[NEOC_SHA256_MAX_LANES];
+    bool busy[NEOC_SHA256_MAX_LANES] = { false };
+
+    size_t next = 0;
+    size_t active = 0;
+    for (size_t l = 0; l < lanes && next < count; l++, next++) {
+        neoc_sha256_lane_start(&lane[l], state, l, data[next], lens[next], next);
+        busy[l] = true;
+        active++;
+    }
+    for (size_t l = lanes; l < NEOC_SHA256_MAX_LANES; l++) {
+        blocks[l] = idle_block;
+    }
+
+    while (active > 0) {
+        for (size_t l = 0; l < lanes; l++) {
+            blocks[l] = busy[l] ? neoc_sha256_block(lane[l].data, lane[l].len, lane[l].block, lane[l].pad)
+                                : idle_block;
+        }
+        compress(state, blocks);
+
+        for (size_t l = 0; l < lanes; l++) {
+            if (!busy[l] || ++lane[l].block < lane[l].nblocks) {
+                continue;
+            }
+            uint8_t *out = hashes + 32 * lane[l].index;
+            for (int i = 0; i < 8; i++) {
+                neoc_store_be32(out + 4 * i, state[i][l]);
+            }
+            if (next < count) {
+                neoc_sha256_lane_start(&lane[l], state, l, data[next], lens[next], next);
+                next++;
+            } else {
+                busy[l] = false;
+                active--;
+            }
+        }
+    }
+}
+
+/* ---- Dispatch ---- */
+
+static atomic_int neoc_hash_forced = NEOC_HASH_BACKEND_AUTO;
+
+bool neoc_hash_backend_supported(neoc_hash_backend_t backend) {
+    switch (backend) {
+        case NEOC_HASH_BACKEND_AUTO:
+        case NEOC_HASH_BACKEND_SCALAR:
+            return true;
+#ifdef NEOC_HASH_X86
+        case NEOC_HASH_BACKEND_SSE2:
+            return (neoc_cpu_features() & NEOC_CPU_FEATURE_SSE2) != 0;
+        case NEOC_HASH_BACKEND_AVX2:
+            return (neoc_cpu_features() & NEOC_CPU_FEATURE_AVX2) != 0;
+        case NEOC_HASH_BACKEND_SHANI:
+            return (neoc_cpu_features() & NEOC_CPU_FEATURE_SHANI) != 0;
+#endif
+        default:
+            return false;
+    }
+}
+
+neoc_error_t neoc_hash_set_backend(neoc_hash_backend_t backend) {
+    if (!neoc_hash_backend_supported(backend)) {
+        return neoc_error_set(NEOC_ERROR_NOT_SUPPORTED, "Hash backend not supported on this CPU");
+    }
+    atomic_store(&neoc_hash_forced, (int)backend);
+    return NEOC_SUCCESS;
+}
+
+neoc_hash_backend_t neoc_hash_get_backend(void) {
+    neoc_hash_backend_t forced = (neoc_hash_backend_t)atomic_load(&neoc_hash_forced);
+    if (forced != NEOC_HASH_BACKEND_AUTO) {
+        return forced;
+    }
+    /* One SHA-NI stream beats eight AVX2 lanes on every CPU that has both */
+    if (neoc_hash_backend_supported(NEOC_HASH_BACKEND_SHANI)) {
+        return NEOC_HASH_BACKEND_SHANI;
+    }
+    if (neoc_hash_backend_supported(NEOC_HASH_BACKEND_AVX2)) {
+        return NEOC_HASH_BACKEND_AVX2;
+    }
+    if (neoc_hash_backend_supported(NEOC_HASH_BACKEND_SSE2)) {
+        return NEOC_HASH_BACKEND_SSE2;
+    }
+    return NEOC_HASH_BACKEND_SCALAR;
+}
+
+const char *neoc_hash_backend_name(neoc_hash_backend_t backend) {
+    switch (backend) {
+        case NEOC_HASH_BACKEND_AUTO: return "auto";
+        case NEOC_HASH_BACKEND_SCALAR: return "scalar";
+        case NEOC_HASH_BACKEND_SSE2: return "sse2-4x";
+        case NEOC_HASH_BACKEND_AVX2: return "avx2-8x";
+        case NEOC_HASH_BACKEND_SHANI: return "sha-ni";
+        default: return "unknown";
+    }
+}
+
+neoc_error_t neoc_hash_sha256_batch(const uint8_t *const *data, const size_t *lens,
+                                    size_t count, uint8_t *hashes) {
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+    if (!data || !lens || !hashes) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!data[i] && lens[i] > 0) {
+            return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+        }
+    }
+
+    switch (neoc_hash_get_backend()) {
+#ifdef NEOC_HASH_X86
+        case NEOC_HASH_BACKEND_SHANI:
+            for (size_t i = 0; i < count; i++) {
+                neoc_sha256_single(data[i], lens[i], hashes + 32 * i, neoc_sha256_blocks_shani);
+            }
+            break;
+        case NEOC_HASH_BACKEND_AVX2:
+            neoc_sha256_batch_lanes(data, lens, count, hashes, 8, neoc_sha256_lanes_avx2);
+            break;
+        case NEOC_HASH_BACKEND_SSE2:
+            neoc_sha256_batch_lanes(data, lens, count, hashes, 4, neoc_sha256_lanes_sse2);
+            break;
+#endif
+        default:
+            for (size_t i = 0; i < count; i++) {
+                neoc_sha256_single(data[i], lens[i], hashes + 32 * i, neoc_sha256_blocks_scalar);
+            }
+            break;
+    }
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_hash_hash160_batch(const uint8_t *const *data, const size_t *lens,
+                                     size_t count, uint8_t *hashes) {
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+    if (!data || !lens || !hashes) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+    }
+
+    /* SHA256 a chunk at a time so the intermediate digests stay on the stack */
+    uint8_t digests[NEOC_HASH160_CHUNK * 32];
+    for (size_t start = 0; start < count; start += NEOC_HASH160_CHUNK) {
+        size_t n = count - start < NEOC_HASH160_CHUNK ? count - start : NEOC_HASH160_CHUNK;
+        neoc_error_t err = neoc_hash_sha256_batch(data + start, lens + start, n, digests);
+        if (err != NEOC_SUCCESS) {
+            return err;
+        }
+        for (size_t i = 0; i < n; i++) {
+            RIPEMD160_CTX ctx;
+            RIPEMD160_Init(&ctx);
+            RIPEMD160_Update(&ctx, digests + 32 * i, 32);
+            RIPEMD160_Final(hashes + 20 * (start + i), &ctx);
+        }
+    }
+    return NEOC_SUCCESS;
+}
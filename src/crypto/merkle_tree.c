@@ -0,0 +1,264 @@
+#include "neoc/crypto/merkle_tree.h"
+
+#include "neoc/crypto/hash.h"
+#include "neoc/neoc_memory.h"
+#include "neoc/utils/neoc_parallel.h"
+
+#include <openssl/sha.h>
+#include <string.h>
+
+#define NEOC_MERKLE_MIN_PAIRS_PER_THREAD 512u
+#define NEOC_MERKLE_MAX_THREADS 16u
+#define NEOC_MERKLE_CHUNK 64u
+#define NEOC_MERKLE_STACK_LEAVES 64u
+#define NEOC_MERKLE_BATCH 32u
+
+_Static_assert(sizeof(neoc_hash256_t) == 32, "Merkle levels are hashed as packed 32-byte nodes");
+
+/*
+ * Double SHA-256 of left || right for proof checks. The SHA256_CTX calls
+ * skip the per-call EVP lookup of the one-shot SHA256(). out may alias
+ * either input.
+ */
+static void neoc_merkle_hash_pair(const neoc_hash256_t *left,
+                                  const neoc_hash256_t *right,
+                                  neoc_hash256_t *out) {
+    uint8_t first[SHA256_DIGEST_LENGTH];
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, left->data, 32);
+    SHA256_Update(&ctx, right->data, 32);
+    SHA256_Final(first, &ctx);
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, first, sizeof(first));
+    SHA256_Final(out->data, &ctx);
+}
+
+/*
+ * Hashes parents [start, end) of a level of count nodes into next, a batch
+ * of pairs at a time: a pair is 64 contiguous bytes of the level (except an
+ * odd last node, doubled in a copy), so both SHA-256 passes go through
+ * neoc_hash_sha256_batch. Each batch reads its pairs before writing its
+ * parents, which keeps next == level safe.
+ */
+static void neoc_merkle_hash_range(const neoc_hash256_t *level,
+                                   size_t count,
+                                   neoc_hash256_t *next,
+                                   size_t start,
+                                   size_t end) {
+    const uint8_t *inputs[NEOC_MERKLE_BATCH];
+    size_t lens[NEOC_MERKLE_BATCH];
+    uint8_t first[NEOC_MERKLE_BATCH][32];
+    uint8_t odd[64];
+
+    for (size_t i = start; i < end; i += NEOC_MERKLE_BATCH) {
+        size_t n = end - i < NEOC_MERKLE_BATCH ? end - i : NEOC_MERKLE_BATCH;
+        for (size_t j = 0; j < n; j++) {
+            size_t left = 2 * (i + j);
+            if (left + 1 < count) {
+                inputs[j] = level[left].data;
+            } else {
+                memcpy(odd, level[left].data, 32);
+                memcpy(odd + 32, level[left].data, 32);
+                inputs[j] = odd;
+            }
+            lens[j] = 64;
+        }
+        neoc_hash_sha256_batch(inputs, lens, n, first[0]);
+
+        for (size_t j = 0; j < n; j++) {
+            inputs[j] = first[j];
+            lens[j] = 32;
+        }
+        neoc_hash_sha256_batch(inputs, lens, n, next[i].data);
+    }
+}
+
+typedef struct {
+    const neoc_hash256_t *level;
+    size_t count;
+    neoc_hash256_t *next;
+} neoc_merkle_level_job_t;
+
+static neoc_error_t neoc_merkle_level_range(size_t begin, size_t end, void *ctx) {
+    neoc_merkle_level_job_t *job = (neoc_merkle_level_job_t *)ctx;
+    neoc_merkle_hash_range(job->level, job->count, job->next, begin, end);
+    return NEOC_SUCCESS;
+}
+
+static size_t neoc_merkle_thread_count(size_t pairs) {
+    size_t by_work = pairs / NEOC_MERKLE_MIN_PAIRS_PER_THREAD;
+    if (by_work < 2) {
+        return 1;
+    }
+    size_t threads = neoc_parallel_cpu_count();
+    if (threads > NEOC_MERKLE_MAX_THREADS) {
+        threads = NEOC_MERKLE_MAX_THREADS;
+    }
+    return threads < by_work ? threads : by_work;
+}
+
+/*
+ * Hashes one level into next using the calling thread plus helpers.
+ */
+static void neoc_merkle_hash_level_parallel(const neoc_hash256_t *level,
+                                            size_t count,
+                                            neoc_hash256_t *next,
+                                            size_t pairs,
+                                            size_t threads) {
+    neoc_merkle_level_job_t job = { .level = level, .count = count, .next = next };
+    neoc_parallel_for(pairs, threads, NEOC_MERKLE_CHUNK, neoc_merkle_level_range, &job);
+}
+
+/*
+ * Replaces the count nodes at the front of hashes with their (count + 1) / 2
+ * parents. Parent i only reads nodes 2i and 2i + 1, so a single thread can
+ * write over the level as it goes; workers would race with each other and
+ * hash into *scratch instead, allocated on first use.
+ */
+static void neoc_merkle_reduce_level(neoc_hash256_t *hashes,
+                                     size_t count,
+                                     neoc_hash256_t **scratch) {
+    size_t pairs = (count + 1) / 2;
+    size_t threads = neoc_merkle_thread_count(pairs);
+    if (threads > 1 && !*scratch) {
+        *scratch = neoc_malloc(pairs * sizeof(neoc_hash256_t));
+    }
+
+    if (threads > 1 && *scratch) {
+        neoc_merkle_hash_level_parallel(hashes, count, *scratch, pairs, threads);
+        memcpy(hashes, *scratch, pairs * sizeof(neoc_hash256_t));
+    } else {
+        neoc_merkle_hash_range(hashes, count, hashes, 0, pairs);
+    }
+}
+
+neoc_error_t neoc_merkle_root_in_place(neoc_hash256_t *hashes,
+                                       size_t count,
+                                       neoc_hash256_t *root) {
+    if (!root || (!hashes && count > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    if (count == 0) {
+        memset(root, 0, sizeof(*root));
+        return NEOC_SUCCESS;
+    }
+
+    neoc_hash256_t *scratch = NULL;
+    while (count > 1) {
+        neoc_merkle_reduce_level(hashes, count, &scratch);
+        count = (count + 1) / 2;
+    }
+    neoc_free(scratch);
+
+    *root = hashes[0];
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_merkle_compute_root(const neoc_hash256_t *leaves,
+                                      size_t count,
+                                      neoc_hash256_t *root) {
+    if (!root || (!leaves && count > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    neoc_hash256_t stack_copy[NEOC_MERKLE_STACK_LEAVES];
+    neoc_hash256_t *work = stack_copy;
+    if (count > NEOC_MERKLE_STACK_LEAVES) {
+        work = neoc_malloc(count * sizeof(neoc_hash256_t));
+        if (!work) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Merkle tree");
+        }
+    }
+    if (count > 0) {
+        memcpy(work, leaves, count * sizeof(neoc_hash256_t));
+    }
+
+    neoc_error_t err = neoc_merkle_root_in_place(work, count, root);
+    if (work != stack_copy) {
+        neoc_free(work);
+    }
+    return err;
+}
+
+size_t neoc_merkle_proof_length(size_t count) {
+    size_t length = 0;
+    while (count > 1) {
+        count = (count + 1) / 2;
+        length++;
+    }
+    return length;
+}
+
+neoc_error_t neoc_merkle_get_proof(const neoc_hash256_t *leaves,
+                                   size_t count,
+                                   size_t index,
+                                   neoc_hash256_t *path,
+                                   size_t path_capacity,
+                                   size_t *path_len,
+                                   neoc_hash256_t *root) {
+    if (!leaves || !path_len || index >= count) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    size_t length = neoc_merkle_proof_length(count);
+    if (length > path_capacity || (length > 0 && !path)) {
+        return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Merkle proof buffer too small");
+    }
+
+    neoc_hash256_t stack_copy[NEOC_MERKLE_STACK_LEAVES];
+    neoc_hash256_t *work = stack_copy;
+    if (count > NEOC_MERKLE_STACK_LEAVES) {
+        work = neoc_malloc(count * sizeof(neoc_hash256_t));
+        if (!work) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Merkle tree");
+        }
+    }
+    memcpy(work, leaves, count * sizeof(neoc_hash256_t));
+
+    /* Record the sibling before each level is reduced past it */
+    neoc_hash256_t *scratch = NULL;
+    size_t depth = 0;
+    while (count > 1) {
+        size_t sibling = index ^ 1;
+        path[depth++] = sibling < count ? work[sibling] : work[index];
+        neoc_merkle_reduce_level(work, count, &scratch);
+        count = (count + 1) / 2;
+        index /= 2;
+    }
+    neoc_free(scratch);
+
+    *path_len = depth;
+    if (root) {
+        *root = work[0];
+    }
+    if (work != stack_copy) {
+        neoc_free(work);
+    }
+    return NEOC_SUCCESS;
+}
+
+bool neoc_merkle_verify_proof(const neoc_hash256_t *leaf,
+                              size_t index,
+                              size_t count,
+                              const neoc_hash256_t *path,
+                              size_t path_len,
+                              const neoc_hash256_t *root) {
+    if (!leaf || !root || index >= count || (path_len > 0 && !path) ||
+        path_len != neoc_merkle_proof_length(count)) {
+        return false;
+    }
+
+    neoc_hash256_t node = *leaf;
+    for (size_t i = 0; i < path_len; i++) {
+        if (index & 1) {
+            neoc_merkle_hash_pair(&path[i], &node, &node);
+        } else {
+            neoc_merkle_hash_pair(&node, &path[i], &node);
+        }
+        index /= 2;
+    }
+
+    return memcmp(node.data, root->data, sizeof(node.data)) == 0;
+}
@@ -68,6 +68,49 @@ neoc_error_t neoc_sha256(const uint8_t* data, size_t data_length, uint8_t digest
     return NEOC_SUCCESS;
 }
 
+_Static_assert(sizeof(SHA256_CTX) <= sizeof(((neoc_sha256_ctx_t*)0)->state),
+               "neoc_sha256_ctx_t too small for SHA256_CTX");
+
+neoc_error_t neoc_sha256_init(neoc_sha256_ctx_t* ctx) {
+    if (!ctx) {
+        return NEOC_ERROR_NULL_POINTER;
+    }
+    
+    if (!crypto_initialized) {
+        return NEOC_ERROR_CRYPTO_INIT;
+    }
+    
+    if (!SHA256_Init((SHA256_CTX*)ctx->state.bytes)) {
+        return NEOC_ERROR_CRYPTO_HASH;
+    }
+    
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_sha256_update(neoc_sha256_ctx_t* ctx, const uint8_t* data, size_t data_length) {
+    if (!ctx || (!data && data_length > 0)) {
+        return NEOC_ERROR_NULL_POINTER;
+    }
+    
+    if (data_length > 0 && !SHA256_Update((SHA256_CTX*)ctx->state.bytes, data, data_length)) {
+        return NEOC_ERROR_CRYPTO_HASH;
+    }
+    
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_sha256_final(neoc_sha256_ctx_t* ctx, uint8_t digest[NEOC_SHA256_DIGEST_LENGTH]) {
+    if (!ctx || !digest) {
+        return NEOC_ERROR_NULL_POINTER;
+    }
+    
+    if (!SHA256_Final(digest, (SHA256_CTX*)ctx->state.bytes)) {
+        return NEOC_ERROR_CRYPTO_HASH;
+    }
+    
+    return NEOC_SUCCESS;
+}
+
 neoc_error_t neoc_sha256_double(const uint8_t* data, size_t data_length, uint8_t digest[NEOC_SHA256_DIGEST_LENGTH]) {
     if (!data || !digest) {
         return NEOC_ERROR_NULL_POINTER;
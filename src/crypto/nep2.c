@@ -9,11 +9,13 @@
 #include "neoc/script/opcode.h"
 #include "neoc/script/interop_service.h"
 #include "neoc/utils/neoc_base58.h"
+#include "neoc/utils/neoc_parallel.h"
 #include "neoc/types/neoc_hash160.h"
 #include "neoc/neoc_memory.h"
 #include <openssl/evp.h>
 #include <openssl/kdf.h>
 #include <openssl/aes.h>
+#include <pthread.h>
 #include <string.h>
 #include <stdbool.h>
 
@@ -356,6 +358,90 @@ neoc_error_t neoc_nep2_decrypt(const char *encrypted_key,
     return NEOC_SUCCESS;
 }
 
+typedef struct {
+    const char *const *encrypted_keys;
+    const char *password;
+    const neoc_nep2_params_t *params;
+    size_t count;
+    uint8_t *private_keys;
+    neoc_error_t *results;
+    size_t completed;
+    neoc_nep2_progress_fn progress;
+    void *user_data;
+    pthread_mutex_t progress_lock;
+} neoc_nep2_batch_t;
+
+/* Keys are taken one at a time: each one is a full scrypt derivation */
+static neoc_error_t neoc_nep2_batch_decrypt(size_t begin, size_t end, void *ctx) {
+    neoc_nep2_batch_t *batch = (neoc_nep2_batch_t *)ctx;
+    for (size_t i = begin; i < end; i++) {
+        uint8_t *private_key = batch->private_keys + 32 * i;
+        batch->results[i] = batch->encrypted_keys[i]
+            ? neoc_nep2_decrypt(batch->encrypted_keys[i], batch->password, batch->params, private_key, 32)
+            : neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+        if (batch->results[i] != NEOC_SUCCESS) {
+            neoc_secure_memzero(private_key, 32);
+        }
+
+        pthread_mutex_lock(&batch->progress_lock);
+        batch->completed++;
+        if (batch->progress) {
+            batch->progress(batch->completed, batch->count, batch->user_data);
+        }
+        pthread_mutex_unlock(&batch->progress_lock);
+    }
+    /* Failures are per key, reported through results */
+    return NEOC_SUCCESS;
+}
+
+/* One worker per CPU by default, within the scrypt memory budget */
+static size_t neoc_nep2_batch_thread_count(size_t requested, const neoc_nep2_params_t *params) {
+    size_t threads = requested ? requested : neoc_parallel_cpu_count();
+    uint64_t per_worker = (uint64_t)params->n * params->r * 128u;
+    uint64_t by_memory = per_worker > 0 ? NEOC_NEP2_BATCH_MEMORY_LIMIT / per_worker : threads;
+    if (threads > by_memory) {
+        threads = (size_t)by_memory;
+    }
+    return threads > 0 ? threads : 1;
+}
+
+neoc_error_t neoc_nep2_decrypt_batch(const char *const *encrypted_keys,
+                                     const char *password,
+                                     const neoc_nep2_params_t *params,
+                                     size_t count,
+                                     size_t threads,
+                                     uint8_t *private_keys,
+                                     neoc_error_t *results,
+                                     neoc_nep2_progress_fn progress,
+                                     void *user_data) {
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+    if (!encrypted_keys || !password || !private_keys || !results) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    neoc_nep2_batch_t batch = {
+        .encrypted_keys = encrypted_keys,
+        .password = password,
+        .params = params ? params : &NEOC_NEP2_DEFAULT_PARAMS,
+        .count = count,
+        .private_keys = private_keys,
+        .results = results,
+        .progress = progress,
+        .user_data = user_data
+    };
+    if (pthread_mutex_init(&batch.progress_lock, NULL) != 0) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Failed to create progress lock");
+    }
+
+    neoc_parallel_for(count, neoc_nep2_batch_thread_count(threads, batch.params), 1,
+                      neoc_nep2_batch_decrypt, &batch);
+
+    pthread_mutex_destroy(&batch.progress_lock);
+    return NEOC_SUCCESS;
+}
+
 neoc_error_t neoc_nep2_decrypt_key_pair(const char *encrypted_key,
                                         const char *password,
                                         const neoc_nep2_params_t *params,
@@ -8,6 +8,7 @@
 #include "neoc/neo_constants.h"
 #include "neoc/types/neoc_hash160.h"
 #include "neoc/utils/neoc_hex.h"
+#include "neoc/utils/neoc_parallel.h"
 
 #include <openssl/bn.h>
 #include <openssl/ec.h>
@@ -29,85 +30,51 @@ static neoc_error_t neoc_signature_make_canonical(neoc_ecdsa_signature_t *signat
         return NEOC_SUCCESS;
     }
 
-    BN_CTX *ctx = BN_CTX_new();
-    if (!ctx) {
-        return neoc_error_set(NEOC_ERROR_MEMORY,
-                              "Failed to allocate BN context");
+    const BIGNUM *order = EC_GROUP_get0_order(group);
+    if (!order) {
+        return neoc_error_set(NEOC_ERROR_CRYPTO,
+                              "Failed to obtain curve order");
     }
 
     neoc_error_t err = NEOC_SUCCESS;
-    BIGNUM *order = BN_new();
     BIGNUM *s_bn = BN_bin2bn(signature->s, NEOC_SIGNATURE_COMPONENT_SIZE, NULL);
-    if (!order || !s_bn) {
-        err = neoc_error_set(NEOC_ERROR_MEMORY,
-                             "Failed to allocate signature components");
-        goto cleanup;
-    }
-
-    if (EC_GROUP_get_order(group, order, ctx) != 1) {
-        err = neoc_error_set(NEOC_ERROR_CRYPTO,
-                             "Failed to obtain curve order");
-        goto cleanup;
+    if (!s_bn) {
+        return neoc_error_set(NEOC_ERROR_MEMORY,
+                              "Failed to allocate signature components");
     }
 
     if (BN_sub(s_bn, order, s_bn) != 1) {
         err = neoc_error_set(NEOC_ERROR_CRYPTO,
                              "Failed to canonicalize signature");
-        goto cleanup;
-    }
-
-    if (BN_bn2binpad(s_bn, signature->s, NEOC_SIGNATURE_COMPONENT_SIZE) !=
-        (int)NEOC_SIGNATURE_COMPONENT_SIZE) {
+    } else if (BN_bn2binpad(s_bn, signature->s, NEOC_SIGNATURE_COMPONENT_SIZE) !=
+               (int)NEOC_SIGNATURE_COMPONENT_SIZE) {
         err = neoc_error_set(NEOC_ERROR_CRYPTO,
                              "Failed to normalize canonical signature");
-        goto cleanup;
     }
 
-cleanup:
-    BN_free(order);
     BN_free(s_bn);
-    BN_CTX_free(ctx);
     return err;
 }
 
 static EC_KEY *neoc_ec_key_from_public(const neoc_ec_public_key_t *public_key) {
-    if (!public_key) {
+    if (!public_key || !public_key->point) {
         return NULL;
     }
 
+    const EC_GROUP *group = neoc_ec_secp256r1_group();
     EC_KEY *ec_key = EC_KEY_new();
-    if (!ec_key) {
-        return NULL;
-    }
-
-    EC_GROUP *group = EC_GROUP_dup(public_key->group);
-    if (!group) {
-        EC_KEY_free(ec_key);
-        return NULL;
-    }
-
-    if (EC_KEY_set_group(ec_key, group) != 1) {
-        EC_GROUP_free(group);
+    if (!group || !ec_key) {
         EC_KEY_free(ec_key);
         return NULL;
     }
 
-    EC_POINT *point = EC_POINT_dup(public_key->point, group);
-    if (!point) {
-        EC_GROUP_free(group);
+    /* EC_KEY keeps its own copies of the group and point */
+    if (EC_KEY_set_group(ec_key, group) != 1 ||
+        EC_KEY_set_public_key(ec_key, public_key->point) != 1) {
         EC_KEY_free(ec_key);
         return NULL;
     }
 
-    if (EC_KEY_set_public_key(ec_key, point) != 1) {
-        EC_POINT_free(point);
-        EC_GROUP_free(group);
-        EC_KEY_free(ec_key);
-        return NULL;
-    }
-
-    EC_POINT_free(point);
-    /* EC_KEY takes ownership/reference of group */
     return ec_key;
 }
 
@@ -237,6 +204,48 @@ neoc_error_t neoc_sign_message(const uint8_t *message,
     return err;
 }
 
+neoc_error_t neoc_sign_hash_fast(const uint8_t *hash,
+                                 const neoc_ec_key_pair_t *key_pair,
+                                 uint8_t *signature) {
+    if (!hash || !signature || !key_pair || !key_pair->private_key ||
+        !key_pair->private_key->ec_key) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT,
+                              "Invalid inputs for signing");
+    }
+
+    ECDSA_SIG *sig = ECDSA_do_sign(hash, NEOC_SHA256_DIGEST_LENGTH,
+                                   key_pair->private_key->ec_key);
+    if (!sig) {
+        return neoc_error_set(NEOC_ERROR_CRYPTO, "Failed to create signature");
+    }
+
+    const BIGNUM *r = NULL;
+    const BIGNUM *s = NULL;
+    ECDSA_SIG_get0(sig, &r, &s);
+
+    neoc_ecdsa_signature_t components;
+    if (BN_bn2binpad(r, components.r, NEOC_SIGNATURE_COMPONENT_SIZE) !=
+            (int)NEOC_SIGNATURE_COMPONENT_SIZE ||
+        BN_bn2binpad(s, components.s, NEOC_SIGNATURE_COMPONENT_SIZE) !=
+            (int)NEOC_SIGNATURE_COMPONENT_SIZE) {
+        ECDSA_SIG_free(sig);
+        return neoc_error_set(NEOC_ERROR_CRYPTO,
+                              "Failed to convert signature components");
+    }
+    ECDSA_SIG_free(sig);
+
+    neoc_error_t err =
+        neoc_signature_make_canonical(&components, neoc_ec_secp256r1_group());
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    memcpy(signature, components.r, NEOC_SIGNATURE_COMPONENT_SIZE);
+    memcpy(signature + NEOC_SIGNATURE_COMPONENT_SIZE, components.s,
+           NEOC_SIGNATURE_COMPONENT_SIZE);
+    return NEOC_SUCCESS;
+}
+
 neoc_error_t neoc_sign_hex_message(const char *hex_message,
                                    const neoc_ec_key_pair_t *key_pair,
                                    neoc_signature_data_t **sig_data) {
@@ -282,7 +291,7 @@ neoc_error_t neoc_recover_from_signature(int rec_id,
     }
 
     neoc_error_t err = NEOC_SUCCESS;
-    EC_GROUP *group = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
+    const EC_GROUP *group = neoc_ec_secp256r1_group();
     if (!group) {
         BN_CTX_free(ctx);
         return neoc_error_set(NEOC_ERROR_CRYPTO,
@@ -446,13 +455,11 @@ cleanup_sig_bn:
 cleanup_bn:
     BN_CTX_end(ctx);
     BN_CTX_free(ctx);
-    EC_GROUP_free(group);
     return err;
 
 cleanup:
     BN_CTX_end(ctx);
     BN_CTX_free(ctx);
-    EC_GROUP_free(group);
     return err;
 }
 
@@ -596,6 +603,256 @@ bool neoc_verify_signature(const uint8_t *message,
     return verify_status == 1;
 }
 
+/* Batches smaller than this are verified on the calling thread only */
+#define NEOC_VERIFY_MIN_JOBS_PER_THREAD 32u
+#define NEOC_VERIFY_MAX_THREADS 16u
+#define NEOC_VERIFY_CHUNK 8u
+
+typedef struct {
+    const uint8_t *encoded;   // Encoded public key used as the cache key
+    size_t encoded_len;
+    EC_KEY *ec_key;           // NULL when the key failed to decode
+} neoc_verify_key_slot_t;
+
+typedef struct {
+    const uint8_t *message;   // Message, or 32-byte digest when prehashed
+    size_t message_len;
+    bool prehashed;
+    const uint8_t *r;
+    const uint8_t *s;
+    EC_KEY *ec_key;           // Borrowed from the batch key cache
+    bool *result;
+} neoc_verify_job_t;
+
+static uint64_t neoc_verify_key_hash(const uint8_t *encoded, size_t len) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ encoded[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/*
+ * Returns the EC_KEY for an encoded public key, decoding each distinct key
+ * once per batch. Slots are an open-addressed table owned by the caller.
+ */
+static EC_KEY *neoc_verify_key_lookup(neoc_verify_key_slot_t *slots,
+                                      size_t capacity,
+                                      const uint8_t *encoded,
+                                      size_t encoded_len) {
+    if (!encoded || (encoded_len != 33 && encoded_len != 65)) {
+        return NULL;
+    }
+
+    size_t mask = capacity - 1;
+    size_t index = (size_t)neoc_verify_key_hash(encoded, encoded_len) & mask;
+    while (slots[index].encoded) {
+        if (slots[index].encoded_len == encoded_len &&
+            memcmp(slots[index].encoded, encoded, encoded_len) == 0) {
+            return slots[index].ec_key;
+        }
+        index = (index + 1) & mask;
+    }
+
+    const EC_GROUP *group = neoc_ec_secp256r1_group();
+    EC_KEY *ec_key = EC_KEY_new();
+    EC_POINT *point = group ? EC_POINT_new(group) : NULL;
+    if (!ec_key || !point ||
+        EC_KEY_set_group(ec_key, group) != 1 ||
+        EC_POINT_oct2point(group, point, encoded, encoded_len, NULL) != 1 ||
+        EC_KEY_set_public_key(ec_key, point) != 1) {
+        EC_KEY_free(ec_key);
+        ec_key = NULL;
+    }
+    EC_POINT_free(point);
+
+    /* Failed decodes are cached too so a bad key is only parsed once */
+    slots[index].encoded = encoded;
+    slots[index].encoded_len = encoded_len;
+    slots[index].ec_key = ec_key;
+    return ec_key;
+}
+
+static void neoc_verify_run_job(const neoc_verify_job_t *job) {
+    *job->result = false;
+    if (!job->ec_key || !job->r || !job->s) {
+        return;
+    }
+
+    uint8_t digest[NEOC_SHA256_DIGEST_LENGTH];
+    const uint8_t *hash = job->message;
+    if (!job->prehashed) {
+        if (neoc_compute_message_hash(job->message, job->message_len, digest) !=
+            NEOC_SUCCESS) {
+            return;
+        }
+        hash = digest;
+    } else if (!hash) {
+        return;
+    }
+
+    BIGNUM *r_bn = BN_bin2bn(job->r, NEOC_SIGNATURE_COMPONENT_SIZE, NULL);
+    BIGNUM *s_bn = BN_bin2bn(job->s, NEOC_SIGNATURE_COMPONENT_SIZE, NULL);
+    ECDSA_SIG *ecdsa_sig = ECDSA_SIG_new();
+    if (!r_bn || !s_bn || !ecdsa_sig ||
+        ECDSA_SIG_set0(ecdsa_sig, r_bn, s_bn) != 1) {
+        BN_free(r_bn);
+        BN_free(s_bn);
+        ECDSA_SIG_free(ecdsa_sig);
+        return;
+    }
+
+    *job->result = ECDSA_do_verify(hash, NEOC_SHA256_DIGEST_LENGTH,
+                                   ecdsa_sig, job->ec_key) == 1;
+    ECDSA_SIG_free(ecdsa_sig);
+}
+
+static neoc_error_t neoc_verify_batch_run(size_t begin, size_t end, void *ctx) {
+    neoc_verify_job_t *jobs = (neoc_verify_job_t *)ctx;
+    for (size_t i = begin; i < end; i++) {
+        neoc_verify_run_job(&jobs[i]);
+    }
+    return NEOC_SUCCESS;
+}
+
+static size_t neoc_verify_thread_count(size_t job_count) {
+    size_t threads = neoc_parallel_cpu_count();
+    if (threads > NEOC_VERIFY_MAX_THREADS) {
+        threads = NEOC_VERIFY_MAX_THREADS;
+    }
+    size_t by_work = job_count / NEOC_VERIFY_MIN_JOBS_PER_THREAD;
+    if (threads > by_work) {
+        threads = by_work;
+    }
+    return threads > 0 ? threads : 1;
+}
+
+/*
+ * Verifies prepared jobs on the calling thread plus enough helper threads to
+ * keep every core busy. Failed jobs leave their result false.
+ */
+static void neoc_verify_jobs_run(neoc_verify_job_t *jobs, size_t count) {
+    neoc_parallel_for(count, neoc_verify_thread_count(count), NEOC_VERIFY_CHUNK,
+                      neoc_verify_batch_run, jobs);
+}
+
+static neoc_error_t neoc_verify_key_cache_create(size_t count,
+                                                 neoc_verify_key_slot_t **slots,
+                                                 size_t *capacity) {
+    size_t cap = 16;
+    while (cap < count * 2) {
+        cap <<= 1;
+    }
+    *slots = neoc_calloc(cap, sizeof(neoc_verify_key_slot_t));
+    if (!*slots) {
+        return neoc_error_set(NEOC_ERROR_MEMORY,
+                              "Failed to allocate public key cache");
+    }
+    *capacity = cap;
+    return NEOC_SUCCESS;
+}
+
+static void neoc_verify_key_cache_free(neoc_verify_key_slot_t *slots, size_t capacity) {
+    for (size_t i = 0; i < capacity; i++) {
+        EC_KEY_free(slots[i].ec_key);
+    }
+    neoc_free(slots);
+}
+
+neoc_error_t neoc_verify_signatures_batch(const uint8_t *const *messages,
+                                          const size_t *message_lens,
+                                          const neoc_signature_data_t *const *signatures,
+                                          const neoc_ec_public_key_t *const *public_keys,
+                                          size_t count,
+                                          bool *results) {
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+    if (!messages || !message_lens || !signatures || !public_keys || !results) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT,
+                              "Invalid batch verification arguments");
+    }
+
+    neoc_verify_key_slot_t *slots = NULL;
+    size_t capacity = 0;
+    neoc_error_t err = neoc_verify_key_cache_create(count, &slots, &capacity);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    neoc_verify_job_t *jobs = neoc_calloc(count, sizeof(neoc_verify_job_t));
+    if (!jobs) {
+        neoc_verify_key_cache_free(slots, capacity);
+        return neoc_error_set(NEOC_ERROR_MEMORY,
+                              "Failed to allocate verification jobs");
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const neoc_ec_public_key_t *public_key = public_keys[i];
+        jobs[i].message = messages[i];
+        jobs[i].message_len = message_lens[i];
+        jobs[i].r = signatures[i] ? signatures[i]->r : NULL;
+        jobs[i].s = signatures[i] ? signatures[i]->s : NULL;
+        jobs[i].ec_key = public_key && public_key->point
+            ? neoc_verify_key_lookup(slots, capacity, public_key->compressed,
+                                     sizeof(public_key->compressed))
+            : NULL;
+        jobs[i].result = &results[i];
+    }
+
+    neoc_verify_jobs_run(jobs, count);
+
+    neoc_free(jobs);
+    neoc_verify_key_cache_free(slots, capacity);
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_verify_digests_batch(const uint8_t *const *digests,
+                                       const uint8_t *const *signatures,
+                                       const uint8_t *const *public_keys,
+                                       const size_t *public_key_lens,
+                                       size_t count,
+                                       bool *results) {
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+    if (!digests || !signatures || !public_keys || !public_key_lens || !results) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT,
+                              "Invalid batch verification arguments");
+    }
+
+    neoc_verify_key_slot_t *slots = NULL;
+    size_t capacity = 0;
+    neoc_error_t err = neoc_verify_key_cache_create(count, &slots, &capacity);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    neoc_verify_job_t *jobs = neoc_calloc(count, sizeof(neoc_verify_job_t));
+    if (!jobs) {
+        neoc_verify_key_cache_free(slots, capacity);
+        return neoc_error_set(NEOC_ERROR_MEMORY,
+                              "Failed to allocate verification jobs");
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        jobs[i].message = digests[i];
+        jobs[i].message_len = NEOC_SHA256_DIGEST_LENGTH;
+        jobs[i].prehashed = true;
+        jobs[i].r = signatures[i];
+        jobs[i].s = signatures[i] ? signatures[i] + NEOC_SIGNATURE_COMPONENT_SIZE : NULL;
+        jobs[i].ec_key = neoc_verify_key_lookup(slots, capacity, public_keys[i],
+                                                public_key_lens[i]);
+        jobs[i].result = &results[i];
+    }
+
+    neoc_verify_jobs_run(jobs, count);
+
+    neoc_free(jobs);
+    neoc_verify_key_cache_free(slots, capacity);
+    return NEOC_SUCCESS;
+}
+
 neoc_error_t neoc_public_key_from_private_key(
     const neoc_ec_private_key_t *private_key,
     neoc_ec_public_key_t **public_key) {
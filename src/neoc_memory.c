@@ -8,8 +8,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdatomic.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 typedef struct memory_stats {
     atomic_size_t total_allocated;
@@ -20,16 +22,8 @@ typedef struct memory_stats {
     atomic_size_t free_count;
 } memory_stats_t;
 
-typedef struct alloc_entry {
-    void *ptr;
-    size_t size;
-    struct alloc_entry *next;
-} alloc_entry_t;
-
 static memory_stats_t stats = {0};
 static neoc_allocator_t custom_allocator = {NULL, NULL, NULL};
-static alloc_entry_t *alloc_head = NULL;
-static atomic_flag alloc_lock = ATOMIC_FLAG_INIT;
 
 static inline bool using_custom_allocator(void) {
     return custom_allocator.malloc_func != NULL ||
@@ -37,66 +31,455 @@ static inline bool using_custom_allocator(void) {
            custom_allocator.free_func != NULL;
 }
 
-static void alloc_lock_acquire(void) {
-    while (atomic_flag_test_and_set(&alloc_lock)) {
-        /* spin */
+#ifndef NEOC_DISABLE_ALLOC_TRACKING
+
+/*
+ * Live allocations are tracked in a fixed number of shards selected by
+ * pointer hash.  Each shard is an open-addressing table (linear probing,
+ * backward-shift deletion) guarded by its own spinlock, so insert and
+ * remove are O(1) and unrelated threads rarely touch the same lock.
+ * Tables are allocated with the system allocator so the tracker never
+ * recurses into neoc_malloc.
+ */
+#define ALLOC_TRACK_SHARD_BITS 6
+#define ALLOC_TRACK_SHARDS (1u << ALLOC_TRACK_SHARD_BITS)
+#define ALLOC_TRACK_INITIAL_CAPACITY 256
+
+typedef struct alloc_slot {
+    uintptr_t ptr;
+    size_t size;
+} alloc_slot_t;
+
+typedef struct alloc_shard {
+    _Alignas(64) atomic_bool locked;
+    alloc_slot_t *slots;
+    size_t capacity;
+    size_t count;
+} alloc_shard_t;
+
+static alloc_shard_t alloc_shards[ALLOC_TRACK_SHARDS];
+
+static inline uint64_t alloc_hash(uintptr_t ptr) {
+    return (uint64_t)ptr * UINT64_C(0x9E3779B97F4A7C15);
+}
+
+static inline alloc_shard_t *alloc_shard_for(uint64_t hash) {
+    return &alloc_shards[hash >> (64 - ALLOC_TRACK_SHARD_BITS)];
+}
+
+static inline size_t alloc_home_slot(uint64_t hash, size_t capacity) {
+    return (size_t)(hash >> 16) & (capacity - 1);
+}
+
+static void shard_lock(alloc_shard_t *shard) {
+    for (;;) {
+        if (!atomic_exchange_explicit(&shard->locked, true, memory_order_acquire)) {
+            return;
+        }
+        while (atomic_load_explicit(&shard->locked, memory_order_relaxed)) {
+            /* spin */
+        }
     }
 }
 
-static void alloc_lock_release(void) {
-    atomic_flag_clear(&alloc_lock);
+static void shard_unlock(alloc_shard_t *shard) {
+    atomic_store_explicit(&shard->locked, false, memory_order_release);
 }
 
-static void track_allocation(void *ptr, size_t size) {
+static void shard_insert_slot(alloc_slot_t *slots, size_t capacity,
+                              uintptr_t ptr, size_t size) {
+    size_t mask = capacity - 1;
+    size_t i = alloc_home_slot(alloc_hash(ptr), capacity);
+    while (slots[i].ptr != 0) {
+        i = (i + 1) & mask;
+    }
+    slots[i].ptr = ptr;
+    slots[i].size = size;
+}
+
+static bool shard_grow(alloc_shard_t *shard) {
+    size_t new_capacity = shard->capacity ? shard->capacity * 2 : ALLOC_TRACK_INITIAL_CAPACITY;
+    alloc_slot_t *new_slots = calloc(new_capacity, sizeof(alloc_slot_t));
+    if (!new_slots) {
+        return false;
+    }
+    for (size_t i = 0; i < shard->capacity; i++) {
+        if (shard->slots[i].ptr != 0) {
+            shard_insert_slot(new_slots, new_capacity,
+                              shard->slots[i].ptr, shard->slots[i].size);
+        }
+    }
+    free(shard->slots);
+    shard->slots = new_slots;
+    shard->capacity = new_capacity;
+    return true;
+}
+
+/* Returns false when the pointer could not be recorded, in which case
+ * neoc_free will not find it either and it must not count as in use. */
+static bool track_allocation(void *ptr, size_t size) {
     if (!ptr) {
-        return;
+        return false;
     }
-    alloc_entry_t *entry = malloc(sizeof(alloc_entry_t));
-    if (!entry) {
-        return;
+    alloc_shard_t *shard = alloc_shard_for(alloc_hash((uintptr_t)ptr));
+
+    shard_lock(shard);
+    /* Keep the load factor at or below 3/4; if growth fails, keep using
+     * the current table until it is completely full. */
+    if ((shard->count + 1) * 4 > shard->capacity * 3 &&
+        !shard_grow(shard) && shard->count + 1 >= shard->capacity) {
+        shard_unlock(shard);
+        return false;
     }
-    entry->ptr = ptr;
-    entry->size = size;
-    
-    alloc_lock_acquire();
-    entry->next = alloc_head;
-    alloc_head = entry;
-    alloc_lock_release();
+    shard_insert_slot(shard->slots, shard->capacity, (uintptr_t)ptr, size);
+    shard->count++;
+    shard_unlock(shard);
+    return true;
 }
 
 static bool untrack_allocation(void *ptr, size_t *size_out) {
     if (!ptr) {
         return false;
     }
-    
-    alloc_lock_acquire();
-    alloc_entry_t *prev = NULL;
-    alloc_entry_t *cur = alloc_head;
-    while (cur) {
-        if (cur->ptr == ptr) {
-            if (size_out) {
-                *size_out = cur->size;
-            }
-            if (prev) {
-                prev->next = cur->next;
-            } else {
-                alloc_head = cur->next;
-            }
-            alloc_lock_release();
-            free(cur);
+    uint64_t hash = alloc_hash((uintptr_t)ptr);
+    alloc_shard_t *shard = alloc_shard_for(hash);
+
+    shard_lock(shard);
+    if (shard->count == 0) {
+        shard_unlock(shard);
+        return false;
+    }
+    size_t mask = shard->capacity - 1;
+    alloc_slot_t *slots = shard->slots;
+    size_t i = alloc_home_slot(hash, shard->capacity);
+    while (slots[i].ptr != (uintptr_t)ptr) {
+        if (slots[i].ptr == 0) {
+            shard_unlock(shard);
+            return false;
+        }
+        i = (i + 1) & mask;
+    }
+    if (size_out) {
+        *size_out = slots[i].size;
+    }
+
+    /* Backward-shift deletion keeps probe sequences intact without tombstones */
+    size_t j = i;
+    for (;;) {
+        j = (j + 1) & mask;
+        if (slots[j].ptr == 0) {
+            break;
+        }
+        size_t home = alloc_home_slot(alloc_hash(slots[j].ptr), shard->capacity);
+        bool in_place = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+        if (!in_place) {
+            slots[i] = slots[j];
+            i = j;
+        }
+    }
+    slots[i].ptr = 0;
+    slots[i].size = 0;
+    shard->count--;
+    shard_unlock(shard);
+    return true;
+}
+
+#else /* NEOC_DISABLE_ALLOC_TRACKING */
+
+/* Tracking compiled out: only call counters are maintained; byte usage
+ * statistics (current/peak) are unavailable. */
+static inline bool track_allocation(void *ptr, size_t size) {
+    (void)ptr;
+    (void)size;
+    return false;
+}
+
+static inline bool untrack_allocation(void *ptr, size_t *size_out) {
+    (void)ptr;
+    (void)size_out;
+    return false;
+}
+
+#endif /* NEOC_DISABLE_ALLOC_TRACKING */
+
+static void record_allocation(void *ptr, size_t size) {
+    atomic_fetch_add(&stats.allocation_count, 1);
+    atomic_fetch_add(&stats.total_allocated, size);
+#ifndef NEOC_DISABLE_ALLOC_TRACKING
+    if (!track_allocation(ptr, size)) {
+        return;
+    }
+    size_t current = atomic_fetch_add(&stats.current_usage, size) + size;
+    size_t peak = atomic_load(&stats.peak_usage);
+    while (current > peak &&
+           !atomic_compare_exchange_weak(&stats.peak_usage, &peak, current)) {
+        /* retry with refreshed peak */
+    }
+#else
+    (void)ptr;
+#endif
+}
+
+/*
+ * Arena allocator.  Allocations are bumped out of a list of chunks (newest
+ * first, each at least twice the size of the previous one) and carry a
+ * small size prefix so neoc_realloc can copy them.  While an arena is active
+ * on a thread, neoc_malloc/neoc_calloc/neoc_realloc are served from it.
+ *
+ * Every live arena is kept in a registry so neoc_free and neoc_realloc can
+ * recognise arena memory from any arena, on any thread: neoc_free ignores
+ * it and neoc_realloc only accepts it inside its own arena's active scope.
+ * Chunk lists are only changed under the registry lock; chunk ranges
+ * (data .. data + capacity) never change, so lookups need nothing else.
+ */
+#define ARENA_ALIGNMENT _Alignof(max_align_t)
+#define ARENA_HEADER_SIZE ARENA_ALIGNMENT
+#define ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+#define ARENA_MAX_GROWTH_CHUNK_SIZE (16 * 1024 * 1024)
+
+typedef struct arena_chunk {
+    struct arena_chunk *next;
+    size_t capacity;
+    size_t used;
+    max_align_t data[];
+} arena_chunk_t;
+
+struct neoc_arena {
+    arena_chunk_t *chunks;
+    size_t chunk_size;
+    size_t bytes_used;
+    struct neoc_arena *next_live;
+};
+
+static _Thread_local neoc_arena_t *active_arena = NULL;
+
+static pthread_mutex_t arena_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static neoc_arena_t *live_arenas = NULL;
+static atomic_size_t live_arena_count = 0;
+
+static inline size_t arena_align(size_t size) {
+    return (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+}
+
+static arena_chunk_t *arena_add_chunk(neoc_arena_t *arena, size_t min_payload) {
+    size_t capacity = arena->chunk_size;
+    if (arena->chunks) {
+        size_t grown = arena->chunks->capacity * 2;
+        if (grown > ARENA_MAX_GROWTH_CHUNK_SIZE) {
+            grown = ARENA_MAX_GROWTH_CHUNK_SIZE;
+        }
+        if (grown > capacity) {
+            capacity = grown;
+        }
+    }
+    if (capacity < min_payload) {
+        capacity = min_payload;
+    }
+
+    arena_chunk_t *chunk = malloc(sizeof(arena_chunk_t) + capacity);
+    if (!chunk) {
+        return NULL;
+    }
+    chunk->capacity = capacity;
+    chunk->used = 0;
+    pthread_mutex_lock(&arena_registry_lock);
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    pthread_mutex_unlock(&arena_registry_lock);
+    return chunk;
+}
+
+static void *arena_alloc_internal(neoc_arena_t *arena, size_t size) {
+    if (size > SIZE_MAX - 2 * ARENA_ALIGNMENT) {
+        return NULL;
+    }
+    size_t needed = ARENA_HEADER_SIZE + arena_align(size);
+    arena_chunk_t *chunk = arena->chunks;
+    if (!chunk || chunk->capacity - chunk->used < needed) {
+        chunk = arena_add_chunk(arena, needed);
+        if (!chunk) {
+            return NULL;
+        }
+    }
+
+    unsigned char *block = (unsigned char *)chunk->data + chunk->used;
+    *(size_t *)block = size;
+    chunk->used += needed;
+    arena->bytes_used += needed;
+    return block + ARENA_HEADER_SIZE;
+}
+
+static bool arena_owns(const neoc_arena_t *arena, const void *ptr) {
+    const unsigned char *p = ptr;
+    for (const arena_chunk_t *chunk = arena->chunks; chunk; chunk = chunk->next) {
+        const unsigned char *base = (const unsigned char *)chunk->data;
+        if (p >= base && p < base + chunk->capacity) {
             return true;
         }
-        prev = cur;
-        cur = cur->next;
     }
-    alloc_lock_release();
     return false;
 }
 
+/* Live arena whose chunks hold ptr, or NULL for heap memory */
+static neoc_arena_t *arena_find_owner(const void *ptr) {
+    if (atomic_load(&live_arena_count) == 0) {
+        return NULL;
+    }
+    /* Only this thread changes the chunks of the arena it has active */
+    if (active_arena && arena_owns(active_arena, ptr)) {
+        return active_arena;
+    }
+    neoc_arena_t *owner = NULL;
+    pthread_mutex_lock(&arena_registry_lock);
+    for (neoc_arena_t *arena = live_arenas; arena && !owner; arena = arena->next_live) {
+        if (arena_owns(arena, ptr)) {
+            owner = arena;
+        }
+    }
+    pthread_mutex_unlock(&arena_registry_lock);
+    return owner;
+}
+
+static void *arena_realloc_internal(neoc_arena_t *arena, void *ptr, size_t size) {
+    unsigned char *block = (unsigned char *)ptr - ARENA_HEADER_SIZE;
+    size_t old_size = *(size_t *)block;
+    if (size <= old_size) {
+        return ptr;
+    }
+
+    /* Grow in place when this is the most recent allocation of the newest chunk */
+    arena_chunk_t *chunk = arena->chunks;
+    size_t old_span = ARENA_HEADER_SIZE + arena_align(old_size);
+    if (size <= SIZE_MAX - 2 * ARENA_ALIGNMENT &&
+        block + old_span == (unsigned char *)chunk->data + chunk->used) {
+        size_t new_span = ARENA_HEADER_SIZE + arena_align(size);
+        size_t offset = (size_t)(block - (unsigned char *)chunk->data);
+        if (chunk->capacity - offset >= new_span) {
+            chunk->used = offset + new_span;
+            arena->bytes_used += new_span - old_span;
+            *(size_t *)block = size;
+            return ptr;
+        }
+    }
+
+    void *new_ptr = arena_alloc_internal(arena, size);
+    if (new_ptr) {
+        memcpy(new_ptr, ptr, old_size);
+    }
+    return new_ptr;
+}
+
+neoc_error_t neoc_arena_create(size_t chunk_size, neoc_arena_t **arena) {
+    if (!arena) {
+        return NEOC_ERROR_INVALID_ARGUMENT;
+    }
+    *arena = NULL;
+
+    neoc_arena_t *created = calloc(1, sizeof(neoc_arena_t));
+    if (!created) {
+        return NEOC_ERROR_OUT_OF_MEMORY;
+    }
+    created->chunk_size = arena_align(chunk_size ? chunk_size : ARENA_DEFAULT_CHUNK_SIZE);
+
+    pthread_mutex_lock(&arena_registry_lock);
+    created->next_live = live_arenas;
+    live_arenas = created;
+    atomic_fetch_add(&live_arena_count, 1);
+    pthread_mutex_unlock(&arena_registry_lock);
+
+    *arena = created;
+    return NEOC_SUCCESS;
+}
+
+void* neoc_arena_alloc(neoc_arena_t *arena, size_t size) {
+    if (!arena || size == 0) {
+        return NULL;
+    }
+    return arena_alloc_internal(arena, size);
+}
+
+char* neoc_arena_strdup(neoc_arena_t *arena, const char *str) {
+    if (!arena || !str) {
+        return NULL;
+    }
+    size_t len = strlen(str) + 1;
+    char *copy = arena_alloc_internal(arena, len);
+    if (copy) {
+        memcpy(copy, str, len);
+    }
+    return copy;
+}
+
+void neoc_arena_reset(neoc_arena_t *arena) {
+    if (!arena) {
+        return;
+    }
+    /* Keep the newest (largest) chunk so a steady-state workload stops allocating */
+    arena_chunk_t *keep = arena->chunks;
+    arena_chunk_t *chunk = NULL;
+    pthread_mutex_lock(&arena_registry_lock);
+    if (keep) {
+        chunk = keep->next;
+        keep->next = NULL;
+        keep->used = 0;
+    }
+    pthread_mutex_unlock(&arena_registry_lock);
+    while (chunk) {
+        arena_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    arena->bytes_used = 0;
+}
+
+void neoc_arena_free(neoc_arena_t *arena) {
+    if (!arena) {
+        return;
+    }
+    if (active_arena == arena) {
+        active_arena = NULL;
+    }
+
+    pthread_mutex_lock(&arena_registry_lock);
+    for (neoc_arena_t **link = &live_arenas; *link; link = &(*link)->next_live) {
+        if (*link == arena) {
+            *link = arena->next_live;
+            atomic_fetch_sub(&live_arena_count, 1);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&arena_registry_lock);
+
+    arena_chunk_t *chunk = arena->chunks;
+    while (chunk) {
+        arena_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+size_t neoc_arena_bytes_used(const neoc_arena_t *arena) {
+    return arena ? arena->bytes_used : 0;
+}
+
+neoc_arena_t* neoc_arena_set_active(neoc_arena_t *arena) {
+    neoc_arena_t *previous = active_arena;
+    active_arena = arena;
+    return previous;
+}
+
+neoc_arena_t* neoc_arena_get_active(void) {
+    return active_arena;
+}
+
 void* neoc_malloc(size_t size) {
     if (size == 0) {
         return NULL;
     }
+    if (active_arena) {
+        return arena_alloc_internal(active_arena, size);
+    }
     
     void *ptr = NULL;
     
@@ -108,16 +491,7 @@ void* neoc_malloc(size_t size) {
     }
     
     if (ptr && !custom) {
-        atomic_fetch_add(&stats.allocation_count, 1);
-        track_allocation(ptr, size);
-        atomic_fetch_add(&stats.total_allocated, size);
-        atomic_fetch_add(&stats.current_usage, size);
-        
-        size_t current = atomic_load(&stats.current_usage);
-        size_t peak = atomic_load(&stats.peak_usage);
-        if (current > peak) {
-            atomic_store(&stats.peak_usage, current);
-        }
+        record_allocation(ptr, size);
     }
     
     return ptr;
@@ -131,6 +505,14 @@ void* neoc_calloc(size_t count, size_t size) {
     size_t total = count * size;
     void *ptr = NULL;
     
+    if (active_arena) {
+        ptr = arena_alloc_internal(active_arena, total);
+        if (ptr) {
+            memset(ptr, 0, total);
+        }
+        return ptr;
+    }
+    
     bool custom = using_custom_allocator();
     if (custom_allocator.malloc_func) {
         ptr = custom_allocator.malloc_func(total);
@@ -142,16 +524,7 @@ void* neoc_calloc(size_t count, size_t size) {
     }
     
     if (ptr && !custom) {
-        atomic_fetch_add(&stats.allocation_count, 1);
-        track_allocation(ptr, total);
-        atomic_fetch_add(&stats.total_allocated, total);
-        atomic_fetch_add(&stats.current_usage, total);
-        
-        size_t current = atomic_load(&stats.current_usage);
-        size_t peak = atomic_load(&stats.peak_usage);
-        if (current > peak) {
-            atomic_store(&stats.peak_usage, current);
-        }
+        record_allocation(ptr, total);
     }
     
     return ptr;
@@ -167,6 +540,16 @@ void* neoc_realloc(void *ptr, size_t size) {
         return NULL;
     }
     
+    neoc_arena_t *owner = arena_find_owner(ptr);
+    if (owner) {
+        if (owner != active_arena) {
+            neoc_error_set(NEOC_ERROR_INVALID_STATE,
+                           "neoc_realloc: pointer belongs to an arena that is not active");
+            return NULL;
+        }
+        return arena_realloc_internal(owner, ptr, size);
+    }
+    
     bool custom = using_custom_allocator();
     size_t old_size = 0;
     bool had_entry = false;
@@ -178,17 +561,15 @@ void* neoc_realloc(void *ptr, size_t size) {
                         ? custom_allocator.realloc_func(ptr, size)
                         : realloc(ptr, size);
     if (!new_ptr) {
-        if (had_entry) {
-            track_allocation(ptr, old_size);
+        /* ptr is still live; if it cannot be re-recorded, stop counting it */
+        if (had_entry && !track_allocation(ptr, old_size)) {
+            atomic_fetch_sub(&stats.current_usage, old_size);
         }
         return NULL;
     }
     
     if (!custom) {
-        atomic_fetch_add(&stats.allocation_count, 1);
-        track_allocation(new_ptr, size);
-        atomic_fetch_add(&stats.total_allocated, size);
-        atomic_fetch_add(&stats.current_usage, size);
+        record_allocation(new_ptr, size);
         if (had_entry && old_size > 0) {
             atomic_fetch_add(&stats.free_count, 1);
             atomic_fetch_add(&stats.total_freed, old_size);
@@ -203,6 +584,10 @@ void neoc_free(void *ptr) {
     if (!ptr) {
         return;
     }
+    /* Arena memory is only released by neoc_arena_reset/neoc_arena_free */
+    if (arena_find_owner(ptr)) {
+        return;
+    }
     
     bool custom = using_custom_allocator();
     if (custom_allocator.free_func) {
@@ -517,7 +517,7 @@ static neoc_error_t neoc_signers_to_cjson_array(const neoc_signer_t *signers,
 
 #endif // HAVE_CJSON
 
-neoc_invocation_result_t *neoc_invocation_result_from_json(const char *json_str);
+neoc_invocation_result_t *neoc_invocation_result_from_json_node(const neoc_json_t *json);
 
 /**
  * @brief Create a new Neo protocol client
@@ -667,6 +667,68 @@ neoc_error_t neoc_neo_get_block_by_index(neoc_neo_client_t *client, uint32_t blo
     return neoc_rpc_get_block(client->rpc_client, &block_hash, full_transactions, block);
 }
 
+/**
+ * @brief Get a range of consecutive blocks using batched RPC calls
+ * @param client The Neo client
+ * @param start_index Index of the first block
+ * @param count Number of blocks
+ * @param full_transactions Whether to return full transaction objects
+ * @param blocks Array of count pointers to store the blocks
+ * @param errors Optional array of count per-block error codes
+ * @return Error code indicating success or failure
+ */
+neoc_error_t neoc_neo_get_blocks_by_index(neoc_neo_client_t *client, uint32_t start_index, size_t count,
+                                          bool full_transactions, neoc_block_t **blocks, neoc_error_t *errors) {
+    if (!client || !blocks || count == 0) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments to neoc_neo_get_blocks_by_index");
+    }
+
+    neoc_error_t err = neoc_ensure_rpc_client(client);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        blocks[i] = NULL;
+        if (errors) {
+            errors[i] = NEOC_ERROR_INVALID_STATE;
+        }
+    }
+
+    neoc_rpc_batch_t *batch = NULL;
+    err = neoc_rpc_batch_create(client->rpc_client, 0, &batch);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    for (size_t i = 0; i < count && err == NEOC_SUCCESS; i++) {
+        err = neoc_rpc_batch_add_get_block_by_index(batch, start_index + (uint32_t)i, full_transactions, NULL);
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_rpc_batch_send(batch, NULL);
+    }
+
+    neoc_error_t first_err = err;
+    for (size_t i = 0; i < neoc_rpc_batch_count(batch); i++) {
+        const char *message = NULL;
+        neoc_error_t block_err = neoc_rpc_batch_get_status(batch, i, &message);
+        if (block_err == NEOC_SUCCESS) {
+            block_err = neoc_rpc_batch_get_block(batch, i, &blocks[i]);
+        } else if (first_err == NEOC_SUCCESS) {
+            neoc_error_set(block_err, message);
+        }
+        if (errors) {
+            errors[i] = block_err;
+        }
+        if (first_err == NEOC_SUCCESS) {
+            first_err = block_err;
+        }
+    }
+
+    neoc_rpc_batch_free(batch);
+    return first_err;
+}
+
 /**
  * @brief Get block count
  * @param client The Neo client
@@ -1004,21 +1066,17 @@ neoc_error_t neoc_neo_invoke_function(neoc_neo_client_t *client,
     }
     cJSON_AddItemToArray(request_array, signers_json);
 
-    char *rpc_params = cJSON_PrintUnformatted(request_array);
+    // The parameter tree is printed straight into the request body and the
+    // result node is parsed in place, so neither side goes through text twice
+    cJSON *result_json = NULL;
+    err = neoc_rpc_call_json(client->rpc_client, RPC_INVOKE_FUNCTION, request_array, &result_json);
     cJSON_Delete(request_array);
-    if (!rpc_params) {
-        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to serialize invokefunction parameters");
-    }
-
-    char *raw_response = NULL;
-    err = neoc_rpc_call_raw(client->rpc_client, RPC_INVOKE_FUNCTION, rpc_params, &raw_response);
-    free(rpc_params);
     if (err != NEOC_SUCCESS) {
         return err;
     }
 
-    neoc_invocation_result_t *parsed = neoc_invocation_result_from_json(raw_response);
-    free(raw_response);
+    neoc_invocation_result_t *parsed = neoc_invocation_result_from_json_node(result_json);
+    cJSON_Delete(result_json);
     if (!parsed) {
         return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Failed to parse invokefunction result");
     }
@@ -1081,21 +1139,17 @@ neoc_error_t neoc_neo_invoke_script(neoc_neo_client_t *client,
     }
     cJSON_AddItemToArray(request_array, signers_json);
 
-    char *rpc_params = cJSON_PrintUnformatted(request_array);
+    // The parameter tree is printed straight into the request body and the
+    // result node is parsed in place, so neither side goes through text twice
+    cJSON *result_json = NULL;
+    err = neoc_rpc_call_json(client->rpc_client, RPC_INVOKE_SCRIPT, request_array, &result_json);
     cJSON_Delete(request_array);
-    if (!rpc_params) {
-        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to serialize invokescript parameters");
-    }
-
-    char *raw_response = NULL;
-    err = neoc_rpc_call_raw(client->rpc_client, RPC_INVOKE_SCRIPT, rpc_params, &raw_response);
-    free(rpc_params);
     if (err != NEOC_SUCCESS) {
         return err;
     }
 
-    neoc_invocation_result_t *parsed = neoc_invocation_result_from_json(raw_response);
-    free(raw_response);
+    neoc_invocation_result_t *parsed = neoc_invocation_result_from_json_node(result_json);
+    cJSON_Delete(result_json);
     if (!parsed) {
         return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Failed to parse invokescript result");
     }
@@ -1,7 +1,97 @@
 #include "neoc/protocol/core/polling/block_index_polling.h"
 #include "neoc/protocol/neo_c.h"
 #include "neoc/protocol/core/neo.h"
+#include <pthread.h>
 #include <string.h>
+#include <time.h>
+
+typedef struct {
+    neoc_block_index_polling_t *polling;
+    void *neo_c;
+    neoc_block_index_callback_t callback;
+    neoc_polling_error_callback_t error_callback;
+    void *user_data;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    bool stopping;
+} neoc_polling_worker_t;
+
+/* Worker whose thread is running the calling code, if any */
+static __thread neoc_polling_worker_t *polling_current_worker = NULL;
+
+static void polling_report_error(neoc_polling_worker_t *worker, neoc_error_t err) {
+    if (worker->error_callback) {
+        const neoc_error_info_t *info = neoc_get_last_error();
+        worker->error_callback(err, info ? info->message : "Polling error", worker->user_data);
+    }
+}
+
+/* Sleeps one interval; returns false once the poller is stopping */
+static bool polling_wait(neoc_polling_worker_t *worker) {
+    int ms = worker->polling->polling_interval_ms;
+    struct timespec deadline;
+    timespec_get(&deadline, TIME_UTC);
+    deadline.tv_sec += ms / 1000;
+    deadline.tv_nsec += (long)(ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&worker->lock);
+    while (!worker->stopping) {
+        if (pthread_cond_timedwait(&worker->wake, &worker->lock, &deadline) != 0) {
+            break;
+        }
+    }
+    bool running = !worker->stopping;
+    pthread_mutex_unlock(&worker->lock);
+    return running;
+}
+
+static void *polling_run(void *arg) {
+    neoc_polling_worker_t *worker = (neoc_polling_worker_t *)arg;
+    neoc_block_index_polling_t *polling = worker->polling;
+    polling_current_worker = worker;
+
+    do {
+        if (polling->current_block_index < 0) {
+            uint32_t latest = 0;
+            neoc_error_t err = neoc_neo_get_block_count((neoc_neo_client_t *)worker->neo_c, &latest);
+            if (err != NEOC_SUCCESS) {
+                polling_report_error(worker, err);
+            } else if (latest > 0) {
+                int new_index = (int)latest - 1;
+                polling->current_block_index = new_index;
+                worker->callback(&new_index, 1, worker->user_data);
+            }
+            continue;
+        }
+
+        int *indices = NULL;
+        size_t count = 0;
+        neoc_error_t err = neoc_block_index_polling_poll_once(polling, worker->neo_c, &indices, &count);
+        if (err != NEOC_SUCCESS) {
+            polling_report_error(worker, err);
+        } else if (count > 0) {
+            worker->callback(indices, count, worker->user_data);
+        }
+        neoc_free(indices);
+    } while (polling_wait(worker));
+
+    return NULL;
+}
+
+static void polling_worker_join(neoc_block_index_polling_t *polling) {
+    neoc_polling_worker_t *worker = (neoc_polling_worker_t *)polling->worker;
+    if (!worker) return;
+    pthread_join(worker->thread, NULL);
+    pthread_cond_destroy(&worker->wake);
+    pthread_mutex_destroy(&worker->lock);
+    neoc_free(worker);
+    polling->worker = NULL;
+}
 
 neoc_error_t neoc_block_index_polling_create(
     int polling_interval_ms,
@@ -26,6 +116,8 @@ neoc_error_t neoc_block_index_polling_create(
 void neoc_block_index_polling_free(
     neoc_block_index_polling_t *polling) {
     if (!polling) return;
+    neoc_block_index_polling_stop(polling);
+    polling_worker_join(polling);
     neoc_free(polling);
 }
 
@@ -42,17 +134,32 @@ neoc_error_t neoc_block_index_polling_start(
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid polling arguments");
     }
 
-    uint32_t latest = 0;
-    neoc_error_t err = neoc_neo_get_block_count((neoc_neo_client_t *)neo_c, &latest);
-    if (err == NEOC_SUCCESS) {
-        polling->current_block_index = (int)latest - 1;
-        int new_index = (int)latest - 1;
-        callback(&new_index, 1, user_data);
-    } else if (error_callback) {
-        const neoc_error_info_t *info = neoc_get_last_error();
-        error_callback(err, info ? info->message : "Polling error", user_data);
+    if (polling->worker) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Polling already started");
+    }
+
+    neoc_polling_worker_t *worker = neoc_calloc(1, sizeof(neoc_polling_worker_t));
+    if (!worker) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate polling worker");
     }
-    return err;
+    worker->polling = polling;
+    worker->neo_c = neo_c;
+    worker->callback = callback;
+    worker->error_callback = error_callback;
+    worker->user_data = user_data;
+    pthread_mutex_init(&worker->lock, NULL);
+    pthread_cond_init(&worker->wake, NULL);
+
+    /* Set before the thread runs so a callback can stop it */
+    polling->worker = worker;
+    if (pthread_create(&worker->thread, NULL, polling_run, worker) != 0) {
+        polling->worker = NULL;
+        pthread_cond_destroy(&worker->wake);
+        pthread_mutex_destroy(&worker->lock);
+        neoc_free(worker);
+        return neoc_error_set(NEOC_ERROR_INTERNAL, "Failed to start polling thread");
+    }
+    return NEOC_SUCCESS;
 }
 
 neoc_error_t neoc_block_index_polling_stop(
@@ -60,6 +167,20 @@ neoc_error_t neoc_block_index_polling_stop(
     if (!polling) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Polling is NULL");
     }
+
+    neoc_polling_worker_t *worker = (neoc_polling_worker_t *)polling->worker;
+    if (!worker) {
+        return NEOC_SUCCESS;
+    }
+    pthread_mutex_lock(&worker->lock);
+    worker->stopping = true;
+    pthread_cond_broadcast(&worker->wake);
+    pthread_mutex_unlock(&worker->lock);
+
+    /* From a callback the thread exits once it returns; free joins it */
+    if (polling_current_worker != worker) {
+        polling_worker_join(polling);
+    }
     return NEOC_SUCCESS;
 }
 
@@ -80,12 +201,14 @@ neoc_error_t neoc_block_index_polling_poll_once(
         return err;
     }
 
+    /* The chain tip is one below the block count */
+    int latest_index = (int)latest - 1;
     int current = polling->current_block_index;
-    if ((int)latest <= current) {
+    if (latest_index <= current) {
         return NEOC_SUCCESS;
     }
 
-    size_t diff = (size_t)(latest - current);
+    size_t diff = (size_t)(latest_index - current);
     int *indices = neoc_calloc(diff, sizeof(int));
     if (!indices) {
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate indices");
@@ -94,7 +217,7 @@ neoc_error_t neoc_block_index_polling_poll_once(
         indices[i] = current + 1 + (int)i;
     }
 
-    polling->current_block_index = latest;
+    polling->current_block_index = latest_index;
     *new_indices = indices;
     *count = diff;
     return NEOC_SUCCESS;
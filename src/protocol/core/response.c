@@ -25,6 +25,7 @@ neoc_response_t *neoc_response_create(int id) {
     // Initialize response structure
     response->id = id;
     response->result = NULL;
+    response->result_json = NULL;
     response->error = NULL;
     response->has_error = false;
     response->raw_response = NULL;
@@ -74,6 +75,8 @@ neoc_error_t neoc_response_set_error(neoc_response_t *response, int code,
     
     response->has_error = true;
     response->result = NULL;  // Clear result when setting error
+    neoc_json_free(response->result_json);
+    response->result_json = NULL;
     
     return NEOC_SUCCESS;
 }
@@ -107,6 +110,31 @@ neoc_error_t neoc_response_get_result(const neoc_response_t *response, void **re
     return NEOC_SUCCESS;
 }
 
+/**
+ * @brief Get the result as JSON text, printing the parsed node once
+ */
+neoc_error_t neoc_response_get_result_text(neoc_response_t *response, const char **text) {
+    if (!response || !text) {
+        return NEOC_ERROR_INVALID_PARAM;
+    }
+    
+    *text = NULL;
+    
+    if (response->has_error) {
+        return NEOC_ERROR_PROTOCOL;
+    }
+    
+    if (!response->result && response->result_json) {
+        response->result = neoc_json_to_string(response->result_json);
+        if (!response->result) {
+            return NEOC_ERROR_OUT_OF_MEMORY;
+        }
+    }
+    
+    *text = response->result;
+    return NEOC_SUCCESS;
+}
+
 /**
  * @brief Set raw response string
  */
@@ -244,6 +272,8 @@ void neoc_response_free(neoc_response_t *response) {
     if (response->result) {
         neoc_free(response->result);
     }
+    
+    neoc_json_free(response->result_json);
 
     neoc_free(response);
 }
@@ -294,9 +294,25 @@ neoc_invocation_result_t* neoc_invocation_result_from_json(const char* json_str)
         return NULL;
     }
     
+    neoc_invocation_result_t* result = neoc_invocation_result_from_json_node(root);
+    cJSON_Delete(root);
+    return result;
+#endif
+}
+
+// Parse from an already parsed result node
+neoc_invocation_result_t* neoc_invocation_result_from_json_node(const neoc_json_t* json) {
+#ifndef HAVE_CJSON
+    (void)json;
+    return NULL; // cJSON not available
+#else
+    const cJSON *root = json;
+    if (!cJSON_IsObject(root)) {
+        return NULL;
+    }
+    
     neoc_invocation_result_t* result = neoc_invocation_result_create();
     if (!result) {
-        cJSON_Delete(root);
         return NULL;
     }
     
@@ -338,27 +354,31 @@ neoc_invocation_result_t* neoc_invocation_result_from_json(const char* json_str)
     // Parse stack items
     cJSON *stack = cJSON_GetObjectItem(root, "stack");
     if (stack && cJSON_IsArray(stack)) {
-        size_t stack_size = cJSON_GetArraySize(stack);
-        for (size_t i = 0; i < stack_size; i++) {
-            cJSON *item = cJSON_GetArrayItem(stack, i);
-            if (item) {
-                char *item_str = cJSON_Print(item);
-                if (item_str) {
-                    neoc_stack_item_t *stack_item = neoc_stack_item_from_json(item_str);
-                    if (stack_item) {
-                        neoc_invocation_result_add_stack_item(result, stack_item);
-                    }
-                    free(item_str);
-                }
+        cJSON *item = NULL;
+        cJSON_ArrayForEach(item, stack) {
+            neoc_stack_item_t *stack_item = neoc_stack_item_from_json_node(item);
+            if (stack_item) {
+                neoc_invocation_result_add_stack_item(result, stack_item);
             }
         }
     }
     
-    cJSON_Delete(root);
     return result;
 #endif
 }
 
+// Parse from JSON into an arena
+neoc_invocation_result_t* neoc_invocation_result_from_json_arena(const char* json_str, neoc_arena_t* arena) {
+    if (!json_str || !arena) {
+        return NULL;
+    }
+    
+    neoc_arena_t* previous = neoc_arena_set_active(arena);
+    neoc_invocation_result_t* result = neoc_invocation_result_from_json(json_str);
+    neoc_arena_set_active(previous);
+    return result;
+}
+
 // Convert to JSON
 char* neoc_invocation_result_to_json(const neoc_invocation_result_t* result) {
     if (!result) {
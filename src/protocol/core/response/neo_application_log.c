@@ -298,13 +298,7 @@ static neoc_error_t neoc_application_execution_from_json_object(const cJSON *exe
                 neoc_application_execution_free(execution);
                 return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_execution: invalid stack entry");
             }
-            char *stack_str = cJSON_PrintUnformatted(stack_elem);
-            if (!stack_str) {
-                neoc_application_execution_free(execution);
-                return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_execution: stack item stringify failed");
-            }
-            neoc_stack_item_t *item = neoc_stack_item_from_json(stack_str);
-            cJSON_free(stack_str);
+            neoc_stack_item_t *item = neoc_stack_item_from_json_node(stack_elem);
             if (!item) {
                 neoc_application_execution_free(execution);
                 return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_execution: stack item parse failed");
@@ -327,13 +321,7 @@ static neoc_error_t neoc_application_execution_from_json_object(const cJSON *exe
                 neoc_application_execution_free(execution);
                 return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_execution: notification entry missing");
             }
-            char *notification_str = cJSON_PrintUnformatted(notification_elem);
-            if (!notification_str) {
-                neoc_application_execution_free(execution);
-                return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_execution: notification stringify failed");
-            }
-            neoc_notification_t *notification = neoc_notification_from_json(notification_str);
-            cJSON_free(notification_str);
+            neoc_notification_t *notification = neoc_notification_from_json_node(notification_elem);
             if (!notification) {
                 neoc_application_execution_free(execution);
                 return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_execution: notification parse failed");
@@ -351,31 +339,51 @@ static neoc_error_t neoc_application_execution_from_json_object(const cJSON *exe
     return NEOC_SUCCESS;
 }
 
-static neoc_error_t neoc_application_log_from_json_object(const cJSON *log_obj,
-                                                          neoc_application_log_t **log_out) {
-    neoc_application_log_t *log = NULL;
-    neoc_error_t err = neoc_application_log_allocate(&log);
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
-
+static neoc_error_t neoc_application_log_read_txid(const cJSON *log_obj, neoc_application_log_t *log) {
     const cJSON *txid_item = cJSON_GetObjectItemCaseSensitive(log_obj, "txid");
     if (!txid_item || !cJSON_IsString(txid_item) || !txid_item->valuestring) {
-        neoc_application_log_free(log);
         return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_log: missing txid");
     }
 
     neoc_hash256_t *hash = neoc_malloc(sizeof(neoc_hash256_t));
     if (!hash) {
-        neoc_application_log_free(log);
         return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_log: transaction hash allocation failed");
     }
     if (neoc_hash256_from_string(txid_item->valuestring, hash) != NEOC_SUCCESS) {
         neoc_free(hash);
-        neoc_application_log_free(log);
         return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_log: invalid txid");
     }
     log->transaction_id = hash;
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t neoc_application_log_add_execution_json(neoc_application_log_t *log,
+                                                            const cJSON *exec_obj) {
+    neoc_application_execution_t *execution = NULL;
+    neoc_error_t err = neoc_application_execution_from_json_object(exec_obj, &execution);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    err = neoc_application_log_add_execution(log, execution);
+    if (err != NEOC_SUCCESS) {
+        neoc_application_execution_free(execution);
+    }
+    return err;
+}
+
+static neoc_error_t neoc_application_log_from_json_object(const cJSON *log_obj,
+                                                          neoc_application_log_t **log_out) {
+    neoc_application_log_t *log = NULL;
+    neoc_error_t err = neoc_application_log_allocate(&log);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    err = neoc_application_log_read_txid(log_obj, log);
+    if (err != NEOC_SUCCESS) {
+        neoc_application_log_free(log);
+        return err;
+    }
 
     const cJSON *executions_array = cJSON_GetObjectItemCaseSensitive(log_obj, "executions");
     if (!executions_array || !cJSON_IsArray(executions_array)) {
@@ -385,19 +393,11 @@ static neoc_error_t neoc_application_log_from_json_object(const cJSON *log_obj,
 
     size_t count = (size_t)cJSON_GetArraySize(executions_array);
     for (size_t i = 0; i < count; i++) {
-        cJSON *exec_obj = cJSON_GetArrayItem(executions_array, (int)i);
-        neoc_application_execution_t *execution = NULL;
-        err = neoc_application_execution_from_json_object(exec_obj, &execution);
+        err = neoc_application_log_add_execution_json(log, cJSON_GetArrayItem(executions_array, (int)i));
         if (err != NEOC_SUCCESS) {
             neoc_application_log_free(log);
             return err;
         }
-        err = neoc_application_log_add_execution(log, execution);
-        if (err != NEOC_SUCCESS) {
-            neoc_application_execution_free(execution);
-            neoc_application_log_free(log);
-            return err;
-        }
     }
 
     *log_out = log;
@@ -427,6 +427,24 @@ static neoc_error_t neoc_get_application_log_response_parse_error(const cJSON *r
     return NEOC_SUCCESS;
 }
 
+static neoc_error_t neoc_get_application_log_response_parse_envelope(const cJSON *root,
+                                                                     neoc_get_application_log_response_t *response) {
+    const cJSON *jsonrpc_item = cJSON_GetObjectItemCaseSensitive(root, "jsonrpc");
+    if (jsonrpc_item && cJSON_IsString(jsonrpc_item) && jsonrpc_item->valuestring) {
+        response->jsonrpc = neoc_strdup(jsonrpc_item->valuestring);
+        if (!response->jsonrpc) {
+            return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_log_response: jsonrpc copy failed");
+        }
+    }
+
+    const cJSON *id_item = cJSON_GetObjectItemCaseSensitive(root, "id");
+    if (id_item && cJSON_IsNumber(id_item)) {
+        response->id = id_item->valueint;
+    }
+
+    return neoc_get_application_log_response_parse_error(root, response);
+}
+
 neoc_error_t neoc_get_application_log_response_from_json(const char *json_str,
                                                          neoc_get_application_log_response_t **response_out) {
     if (!json_str || !response_out) {
@@ -446,45 +464,142 @@ neoc_error_t neoc_get_application_log_response_from_json(const char *json_str,
         return err;
     }
 
-    const cJSON *jsonrpc_item = cJSON_GetObjectItemCaseSensitive(root, "jsonrpc");
-    if (jsonrpc_item && cJSON_IsString(jsonrpc_item) && jsonrpc_item->valuestring) {
-        response->jsonrpc = neoc_strdup(jsonrpc_item->valuestring);
-        if (!response->jsonrpc) {
+    err = neoc_get_application_log_response_parse_envelope(root, response);
+    if (err != NEOC_SUCCESS) {
+        neoc_get_application_log_response_free(response);
+        cJSON_Delete(root);
+        return err;
+    }
+
+    const cJSON *result_item = cJSON_GetObjectItemCaseSensitive(root, "result");
+    if (result_item && cJSON_IsObject(result_item)) {
+        neoc_application_log_t *log = NULL;
+        err = neoc_application_log_from_json_object(result_item, &log);
+        if (err != NEOC_SUCCESS) {
             neoc_get_application_log_response_free(response);
             cJSON_Delete(root);
-            return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_log_response: jsonrpc copy failed");
+            return err;
         }
+        response->result = log;
     }
 
-    const cJSON *id_item = cJSON_GetObjectItemCaseSensitive(root, "id");
-    if (id_item && cJSON_IsNumber(id_item)) {
-        response->id = id_item->valueint;
+    *response_out = response;
+    cJSON_Delete(root);
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_get_application_log_response_from_json_arena(const char *json_str,
+                                                               neoc_arena_t *arena,
+                                                               neoc_get_application_log_response_t **response_out) {
+    if (!arena) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "application_log_response: arena is NULL");
+    }
+
+    neoc_arena_t *previous = neoc_arena_set_active(arena);
+    neoc_error_t err = neoc_get_application_log_response_from_json(json_str, response_out);
+    neoc_arena_set_active(previous);
+    return err;
+}
+
+struct neoc_application_log_decoder {
+    neoc_json_splitter_t *splitter;
+    neoc_application_log_t *log;        /* Receives executions as they complete */
+};
+
+static neoc_error_t neoc_application_log_decoder_on_execution(size_t path_index,
+                                                              const neoc_json_t *element,
+                                                              void *user_data) {
+    (void)path_index;
+    neoc_application_log_decoder_t *decoder = user_data;
+    return neoc_application_log_add_execution_json(decoder->log, element);
+}
+
+neoc_error_t neoc_application_log_decoder_create(neoc_application_log_decoder_t **decoder_out) {
+    if (!decoder_out) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "application_log_decoder: create arguments invalid");
+    }
+
+    neoc_application_log_decoder_t *decoder = neoc_calloc(1, sizeof(neoc_application_log_decoder_t));
+    if (!decoder) {
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_log_decoder: allocation failed");
+    }
+
+    neoc_error_t err = neoc_application_log_allocate(&decoder->log);
+    if (err == NEOC_SUCCESS) {
+        const char *executions_path = "result.executions";
+        err = neoc_json_splitter_create(&executions_path, 1, neoc_application_log_decoder_on_execution,
+                                        decoder, &decoder->splitter);
+    }
+    if (err != NEOC_SUCCESS) {
+        neoc_application_log_decoder_free(decoder);
+        return err;
+    }
+
+    *decoder_out = decoder;
+    return NEOC_SUCCESS;
+}
+
+neoc_json_stream_t *neoc_application_log_decoder_stream(neoc_application_log_decoder_t *decoder) {
+    return decoder ? neoc_json_splitter_stream(decoder->splitter) : NULL;
+}
+
+neoc_error_t neoc_application_log_decoder_finish(neoc_application_log_decoder_t *decoder,
+                                                 neoc_get_application_log_response_t **response_out) {
+    if (!decoder || !decoder->log || !response_out) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "application_log_decoder: finish arguments invalid");
+    }
+
+    const neoc_json_t *root = NULL;
+    neoc_error_t err = neoc_json_splitter_finish(decoder->splitter, &root);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    if (!cJSON_IsObject(root)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_log_response: JSON is not an object");
+    }
+
+    neoc_get_application_log_response_t *response = NULL;
+    err = neoc_get_application_log_response_allocate(&response);
+    if (err != NEOC_SUCCESS) {
+        return err;
     }
 
-    err = neoc_get_application_log_response_parse_error(root, response);
+    err = neoc_get_application_log_response_parse_envelope(root, response);
     if (err != NEOC_SUCCESS) {
         neoc_get_application_log_response_free(response);
-        cJSON_Delete(root);
         return err;
     }
 
+    /* The skeleton keeps an empty executions array where the split ones were */
     const cJSON *result_item = cJSON_GetObjectItemCaseSensitive(root, "result");
     if (result_item && cJSON_IsObject(result_item)) {
-        neoc_application_log_t *log = NULL;
-        err = neoc_application_log_from_json_object(result_item, &log);
+        const cJSON *executions_array = cJSON_GetObjectItemCaseSensitive(result_item, "executions");
+        if (!executions_array || !cJSON_IsArray(executions_array)) {
+            neoc_get_application_log_response_free(response);
+            return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_log: executions missing or invalid");
+        }
+        err = neoc_application_log_read_txid(result_item, decoder->log);
         if (err != NEOC_SUCCESS) {
             neoc_get_application_log_response_free(response);
-            cJSON_Delete(root);
             return err;
         }
-        response->result = log;
+        response->result = decoder->log;
+        decoder->log = NULL;
     }
 
     *response_out = response;
-    cJSON_Delete(root);
     return NEOC_SUCCESS;
 }
 
+void neoc_application_log_decoder_free(neoc_application_log_decoder_t *decoder) {
+    if (!decoder) {
+        return;
+    }
+    neoc_json_splitter_free(decoder->splitter);
+    neoc_application_log_free(decoder->log);
+    neoc_free(decoder);
+}
+
 #endif
 
 neoc_error_t neoc_get_application_log_response_to_json(const neoc_get_application_log_response_t *response,
@@ -580,16 +695,10 @@ neoc_error_t neoc_get_application_log_response_to_json(const neoc_get_applicatio
                 if (!item) {
                     continue;
                 }
-                char *item_json = neoc_stack_item_to_json(item);
-                if (!item_json) {
-                    cJSON_Delete(root);
-                    return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_log_response: stack item serialization failed");
-                }
-                cJSON *item_obj = cJSON_Parse(item_json);
-                cJSON_free(item_json);
+                cJSON *item_obj = neoc_stack_item_to_json_node(item);
                 if (!item_obj) {
                     cJSON_Delete(root);
-                    return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_log_response: stack item json invalid");
+                    return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_log_response: stack item serialization failed");
                 }
                 cJSON_AddItemToArray(stack_array, item_obj);
             }
@@ -612,7 +721,7 @@ neoc_error_t neoc_get_application_log_response_to_json(const neoc_get_applicatio
                     return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "application_log_response: notification serialization failed");
                 }
                 cJSON *notification_obj = cJSON_Parse(notification_json);
-                cJSON_free(notification_json);
+                neoc_free(notification_json);
                 if (!notification_obj) {
                     cJSON_Delete(root);
                     return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "application_log_response: notification json invalid");
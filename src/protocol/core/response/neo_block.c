@@ -8,6 +8,7 @@
 #include "neoc/transaction/witness.h"
 #include "neoc/neoc_memory.h"
 #include "neoc/crypto/hash.h"
+#include "neoc/crypto/merkle_tree.h"
 #include "neoc/utils/neoc_hex.h"
 
 // Create block
@@ -194,6 +195,23 @@ void neoc_neo_block_add_transaction(neoc_neo_block_t* block, neoc_transaction_t*
     block->transaction_count++;
 }
 
+// Collect transaction hashes, reusing the ones already cached on each transaction
+static neoc_hash256_t* neoc_neo_block_collect_tx_hashes(const neoc_neo_block_t* block) {
+    neoc_hash256_t* hashes = neoc_malloc(block->transaction_count * sizeof(neoc_hash256_t));
+    if (!hashes) {
+        return NULL;
+    }
+    
+    for (size_t i = 0; i < block->transaction_count; i++) {
+        neoc_error_t err = neoc_transaction_get_hash(block->transactions[i], &hashes[i]);
+        if (err != NEOC_SUCCESS) {
+            // Set to zero hash on error
+            memset(&hashes[i], 0, sizeof(neoc_hash256_t));
+        }
+    }
+    return hashes;
+}
+
 // Calculate merkle root
 neoc_hash256_t neoc_neo_block_calculate_merkle_root(const neoc_neo_block_t* block) {
     neoc_hash256_t root;
@@ -203,90 +221,38 @@ neoc_hash256_t neoc_neo_block_calculate_merkle_root(const neoc_neo_block_t* bloc
         return root;
     }
     
-    // Special case: single transaction
-    if (block->transaction_count == 1) {
-        neoc_hash256_t tx_hash;
-        neoc_error_t err = neoc_transaction_calculate_hash(block->transactions[0], &tx_hash);
-        if (err == NEOC_SUCCESS) {
-            return tx_hash;
-        }
-        return root;
-    }
-    
-    // Collect all transaction hashes
-    neoc_hash256_t* hashes = neoc_malloc(block->transaction_count * sizeof(neoc_hash256_t));
+    neoc_hash256_t* hashes = neoc_neo_block_collect_tx_hashes(block);
     if (!hashes) {
         return root;
     }
     
-    for (size_t i = 0; i < block->transaction_count; i++) {
-        neoc_error_t err = neoc_transaction_calculate_hash(block->transactions[i], &hashes[i]);
-        if (err != NEOC_SUCCESS) {
-            // Set to zero hash on error
-            memset(&hashes[i], 0, sizeof(neoc_hash256_t));
-        }
+    if (neoc_merkle_root_in_place(hashes, block->transaction_count, &root) != NEOC_SUCCESS) {
+        memset(&root, 0, sizeof(root));
     }
     
-    // Build merkle tree bottom-up
-    size_t level_count = block->transaction_count;
-    neoc_hash256_t* level_hashes = hashes;
-    
-    while (level_count > 1) {
-        size_t next_level_count = (level_count + 1) / 2;
-        neoc_hash256_t* next_level = neoc_malloc(next_level_count * sizeof(neoc_hash256_t));
-        if (!next_level) {
-            neoc_free(hashes);
-            return root;
-        }
-        
-        for (size_t i = 0; i < next_level_count; i++) {
-            size_t left_index = i * 2;
-            size_t right_index = left_index + 1;
-            
-            // Create combined hash
-            uint8_t combined[64];
-            memcpy(combined, level_hashes[left_index].data, 32);
-            
-            if (right_index < level_count) {
-                // Use right hash
-                memcpy(combined + 32, level_hashes[right_index].data, 32);
-            } else {
-                // Duplicate left hash for odd count
-                memcpy(combined + 32, level_hashes[left_index].data, 32);
-            }
-            
-            // Double SHA256 hash
-            uint8_t first_hash[32];
-            neoc_error_t err = neoc_hash_sha256(combined, 64, first_hash);
-            if (err == NEOC_SUCCESS) {
-                err = neoc_hash_sha256(first_hash, 32, next_level[i].data);
-            }
-            
-            if (err != NEOC_SUCCESS) {
-                neoc_free(next_level);
-                neoc_free(hashes);
-                memset(&root, 0, sizeof(root));
-                return root;
-            }
-        }
-        
-        // Move to next level
-        if (level_hashes != hashes) {
-            neoc_free(level_hashes);
-        }
-        level_hashes = next_level;
-        level_count = next_level_count;
+    neoc_free(hashes);
+    return root;
+}
+
+// Get merkle proof for one transaction
+neoc_error_t neoc_neo_block_get_merkle_proof(const neoc_neo_block_t* block,
+                                             size_t tx_index,
+                                             neoc_hash256_t* path,
+                                             size_t path_capacity,
+                                             size_t* path_len) {
+    if (!block || tx_index >= block->transaction_count) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    // Copy final root
-    root = level_hashes[0];
-    
-    if (level_hashes != hashes) {
-        neoc_free(level_hashes);
+    neoc_hash256_t* hashes = neoc_neo_block_collect_tx_hashes(block);
+    if (!hashes) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate transaction hashes");
     }
-    neoc_free(hashes);
     
-    return root;
+    neoc_error_t err = neoc_merkle_get_proof(hashes, block->transaction_count, tx_index,
+                                             path, path_capacity, path_len, NULL);
+    neoc_free(hashes);
+    return err;
 }
 
 // Calculate block hash
@@ -385,24 +351,9 @@ bool neoc_neo_block_verify(const neoc_neo_block_t* block) {
     return true;
 }
 
-// Parse from JSON
-neoc_neo_block_t* neoc_neo_block_from_json(const char* json_str) {
-    if (!json_str) {
-        return NULL;
-    }
-    
 #ifdef HAVE_CJSON
-    cJSON *root = cJSON_Parse(json_str);
-    if (!root) {
-        return NULL;
-    }
-    
-    neoc_neo_block_t* block = neoc_neo_block_create();
-    if (!block) {
-        cJSON_Delete(root);
-        return NULL;
-    }
-    
+// Read the header fields of a block object; transactions are handled by the callers
+static void neo_block_read_header(const cJSON* root, neoc_neo_block_t* block) {
     // Parse hash
     cJSON *hash = cJSON_GetObjectItem(root, "hash");
     if (hash && cJSON_IsString(hash)) {
@@ -476,34 +427,208 @@ neoc_neo_block_t* neoc_neo_block_from_json(const char* json_str) {
         // Currently set to NULL as witness parsing needs to be implemented
         block->header.witness = NULL;
     }
+}
+
+// Parse one entry of the "tx" array
+static neoc_transaction_t* neo_block_read_transaction(const cJSON* tx_item) {
+    return neoc_transaction_from_json_node(tx_item);
+}
+#endif
+
+// Parse from JSON
+neoc_neo_block_t* neoc_neo_block_from_json(const char* json_str) {
+    if (!json_str) {
+        return NULL;
+    }
+    
+#ifdef HAVE_CJSON
+    cJSON *root = cJSON_Parse(json_str);
+    if (!root) {
+        return NULL;
+    }
+    
+    neoc_neo_block_t* block = neoc_neo_block_from_json_node(root);
+    cJSON_Delete(root);
+    return block;
+#else
+    return NULL; // cJSON not available
+#endif
+}
+
+// Parse from an already parsed block node
+neoc_neo_block_t* neoc_neo_block_from_json_node(const neoc_json_t* json) {
+#ifdef HAVE_CJSON
+    const cJSON *root = json;
+    if (!cJSON_IsObject(root)) {
+        return NULL;
+    }
+    
+    neoc_neo_block_t* block = neoc_neo_block_create();
+    if (!block) {
+        return NULL;
+    }
+    
+    neo_block_read_header(root, block);
     
     // Parse transactions
     cJSON *tx_array = cJSON_GetObjectItem(root, "tx");
     if (tx_array && cJSON_IsArray(tx_array)) {
         size_t tx_count = cJSON_GetArraySize(tx_array);
-        for (size_t i = 0; i < tx_count; i++) {
-            cJSON *tx_item = cJSON_GetArrayItem(tx_array, i);
-            if (tx_item) {
-                char* tx_str = cJSON_Print(tx_item);
-                if (tx_str) {
-                    // Parse transaction from JSON
-                    neoc_transaction_t* tx = neoc_transaction_from_json(tx_str);
-                    if (tx) {
-                        neoc_neo_block_add_transaction(block, tx);
-                    }
-                    neoc_free(tx_str);
-                }
+        if (tx_count > 0) {
+            // Size the array once instead of growing it per transaction
+            block->transactions = neoc_calloc(tx_count, sizeof(neoc_transaction_t*));
+        }
+        cJSON *tx_item = NULL;
+        cJSON_ArrayForEach(tx_item, tx_array) {
+            if (!block->transactions) {
+                break;
+            }
+            neoc_transaction_t* tx = neo_block_read_transaction(tx_item);
+            if (tx) {
+                block->transactions[block->transaction_count++] = tx;
             }
         }
     }
     
-    cJSON_Delete(root);
     return block;
 #else
+    (void)json;
     return NULL; // cJSON not available
 #endif
 }
 
+// Parse from JSON into an arena
+neoc_neo_block_t* neoc_neo_block_from_json_arena(const char* json_str, neoc_arena_t* arena) {
+    if (!json_str || !arena) {
+        return NULL;
+    }
+    
+    neoc_arena_t* previous = neoc_arena_set_active(arena);
+    neoc_neo_block_t* block = neoc_neo_block_from_json(json_str);
+    neoc_arena_set_active(previous);
+    return block;
+}
+
+struct neoc_neo_block_decoder {
+    neoc_json_splitter_t* splitter;
+    neoc_neo_block_t* block;
+    size_t tx_capacity;
+    bool rpc_envelope;
+};
+
+#ifdef HAVE_CJSON
+// Called for each complete element of the "tx" array
+static neoc_error_t neo_block_decoder_on_tx(size_t path_index, const neoc_json_t* element, void* user_data) {
+    (void)path_index;
+    neoc_neo_block_decoder_t* decoder = user_data;
+    neoc_neo_block_t* block = decoder->block;
+    
+    neoc_transaction_t* tx = neo_block_read_transaction(element);
+    if (!tx) {
+        // Unparseable transactions are skipped, as in neoc_neo_block_from_json
+        return NEOC_SUCCESS;
+    }
+    
+    if (block->transaction_count == decoder->tx_capacity) {
+        size_t capacity = decoder->tx_capacity ? decoder->tx_capacity * 2 : 16;
+        neoc_transaction_t** txs = neoc_realloc(block->transactions, capacity * sizeof(neoc_transaction_t*));
+        if (!txs) {
+            neoc_transaction_free(tx);
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to grow block transactions");
+        }
+        block->transactions = txs;
+        decoder->tx_capacity = capacity;
+    }
+    block->transactions[block->transaction_count++] = tx;
+    return NEOC_SUCCESS;
+}
+#endif
+
+// Create streaming decoder
+neoc_error_t neoc_neo_block_decoder_create(bool rpc_envelope, neoc_neo_block_decoder_t** decoder) {
+    if (!decoder) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+#ifdef HAVE_CJSON
+    neoc_neo_block_decoder_t* created = neoc_calloc(1, sizeof(neoc_neo_block_decoder_t));
+    if (!created) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate block decoder");
+    }
+    created->rpc_envelope = rpc_envelope;
+    
+    created->block = neoc_neo_block_create();
+    if (!created->block) {
+        neoc_free(created);
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate block");
+    }
+    
+    const char* tx_path = rpc_envelope ? "result.tx" : "tx";
+    neoc_error_t err = neoc_json_splitter_create(&tx_path, 1, neo_block_decoder_on_tx, created,
+                                                 &created->splitter);
+    if (err != NEOC_SUCCESS) {
+        neoc_neo_block_decoder_free(created);
+        return err;
+    }
+    
+    *decoder = created;
+    return NEOC_SUCCESS;
+#else
+    (void)rpc_envelope;
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "JSON support not compiled");
+#endif
+}
+
+// Stream to feed the block JSON into
+neoc_json_stream_t* neoc_neo_block_decoder_stream(neoc_neo_block_decoder_t* decoder) {
+    return decoder ? neoc_json_splitter_stream(decoder->splitter) : NULL;
+}
+
+// Finish decoding
+neoc_error_t neoc_neo_block_decoder_finish(neoc_neo_block_decoder_t* decoder, neoc_neo_block_t** block) {
+    if (!decoder || !block || !decoder->block) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+#ifdef HAVE_CJSON
+    const neoc_json_t* skeleton = NULL;
+    neoc_error_t err = neoc_json_splitter_finish(decoder->splitter, &skeleton);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    const cJSON* root = skeleton;
+    if (decoder->rpc_envelope) {
+        const cJSON* error = cJSON_GetObjectItem(skeleton, "error");
+        if (error && !cJSON_IsNull(error)) {
+            const cJSON* message = cJSON_GetObjectItem(error, "message");
+            return neoc_error_set(NEOC_ERROR_RPC, cJSON_IsString(message) ? message->valuestring : "RPC error");
+        }
+        root = cJSON_GetObjectItem(skeleton, "result");
+    }
+    if (!cJSON_IsObject(root)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Block JSON is not an object");
+    }
+    
+    neo_block_read_header(root, decoder->block);
+    *block = decoder->block;
+    decoder->block = NULL;
+    return NEOC_SUCCESS;
+#else
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "JSON support not compiled");
+#endif
+}
+
+// Free streaming decoder
+void neoc_neo_block_decoder_free(neoc_neo_block_decoder_t* decoder) {
+    if (!decoder) {
+        return;
+    }
+    neoc_json_splitter_free(decoder->splitter);
+    neoc_neo_block_free(decoder->block);
+    neoc_free(decoder);
+}
+
 // Convert to JSON
 char* neoc_neo_block_to_json(const neoc_neo_block_t* block) {
     if (!block) {
@@ -117,25 +117,31 @@ neoc_notification_t* neoc_notification_from_json(const char* json_str) {
         return NULL;
     }
     
-    neoc_notification_t* notification = NULL;
+    neoc_notification_t* notification = neoc_notification_from_json_node(json);
+    neoc_json_free(json);
+    return notification;
+}
+
+// Parse from an already parsed JSON object
+neoc_notification_t* neoc_notification_from_json_node(const neoc_json_t* json) {
+    if (!json) {
+        return NULL;
+    }
     
     // Get contract hash
     const char* contract_str = neoc_json_get_string(json, "contract");
     if (!contract_str) {
-        neoc_json_free(json);
         return NULL;
     }
     
     neoc_hash160_t contract;
     if (neoc_hash160_from_string(contract_str, &contract) != NEOC_SUCCESS) {
-        neoc_json_free(json);
         return NULL;
     }
     
     // Get event name
     const char* event_name = neoc_json_get_string(json, "eventname");
     if (!event_name) {
-        neoc_json_free(json);
         return NULL;
     }
     
@@ -144,22 +150,16 @@ neoc_notification_t* neoc_notification_from_json(const char* json_str) {
     neoc_stack_item_t* state = NULL;
     
     if (state_json) {
-        // Convert state JSON to string for parsing
-        char* state_str = neoc_json_to_string(state_json);
-        if (state_str) {
-            state = neoc_stack_item_from_json(state_str);
-            neoc_free(state_str);
-        }
+        state = neoc_stack_item_from_json_node(state_json);
     }
     
     // Create notification
-    notification = neoc_notification_create(&contract, event_name, state);
+    neoc_notification_t* notification = neoc_notification_create(&contract, event_name, state);
     
     if (!notification && state) {
         neoc_stack_item_free(state);
     }
     
-    neoc_json_free(json);
     return notification;
 }
 
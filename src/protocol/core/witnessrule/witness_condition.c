@@ -815,10 +815,7 @@ static neoc_error_t neoc_witness_condition_serialize_internal(
 
         case NEOC_WITNESS_CONDITION_SCRIPT_HASH:
         case NEOC_WITNESS_CONDITION_CALLED_BY_CONTRACT:
-            return neoc_binary_writer_write_bytes(
-                writer,
-                condition->data.hash_condition.hash.data,
-                NEOC_HASH160_SIZE);
+            return neoc_hash160_serialize(&condition->data.hash_condition.hash, writer);
 
         case NEOC_WITNESS_CONDITION_GROUP:
         case NEOC_WITNESS_CONDITION_CALLED_BY_GROUP: {
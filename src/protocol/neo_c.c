@@ -13,8 +13,6 @@
 #include "neoc/protocol/rx/json_rpc2_0_rx.h"
 #include "neoc/neoc_memory.h"
 #include "neoc/neoc_error.h"
-#include "neoc/utils/decode.h"
-#include <cjson/cJSON.h>
 #include <string.h>
 #include <stdlib.h>
 #include <pthread.h>
@@ -186,103 +184,28 @@ neoc_error_t neoc_neo_c_send_request(neoc_neo_c_t *neo_c,
         return err;
     }
 
-    if (!result || !result->data) {
-        neoc_byte_array_free(result);
-        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT,
-                              "Service returned empty response");
-    }
-
-    char *response_str = neoc_malloc(result->length + 1);
-    if (!response_str) {
-        neoc_byte_array_free(result);
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate response buffer");
-    }
-    memcpy(response_str, result->data, result->length);
-    response_str[result->length] = '\0';
-
-    cJSON *response_json = cJSON_Parse(response_str);
-    if (!response_json || !cJSON_IsObject(response_json)) {
-        cJSON_Delete(response_json);
-        neoc_byte_array_free(result);
-        neoc_free(response_str);
-        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Failed to parse response JSON");
-    }
-
-    neoc_response_t *resp = neoc_response_create(0);
-    if (!resp) {
-        cJSON_Delete(response_json);
-        neoc_byte_array_free(result);
-        neoc_free(response_str);
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate response");
-    }
-
-    const cJSON *jsonrpc = cJSON_GetObjectItemCaseSensitive(response_json, "jsonrpc");
-    if (cJSON_IsString(jsonrpc) && jsonrpc->valuestring) {
-        neoc_free(resp->jsonrpc);
-        resp->jsonrpc = neoc_strdup(jsonrpc->valuestring);
-    }
-
-    const cJSON *id = cJSON_GetObjectItemCaseSensitive(response_json, "id");
-    if (id) {
-        if (cJSON_IsNumber(id)) {
-            resp->id = (int)id->valuedouble;
-        } else if (cJSON_IsString(id) && id->valuestring) {
-            int parsed_id = 0;
-            if (neoc_decode_int_from_string(id->valuestring, &parsed_id) == NEOC_SUCCESS) {
-                resp->id = parsed_id;
-            }
-        }
-    }
-
-    if (service->config.include_raw_responses) {
-        neoc_response_set_raw(resp, response_str);
-    }
-
-    const cJSON *error_obj = cJSON_GetObjectItemCaseSensitive(response_json, "error");
-    if (error_obj && cJSON_IsObject(error_obj)) {
-        const cJSON *code = cJSON_GetObjectItemCaseSensitive(error_obj, "code");
-        const cJSON *message = cJSON_GetObjectItemCaseSensitive(error_obj, "message");
-        const cJSON *data = cJSON_GetObjectItemCaseSensitive(error_obj, "data");
+    err = neoc_service_parse_response(service, 0, result, response_out);
+    neoc_byte_array_free(result);
+    return err;
+}
 
-        char *data_str = NULL;
-        if (data) {
-            if (cJSON_IsString(data) && data->valuestring) {
-                data_str = data->valuestring;
-            } else {
-                data_str = cJSON_PrintUnformatted((cJSON *)data);
-            }
-        }
+typedef struct {
+    const neoc_service_t *service;
+    neoc_neo_c_callback_t callback;
+    void *user_data;
+} neo_c_async_context_t;
 
-        neoc_response_set_error(resp,
-                                 code && cJSON_IsNumber(code) ? (int)code->valuedouble : -1,
-                                 message && cJSON_IsString(message) ? message->valuestring : NULL,
-                                 data_str);
+static void neo_c_async_completed(neoc_byte_array_t *result, neoc_error_t err, void *user_data) {
+    neo_c_async_context_t *ctx = (neo_c_async_context_t *)user_data;
+    neoc_response_t *response = NULL;
 
-        if (data && data_str && data_str != data->valuestring) {
-            cJSON_free(data_str);
-        }
-    } else {
-        const cJSON *result_obj = cJSON_GetObjectItemCaseSensitive(response_json, "result");
-        if (result_obj) {
-            char *result_str = cJSON_PrintUnformatted((cJSON *)result_obj);
-            if (!result_str) {
-                neoc_response_free(resp);
-                cJSON_Delete(response_json);
-                neoc_byte_array_free(result);
-                neoc_free(response_str);
-                return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to serialize result");
-            }
-            resp->result = result_str;
-            resp->has_error = false;
-        }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_service_parse_response(ctx->service, 0, result, &response);
     }
-
-    *response_out = resp;
-
-    cJSON_Delete(response_json);
     neoc_byte_array_free(result);
-    neoc_free(response_str);
-    return NEOC_SUCCESS;
+
+    ctx->callback(response, err, ctx->user_data);
+    neoc_free(ctx);
 }
 
 /**
@@ -297,9 +220,25 @@ neoc_error_t neoc_neo_c_send_request_async(neoc_neo_c_t *neo_c,
                               "Invalid arguments to send_request_async");
     }
 
-    neoc_response_t *response = NULL;
-    neoc_error_t err = neoc_neo_c_send_request(neo_c, request_data, &response);
-    callback(response, err, user_data);
+    neoc_service_t *service = neoc_neo_c_get_service(neo_c);
+    if (!service) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE,
+                              "NeoC client missing base service");
+    }
+
+    neo_c_async_context_t *ctx = neoc_malloc(sizeof(neo_c_async_context_t));
+    if (!ctx) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate async context");
+    }
+    ctx->service = service;
+    ctx->callback = callback;
+    ctx->user_data = user_data;
+
+    neoc_error_t err = neoc_service_perform_io_async(service, request_data,
+                                                     neo_c_async_completed, ctx, NULL);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(ctx);
+    }
     return err;
 }
 
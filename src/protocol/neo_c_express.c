@@ -69,9 +69,11 @@ static neoc_error_t express_send_request(
                               "Express client missing base service");
     }
 
-    neoc_response_t *response = NULL;
-    neoc_error_t err = neoc_service_send_request(service, request, &response);
-    callback(response, err, user_data);
+    neoc_error_t err = neoc_service_send_request_async(service, request, callback, user_data, NULL);
+    neoc_request_free(request);
+    if (err != NEOC_SUCCESS) {
+        callback(NULL, err, user_data);
+    }
     return err;
 }
 
@@ -8,6 +8,7 @@
 #include "neoc/contract/contract_manifest.h"
 #include "neoc/utils/neoc_hex.h"
 #include "neoc/utils/neoc_base64.h"
+#include "neoc/utils/json.h"
 #include "neoc/neo_constants.h"
 #include "neoc/neoc_memory.h"
 #include <string.h>
@@ -28,6 +29,13 @@
 #include <cjson/cJSON.h>
 #endif
 
+// Response buffer structure
+typedef struct {
+    char *data;
+    size_t size;
+    size_t capacity;
+} response_buffer_t;
+
 // RPC client structure
 struct neoc_rpc_client_t {
     char *url;
@@ -36,18 +44,14 @@ struct neoc_rpc_client_t {
 #ifdef HAVE_CURL
     CURL *curl;
 #endif
+    char *request_buf;          // Reused request body, grown on demand
+    size_t request_capacity;
+    response_buffer_t response; // Reused response body, grown on demand
 };
 
-// Response buffer structure
-typedef struct {
-    char *data;
-    size_t size;
-    size_t capacity;
-} response_buffer_t;
-
 #ifdef HAVE_CURL
 // CURL write callback
-static size_t write_callback(void *contents, size_t size, size_t nmemb, void *userp) {
+static size_t write_callback(char *contents, size_t size, size_t nmemb, void *userp) {
     size_t real_size = size * nmemb;
     response_buffer_t *buf = (response_buffer_t *)userp;
     
@@ -112,122 +116,351 @@ neoc_error_t neoc_rpc_client_set_timeout(neoc_rpc_client_t *client, uint32_t tim
     return NEOC_SUCCESS;
 }
 
-// Helper function to make RPC call
-static neoc_error_t make_rpc_call(neoc_rpc_client_t *client,
-                                   const char *method,
-                                   const char *params,
-                                   char **result) {
-    if (!client || !method || !result) {
-        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
-    }
-    
-#ifndef HAVE_CURL
-    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "CURL support not compiled in");
-#else
-#ifndef HAVE_CJSON
-    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
-#else
-    
-    // Create JSON-RPC request
-    cJSON *request = cJSON_CreateObject();
-    if (!request) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to create JSON request");
-    }
-    
-    cJSON_AddStringToObject(request, "jsonrpc", "2.0");
-    cJSON_AddStringToObject(request, "method", method);
-    cJSON_AddNumberToObject(request, "id", client->request_id++);
-    
-    if (params) {
-        cJSON *params_json = cJSON_Parse(params);
-        if (!params_json) {
-            cJSON_Delete(request);
-            return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid JSON parameters");
+// Method names go out unescaped, so anything that would need escaping is refused
+static bool rpc_method_name_valid(const char *method) {
+    for (const char *c = method; *c; c++) {
+        if (*c == '"' || *c == '\\' || (unsigned char)*c < 0x20) {
+            return false;
         }
-        cJSON_AddItemToObject(request, "params", params_json);
-    } else {
-        cJSON *params_array = cJSON_CreateArray();
-        cJSON_AddItemToObject(request, "params", params_array);
-    }
-    
-    char *request_str = cJSON_PrintUnformatted(request);
-    cJSON_Delete(request);
-    
-    if (!request_str) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to serialize request");
     }
-    
-    // Setup response buffer
-    response_buffer_t response_buf = {0};
-    response_buf.data = neoc_malloc(4096);
-    response_buf.capacity = 4096;
-    
-    if (!response_buf.data) {
-        free(request_str);
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate response buffer");
+    return *method != '\0';
+}
+
+#ifdef HAVE_CJSON
+// Upper bound for text printed with rpc_print_json
+#define RPC_MAX_PRINTED_SIZE (64u * 1024u * 1024u)
+
+/*
+ * Prints a node, unformatted, at *len in a growable neoc buffer with
+ * cJSON_PrintPreallocated and advances *len past the text. The buffer is
+ * left terminated.
+ */
+static neoc_error_t rpc_print_json(const cJSON *node, char **buffer, size_t *capacity,
+                                   size_t *len) {
+    // cJSON wants 5 bytes more than the printed text
+    size_t room = *capacity > *len + 5 ? *capacity - *len : 256;
+    for (;;) {
+        if (*len + room > *capacity) {
+            char *data = neoc_realloc(*buffer, *len + room);
+            if (!data) {
+                return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to grow JSON buffer");
+            }
+            *buffer = data;
+            *capacity = *len + room;
+        }
+        if (cJSON_PrintPreallocated((cJSON *)node, *buffer + *len, (int)room, false)) {
+            *len += strlen(*buffer + *len);
+            return NEOC_SUCCESS;
+        }
+        if (room >= RPC_MAX_PRINTED_SIZE) {
+            return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "JSON node cannot be printed");
+        }
+        room *= 2;
     }
-    
-    // Setup CURL
+}
+#endif
+
+#if defined(HAVE_CURL) && defined(HAVE_CJSON)
+// Posts a serialized JSON-RPC payload, handing the reply body to write_fn
+static neoc_error_t rpc_perform(neoc_rpc_client_t *client,
+                                const char *request_str,
+                                curl_write_callback write_fn,
+                                void *write_data) {
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
     
     curl_easy_setopt(client->curl, CURLOPT_URL, client->url);
     curl_easy_setopt(client->curl, CURLOPT_POSTFIELDS, request_str);
     curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, headers);
-    curl_easy_setopt(client->curl, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, &response_buf);
+    curl_easy_setopt(client->curl, CURLOPT_WRITEFUNCTION, write_fn);
+    curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, write_data);
     curl_easy_setopt(client->curl, CURLOPT_TIMEOUT_MS, client->timeout_ms);
     
     // Perform request
     CURLcode res = curl_easy_perform(client->curl);
     
     curl_slist_free_all(headers);
-    free(request_str);
     
     if (res != CURLE_OK) {
-        neoc_free(response_buf.data);
         return neoc_error_set(NEOC_ERROR_NETWORK, curl_easy_strerror(res));
     }
+    return NEOC_SUCCESS;
+}
+
+// Posts a serialized JSON-RPC payload and parses the reply
+static neoc_error_t rpc_exchange(neoc_rpc_client_t *client,
+                                 const char *request_str,
+                                 cJSON **response) {
+    // The response buffer keeps its capacity between calls
+    response_buffer_t *response_buf = &client->response;
+    if (!response_buf->data) {
+        response_buf->data = neoc_malloc(4096);
+        if (!response_buf->data) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate response buffer");
+        }
+        response_buf->capacity = 4096;
+    }
+    response_buf->size = 0;
+    response_buf->data[0] = '\0';
+    
+    neoc_error_t err = rpc_perform(client, request_str, write_callback, response_buf);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
     
     // Parse response
-    cJSON *response = cJSON_Parse(response_buf.data);
-    if (!response) {
-        neoc_free(response_buf.data);
+    *response = cJSON_ParseWithLength(response_buf->data, response_buf->size);
+    if (!*response) {
         return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Failed to parse response");
     }
     
+    return NEOC_SUCCESS;
+}
+
+// Grows the request buffer to hold at least `needed` bytes
+static neoc_error_t rpc_request_reserve(neoc_rpc_client_t *client, size_t needed) {
+    if (needed <= client->request_capacity) {
+        return NEOC_SUCCESS;
+    }
+    
+    size_t capacity = client->request_capacity ? client->request_capacity : 1024;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+    
+    char *data = neoc_realloc(client->request_buf, capacity);
+    if (!data) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to grow request buffer");
+    }
+    client->request_buf = data;
+    client->request_capacity = capacity;
+    return NEOC_SUCCESS;
+}
+
+// Appends n bytes at *len, growing the request buffer as needed
+static neoc_error_t rpc_request_append(neoc_rpc_client_t *client, size_t *len,
+                                       const char *data, size_t n) {
+    // One spare byte so the finished request can always be terminated
+    neoc_error_t err = rpc_request_reserve(client, *len + n + 1);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    memcpy(client->request_buf + *len, data, n);
+    *len += n;
+    return NEOC_SUCCESS;
+}
+
+/*
+ * Appends one JSON-RPC request object at *len in the client's request
+ * buffer. Parameters are either JSON text, copied verbatim, or a node
+ * printed in place; neither form is parsed here.
+ */
+static neoc_error_t rpc_append_request(neoc_rpc_client_t *client,
+                                       size_t *len,
+                                       const char *method,
+                                       const char *params_text,
+                                       const cJSON *params_node,
+                                       uint32_t id) {
+    if (!rpc_method_name_valid(method)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid method name");
+    }
+    
+    static const char prefix[] = "{\"jsonrpc\":\"2.0\",\"method\":\"";
+    static const char middle[] = "\",\"params\":";
+    char suffix[32];
+    int suffix_len = snprintf(suffix, sizeof(suffix), ",\"id\":%u}", id);
+    
+    neoc_error_t err = rpc_request_append(client, len, prefix, sizeof(prefix) - 1);
+    if (err == NEOC_SUCCESS) {
+        err = rpc_request_append(client, len, method, strlen(method));
+    }
+    if (err == NEOC_SUCCESS) {
+        err = rpc_request_append(client, len, middle, sizeof(middle) - 1);
+    }
+    if (err == NEOC_SUCCESS) {
+        if (params_node) {
+            err = rpc_print_json(params_node, &client->request_buf, &client->request_capacity,
+                                 len);
+        } else {
+            const char *params = params_text ? params_text : "[]";
+            err = rpc_request_append(client, len, params, strlen(params));
+        }
+    }
+    if (err == NEOC_SUCCESS) {
+        err = rpc_request_append(client, len, suffix, (size_t)suffix_len);
+    }
+    return err;
+}
+
+// Writes one JSON-RPC request as the whole, terminated request buffer
+static neoc_error_t rpc_write_request(neoc_rpc_client_t *client,
+                                      const char *method,
+                                      const char *params_text,
+                                      const cJSON *params_node,
+                                      uint32_t id) {
+    size_t len = 0;
+    neoc_error_t err = rpc_append_request(client, &len, method, params_text, params_node, id);
+    if (err == NEOC_SUCCESS) {
+        client->request_buf[len] = '\0';
+    }
+    return err;
+}
+#endif
+
+#ifdef HAVE_CJSON
+/*
+ * Sends one request and hands back its result node, detached from the
+ * response envelope. A missing result comes back as a JSON null.
+ */
+static neoc_error_t rpc_call_json(neoc_rpc_client_t *client,
+                                  const char *method,
+                                  const char *params_text,
+                                  const cJSON *params_node,
+                                  cJSON **result) {
+    if (!client || !method || !result) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *result = NULL;
+    
+#ifndef HAVE_CURL
+    (void)params_text;
+    (void)params_node;
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "CURL support not compiled in");
+#else
+    neoc_error_t err = rpc_write_request(client, method, params_text, params_node,
+                                         client->request_id++);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    cJSON *response = NULL;
+    err = rpc_exchange(client, client->request_buf, &response);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
     // Check for error
     cJSON *error = cJSON_GetObjectItem(response, "error");
     if (error) {
         cJSON *error_msg = cJSON_GetObjectItem(error, "message");
-        const char *msg = error_msg ? error_msg->valuestring : "RPC error";
-        neoc_error_t err = neoc_error_set(NEOC_ERROR_RPC, msg);
+        const char *msg = cJSON_IsString(error_msg) ? error_msg->valuestring : "RPC error";
+        err = neoc_error_set(NEOC_ERROR_RPC, msg);
         cJSON_Delete(response);
-        neoc_free(response_buf.data);
         return err;
     }
     
     // Get result
-    cJSON *result_json = cJSON_GetObjectItem(response, "result");
-    if (result_json) {
-        char *tmp = cJSON_PrintUnformatted(result_json);
-        if (!tmp) {
-            cJSON_Delete(response);
-            neoc_free(response_buf.data);
-            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to serialize RPC result");
+    *result = cJSON_DetachItemFromObject(response, "result");
+    cJSON_Delete(response);
+    if (!*result) {
+        *result = cJSON_CreateNull();
+        if (!*result) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate RPC result");
         }
-        *result = neoc_strdup(tmp);
-        free(tmp);
-    } else {
-        *result = neoc_strdup("null");
     }
     
-    cJSON_Delete(response);
-    neoc_free(response_buf.data);
+    return NEOC_SUCCESS;
+#endif // HAVE_CURL
+}
+#endif
+
+// Helper function to make RPC call
+static neoc_error_t make_rpc_call(neoc_rpc_client_t *client,
+                                   const char *method,
+                                   const char *params,
+                                   char **result) {
+    if (!client || !method || !result) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+#ifndef HAVE_CJSON
+    (void)params;
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+#else
+    cJSON *result_json = NULL;
+    neoc_error_t err = rpc_call_json(client, method, params, NULL, &result_json);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    // Text callers get the result printed once, straight into their buffer
+    char *text = NULL;
+    size_t capacity = 0;
+    size_t len = 0;
+    err = rpc_print_json(result_json, &text, &capacity, &len);
+    cJSON_Delete(result_json);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(text);
+        return err;
+    }
+    *result = text;
     
     return NEOC_SUCCESS;
 #endif // HAVE_CJSON
-#endif // HAVE_CURL
+}
+
+neoc_error_t neoc_rpc_call_json(neoc_rpc_client_t *client,
+                                const char *method,
+                                const neoc_json_t *params,
+                                neoc_json_t **result) {
+    if (!client || !method || !result) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+#ifndef HAVE_CJSON
+    (void)params;
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+#else
+    return rpc_call_json(client, method, NULL, params, result);
+#endif
+}
+
+#if defined(HAVE_CURL) && defined(HAVE_CJSON)
+// Destination of a streamed response body
+typedef struct {
+    neoc_json_stream_t *stream;
+    neoc_error_t status;
+} rpc_stream_sink_t;
+
+// CURL write callback that feeds each chunk to a streaming parser
+static size_t stream_write_callback(char *contents, size_t size, size_t nmemb, void *userp) {
+    size_t real_size = size * nmemb;
+    rpc_stream_sink_t *sink = (rpc_stream_sink_t *)userp;
+    
+    sink->status = neoc_json_stream_feed(sink->stream, contents, real_size);
+    return sink->status == NEOC_SUCCESS ? real_size : 0; // 0 aborts the transfer
+}
+#endif
+
+neoc_error_t neoc_rpc_call_streamed(neoc_rpc_client_t *client,
+                                    const char *method,
+                                    const char *params,
+                                    neoc_json_stream_t *stream) {
+    if (!client || !method || !stream) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+#if !defined(HAVE_CURL) || !defined(HAVE_CJSON)
+    (void)params;
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "CURL support not compiled in");
+#else
+    neoc_error_t err = rpc_write_request(client, method, params, NULL, client->request_id++);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    rpc_stream_sink_t sink = { stream, NEOC_SUCCESS };
+    err = rpc_perform(client, client->request_buf, stream_write_callback, &sink);
+    // A parse failure aborts the transfer; report it rather than the write error
+    if (sink.status != NEOC_SUCCESS) {
+        return sink.status;
+    }
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    return neoc_json_stream_finish(stream);
+#endif
 }
 
 neoc_error_t neoc_rpc_get_best_block_hash(neoc_rpc_client_t *client, neoc_hash256_t *hash) {
@@ -235,30 +468,27 @@ neoc_error_t neoc_rpc_get_best_block_hash(neoc_rpc_client_t *client, neoc_hash25
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    char *result = NULL;
-    neoc_error_t err = make_rpc_call(client, RPC_GET_BEST_BLOCK_HASH, NULL, &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    neoc_error_t err = rpc_call_json(client, RPC_GET_BEST_BLOCK_HASH, NULL, NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-#ifdef HAVE_CJSON
     // Result should be a string hash
-    cJSON *json = cJSON_Parse(result);
-    if (json && cJSON_IsString(json)) {
+    if (cJSON_IsString(json)) {
         const char *hash_str = json->valuestring;
         if (hash_str && strlen(hash_str) == 66 && hash_str[0] == '0' && hash_str[1] == 'x') {
             err = neoc_hash256_from_string(hash_str + 2, hash);
         } else {
             err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid hash format");
         }
-        cJSON_Delete(json);
     } else {
         err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
     }
-    neoc_free(result);
+    cJSON_Delete(json);
 #else
-    neoc_free(result);
-    err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+    neoc_error_t err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
 #endif
     
     return err;
@@ -274,15 +504,14 @@ neoc_error_t neoc_rpc_get_block_hash(neoc_rpc_client_t *client,
     char params[32];
     snprintf(params, sizeof(params), "[%u]", block_index);
 
-    char *result = NULL;
-    neoc_error_t err = make_rpc_call(client, RPC_GET_BLOCK_HASH, params, &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    neoc_error_t err = rpc_call_json(client, RPC_GET_BLOCK_HASH, params, NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
 
-#ifdef HAVE_CJSON
-    cJSON *json = cJSON_Parse(result);
-    if (json && cJSON_IsString(json)) {
+    if (cJSON_IsString(json)) {
         const char *hash_str = json->valuestring;
         if (hash_str) {
             if (strncmp(hash_str, "0x", 2) == 0) {
@@ -292,14 +521,12 @@ neoc_error_t neoc_rpc_get_block_hash(neoc_rpc_client_t *client,
         } else {
             err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid hash response");
         }
-        cJSON_Delete(json);
     } else {
         err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
     }
-    neoc_free(result);
+    cJSON_Delete(json);
 #else
-    neoc_free(result);
-    err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+    neoc_error_t err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
 #endif
 
     return err;
@@ -321,24 +548,21 @@ neoc_error_t neoc_rpc_get_block_count(neoc_rpc_client_t *client, uint32_t *count
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    char *result = NULL;
-    neoc_error_t err = make_rpc_call(client, RPC_GET_BLOCK_COUNT, NULL, &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    neoc_error_t err = rpc_call_json(client, RPC_GET_BLOCK_COUNT, NULL, NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-#ifdef HAVE_CJSON
-    cJSON *json = cJSON_Parse(result);
-    if (json && cJSON_IsNumber(json)) {
+    if (cJSON_IsNumber(json)) {
         *count = (uint32_t)json->valueint;
-        cJSON_Delete(json);
     } else {
         err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
     }
-    neoc_free(result);
+    cJSON_Delete(json);
 #else
-    neoc_free(result);
-    err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+    neoc_error_t err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
 #endif
     
     return err;
@@ -370,15 +594,14 @@ neoc_error_t neoc_rpc_send_raw_transaction(neoc_rpc_client_t *client,
     snprintf(params, sizeof(params), "[\"%s\"]", base64_tx);
     neoc_free(base64_tx);
     
-    char *result = NULL;
-    err = make_rpc_call(client, RPC_SEND_RAW_TRANSACTION, params, &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    err = rpc_call_json(client, RPC_SEND_RAW_TRANSACTION, params, NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-#ifdef HAVE_CJSON
-    cJSON *json = cJSON_Parse(result);
-    if (json) {
+    if (cJSON_IsObject(json)) {
         cJSON *hash_json = cJSON_GetObjectItem(json, "hash");
         if (hash_json && cJSON_IsString(hash_json)) {
             const char *hash_str = hash_json->valuestring;
@@ -390,13 +613,11 @@ neoc_error_t neoc_rpc_send_raw_transaction(neoc_rpc_client_t *client,
         } else {
             err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "No hash in response");
         }
-        cJSON_Delete(json);
     } else {
         err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
     }
-    neoc_free(result);
+    cJSON_Delete(json);
 #else
-    neoc_free(result);
     err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
 #endif
     
@@ -484,15 +705,14 @@ neoc_error_t neoc_rpc_get_nep17_balances(neoc_rpc_client_t *client,
     char params[128];
     snprintf(params, sizeof(params), "[\"%s\"]", addr_str);
     
-    char *result = NULL;
-    err = make_rpc_call(client, RPC_GET_NEP17_BALANCES, params, &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    err = rpc_call_json(client, RPC_GET_NEP17_BALANCES, params, NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-#ifdef HAVE_CJSON
-    cJSON *json = cJSON_Parse(result);
-    if (json) {
+    if (cJSON_IsObject(json)) {
         cJSON *balance_array = cJSON_GetObjectItem(json, "balance");
         if (balance_array && cJSON_IsArray(balance_array)) {
             *count = cJSON_GetArraySize(balance_array);
@@ -525,13 +745,11 @@ neoc_error_t neoc_rpc_get_nep17_balances(neoc_rpc_client_t *client,
             *count = 0;
             *balances = NULL;
         }
-        cJSON_Delete(json);
     } else {
         err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
     }
-    neoc_free(result);
+    cJSON_Delete(json);
 #else
-    neoc_free(result);
     *count = 0;
     *balances = NULL;
     err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
@@ -606,6 +824,73 @@ neoc_error_t neoc_rpc_get_application_log(neoc_rpc_client_t *client,
     return make_rpc_call(client, RPC_GET_APPLICATION_LOG, params, log);
 }
 
+neoc_error_t neoc_rpc_get_application_log_decoded(neoc_rpc_client_t *client,
+                                                   const neoc_hash256_t *tx_hash,
+                                                   neoc_get_application_log_response_t **response) {
+    if (!client || !tx_hash || !response) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *response = NULL;
+    
+    char hash_str[NEOC_HASH256_STRING_LENGTH];
+    neoc_error_t err = neoc_hash256_to_hex(tx_hash, hash_str, sizeof(hash_str), false);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    char params[128];
+    snprintf(params, sizeof(params), "[\"0x%s\"]", hash_str);
+    
+    neoc_application_log_decoder_t *decoder = NULL;
+    err = neoc_application_log_decoder_create(&decoder);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    err = neoc_rpc_call_streamed(client, RPC_GET_APPLICATION_LOG, params,
+                                 neoc_application_log_decoder_stream(decoder));
+    if (err == NEOC_SUCCESS) {
+        err = neoc_application_log_decoder_finish(decoder, response);
+    }
+    neoc_application_log_decoder_free(decoder);
+    
+    // Report an error envelope the way the buffered calls do
+    if (err == NEOC_SUCCESS && !(*response)->result) {
+        err = neoc_error_set(NEOC_ERROR_RPC, (*response)->error_message ? (*response)->error_message
+                                                                         : "RPC error");
+        neoc_get_application_log_response_free(*response);
+        *response = NULL;
+    }
+    return err;
+}
+
+neoc_error_t neoc_rpc_get_neo_block(neoc_rpc_client_t *client,
+                                    const neoc_hash256_t *hash,
+                                    neoc_neo_block_t **block) {
+    if (!client || !hash || !block) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *block = NULL;
+    
+    char hash_str[NEOC_HASH256_STRING_LENGTH];
+    neoc_error_t err = neoc_hash256_to_hex(hash, hash_str, sizeof(hash_str), false);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    char params[128];
+    snprintf(params, sizeof(params), "[\"0x%s\",true]", hash_str);
+    
+    neoc_neo_block_decoder_t *decoder = NULL;
+    err = neoc_neo_block_decoder_create(true, &decoder);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    err = neoc_rpc_call_streamed(client, RPC_GET_BLOCK, params, neoc_neo_block_decoder_stream(decoder));
+    if (err == NEOC_SUCCESS) {
+        err = neoc_neo_block_decoder_finish(decoder, block);
+    }
+    neoc_neo_block_decoder_free(decoder);
+    return err;
+}
+
 void neoc_rpc_block_free(neoc_block_t *block) {
     if (!block) return;
     
@@ -654,62 +939,22 @@ void neoc_rpc_client_free(neoc_rpc_client_t *client) {
     }
 #endif
     
+    neoc_free(client->request_buf);
+    neoc_free(client->response.data);
     neoc_free(client->url);
     neoc_free(client);
 }
 
-// Complete implementations of RPC methods
-neoc_error_t neoc_rpc_get_block(neoc_rpc_client_t *client,
-                                 const neoc_hash256_t *hash,
-                                 bool verbose,
-                                 neoc_block_t **block) {
-    if (!client || !hash || !block) {
-        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
-    }
-    
-#ifndef HAVE_CURL
-    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "libcurl support not compiled in");
-#else
-#ifndef HAVE_CJSON
-    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
-#else
-    
-    // Convert hash to hex string
-    char hash_str[65];
-    neoc_error_t err = neoc_hash256_to_hex(hash, hash_str, sizeof(hash_str), false);
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
-    
-    // Build params array
-    cJSON *params = cJSON_CreateArray();
-    cJSON_AddItemToArray(params, cJSON_CreateString(hash_str));
-    cJSON_AddItemToArray(params, cJSON_CreateBool(verbose));
-    
-    char *params_str = cJSON_PrintUnformatted(params);
-    cJSON_Delete(params);
-    
-    // Make RPC call
-    char *result = NULL;
-    err = make_rpc_call(client, RPC_GET_BLOCK, params_str, &result);
-    free(params_str);
-    
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
-    
-    // Parse the result
-    cJSON *json = cJSON_Parse(result);
-    if (!json) {
-        neoc_free(result);
-        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid JSON response");
+#ifdef HAVE_CJSON
+// Fills a block from a getblock result object
+static neoc_error_t rpc_block_from_json(const cJSON *json, neoc_block_t **block) {
+    if (!cJSON_IsObject(json)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid block format");
     }
     
     // Allocate block structure
     *block = neoc_calloc(1, sizeof(neoc_block_t));
     if (!*block) {
-        cJSON_Delete(json);
-        neoc_free(result);
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate block");
     }
     
@@ -811,10 +1056,52 @@ neoc_error_t neoc_rpc_get_block(neoc_rpc_client_t *client,
         }
     }
     
+    return NEOC_SUCCESS;
+}
+#endif
+
+// Complete implementations of RPC methods
+neoc_error_t neoc_rpc_get_block(neoc_rpc_client_t *client,
+                                 const neoc_hash256_t *hash,
+                                 bool verbose,
+                                 neoc_block_t **block) {
+    if (!client || !hash || !block) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+#ifndef HAVE_CURL
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "libcurl support not compiled in");
+#else
+#ifndef HAVE_CJSON
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+#else
+    
+    // Convert hash to hex string
+    char hash_str[65];
+    neoc_error_t err = neoc_hash256_to_hex(hash, hash_str, sizeof(hash_str), false);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    // Build params array
+    cJSON *params = cJSON_CreateArray();
+    cJSON_AddItemToArray(params, cJSON_CreateString(hash_str));
+    cJSON_AddItemToArray(params, cJSON_CreateBool(verbose));
+    
+    // Make RPC call
+    cJSON *json = NULL;
+    err = rpc_call_json(client, RPC_GET_BLOCK, NULL, params, &json);
+    cJSON_Delete(params);
+    
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    err = rpc_block_from_json(json, block);
+    
     cJSON_Delete(json);
-    neoc_free(result);
     
-    return NEOC_SUCCESS;
+    return err;
 #endif // HAVE_CJSON
 #endif // HAVE_CURL
 }
@@ -846,30 +1133,19 @@ neoc_error_t neoc_rpc_get_transaction(neoc_rpc_client_t *client,
     cJSON_AddItemToArray(params, cJSON_CreateString(hash_str));
     cJSON_AddItemToArray(params, cJSON_CreateBool(verbose));
     
-    char *params_str = cJSON_PrintUnformatted(params);
-    cJSON_Delete(params);
-    
     // Make RPC call
-    char *result = NULL;
-    err = make_rpc_call(client, RPC_GET_TRANSACTION, params_str, &result);
-    free(params_str);
+    cJSON *json = NULL;
+    err = rpc_call_json(client, RPC_GET_TRANSACTION, NULL, params, &json);
+    cJSON_Delete(params);
     
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-    // Parse the result
-    cJSON *json = cJSON_Parse(result);
-    if (!json) {
-        neoc_free(result);
-        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid JSON response");
-    }
-    
     // Allocate transaction structure
     *transaction = neoc_calloc(1, sizeof(neoc_rpc_transaction_t));
     if (!*transaction) {
         cJSON_Delete(json);
-        neoc_free(result);
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate transaction");
     }
     
@@ -940,7 +1216,6 @@ neoc_error_t neoc_rpc_get_transaction(neoc_rpc_client_t *client,
     }
     
     cJSON_Delete(json);
-    neoc_free(result);
     
     return NEOC_SUCCESS;
 #endif // HAVE_CJSON
@@ -972,30 +1247,19 @@ neoc_error_t neoc_rpc_get_contract_state(neoc_rpc_client_t *client,
     cJSON *params = cJSON_CreateArray();
     cJSON_AddItemToArray(params, cJSON_CreateString(hash_str));
     
-    char *params_str = cJSON_PrintUnformatted(params);
-    cJSON_Delete(params);
-    
     // Make RPC call
-    char *result = NULL;
-    err = make_rpc_call(client, RPC_GET_CONTRACT_STATE, params_str, &result);
-    free(params_str);
+    cJSON *json = NULL;
+    err = rpc_call_json(client, RPC_GET_CONTRACT_STATE, NULL, params, &json);
+    cJSON_Delete(params);
     
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-    // Parse the result
-    cJSON *json = cJSON_Parse(result);
-    if (!json) {
-        neoc_free(result);
-        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid JSON response");
-    }
-    
     // Allocate contract state structure
     *state = neoc_calloc(1, sizeof(neoc_contract_state_t));
     if (!*state) {
         cJSON_Delete(json);
-        neoc_free(result);
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate contract state");
     }
     
@@ -1158,7 +1422,6 @@ neoc_error_t neoc_rpc_get_contract_state(neoc_rpc_client_t *client,
     }
     
     cJSON_Delete(json);
-    neoc_free(result);
     
     return NEOC_SUCCESS;
 #endif // HAVE_CJSON
@@ -1188,25 +1451,29 @@ neoc_error_t neoc_rpc_get_connection_count(neoc_rpc_client_t *client, uint32_t *
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    char *result = NULL;
-    neoc_error_t err = make_rpc_call(client, RPC_GET_CONNECTION_COUNT, "[]", &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    neoc_error_t err = rpc_call_json(client, RPC_GET_CONNECTION_COUNT, "[]", NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-#ifdef HAVE_CJSON
-    cJSON *json = cJSON_Parse(result);
-    if (json && cJSON_IsNumber(json)) {
+    if (cJSON_IsNumber(json)) {
         *count = (uint32_t)json->valueint;
-        cJSON_Delete(json);
     } else {
         err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
     }
+    cJSON_Delete(json);
 #else
+    char *result = NULL;
+    neoc_error_t err = make_rpc_call(client, RPC_GET_CONNECTION_COUNT, "[]", &result);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
     *count = (uint32_t)atoi(result);
+    neoc_free(result);
 #endif
     
-    neoc_free(result);
     return err;
 }
 
@@ -1244,25 +1511,29 @@ neoc_error_t neoc_rpc_get_transaction_height(neoc_rpc_client_t *client,
     char params[128];
     snprintf(params, sizeof(params), "[\"%s\"]", hash_str);
     
-    char *result = NULL;
-    err = make_rpc_call(client, RPC_GET_TRANSACTION_HEIGHT, params, &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    err = rpc_call_json(client, RPC_GET_TRANSACTION_HEIGHT, params, NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-#ifdef HAVE_CJSON
-    cJSON *json = cJSON_Parse(result);
-    if (json && cJSON_IsNumber(json)) {
+    if (cJSON_IsNumber(json)) {
         *height = (uint32_t)json->valueint;
-        cJSON_Delete(json);
     } else {
         err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
     }
+    cJSON_Delete(json);
 #else
+    char *result = NULL;
+    err = make_rpc_call(client, RPC_GET_TRANSACTION_HEIGHT, params, &result);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
     *height = (uint32_t)atoi(result);
+    neoc_free(result);
 #endif
     
-    neoc_free(result);
     return err;
 }
 
@@ -1271,28 +1542,23 @@ neoc_error_t neoc_rpc_get_state_height(neoc_rpc_client_t *client, uint32_t *heig
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    char *result = NULL;
-    neoc_error_t err = make_rpc_call(client, RPC_GET_STATE_HEIGHT, "[]", &result);
+#ifdef HAVE_CJSON
+    cJSON *json = NULL;
+    neoc_error_t err = rpc_call_json(client, RPC_GET_STATE_HEIGHT, "[]", NULL, &json);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-#ifdef HAVE_CJSON
-    cJSON *json = cJSON_Parse(result);
-    if (json) {
-        cJSON *local = cJSON_GetObjectItem(json, "localrootindex");
-        if (local && cJSON_IsNumber(local)) {
-            *height = (uint32_t)local->valueint;
-        }
-        cJSON_Delete(json);
-    } else {
-        err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid response format");
+    cJSON *local = cJSON_GetObjectItem(json, "localrootindex");
+    if (local && cJSON_IsNumber(local)) {
+        *height = (uint32_t)local->valueint;
     }
+    cJSON_Delete(json);
 #else
+    neoc_error_t err = neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
     *height = 0;
 #endif
     
-    neoc_free(result);
     return err;
 }
 
@@ -1303,3 +1569,398 @@ neoc_error_t neoc_rpc_get_native_contracts(neoc_rpc_client_t *client, char **con
     
     return make_rpc_call(client, RPC_GET_NATIVE_CONTRACTS, "[]", contracts);
 }
+
+// MARK: Batched calls
+
+typedef struct {
+    char *method;
+    char *params;           // JSON parameters, NULL for an empty array
+    uint32_t id;
+    neoc_error_t status;
+    char *message;          // Error message when status is not NEOC_SUCCESS
+    neoc_json_t *result;    // Result node, detached from its response
+    char *result_text;      // Result printed on first neoc_rpc_batch_get_result
+} rpc_batch_entry_t;
+
+struct neoc_rpc_batch_t {
+    neoc_rpc_client_t *client;
+    size_t max_batch_size;
+    rpc_batch_entry_t *entries;
+    size_t count;
+    size_t capacity;
+    bool sent;
+};
+
+static void rpc_batch_entry_clear_outcome(rpc_batch_entry_t *entry) {
+    neoc_free(entry->message);
+    neoc_json_free(entry->result);
+    neoc_free(entry->result_text);
+    entry->message = NULL;
+    entry->result = NULL;
+    entry->result_text = NULL;
+    entry->status = NEOC_ERROR_INVALID_STATE;
+}
+
+static void rpc_batch_entry_fail(rpc_batch_entry_t *entry, neoc_error_t status, const char *message) {
+    rpc_batch_entry_clear_outcome(entry);
+    entry->status = status;
+    entry->message = neoc_strdup(message ? message : "RPC error");
+}
+
+neoc_error_t neoc_rpc_batch_create(neoc_rpc_client_t *client,
+                                   size_t max_batch_size,
+                                   neoc_rpc_batch_t **batch) {
+    if (!client || !batch) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    *batch = neoc_calloc(1, sizeof(neoc_rpc_batch_t));
+    if (!*batch) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate RPC batch");
+    }
+    
+    (*batch)->client = client;
+    (*batch)->max_batch_size = max_batch_size ? max_batch_size : NEOC_RPC_BATCH_DEFAULT_MAX_SIZE;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_rpc_batch_add(neoc_rpc_batch_t *batch,
+                                const char *method,
+                                const char *params,
+                                size_t *index) {
+    if (!batch || !method) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (batch->sent) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Batch has already been sent");
+    }
+    if (!rpc_method_name_valid(method)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid method name");
+    }
+    
+    if (batch->count == batch->capacity) {
+        size_t new_capacity = batch->capacity ? batch->capacity * 2 : 16;
+        rpc_batch_entry_t *entries = neoc_realloc(batch->entries, new_capacity * sizeof(rpc_batch_entry_t));
+        if (!entries) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to grow RPC batch");
+        }
+        batch->entries = entries;
+        batch->capacity = new_capacity;
+    }
+    
+    rpc_batch_entry_t *entry = &batch->entries[batch->count];
+    memset(entry, 0, sizeof(*entry));
+    entry->status = NEOC_ERROR_INVALID_STATE;
+    entry->method = neoc_strdup(method);
+    entry->params = params ? neoc_strdup(params) : NULL;
+    if (!entry->method || (params && !entry->params)) {
+        neoc_free(entry->method);
+        neoc_free(entry->params);
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate batch entry");
+    }
+    
+    if (index) {
+        *index = batch->count;
+    }
+    batch->count++;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_rpc_batch_add_get_block_by_index(neoc_rpc_batch_t *batch,
+                                                   uint32_t block_index,
+                                                   bool verbose,
+                                                   size_t *index) {
+    char params[32];
+    snprintf(params, sizeof(params), "[%u,%s]", block_index, verbose ? "true" : "false");
+    return neoc_rpc_batch_add(batch, RPC_GET_BLOCK, params, index);
+}
+
+neoc_error_t neoc_rpc_batch_add_get_application_log(neoc_rpc_batch_t *batch,
+                                                    const neoc_hash256_t *tx_hash,
+                                                    size_t *index) {
+    if (!tx_hash) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    char hash_str[NEOC_HASH256_STRING_LENGTH];
+    neoc_error_t err = neoc_hash256_to_hex(tx_hash, hash_str, sizeof(hash_str), false);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    char params[128];
+    snprintf(params, sizeof(params), "[\"0x%s\"]", hash_str);
+    return neoc_rpc_batch_add(batch, RPC_GET_APPLICATION_LOG, params, index);
+}
+
+size_t neoc_rpc_batch_count(const neoc_rpc_batch_t *batch) {
+    return batch ? batch->count : 0;
+}
+
+#if defined(HAVE_CURL) && defined(HAVE_CJSON)
+// Moves the result of one response object onto the entry it answers
+static void rpc_batch_apply_response(rpc_batch_entry_t *entry, cJSON *response) {
+    cJSON *error = cJSON_GetObjectItem(response, "error");
+    if (error) {
+        cJSON *error_msg = cJSON_GetObjectItem(error, "message");
+        rpc_batch_entry_fail(entry, NEOC_ERROR_RPC,
+                             cJSON_IsString(error_msg) ? error_msg->valuestring : NULL);
+        return;
+    }
+    
+    rpc_batch_entry_clear_outcome(entry);
+    entry->result = cJSON_DetachItemFromObject(response, "result");
+    if (!entry->result) {
+        entry->result = cJSON_CreateNull();
+    }
+    if (!entry->result) {
+        rpc_batch_entry_fail(entry, NEOC_ERROR_MEMORY, "Failed to store RPC result");
+        return;
+    }
+    entry->status = NEOC_SUCCESS;
+}
+
+// Sends entries [first, first + count) as one JSON array
+static neoc_error_t rpc_batch_send_chunk(neoc_rpc_batch_t *batch, size_t first, size_t count) {
+    rpc_batch_entry_t *entries = &batch->entries[first];
+    
+    // Ids within a chunk are consecutive, so a response id maps straight to its entry
+    uint32_t first_id = batch->client->request_id;
+    batch->client->request_id += (uint32_t)count;
+    
+    // The array is written straight into the request buffer; params go out as given
+    size_t len = 0;
+    neoc_error_t err = rpc_request_append(batch->client, &len, "[", 1);
+    for (size_t i = 0; i < count && err == NEOC_SUCCESS; i++) {
+        entries[i].id = first_id + (uint32_t)i;
+        if (i > 0) {
+            err = rpc_request_append(batch->client, &len, ",", 1);
+        }
+        if (err == NEOC_SUCCESS) {
+            err = rpc_append_request(batch->client, &len, entries[i].method, entries[i].params,
+                                     NULL, entries[i].id);
+        }
+    }
+    if (err == NEOC_SUCCESS) {
+        err = rpc_request_append(batch->client, &len, "]", 1);
+    }
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    batch->client->request_buf[len] = '\0';
+    
+    cJSON *response = NULL;
+    err = rpc_exchange(batch->client, batch->client->request_buf, &response);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    if (!cJSON_IsArray(response)) {
+        // Nodes answer a rejected batch with a single error object
+        cJSON *error = cJSON_GetObjectItem(response, "error");
+        cJSON *error_msg = error ? cJSON_GetObjectItem(error, "message") : NULL;
+        err = neoc_error_set(NEOC_ERROR_RPC, cJSON_IsString(error_msg) ? error_msg->valuestring
+                                                                      : "Batch request rejected");
+        cJSON_Delete(response);
+        return err;
+    }
+    
+    cJSON *item = NULL;
+    cJSON_ArrayForEach(item, response) {
+        cJSON *id = cJSON_GetObjectItem(item, "id");
+        if (!cJSON_IsNumber(id) || id->valuedouble < first_id) {
+            continue;
+        }
+        double offset = id->valuedouble - first_id;
+        if (offset >= (double)count) {
+            continue;
+        }
+        rpc_batch_entry_t *entry = &entries[(size_t)offset];
+        if (entry->status == NEOC_ERROR_INVALID_STATE) {
+            rpc_batch_apply_response(entry, item);
+        }
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        if (entries[i].status == NEOC_ERROR_INVALID_STATE) {
+            rpc_batch_entry_fail(&entries[i], NEOC_ERROR_RPC, "No response for request in batch");
+        }
+    }
+    
+    cJSON_Delete(response);
+    return NEOC_SUCCESS;
+}
+#endif
+
+neoc_error_t neoc_rpc_batch_send(neoc_rpc_batch_t *batch, size_t *failed_count) {
+    if (!batch) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (batch->sent) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Batch has already been sent");
+    }
+    
+#ifndef HAVE_CURL
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "CURL support not compiled in");
+#else
+#ifndef HAVE_CJSON
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+#else
+    
+    batch->sent = true;
+    
+    // A failed chunk fails only its own entries; the first such error is returned
+    neoc_error_t first_err = NEOC_SUCCESS;
+    for (size_t first = 0; first < batch->count; first += batch->max_batch_size) {
+        size_t count = batch->count - first;
+        if (count > batch->max_batch_size) {
+            count = batch->max_batch_size;
+        }
+        
+        neoc_error_t err = rpc_batch_send_chunk(batch, first, count);
+        if (err != NEOC_SUCCESS) {
+            const neoc_error_info_t *info = neoc_get_last_error();
+            const char *message = info && info->code == err ? info->message : neoc_error_string(err);
+            for (size_t i = first; i < first + count; i++) {
+                if (batch->entries[i].status == NEOC_ERROR_INVALID_STATE) {
+                    rpc_batch_entry_fail(&batch->entries[i], err, message);
+                }
+            }
+            if (first_err == NEOC_SUCCESS) {
+                first_err = err;
+            }
+        }
+    }
+    
+    if (failed_count) {
+        *failed_count = 0;
+        for (size_t i = 0; i < batch->count; i++) {
+            if (batch->entries[i].status != NEOC_SUCCESS) {
+                (*failed_count)++;
+            }
+        }
+    }
+    
+    return first_err;
+#endif // HAVE_CJSON
+#endif // HAVE_CURL
+}
+
+neoc_error_t neoc_rpc_batch_get_status(const neoc_rpc_batch_t *batch,
+                                       size_t index,
+                                       const char **message) {
+    if (!batch || index >= batch->count) {
+        return NEOC_ERROR_OUT_OF_BOUNDS;
+    }
+    
+    const rpc_batch_entry_t *entry = &batch->entries[index];
+    if (message) {
+        *message = entry->status == NEOC_ERROR_INVALID_STATE && !entry->message
+                       ? "Batch has not been sent"
+                       : entry->message;
+    }
+    return entry->status;
+}
+
+// Looks up an entry that holds a result
+static neoc_error_t rpc_batch_result_entry(const neoc_rpc_batch_t *batch,
+                                           size_t index,
+                                           rpc_batch_entry_t **entry) {
+    if (!batch) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (index >= batch->count) {
+        return neoc_error_set(NEOC_ERROR_OUT_OF_BOUNDS, "Batch index out of range");
+    }
+    
+    *entry = &batch->entries[index];
+    if ((*entry)->status != NEOC_SUCCESS) {
+        return neoc_error_set((*entry)->status,
+                              (*entry)->message ? (*entry)->message : "Batch has not been sent");
+    }
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_rpc_batch_get_result(const neoc_rpc_batch_t *batch,
+                                       size_t index,
+                                       const char **result) {
+    if (!result) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    rpc_batch_entry_t *entry = NULL;
+    neoc_error_t err = rpc_batch_result_entry(batch, index, &entry);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    // Typed getters read the node directly; text is only printed when asked for
+    if (!entry->result_text) {
+        entry->result_text = neoc_json_to_string(entry->result);
+        if (!entry->result_text) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to print RPC result");
+        }
+    }
+    *result = entry->result_text;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_rpc_batch_get_block(const neoc_rpc_batch_t *batch,
+                                      size_t index,
+                                      neoc_block_t **block) {
+    if (!block) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    rpc_batch_entry_t *entry = NULL;
+    neoc_error_t err = rpc_batch_result_entry(batch, index, &entry);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+#ifdef HAVE_CJSON
+    return rpc_block_from_json(entry->result, block);
+#else
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "cJSON support not compiled in");
+#endif
+}
+
+neoc_error_t neoc_rpc_batch_get_application_log(const neoc_rpc_batch_t *batch,
+                                                size_t index,
+                                                char **log) {
+    if (!log) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    rpc_batch_entry_t *entry = NULL;
+    neoc_error_t err = rpc_batch_result_entry(batch, index, &entry);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
+    *log = neoc_json_to_string(entry->result);
+    if (!*log) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to copy application log");
+    }
+    return NEOC_SUCCESS;
+}
+
+void neoc_rpc_batch_reset(neoc_rpc_batch_t *batch) {
+    if (!batch) return;
+    
+    for (size_t i = 0; i < batch->count; i++) {
+        neoc_free(batch->entries[i].method);
+        neoc_free(batch->entries[i].params);
+        rpc_batch_entry_clear_outcome(&batch->entries[i]);
+    }
+    batch->count = 0;
+    batch->sent = false;
+}
+
+void neoc_rpc_batch_free(neoc_rpc_batch_t *batch) {
+    if (!batch) return;
+    
+    neoc_rpc_batch_reset(batch);
+    neoc_free(batch->entries);
+    neoc_free(batch);
+}
@@ -1,11 +1,70 @@
 #include "neoc/protocol/rx/json_rpc2_0_rx.h"
 #include "neoc/neoc_error.h"
 #include "neoc/neoc_memory.h"
+#include "neoc/protocol/service.h"
+#include "neoc/protocol/core/request.h"
+#include "neoc/protocol/core/response.h"
+#include "neoc/protocol/core/response/neo_block.h"
+#include <cjson/cJSON.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
-static neoc_error_t rx_not_implemented(void) {
-    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED,
-                          "Reactive JSON-RPC functionality not implemented");
-}
+typedef enum {
+    RX_MODE_INDEX_POLL,
+    RX_MODE_BLOCK_POLL,
+    RX_MODE_REPLAY,
+    RX_MODE_CATCH_UP,
+    RX_MODE_CATCH_UP_AND_POLL
+} rx_mode_t;
+
+/* One prefetch slot; a slot is reused only after its block was delivered */
+typedef struct {
+    neoc_neo_get_block_t result;
+    neoc_error_t error;
+    neoc_http_call_id_t call_id;
+    bool pending;
+    bool ready;
+} rx_slot_t;
+
+typedef struct {
+    neoc_json_rpc2_0_rx_t *rx;
+    neoc_service_t *service;
+    rx_mode_t mode;
+    bool full_transaction_objects;
+    int polling_interval_ms;
+    int start_index;
+    int end_index;
+    bool ascending;
+    neoc_block_callback_t block_callback;
+    neoc_block_index_callback_t index_callback;
+    void *user_data;
+
+    pthread_t thread;
+    bool joined;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    bool cancelled;
+
+    rx_slot_t *slots;
+    size_t slot_count;
+    size_t in_flight;
+} rx_subscription_impl_t;
+
+typedef struct {
+    rx_subscription_impl_t *impl;
+    rx_slot_t *slot;
+} rx_fetch_context_t;
+
+/* Guards every rx client's subscription list */
+static pthread_mutex_t rx_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Subscription whose thread is running the calling code, if any */
+static __thread rx_subscription_impl_t *rx_current_subscription = NULL;
+
+static bool rx_subscription_stop(neoc_subscription_t *subscription);
 
 neoc_json_rpc2_0_rx_t *neoc_json_rpc2_0_rx_create(neoc_neo_c_t *neo_c, void *executor_service) {
     neoc_json_rpc2_0_rx_t *rx = neoc_calloc(1, sizeof(neoc_json_rpc2_0_rx_t));
@@ -17,19 +76,453 @@ neoc_json_rpc2_0_rx_t *neoc_json_rpc2_0_rx_create(neoc_neo_c_t *neo_c, void *exe
     rx->executor_service = executor_service;
     rx->subscriptions = NULL;
     rx->subscription_count = 0;
+    rx->max_prefetch = NEOC_RX_DEFAULT_PREFETCH;
     return rx;
 }
 
+neoc_error_t neoc_json_rpc2_0_rx_set_max_prefetch(neoc_json_rpc2_0_rx_t *rx, size_t max_prefetch) {
+    if (!rx) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Reactive client is NULL");
+    }
+    rx->max_prefetch = max_prefetch ? max_prefetch : NEOC_RX_DEFAULT_PREFETCH;
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t rx_get_service(neoc_json_rpc2_0_rx_t *rx, neoc_service_t **service) {
+    *service = rx && rx->neo_c ? neoc_neo_c_get_service(rx->neo_c) : NULL;
+    if (!*service) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Reactive client has no service");
+    }
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t rx_parse_block_count(const neoc_response_t *response, int *latest_index) {
+    if (response->has_error || !response->result_json) {
+        return neoc_error_set(NEOC_ERROR_RPC,
+                              response->error && response->error->message
+                                  ? response->error->message : "getblockcount failed");
+    }
+    const cJSON *count = response->result_json;
+    if (!cJSON_IsNumber(count) || count->valuedouble < 1) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid getblockcount result");
+    }
+    *latest_index = (int)(count->valuedouble - 1);
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t rx_fetch_latest_index(neoc_service_t *service, int *latest_index) {
+    neoc_request_t *request = neoc_request_create("getblockcount", "[]", service);
+    if (!request) {
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to create request");
+    }
+
+    neoc_response_t *response = NULL;
+    neoc_error_t err = neoc_service_send_request(service, request, &response);
+    neoc_request_free(request);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    err = rx_parse_block_count(response, latest_index);
+    neoc_response_free(response);
+    return err;
+}
+
+/* ---- Subscription thread helpers ---- */
+
+/* Sleeps for ms or until cancelled; returns false once cancelled */
+static bool rx_wait(rx_subscription_impl_t *impl, int ms) {
+    struct timespec deadline;
+    timespec_get(&deadline, TIME_UTC);
+    deadline.tv_sec += ms / 1000;
+    deadline.tv_nsec += (long)(ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&impl->lock);
+    while (!impl->cancelled) {
+        if (pthread_cond_timedwait(&impl->cond, &impl->lock, &deadline) != 0) {
+            break;
+        }
+    }
+    bool active = !impl->cancelled;
+    pthread_mutex_unlock(&impl->lock);
+    return active;
+}
+
+static bool rx_is_cancelled(rx_subscription_impl_t *impl) {
+    pthread_mutex_lock(&impl->lock);
+    bool cancelled = impl->cancelled;
+    pthread_mutex_unlock(&impl->lock);
+    return cancelled;
+}
+
+static void rx_mark_cancelled(rx_subscription_impl_t *impl) {
+    pthread_mutex_lock(&impl->lock);
+    impl->cancelled = true;
+    pthread_cond_broadcast(&impl->cond);
+    pthread_mutex_unlock(&impl->lock);
+}
+
+/* Reports a failure that is not tied to a block; returns whether to go on */
+static bool rx_report_error(rx_subscription_impl_t *impl, neoc_error_t err) {
+    bool keep_going = impl->block_callback
+        ? impl->block_callback(NULL, err, impl->user_data)
+        : impl->index_callback(-1, err, impl->user_data);
+    if (!keep_going) {
+        rx_mark_cancelled(impl);
+    }
+    return keep_going;
+}
+
+static void rx_block_fetched(neoc_response_t *response, neoc_error_t err, void *user_data) {
+    rx_fetch_context_t *ctx = (rx_fetch_context_t *)user_data;
+    rx_subscription_impl_t *impl = ctx->impl;
+    rx_slot_t *slot = ctx->slot;
+    neoc_neo_block_t *block = NULL;
+
+    if (err == NEOC_SUCCESS) {
+        if (response->has_error || !response->result_json) {
+            err = NEOC_ERROR_RPC;
+        } else if (!(block = neoc_neo_block_from_json_node(response->result_json))) {
+            err = NEOC_ERROR_INVALID_FORMAT;
+        }
+    }
+    neoc_response_free(response);
+
+    pthread_mutex_lock(&impl->lock);
+    slot->result.block = block;
+    slot->error = err;
+    slot->pending = false;
+    slot->ready = true;
+    impl->in_flight--;
+    pthread_cond_broadcast(&impl->cond);
+    pthread_mutex_unlock(&impl->lock);
+    neoc_free(ctx);
+}
+
+static void rx_start_fetch(rx_subscription_impl_t *impl, rx_slot_t *slot, int index) {
+    char params[32];
+    snprintf(params, sizeof(params), "[%d,1]", index);
+    const char *method = impl->full_transaction_objects ? "getblock" : "getblockheader";
+
+    pthread_mutex_lock(&impl->lock);
+    slot->result.index = index;
+    slot->result.block = NULL;
+    slot->call_id = 0;
+    slot->pending = true;
+    slot->ready = false;
+    impl->in_flight++;
+    pthread_mutex_unlock(&impl->lock);
+
+    neoc_error_t err = NEOC_ERROR_OUT_OF_MEMORY;
+    rx_fetch_context_t *ctx = neoc_malloc(sizeof(rx_fetch_context_t));
+    neoc_request_t *request = neoc_request_create(method, params, impl->service);
+    if (ctx && request) {
+        ctx->impl = impl;
+        ctx->slot = slot;
+        neoc_http_call_id_t call_id = 0;
+        err = neoc_service_send_request_async(impl->service, request, rx_block_fetched, ctx, &call_id);
+        if (err == NEOC_SUCCESS) {
+            pthread_mutex_lock(&impl->lock);
+            if (slot->pending) {
+                slot->call_id = call_id;
+            }
+            pthread_mutex_unlock(&impl->lock);
+        }
+    }
+    neoc_request_free(request);
+
+    if (err != NEOC_SUCCESS) {
+        neoc_free(ctx);
+        pthread_mutex_lock(&impl->lock);
+        slot->error = err;
+        slot->pending = false;
+        slot->ready = true;
+        impl->in_flight--;
+        pthread_mutex_unlock(&impl->lock);
+    }
+}
+
+/* Cancels outstanding fetches and waits for their completions */
+static void rx_drain_fetches(rx_subscription_impl_t *impl) {
+    pthread_mutex_lock(&impl->lock);
+    for (size_t i = 0; i < impl->slot_count; i++) {
+        rx_slot_t *slot = &impl->slots[i];
+        if (slot->pending && slot->call_id) {
+            neoc_http_call_id_t call_id = slot->call_id;
+            pthread_mutex_unlock(&impl->lock);
+            neoc_service_cancel_async(impl->service, call_id);
+            pthread_mutex_lock(&impl->lock);
+        }
+    }
+    while (impl->in_flight > 0) {
+        pthread_cond_wait(&impl->cond, &impl->lock);
+    }
+    for (size_t i = 0; i < impl->slot_count; i++) {
+        if (impl->slots[i].ready) {
+            neoc_neo_block_free(impl->slots[i].result.block);
+            memset(&impl->slots[i], 0, sizeof(rx_slot_t));
+        }
+    }
+    pthread_mutex_unlock(&impl->lock);
+}
+
+/*
+ * Delivers blocks first..last (inclusive, stepping by step) in order while
+ * keeping up to slot_count fetches ahead of the consumer. Returns false
+ * once the subscription is cancelled.
+ */
+static bool rx_deliver_range(rx_subscription_impl_t *impl, int first, int last, int step) {
+    size_t total = (size_t)((last - first) * step) + 1;
+    size_t issued = 0;
+    size_t delivered = 0;
+
+    while (delivered < total && !rx_is_cancelled(impl)) {
+        while (issued < total && issued - delivered < impl->slot_count) {
+            rx_start_fetch(impl, &impl->slots[issued % impl->slot_count], first + step * (int)issued);
+            issued++;
+        }
+
+        rx_slot_t *slot = &impl->slots[delivered % impl->slot_count];
+        pthread_mutex_lock(&impl->lock);
+        while (!slot->ready && !impl->cancelled) {
+            pthread_cond_wait(&impl->cond, &impl->lock);
+        }
+        if (impl->cancelled) {
+            pthread_mutex_unlock(&impl->lock);
+            break;
+        }
+        neoc_neo_get_block_t result = slot->result;
+        neoc_error_t err = slot->error;
+        memset(slot, 0, sizeof(*slot));
+        pthread_mutex_unlock(&impl->lock);
+
+        bool keep_going = impl->block_callback(&result, err, impl->user_data);
+        neoc_neo_block_free(result.block);
+        delivered++;
+        if (!keep_going) {
+            rx_mark_cancelled(impl);
+        }
+    }
+
+    if (issued > delivered) {
+        rx_drain_fetches(impl);
+    }
+    return !rx_is_cancelled(impl);
+}
+
+/* Delivers from *next_index up to the chain tip, re-checking the tip until caught up */
+static bool rx_catch_up(rx_subscription_impl_t *impl, int *next_index) {
+    for (;;) {
+        int latest = 0;
+        neoc_error_t err = rx_fetch_latest_index(impl->service, &latest);
+        if (err != NEOC_SUCCESS) {
+            if (!rx_report_error(impl, err) || !rx_wait(impl, impl->polling_interval_ms)) {
+                return false;
+            }
+            continue;
+        }
+        if (latest < *next_index) {
+            return true;
+        }
+        if (!rx_deliver_range(impl, *next_index, latest, 1)) {
+            return false;
+        }
+        *next_index = latest + 1;
+    }
+}
+
+static void rx_poll_blocks(rx_subscription_impl_t *impl, int next_index) {
+    do {
+        int latest = 0;
+        neoc_error_t err = rx_fetch_latest_index(impl->service, &latest);
+        if (err != NEOC_SUCCESS) {
+            if (!rx_report_error(impl, err)) {
+                return;
+            }
+            continue;
+        }
+        if (next_index < 0) {
+            next_index = latest;
+        }
+        if (latest >= next_index) {
+            if (!rx_deliver_range(impl, next_index, latest, 1)) {
+                return;
+            }
+            next_index = latest + 1;
+        }
+    } while (rx_wait(impl, impl->polling_interval_ms));
+}
+
+static void rx_poll_indices(rx_subscription_impl_t *impl) {
+    int last_index = -1;
+    do {
+        int latest = 0;
+        neoc_error_t err = rx_fetch_latest_index(impl->service, &latest);
+        if (err != NEOC_SUCCESS) {
+            if (!rx_report_error(impl, err)) {
+                return;
+            }
+            continue;
+        }
+        int first = last_index < 0 ? latest : last_index + 1;
+        for (int index = first; index <= latest; index++) {
+            if (rx_is_cancelled(impl)) {
+                return;
+            }
+            if (!impl->index_callback(index, NEOC_SUCCESS, impl->user_data)) {
+                rx_mark_cancelled(impl);
+                return;
+            }
+            last_index = index;
+        }
+    } while (rx_wait(impl, impl->polling_interval_ms));
+}
+
+static void *rx_subscription_run(void *arg) {
+    neoc_subscription_t *subscription = (neoc_subscription_t *)arg;
+    rx_subscription_impl_t *impl = (rx_subscription_impl_t *)subscription->impl_data;
+    int next_index = impl->start_index;
+    rx_current_subscription = impl;
+
+    switch (impl->mode) {
+        case RX_MODE_INDEX_POLL:
+            rx_poll_indices(impl);
+            break;
+        case RX_MODE_BLOCK_POLL:
+            rx_poll_blocks(impl, -1);
+            break;
+        case RX_MODE_REPLAY:
+            if (impl->ascending) {
+                rx_deliver_range(impl, impl->start_index, impl->end_index, 1);
+            } else {
+                rx_deliver_range(impl, impl->end_index, impl->start_index, -1);
+            }
+            break;
+        case RX_MODE_CATCH_UP:
+            rx_catch_up(impl, &next_index);
+            break;
+        case RX_MODE_CATCH_UP_AND_POLL:
+            if (rx_catch_up(impl, &next_index)) {
+                rx_poll_blocks(impl, next_index);
+            }
+            break;
+    }
+
+    pthread_mutex_lock(&impl->lock);
+    subscription->is_active = false;
+    pthread_mutex_unlock(&impl->lock);
+    return NULL;
+}
+
+static void rx_subscription_impl_free(rx_subscription_impl_t *impl) {
+    pthread_cond_destroy(&impl->cond);
+    pthread_mutex_destroy(&impl->lock);
+    neoc_free(impl->slots);
+    neoc_free(impl);
+}
+
+static neoc_error_t rx_register(neoc_json_rpc2_0_rx_t *rx, neoc_subscription_t *subscription) {
+    pthread_mutex_lock(&rx_registry_lock);
+    neoc_subscription_t **grown = neoc_realloc(rx->subscriptions,
+                                               (rx->subscription_count + 1) * sizeof(neoc_subscription_t *));
+    if (grown) {
+        grown[rx->subscription_count++] = subscription;
+        rx->subscriptions = grown;
+    }
+    pthread_mutex_unlock(&rx_registry_lock);
+    return grown ? NEOC_SUCCESS : neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to register subscription");
+}
+
+static void rx_unregister(neoc_json_rpc2_0_rx_t *rx, neoc_subscription_t *subscription) {
+    pthread_mutex_lock(&rx_registry_lock);
+    for (size_t i = 0; i < rx->subscription_count; i++) {
+        if (rx->subscriptions[i] == subscription) {
+            rx->subscriptions[i] = rx->subscriptions[--rx->subscription_count];
+            break;
+        }
+    }
+    pthread_mutex_unlock(&rx_registry_lock);
+}
+
+/* Creates, registers and starts a subscription described by config */
+static neoc_error_t rx_subscribe(neoc_json_rpc2_0_rx_t *rx,
+                                 const rx_subscription_impl_t *config,
+                                 neoc_subscription_t **subscription_out) {
+    if (subscription_out) {
+        *subscription_out = NULL;
+    }
+    if (!rx || !subscription_out || (!config->block_callback && !config->index_callback)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid subscription arguments");
+    }
+
+    neoc_service_t *service = NULL;
+    neoc_error_t err = rx_get_service(rx, &service);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    neoc_subscription_t *subscription = neoc_calloc(1, sizeof(neoc_subscription_t));
+    rx_subscription_impl_t *impl = neoc_malloc(sizeof(rx_subscription_impl_t));
+    size_t slot_count = rx->max_prefetch ? rx->max_prefetch : NEOC_RX_DEFAULT_PREFETCH;
+    rx_slot_t *slots = neoc_calloc(slot_count, sizeof(rx_slot_t));
+    if (!subscription || !impl || !slots) {
+        neoc_free(subscription);
+        neoc_free(impl);
+        neoc_free(slots);
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to allocate subscription");
+    }
+
+    *impl = *config;
+    impl->rx = rx;
+    impl->service = service;
+    impl->slots = slots;
+    impl->slot_count = slot_count;
+    impl->in_flight = 0;
+    impl->cancelled = false;
+    impl->joined = false;
+    if (impl->polling_interval_ms <= 0) {
+        impl->polling_interval_ms = 1000;
+    }
+    pthread_mutex_init(&impl->lock, NULL);
+    pthread_cond_init(&impl->cond, NULL);
+
+    subscription->impl_data = impl;
+    subscription->is_active = true;
+    subscription->cancel = rx_subscription_stop;
+
+    err = rx_register(rx, subscription);
+    if (err != NEOC_SUCCESS) {
+        rx_subscription_impl_free(impl);
+        neoc_free(subscription);
+        return err;
+    }
+
+    if (pthread_create(&impl->thread, NULL, rx_subscription_run, subscription) != 0) {
+        rx_unregister(rx, subscription);
+        rx_subscription_impl_free(impl);
+        neoc_free(subscription);
+        return neoc_error_set(NEOC_ERROR_INTERNAL, "Failed to start subscription thread");
+    }
+
+    *subscription_out = subscription;
+    return NEOC_SUCCESS;
+}
+
 neoc_error_t neoc_json_rpc2_0_rx_block_index_publisher(neoc_json_rpc2_0_rx_t *rx,
                                                        int polling_interval,
                                                        neoc_block_index_callback_t callback,
                                                        void *user_data,
                                                        neoc_subscription_t **subscription_out) {
-    (void)rx; (void)polling_interval; (void)callback; (void)user_data;
-    if (subscription_out) {
-        *subscription_out = NULL;
-    }
-    return rx_not_implemented();
+    rx_subscription_impl_t config = {
+        .mode = RX_MODE_INDEX_POLL,
+        .polling_interval_ms = polling_interval,
+        .index_callback = callback,
+        .user_data = user_data
+    };
+    return rx_subscribe(rx, &config, subscription_out);
 }
 
 neoc_error_t neoc_json_rpc2_0_rx_block_publisher(neoc_json_rpc2_0_rx_t *rx,
@@ -38,12 +531,14 @@ neoc_error_t neoc_json_rpc2_0_rx_block_publisher(neoc_json_rpc2_0_rx_t *rx,
                                                  neoc_block_callback_t callback,
                                                  void *user_data,
                                                  neoc_subscription_t **subscription_out) {
-    (void)rx; (void)full_transaction_objects; (void)polling_interval;
-    (void)callback; (void)user_data;
-    if (subscription_out) {
-        *subscription_out = NULL;
-    }
-    return rx_not_implemented();
+    rx_subscription_impl_t config = {
+        .mode = RX_MODE_BLOCK_POLL,
+        .full_transaction_objects = full_transaction_objects,
+        .polling_interval_ms = polling_interval,
+        .block_callback = callback,
+        .user_data = user_data
+    };
+    return rx_subscribe(rx, &config, subscription_out);
 }
 
 neoc_error_t neoc_json_rpc2_0_rx_replay_blocks_publisher(neoc_json_rpc2_0_rx_t *rx,
@@ -54,13 +549,22 @@ neoc_error_t neoc_json_rpc2_0_rx_replay_blocks_publisher(neoc_json_rpc2_0_rx_t *
                                                          neoc_block_callback_t callback,
                                                          void *user_data,
                                                          neoc_subscription_t **subscription_out) {
-    (void)rx; (void)start_block; (void)end_block;
-    (void)full_transaction_objects; (void)ascending;
-    (void)callback; (void)user_data;
-    if (subscription_out) {
-        *subscription_out = NULL;
+    if (start_block < 0 || end_block < start_block) {
+        if (subscription_out) {
+            *subscription_out = NULL;
+        }
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid block range");
     }
-    return rx_not_implemented();
+    rx_subscription_impl_t config = {
+        .mode = RX_MODE_REPLAY,
+        .full_transaction_objects = full_transaction_objects,
+        .start_index = start_block,
+        .end_index = end_block,
+        .ascending = ascending,
+        .block_callback = callback,
+        .user_data = user_data
+    };
+    return rx_subscribe(rx, &config, subscription_out);
 }
 
 neoc_error_t neoc_json_rpc2_0_rx_catch_up_to_latest_and_subscribe(neoc_json_rpc2_0_rx_t *rx,
@@ -70,12 +574,21 @@ neoc_error_t neoc_json_rpc2_0_rx_catch_up_to_latest_and_subscribe(neoc_json_rpc2
                                                                   neoc_block_callback_t callback,
                                                                   void *user_data,
                                                                   neoc_subscription_t **subscription_out) {
-    (void)rx; (void)start_block; (void)full_transaction_objects;
-    (void)polling_interval; (void)callback; (void)user_data;
-    if (subscription_out) {
-        *subscription_out = NULL;
+    if (start_block < 0) {
+        if (subscription_out) {
+            *subscription_out = NULL;
+        }
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid start block");
     }
-    return rx_not_implemented();
+    rx_subscription_impl_t config = {
+        .mode = RX_MODE_CATCH_UP_AND_POLL,
+        .full_transaction_objects = full_transaction_objects,
+        .polling_interval_ms = polling_interval,
+        .start_index = start_block,
+        .block_callback = callback,
+        .user_data = user_data
+    };
+    return rx_subscribe(rx, &config, subscription_out);
 }
 
 neoc_error_t neoc_json_rpc2_0_rx_catch_up_to_latest_block_publisher(neoc_json_rpc2_0_rx_t *rx,
@@ -84,32 +597,110 @@ neoc_error_t neoc_json_rpc2_0_rx_catch_up_to_latest_block_publisher(neoc_json_rp
                                                                     neoc_block_callback_t callback,
                                                                     void *user_data,
                                                                     neoc_subscription_t **subscription_out) {
-    (void)rx; (void)start_block; (void)full_transaction_objects;
-    (void)callback; (void)user_data;
-    if (subscription_out) {
-        *subscription_out = NULL;
+    if (start_block < 0) {
+        if (subscription_out) {
+            *subscription_out = NULL;
+        }
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid start block");
     }
-    return rx_not_implemented();
+    rx_subscription_impl_t config = {
+        .mode = RX_MODE_CATCH_UP,
+        .full_transaction_objects = full_transaction_objects,
+        .start_index = start_block,
+        .block_callback = callback,
+        .user_data = user_data
+    };
+    return rx_subscribe(rx, &config, subscription_out);
 }
 
 neoc_error_t neoc_json_rpc2_0_rx_get_latest_block_index(neoc_json_rpc2_0_rx_t *rx, int *block_index_out) {
-    (void)rx;
-    if (block_index_out) {
-        *block_index_out = -1;
+    if (!rx || !block_index_out) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *block_index_out = -1;
+
+    neoc_service_t *service = NULL;
+    neoc_error_t err = rx_get_service(rx, &service);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    return rx_fetch_latest_index(service, block_index_out);
+}
+
+typedef struct {
+    neoc_block_index_callback_t callback;
+    void *user_data;
+} rx_latest_index_context_t;
+
+static void rx_latest_index_fetched(neoc_response_t *response, neoc_error_t err, void *user_data) {
+    rx_latest_index_context_t *ctx = (rx_latest_index_context_t *)user_data;
+    int latest = -1;
+    if (err == NEOC_SUCCESS) {
+        err = rx_parse_block_count(response, &latest);
     }
-    return rx_not_implemented();
+    neoc_response_free(response);
+    ctx->callback(err == NEOC_SUCCESS ? latest : -1, err, ctx->user_data);
+    neoc_free(ctx);
 }
 
 neoc_error_t neoc_json_rpc2_0_rx_get_latest_block_index_async(neoc_json_rpc2_0_rx_t *rx,
                                                               neoc_block_index_callback_t callback,
                                                               void *user_data) {
-    (void)rx; (void)callback; (void)user_data;
-    return rx_not_implemented();
+    if (!rx || !callback) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    neoc_service_t *service = NULL;
+    neoc_error_t err = rx_get_service(rx, &service);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    rx_latest_index_context_t *ctx = neoc_malloc(sizeof(rx_latest_index_context_t));
+    neoc_request_t *request = neoc_request_create("getblockcount", "[]", service);
+    if (!ctx || !request) {
+        neoc_free(ctx);
+        neoc_request_free(request);
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to create request");
+    }
+    ctx->callback = callback;
+    ctx->user_data = user_data;
+
+    err = neoc_service_send_request_async(service, request, rx_latest_index_fetched, ctx, NULL);
+    neoc_request_free(request);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(ctx);
+    }
+    return err;
+}
+
+static bool rx_subscription_stop(neoc_subscription_t *subscription) {
+    rx_subscription_impl_t *impl = (rx_subscription_impl_t *)subscription->impl_data;
+
+    pthread_mutex_lock(&impl->lock);
+    impl->cancelled = true;
+    subscription->is_active = false;
+    pthread_cond_broadcast(&impl->cond);
+    bool join = !impl->joined && rx_current_subscription != impl;
+    impl->joined = impl->joined || join;
+    pthread_mutex_unlock(&impl->lock);
+
+    /* From inside a callback the thread exits once the callback returns */
+    if (join) {
+        pthread_join(impl->thread, NULL);
+    }
+    return true;
 }
 
 neoc_error_t neoc_subscription_cancel(neoc_subscription_t *subscription) {
-    (void)subscription;
-    return rx_not_implemented();
+    if (!subscription) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Subscription is NULL");
+    }
+    if (subscription->cancel) {
+        subscription->cancel(subscription);
+    }
+    subscription->is_active = false;
+    return NEOC_SUCCESS;
 }
 
 bool neoc_subscription_is_active(const neoc_subscription_t *subscription) {
@@ -123,12 +714,38 @@ void neoc_subscription_free(neoc_subscription_t *subscription) {
     if (subscription->cancel) {
         subscription->cancel(subscription);
     }
+    if (subscription->cancel == rx_subscription_stop) {
+        rx_subscription_impl_t *impl = (rx_subscription_impl_t *)subscription->impl_data;
+        rx_unregister(impl->rx, subscription);
+        rx_subscription_impl_free(impl);
+    }
     neoc_free(subscription);
 }
 
 neoc_error_t neoc_json_rpc2_0_rx_cancel_all_subscriptions(neoc_json_rpc2_0_rx_t *rx) {
-    (void)rx;
-    return rx_not_implemented();
+    if (!rx) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Reactive client is NULL");
+    }
+
+    pthread_mutex_lock(&rx_registry_lock);
+    size_t count = rx->subscription_count;
+    neoc_subscription_t **subscriptions = NULL;
+    if (count > 0) {
+        subscriptions = neoc_malloc(count * sizeof(neoc_subscription_t *));
+        if (subscriptions) {
+            memcpy(subscriptions, rx->subscriptions, count * sizeof(neoc_subscription_t *));
+        }
+    }
+    pthread_mutex_unlock(&rx_registry_lock);
+    if (count > 0 && !subscriptions) {
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to cancel subscriptions");
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        neoc_subscription_cancel(subscriptions[i]);
+    }
+    neoc_free(subscriptions);
+    return NEOC_SUCCESS;
 }
 
 neoc_neo_c_t *neoc_json_rpc2_0_rx_get_neo_c(neoc_json_rpc2_0_rx_t *rx) {
@@ -139,11 +756,17 @@ void neoc_json_rpc2_0_rx_free(neoc_json_rpc2_0_rx_t *rx) {
     if (!rx) {
         return;
     }
-    if (rx->subscriptions) {
-        for (size_t i = 0; i < rx->subscription_count; ++i) {
-            neoc_subscription_free(rx->subscriptions[i]);
-        }
-        neoc_free(rx->subscriptions);
+
+    pthread_mutex_lock(&rx_registry_lock);
+    neoc_subscription_t **subscriptions = rx->subscriptions;
+    size_t count = rx->subscription_count;
+    rx->subscriptions = NULL;
+    rx->subscription_count = 0;
+    pthread_mutex_unlock(&rx_registry_lock);
+
+    for (size_t i = 0; i < count; ++i) {
+        neoc_subscription_free(subscriptions[i]);
     }
+    neoc_free(subscriptions);
     neoc_free(rx);
 }
@@ -14,11 +14,16 @@
 #include "neoc/utils/array.h"
 #include "neoc/utils/url_session.h"
 #include "neoc/utils/decode.h"
+#include "neoc/utils/http_engine.h"
 #include <cjson/cJSON.h>
+#include <pthread.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+/* Guards lazy creation of each service's async engine */
+static pthread_mutex_t service_engine_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static neoc_error_t neoc_service_config_copy(neoc_service_config_t *dest,
                                              const neoc_service_config_t *src) {
     if (!dest || !src) {
@@ -127,6 +132,7 @@ neoc_error_t neoc_service_create(neoc_service_type_t type,
     new_service->type = type;
     new_service->vtable = NULL;
     new_service->impl_data = NULL;
+    new_service->async_engine = NULL;
 
     neoc_error_t err = neoc_service_config_copy(&new_service->config, config);
     if (err != NEOC_SUCCESS) {
@@ -163,6 +169,10 @@ void neoc_service_free(neoc_service_t *service) {
     if (!service) {
         return;
     }
+
+    // Stops the engine; pending async calls complete as cancelled
+    neoc_http_engine_free(service->async_engine);
+    service->async_engine = NULL;
     
     if (service->vtable && service->vtable->free_impl) {
         service->vtable->free_impl(service);
@@ -181,78 +191,85 @@ void neoc_service_free(neoc_service_t *service) {
     neoc_free(service);
 }
 
-/**
- * @brief Send a JSON-RPC request through the service
- */
-neoc_error_t neoc_service_send_request(neoc_service_t *service,
-                                       const neoc_request_t *request,
-                                       neoc_response_t **response) {
-    if (!service || !request || !response) {
-        return NEOC_ERROR_INVALID_PARAM;
-    }
-    
-    *response = NULL;
-    
-    cJSON *request_json = cJSON_CreateObject();
-    if (!request_json) {
-        return NEOC_ERROR_OUT_OF_MEMORY;
+// JSON-RPC envelope strings are written unescaped
+static bool service_is_plain_string(const char *text) {
+    for (const char *c = text; *c; c++) {
+        if (*c == '"' || *c == '\\' || (unsigned char)*c < 0x20) {
+            return false;
+        }
     }
+    return true;
+}
 
-    cJSON_AddStringToObject(request_json, "jsonrpc", request->jsonrpc ? request->jsonrpc : "2.0");
-    cJSON_AddStringToObject(request_json, "method", request->method ? request->method : "");
+/*
+ * Writes the request envelope in one pass. The parameters are already JSON
+ * text, so they are copied into place rather than parsed and printed again.
+ */
+static neoc_error_t service_build_payload(const neoc_request_t *request, char **payload_json) {
+    const char *jsonrpc = request->jsonrpc ? request->jsonrpc : "2.0";
+    const char *method = request->method ? request->method : "";
+    if (!service_is_plain_string(jsonrpc) || !service_is_plain_string(method)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_PARAM, "Request method needs escaping");
+    }
 
-    cJSON *params_node = NULL;
-    if (request->params && strlen(request->params) > 0) {
-        params_node = cJSON_Parse(request->params);
+    const char *params = request->params;
+    if (params) {
+        params += strspn(params, " \t\r\n");
     }
-    if (!params_node) {
-        params_node = cJSON_CreateArray();
+    if (!params || *params == '\0') {
+        params = "[]";
     }
-    cJSON_AddItemToObject(request_json, "params", params_node);
-    cJSON_AddNumberToObject(request_json, "id", request->id);
 
-    char *payload_json = cJSON_PrintUnformatted(request_json);
-    cJSON_Delete(request_json);
-    if (!payload_json) {
-        return NEOC_ERROR_OUT_OF_MEMORY;
+    static const char format[] = "{\"jsonrpc\":\"%s\",\"method\":\"%s\",\"params\":%s,\"id\":%d}";
+    int length = snprintf(NULL, 0, format, jsonrpc, method, params, request->id);
+    if (length < 0) {
+        return NEOC_ERROR_INVALID_FORMAT;
     }
 
-    neoc_byte_array_t payload = { .data = (uint8_t*)payload_json, .length = strlen(payload_json), .capacity = 0 };
-
-    neoc_byte_array_t *result = NULL;
-    neoc_error_t err = neoc_service_perform_io(service, &payload, &result);
-    neoc_free(payload_json);
-    if (err != NEOC_SUCCESS) {
-        return err;
+    *payload_json = neoc_malloc((size_t)length + 1);
+    if (!*payload_json) {
+        return NEOC_ERROR_OUT_OF_MEMORY;
     }
+    snprintf(*payload_json, (size_t)length + 1, format, jsonrpc, method, params, request->id);
+    return NEOC_SUCCESS;
+}
 
+neoc_error_t neoc_service_parse_response(const neoc_service_t *service,
+                                         int request_id,
+                                         const neoc_byte_array_t *result,
+                                         neoc_response_t **response) {
+    if (!service || !response) {
+        return neoc_error_set(NEOC_ERROR_INVALID_PARAM, "Invalid arguments to parse_response");
+    }
     if (!result || !result->data) {
-        neoc_byte_array_free(result);
-        return NEOC_ERROR_INVALID_FORMAT;
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Service returned empty response");
     }
 
-    char *response_str = neoc_malloc(result->length + 1);
-    if (!response_str) {
-        neoc_byte_array_free(result);
-        return NEOC_ERROR_OUT_OF_MEMORY;
+    // Bodies from perform_io are terminated, so they are parsed in place;
+    // anything else gets a terminated copy first
+    const char *text = (const char *)result->data;
+    char *copy = NULL;
+    if (result->capacity <= result->length || result->data[result->length] != '\0') {
+        copy = neoc_malloc(result->length + 1);
+        if (!copy) {
+            return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to allocate response buffer");
+        }
+        memcpy(copy, result->data, result->length);
+        copy[result->length] = '\0';
+        text = copy;
     }
-    memcpy(response_str, result->data, result->length);
-    response_str[result->length] = '\0';
 
-    cJSON *response_json = cJSON_Parse(response_str);
+    cJSON *response_json = cJSON_ParseWithLength(text, result->length);
+    neoc_free(copy);
     if (!response_json || !cJSON_IsObject(response_json)) {
-        neoc_byte_array_free(result);
-        neoc_free(response_str);
-        if (response_json) cJSON_Delete(response_json);
-        return NEOC_ERROR_INVALID_FORMAT;
+        cJSON_Delete(response_json);
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Failed to parse response JSON");
     }
 
-    neoc_response_t *resp = neoc_response_create(request->id);
+    neoc_response_t *resp = neoc_response_create(request_id);
     if (!resp) {
         cJSON_Delete(response_json);
-        neoc_byte_array_free(result);
-        neoc_free(response_str);
-        return NEOC_ERROR_OUT_OF_MEMORY;
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to allocate response");
     }
 
     const cJSON *jsonrpc = cJSON_GetObjectItemCaseSensitive(response_json, "jsonrpc");
@@ -274,7 +291,11 @@ neoc_error_t neoc_service_send_request(neoc_service_t *service,
     }
 
     if (service->config.include_raw_responses) {
-        neoc_response_set_raw(resp, response_str);
+        resp->raw_response = neoc_malloc(result->length + 1);
+        if (resp->raw_response) {
+            memcpy(resp->raw_response, result->data, result->length);
+            resp->raw_response[result->length] = '\0';
+        }
     }
 
     const cJSON *error_obj = cJSON_GetObjectItemCaseSensitive(response_json, "error");
@@ -301,17 +322,19 @@ neoc_error_t neoc_service_send_request(neoc_service_t *service,
             cJSON_free(data_str);
         }
     } else {
-        const cJSON *result_obj = cJSON_GetObjectItemCaseSensitive(response_json, "result");
+        // The result node moves onto the response for typed decoders; the
+        // text stays in result for callers that read it directly
+        cJSON *result_obj = cJSON_DetachItemFromObject(response_json, "result");
         if (result_obj) {
-            char *result_str = cJSON_PrintUnformatted((cJSON *)result_obj);
+            char *result_str = cJSON_PrintUnformatted(result_obj);
             if (!result_str) {
+                cJSON_Delete(result_obj);
                 neoc_response_free(resp);
                 cJSON_Delete(response_json);
-                neoc_byte_array_free(result);
-                neoc_free(response_str);
-                return NEOC_ERROR_OUT_OF_MEMORY;
+                return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to serialize result");
             }
             resp->result = result_str;
+            resp->result_json = result_obj;
             resp->has_error = false;
         }
     }
@@ -319,11 +342,41 @@ neoc_error_t neoc_service_send_request(neoc_service_t *service,
     *response = resp;
 
     cJSON_Delete(response_json);
-    neoc_byte_array_free(result);
-    neoc_free(response_str);
     return NEOC_SUCCESS;
 }
 
+/**
+ * @brief Send a JSON-RPC request through the service
+ */
+neoc_error_t neoc_service_send_request(neoc_service_t *service,
+                                       const neoc_request_t *request,
+                                       neoc_response_t **response) {
+    if (!service || !request || !response) {
+        return NEOC_ERROR_INVALID_PARAM;
+    }
+    
+    *response = NULL;
+
+    char *payload_json = NULL;
+    neoc_error_t err = service_build_payload(request, &payload_json);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    neoc_byte_array_t payload = { .data = (uint8_t*)payload_json, .length = strlen(payload_json), .capacity = 0 };
+
+    neoc_byte_array_t *result = NULL;
+    err = neoc_service_perform_io(service, &payload, &result);
+    neoc_free(payload_json);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    err = neoc_service_parse_response(service, request->id, result, response);
+    neoc_byte_array_free(result);
+    return err;
+}
+
 /**
  * @brief Perform low-level IO operation
  */
@@ -387,15 +440,17 @@ neoc_error_t neoc_service_perform_io(neoc_service_t *service,
     }
 
     if (http_response->body && http_response->body->data && http_response->body->length > 0) {
-        out->data = neoc_malloc(http_response->body->length);
+        // One spare byte keeps the body terminated for in-place parsing
+        out->data = neoc_malloc(http_response->body->length + 1);
         if (!out->data) {
             neoc_http_response_free(http_response);
             neoc_free(out);
             return NEOC_ERROR_OUT_OF_MEMORY;
         }
         memcpy(out->data, http_response->body->data, http_response->body->length);
+        out->data[http_response->body->length] = '\0';
         out->length = http_response->body->length;
-        out->capacity = http_response->body->length;
+        out->capacity = http_response->body->length + 1;
     }
 
     neoc_http_response_free(http_response);
@@ -403,6 +458,177 @@ neoc_error_t neoc_service_perform_io(neoc_service_t *service,
     return NEOC_SUCCESS;
 }
 
+typedef struct {
+    neoc_service_io_callback_t callback;
+    void *user_data;
+} service_io_context_t;
+
+typedef struct {
+    const neoc_service_t *service;
+    int request_id;
+    neoc_service_callback_t callback;
+    void *user_data;
+} service_request_context_t;
+
+static void service_io_completed(neoc_http_completion_t *completion) {
+    service_io_context_t *ctx = (service_io_context_t *)completion->user_data;
+    neoc_error_t err = completion->error;
+    neoc_byte_array_t *body = completion->body;
+
+    if (err == NEOC_SUCCESS && completion->status_code >= 400) {
+        err = NEOC_ERROR_RPC;
+    }
+    if (err != NEOC_SUCCESS) {
+        neoc_byte_array_free(body);
+        body = NULL;
+    }
+
+    ctx->callback(body, err, ctx->user_data);
+    neoc_free(ctx);
+}
+
+static neoc_error_t service_get_engine(neoc_service_t *service, neoc_http_engine_t **engine) {
+    neoc_error_t err = NEOC_SUCCESS;
+
+    pthread_mutex_lock(&service_engine_lock);
+    if (!service->async_engine) {
+        neoc_http_engine_config_t config;
+        neoc_http_engine_get_default_config(&config);
+        if (service->config.timeout_seconds > 0) {
+            config.default_timeout_ms = service->config.timeout_seconds * 1000;
+        }
+        err = neoc_http_engine_create(&config, &service->async_engine);
+    }
+    *engine = service->async_engine;
+    pthread_mutex_unlock(&service_engine_lock);
+
+    return err;
+}
+
+/**
+ * @brief Perform low-level IO without blocking
+ */
+neoc_error_t neoc_service_perform_io_async(neoc_service_t *service,
+                                            const neoc_byte_array_t *payload,
+                                            neoc_service_io_callback_t callback,
+                                            void *user_data,
+                                            neoc_http_call_id_t *call_id) {
+    if (!service || !payload || !callback) {
+        return NEOC_ERROR_INVALID_PARAM;
+    }
+    if (call_id) {
+        *call_id = 0;
+    }
+
+    // Custom transports only offer blocking IO
+    if (service->vtable && service->vtable->perform_io) {
+        neoc_byte_array_t *result = NULL;
+        neoc_error_t err = service->vtable->perform_io(service, payload, &result);
+        if (err != NEOC_SUCCESS) {
+            neoc_byte_array_free(result);
+            result = NULL;
+        }
+        callback(result, err, user_data);
+        return NEOC_SUCCESS;
+    }
+
+    neoc_http_engine_t *engine = NULL;
+    neoc_error_t err = service_get_engine(service, &engine);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    service_io_context_t *ctx = neoc_malloc(sizeof(service_io_context_t));
+    if (!ctx) {
+        return NEOC_ERROR_OUT_OF_MEMORY;
+    }
+    ctx->callback = callback;
+    ctx->user_data = user_data;
+
+    const char *url = service->config.endpoint_url ? service->config.endpoint_url : "http://localhost:10333/";
+    const uint8_t *body = (const uint8_t *)"{}";
+    size_t body_len = 2;
+    if (payload->data && payload->length > 0) {
+        body = payload->data;
+        body_len = payload->length;
+    }
+
+    err = neoc_http_engine_post(engine, url, body, body_len, 0,
+                                service_io_completed, ctx, call_id);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(ctx);
+    }
+    return err;
+}
+
+static void service_request_completed(neoc_byte_array_t *result, neoc_error_t err, void *user_data) {
+    service_request_context_t *ctx = (service_request_context_t *)user_data;
+    neoc_response_t *response = NULL;
+
+    if (err == NEOC_SUCCESS) {
+        err = neoc_service_parse_response(ctx->service, ctx->request_id, result, &response);
+    }
+    neoc_byte_array_free(result);
+
+    ctx->callback(response, err, ctx->user_data);
+    neoc_free(ctx);
+}
+
+/**
+ * @brief Send a JSON-RPC request without blocking
+ */
+neoc_error_t neoc_service_send_request_async(neoc_service_t *service,
+                                              const neoc_request_t *request,
+                                              neoc_service_callback_t callback,
+                                              void *user_data,
+                                              neoc_http_call_id_t *call_id) {
+    if (!service || !request || !callback) {
+        return NEOC_ERROR_INVALID_PARAM;
+    }
+
+    char *payload_json = NULL;
+    neoc_error_t err = service_build_payload(request, &payload_json);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    service_request_context_t *ctx = neoc_malloc(sizeof(service_request_context_t));
+    if (!ctx) {
+        neoc_free(payload_json);
+        return NEOC_ERROR_OUT_OF_MEMORY;
+    }
+    ctx->service = service;
+    ctx->request_id = request->id;
+    ctx->callback = callback;
+    ctx->user_data = user_data;
+
+    neoc_byte_array_t payload = { .data = (uint8_t*)payload_json, .length = strlen(payload_json), .capacity = 0 };
+    err = neoc_service_perform_io_async(service, &payload, service_request_completed, ctx, call_id);
+    neoc_free(payload_json);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(ctx);
+    }
+    return err;
+}
+
+/**
+ * @brief Cancel an asynchronous call
+ */
+neoc_error_t neoc_service_cancel_async(neoc_service_t *service, neoc_http_call_id_t call_id) {
+    if (!service) {
+        return NEOC_ERROR_INVALID_PARAM;
+    }
+
+    pthread_mutex_lock(&service_engine_lock);
+    neoc_http_engine_t *engine = service->async_engine;
+    pthread_mutex_unlock(&service_engine_lock);
+
+    if (!engine) {
+        return NEOC_ERROR_NOT_FOUND;
+    }
+    return neoc_http_engine_cancel(engine, call_id);
+}
+
 /**
  * @brief Check if service includes raw responses
  */
@@ -4,9 +4,16 @@
  */
 
 #include "neoc/protocol/stack_item.h"
+#include "neoc/utils/neoc_base64.h"
+#include "neoc/neoc_memory.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <errno.h>
+
+#ifdef HAVE_CJSON
+#include <cjson/cJSON.h>
+#endif
 
 #define DEFAULT_ARRAY_CAPACITY 16
 #define DEFAULT_MAP_CAPACITY 16
@@ -489,6 +496,74 @@ neoc_error_t stack_item_map_set(stack_item_t* map, stack_item_t* key, stack_item
     return NEOC_SUCCESS;
 }
 
+// Deep copy of a stack item
+stack_item_t* stack_item_clone(const stack_item_t* item) {
+    if (!item) return NULL;
+    
+    stack_item_t* clone = NULL;
+    switch (item->type) {
+        case STACK_ITEM_TYPE_ANY:
+            return stack_item_create_any();
+            
+        case STACK_ITEM_TYPE_BOOLEAN:
+            return stack_item_create_boolean(item->value.boolean_value);
+            
+        case STACK_ITEM_TYPE_INTEGER:
+            return stack_item_create_big_integer(item->value.integer.bytes,
+                                                 item->value.integer.length,
+                                                 item->value.integer.is_negative);
+            
+        case STACK_ITEM_TYPE_BYTE_STRING:
+            return stack_item_create_byte_string(item->value.byte_string.data,
+                                                 item->value.byte_string.length);
+            
+        case STACK_ITEM_TYPE_BUFFER:
+            return stack_item_create_buffer(item->value.byte_string.data,
+                                            item->value.byte_string.length);
+            
+        case STACK_ITEM_TYPE_ARRAY:
+        case STACK_ITEM_TYPE_STRUCT:
+            clone = item->type == STACK_ITEM_TYPE_ARRAY
+                        ? stack_item_create_array(item->value.array.count)
+                        : stack_item_create_struct(item->value.array.count);
+            for (size_t i = 0; clone && i < item->value.array.count; i++) {
+                stack_item_t* element = stack_item_clone(item->value.array.items[i]);
+                if (!element || stack_item_array_add(clone, element) != NEOC_SUCCESS) {
+                    stack_item_unref(element);
+                    stack_item_unref(clone);
+                    return NULL;
+                }
+                stack_item_unref(element);
+            }
+            return clone;
+            
+        case STACK_ITEM_TYPE_MAP:
+            clone = stack_item_create_map(item->value.map.count);
+            for (size_t i = 0; clone && i < item->value.map.count; i++) {
+                stack_item_t* key = stack_item_clone(item->value.map.entries[i].key);
+                stack_item_t* value = stack_item_clone(item->value.map.entries[i].value);
+                neoc_error_t err = key && value ? stack_item_map_set(clone, key, value)
+                                                : NEOC_ERROR_OUT_OF_MEMORY;
+                stack_item_unref(key);
+                stack_item_unref(value);
+                if (err != NEOC_SUCCESS) {
+                    stack_item_unref(clone);
+                    return NULL;
+                }
+            }
+            return clone;
+            
+        case STACK_ITEM_TYPE_POINTER:
+            return stack_item_create_pointer(item->value.pointer.ptr, item->value.pointer.position);
+            
+        case STACK_ITEM_TYPE_INTEROP_INTERFACE:
+            return stack_item_create_interop_interface(item->value.interop_interface);
+            
+        default:
+            return NULL;
+    }
+}
+
 // Check equality of two stack items
 bool stack_item_equals(const stack_item_t* a, const stack_item_t* b) {
     if (a == b) return true;
@@ -565,5 +640,295 @@ const char* stack_item_type_name(stack_item_type_t type) {
     }
 }
 
+#ifdef HAVE_CJSON
+// Decimal Integer value; values outside int64 become little-endian magnitude bytes
+static stack_item_t* stack_item_integer_from_string(const char* text) {
+    char* end = NULL;
+    errno = 0;
+    long long value = strtoll(text, &end, 10);
+    if (end != text && *end == '\0' && errno == 0) {
+        return stack_item_create_integer(value);
+    }
+    
+    bool negative = (*text == '-');
+    const char* digits = (*text == '-' || *text == '+') ? text + 1 : text;
+    size_t digit_count = strlen(digits);
+    if (digit_count == 0 || strspn(digits, "0123456789") != digit_count) {
+        return NULL;
+    }
+    
+    // Each decimal digit needs under half a byte
+    uint8_t* bytes = calloc(digit_count / 2 + 1, 1);
+    if (!bytes) return NULL;
+    size_t length = 1;
+    for (size_t i = 0; i < digit_count; i++) {
+        unsigned int carry = (unsigned int)(digits[i] - '0');
+        for (size_t j = 0; j < length; j++) {
+            unsigned int v = bytes[j] * 10u + carry;
+            bytes[j] = (uint8_t)v;
+            carry = v >> 8;
+        }
+        if (carry) {
+            bytes[length++] = (uint8_t)carry;
+        }
+    }
+    
+    stack_item_t* item = stack_item_create_big_integer(bytes, length, negative);
+    free(bytes);
+    return item;
+}
+
+static stack_item_t* stack_item_bytes_from_base64(const cJSON* value, bool buffer) {
+    const char* text = cJSON_IsString(value) ? value->valuestring : "";
+    size_t capacity = neoc_base64_decode_buffer_size(text);
+    uint8_t* data = capacity ? malloc(capacity) : NULL;
+    size_t length = 0;
+    if (capacity && (!data || neoc_base64_decode(text, data, capacity, &length) != NEOC_SUCCESS)) {
+        free(data);
+        return NULL;
+    }
+    
+    stack_item_t* item = buffer ? stack_item_create_buffer(data, length)
+                                : stack_item_create_byte_string(data, length);
+    free(data);
+    return item;
+}
+#endif
+
+// Create stack item from a parsed RPC stack item node
+stack_item_t* stack_item_from_json_node(const neoc_json_t* json) {
+#ifndef HAVE_CJSON
+    (void)json;
+    return NULL;
+#else
+    const cJSON* type = cJSON_GetObjectItemCaseSensitive(json, "type");
+    if (!cJSON_IsString(type)) {
+        return NULL;
+    }
+    const char* name = type->valuestring;
+    const cJSON* value = cJSON_GetObjectItemCaseSensitive(json, "value");
+    
+    if (strcmp(name, "Any") == 0) {
+        return stack_item_create_any();
+    }
+    if (strcmp(name, "Boolean") == 0) {
+        return cJSON_IsBool(value) ? stack_item_create_boolean(cJSON_IsTrue(value)) : NULL;
+    }
+    if (strcmp(name, "Integer") == 0) {
+        if (cJSON_IsNumber(value)) {
+            return stack_item_create_integer((int64_t)value->valuedouble);
+        }
+        return cJSON_IsString(value) ? stack_item_integer_from_string(value->valuestring) : NULL;
+    }
+    if (strcmp(name, "ByteString") == 0 || strcmp(name, "Buffer") == 0) {
+        return stack_item_bytes_from_base64(value, name[0] == 'B' && name[1] == 'u');
+    }
+    if (strcmp(name, "Pointer") == 0) {
+        return stack_item_create_pointer(NULL, cJSON_IsNumber(value) ? (size_t)value->valuedouble : 0);
+    }
+    if (strcmp(name, "InteropInterface") == 0) {
+        return stack_item_create_interop_interface(NULL);
+    }
+    
+    bool is_struct = strcmp(name, "Struct") == 0;
+    if (is_struct || strcmp(name, "Array") == 0) {
+        size_t count = cJSON_IsArray(value) ? (size_t)cJSON_GetArraySize(value) : 0;
+        stack_item_t* array = is_struct ? stack_item_create_struct(count) : stack_item_create_array(count);
+        if (!array) return NULL;
+        const cJSON* element = NULL;
+        cJSON_ArrayForEach(element, value) {
+            stack_item_t* child = stack_item_from_json_node(element);
+            neoc_error_t err = child ? stack_item_array_add(array, child) : NEOC_ERROR_INVALID_FORMAT;
+            stack_item_unref(child);
+            if (err != NEOC_SUCCESS) {
+                stack_item_unref(array);
+                return NULL;
+            }
+        }
+        return array;
+    }
+    
+    if (strcmp(name, "Map") == 0) {
+        size_t count = cJSON_IsArray(value) ? (size_t)cJSON_GetArraySize(value) : 0;
+        stack_item_t* map = stack_item_create_map(count);
+        if (!map) return NULL;
+        const cJSON* entry = NULL;
+        cJSON_ArrayForEach(entry, value) {
+            stack_item_t* key = stack_item_from_json_node(cJSON_GetObjectItemCaseSensitive(entry, "key"));
+            stack_item_t* val = stack_item_from_json_node(cJSON_GetObjectItemCaseSensitive(entry, "value"));
+            neoc_error_t err = key && val ? stack_item_map_set(map, key, val) : NEOC_ERROR_INVALID_FORMAT;
+            stack_item_unref(key);
+            stack_item_unref(val);
+            if (err != NEOC_SUCCESS) {
+                stack_item_unref(map);
+                return NULL;
+            }
+        }
+        return map;
+    }
+    
+    return NULL;
+#endif
+}
+
+// Create stack item from JSON string
+stack_item_t* stack_item_from_json(const char* json) {
+#ifndef HAVE_CJSON
+    (void)json;
+    return NULL;
+#else
+    if (!json) return NULL;
+    
+    cJSON* root = cJSON_Parse(json);
+    if (!root) return NULL;
+    
+    stack_item_t* item = stack_item_from_json_node(root);
+    cJSON_Delete(root);
+    return item;
+#endif
+}
+
+#ifdef HAVE_CJSON
+// Magnitude bytes (little-endian) as a signed decimal string
+static cJSON* stack_item_integer_to_string(const stack_item_t* item) {
+    size_t length = item->value.integer.length;
+    uint8_t* magnitude = malloc(length ? length : 1);
+    // Each byte needs under three decimal digits, plus sign and terminator
+    char* digits = malloc(length * 3 + 3);
+    if (!magnitude || !digits) {
+        free(magnitude);
+        free(digits);
+        return NULL;
+    }
+    if (length) {
+        memcpy(magnitude, item->value.integer.bytes, length);
+    }
+    
+    size_t count = 0;
+    while (length > 0) {
+        unsigned int remainder = 0;
+        for (size_t i = length; i-- > 0;) {
+            unsigned int v = (remainder << 8) | magnitude[i];
+            magnitude[i] = (uint8_t)(v / 10);
+            remainder = v % 10;
+        }
+        digits[count++] = (char)('0' + remainder);
+        while (length > 0 && magnitude[length - 1] == 0) {
+            length--;
+        }
+    }
+    if (count == 0) {
+        digits[count++] = '0';
+    } else if (item->value.integer.is_negative) {
+        digits[count++] = '-';
+    }
+    for (size_t i = 0; i < count / 2; i++) {
+        char c = digits[i];
+        digits[i] = digits[count - 1 - i];
+        digits[count - 1 - i] = c;
+    }
+    digits[count] = '\0';
+    
+    cJSON* value = cJSON_CreateString(digits);
+    free(magnitude);
+    free(digits);
+    return value;
+}
+
+static cJSON* stack_item_value_to_json(const stack_item_t* item) {
+    switch (item->type) {
+        case STACK_ITEM_TYPE_BOOLEAN:
+            return cJSON_CreateBool(item->value.boolean_value);
+            
+        case STACK_ITEM_TYPE_INTEGER:
+            return stack_item_integer_to_string(item);
+            
+        case STACK_ITEM_TYPE_BYTE_STRING:
+        case STACK_ITEM_TYPE_BUFFER: {
+            char* encoded = neoc_base64_encode_alloc(item->value.byte_string.data,
+                                                     item->value.byte_string.length);
+            cJSON* value = encoded ? cJSON_CreateString(encoded) : NULL;
+            neoc_free(encoded);
+            return value;
+        }
+            
+        case STACK_ITEM_TYPE_ARRAY:
+        case STACK_ITEM_TYPE_STRUCT: {
+            cJSON* array = cJSON_CreateArray();
+            for (size_t i = 0; array && i < item->value.array.count; i++) {
+                cJSON* element = stack_item_to_json_node(item->value.array.items[i]);
+                if (!element) {
+                    cJSON_Delete(array);
+                    return NULL;
+                }
+                cJSON_AddItemToArray(array, element);
+            }
+            return array;
+        }
+            
+        case STACK_ITEM_TYPE_MAP: {
+            cJSON* entries = cJSON_CreateArray();
+            for (size_t i = 0; entries && i < item->value.map.count; i++) {
+                cJSON* entry = cJSON_CreateObject();
+                cJSON* key = stack_item_to_json_node(item->value.map.entries[i].key);
+                cJSON* value = stack_item_to_json_node(item->value.map.entries[i].value);
+                if (!entry || !key || !value) {
+                    cJSON_Delete(entry);
+                    cJSON_Delete(key);
+                    cJSON_Delete(value);
+                    cJSON_Delete(entries);
+                    return NULL;
+                }
+                cJSON_AddItemToObject(entry, "key", key);
+                cJSON_AddItemToObject(entry, "value", value);
+                cJSON_AddItemToArray(entries, entry);
+            }
+            return entries;
+        }
+            
+        case STACK_ITEM_TYPE_POINTER:
+            return cJSON_CreateNumber((double)item->value.pointer.position);
+            
+        default:
+            return NULL;
+    }
+}
+#endif
+
+// Convert stack item to a JSON node in the RPC stack item format
+neoc_json_t* stack_item_to_json_node(const stack_item_t* item) {
+#ifndef HAVE_CJSON
+    (void)item;
+    return NULL;
+#else
+    if (!item) return NULL;
+    
+    cJSON* node = cJSON_CreateObject();
+    if (!node || !cJSON_AddStringToObject(node, "type", stack_item_type_name(item->type))) {
+        cJSON_Delete(node);
+        return NULL;
+    }
+    
+    // Any and InteropInterface carry no value
+    if (item->type != STACK_ITEM_TYPE_ANY && item->type != STACK_ITEM_TYPE_INTEROP_INTERFACE) {
+        cJSON* value = stack_item_value_to_json(item);
+        if (!value) {
+            cJSON_Delete(node);
+            return NULL;
+        }
+        cJSON_AddItemToObject(node, "value", value);
+    }
+    return node;
+#endif
+}
+
+// Convert stack item to JSON string
+char* stack_item_to_json(const stack_item_t* item) {
+    neoc_json_t* node = stack_item_to_json_node(item);
+    char* json = node ? neoc_json_to_string(node) : NULL;
+    neoc_json_free(node);
+    return json;
+}
+
 // Additional functions would be implemented here...
 // For brevity, I'm showing the core implementation pattern
@@ -5,6 +5,7 @@
 
 #include "neoc/script/script_helper.h"
 #include "neoc/script/script_builder_full.h"
+#include "neoc/script/script_template.h"
 #include "neoc/script/opcode.h"
 #include "neoc/script/interop_service.h"
 #include "neoc/crypto/neoc_hash.h"
@@ -258,90 +259,19 @@ neoc_error_t neoc_script_create_nep17_transfer(const neoc_hash160_t *token_hash,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    neoc_script_builder_t *builder = NULL;
-    neoc_error_t err = neoc_script_builder_create(&builder);
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
+    const neoc_script_template_t *tmpl = neoc_script_template_nep17_transfer();
     
-    // Push data parameter (or null)
+    // transfer(from, to, amount, data); empty data is pushed as null
+    neoc_script_arg_t args[4] = {0};
+    args[0].hash160 = from;
+    args[1].hash160 = to;
+    args[2].integer = (int64_t)amount;
     if (data && data_len > 0) {
-        err = neoc_script_builder_push_data(builder, data, data_len);
-    } else {
-        err = neoc_script_builder_emit(builder, NEOC_OP_PUSHNULL);
-    }
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Push amount
-    err = neoc_script_builder_push_integer(builder, (int64_t)amount);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Push to address
-    err = neoc_script_builder_push_data(builder, to->data, sizeof(neoc_hash160_t));
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Push from address
-    err = neoc_script_builder_push_data(builder, from->data, sizeof(neoc_hash160_t));
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Push parameter count (4) and pack into array
-    err = neoc_script_builder_push_integer(builder, 4);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
+        args[3].data = data;
+        args[3].data_len = data_len;
     }
     
-    err = neoc_script_builder_emit(builder, NEOC_OP_PACK);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Push method name "transfer"
-    err = neoc_script_builder_push_string(builder, "transfer");
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Push token contract hash
-    err = neoc_script_builder_push_data(builder, token_hash->data, sizeof(neoc_hash160_t));
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Emit SYSCALL for contract call
-    err = neoc_script_builder_emit_syscall(builder, NEOC_INTEROP_SYSTEM_CONTRACT_CALL);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Add ASSERT to ensure transfer succeeded
-    err = neoc_script_builder_emit(builder, NEOC_OP_ASSERT);
-    if (err != NEOC_SUCCESS) {
-        neoc_script_builder_free(builder);
-        return err;
-    }
-    
-    // Get script
-    err = neoc_script_builder_to_array(builder, script, script_len);
-    neoc_script_builder_free(builder);
-    
-    return err;
+    return neoc_script_template_instantiate(tmpl, token_hash, args, script, script_len);
 }
 
 neoc_error_t neoc_script_create_witness_invocation(const uint8_t *signature,
@@ -426,27 +356,22 @@ neoc_error_t neoc_script_hash_to_address(const neoc_hash160_t *script_hash,
     // Use version parameter for address encoding (currently using NEO N3 format)
     uint8_t address_version = version ? version : NEOC_ADDRESS_VERSION;
     
-    uint8_t versioned[1 + NEOC_HASH160_SIZE];
-    versioned[0] = address_version;
-    memcpy(versioned + 1, script_hash->data, NEOC_HASH160_SIZE);
-
-    size_t buffer_size = neoc_base58_check_encode_buffer_size(sizeof(versioned));
-    *address = neoc_malloc(buffer_size);
-    if (!*address) {
-        return NEOC_ERROR_OUT_OF_MEMORY;
-    }
-    
-    // Encode to Base58Check
-    neoc_error_t err = neoc_base58_check_encode(versioned,
-                                                sizeof(versioned),
-                                                *address,
-                                                buffer_size);
+    char buffer[NEOC_BASE58_ADDRESS_MAX_LENGTH + 1];
+    neoc_error_t err = neoc_base58_check_encode_address(address_version,
+                                                        script_hash->data,
+                                                        buffer,
+                                                        sizeof(buffer));
     if (err != NEOC_SUCCESS) {
-        neoc_free(*address);
-        *address = NULL;
         return err;
     }
     
+    size_t length = strlen(buffer) + 1;
+    *address = neoc_malloc(length);
+    if (!*address) {
+        return NEOC_ERROR_OUT_OF_MEMORY;
+    }
+    memcpy(*address, buffer, length);
+    
     return NEOC_SUCCESS;
 }
 
@@ -0,0 +1,398 @@
+/**
+ * @file script_template.c
+ * @brief Precompiled contract invocation scripts with patchable argument slots
+ */
+
+#include "neoc/script/script_template.h"
+#include "neoc/script/opcode.h"
+#include "neoc/script/interop_service.h"
+#include "neoc/neoc_memory.h"
+#include <pthread.h>
+#include <string.h>
+
+/* PUSHDATA1 + length byte + 20-byte hash */
+#define TEMPLATE_HASH160_PUSH_SIZE (2u + NEOC_HASH160_SIZE)
+
+struct neoc_script_template {
+    neoc_script_slot_type_t slots[NEOC_SCRIPT_TEMPLATE_MAX_SLOTS];
+    size_t slot_count;
+    uint8_t *suffix;        /* PACK .. SYSCALL [ASSERT], identical for every instance */
+    size_t suffix_len;
+    size_t hash_offset;     /* Position of the contract hash bytes within suffix */
+};
+
+static neoc_error_t template_slot_size(neoc_script_slot_type_t type,
+                                       const neoc_script_arg_t *arg,
+                                       size_t *size) {
+    switch (type) {
+        case NEOC_SCRIPT_SLOT_HASH160:
+            if (!arg->hash160) {
+                return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Hash160 argument is NULL");
+            }
+            *size = TEMPLATE_HASH160_PUSH_SIZE;
+            return NEOC_SUCCESS;
+        case NEOC_SCRIPT_SLOT_INTEGER: {
+            int64_t value = arg->integer;
+            if (value >= -1 && value <= 16) {
+                *size = 1;
+            } else if (value >= -128 && value <= 127) {
+                *size = 2;
+            } else if (value >= -32768 && value <= 32767) {
+                *size = 3;
+            } else if (value >= -2147483648LL && value <= 2147483647LL) {
+                *size = 5;
+            } else {
+                *size = 9;
+            }
+            return NEOC_SUCCESS;
+        }
+        case NEOC_SCRIPT_SLOT_BYTES: {
+            size_t len = arg->data_len;
+            if (!arg->data) {
+                if (len > 0) {
+                    return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Bytes argument is NULL");
+                }
+                *size = 1;
+            } else if (len == 0) {
+                *size = 1;
+            } else if (len <= 0xFF) {
+                *size = 2 + len;
+            } else if (len <= 0xFFFF) {
+                *size = 3 + len;
+            } else if (len <= 0xFFFFFFFFu) {
+                *size = 5 + len;
+            } else {
+                return neoc_error_set(NEOC_ERROR_INVALID_SIZE, "Bytes argument too large");
+            }
+            return NEOC_SUCCESS;
+        }
+        default:
+            return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Unknown template slot type");
+    }
+}
+
+static uint8_t *write_le(uint8_t *out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+    return out + bytes;
+}
+
+/* Encodings mirror neoc_script_builder_push_integer / push_data byte for byte */
+static uint8_t *template_write_slot(uint8_t *out,
+                                    neoc_script_slot_type_t type,
+                                    const neoc_script_arg_t *arg) {
+    switch (type) {
+        case NEOC_SCRIPT_SLOT_HASH160:
+            *out++ = NEOC_OP_PUSHDATA1;
+            *out++ = NEOC_HASH160_SIZE;
+            memcpy(out, arg->hash160->data, NEOC_HASH160_SIZE);
+            return out + NEOC_HASH160_SIZE;
+        case NEOC_SCRIPT_SLOT_INTEGER: {
+            int64_t value = arg->integer;
+            uint64_t bits = (uint64_t)value;
+            if (value == -1) {
+                *out++ = NEOC_OP_PUSHM1;
+            } else if (value >= 0 && value <= 16) {
+                *out++ = (uint8_t)(NEOC_OP_PUSH0 + value);
+            } else if (value >= -128 && value <= 127) {
+                *out++ = NEOC_OP_PUSHINT8;
+                out = write_le(out, bits, 1);
+            } else if (value >= -32768 && value <= 32767) {
+                *out++ = NEOC_OP_PUSHINT16;
+                out = write_le(out, bits, 2);
+            } else if (value >= -2147483648LL && value <= 2147483647LL) {
+                *out++ = NEOC_OP_PUSHINT32;
+                out = write_le(out, bits, 4);
+            } else {
+                *out++ = NEOC_OP_PUSHINT64;
+                out = write_le(out, bits, 8);
+            }
+            return out;
+        }
+        case NEOC_SCRIPT_SLOT_BYTES:
+        default: {
+            size_t len = arg->data_len;
+            if (!arg->data) {
+                *out++ = NEOC_OP_PUSHNULL;
+                return out;
+            }
+            if (len == 0) {
+                *out++ = NEOC_OP_PUSH0;
+                return out;
+            }
+            if (len <= 0xFF) {
+                *out++ = NEOC_OP_PUSHDATA1;
+                out = write_le(out, len, 1);
+            } else if (len <= 0xFFFF) {
+                *out++ = NEOC_OP_PUSHDATA2;
+                out = write_le(out, len, 2);
+            } else {
+                *out++ = NEOC_OP_PUSHDATA4;
+                out = write_le(out, len, 4);
+            }
+            memcpy(out, arg->data, len);
+            return out + len;
+        }
+    }
+}
+
+/* Appends one push to the tail being encoded; out may be NULL to only measure */
+static void suffix_push(uint8_t *out, size_t *len,
+                        neoc_script_slot_type_t type, const neoc_script_arg_t *arg) {
+    size_t size = 0;
+    template_slot_size(type, arg, &size);
+    if (out) {
+        template_write_slot(out + *len, type, arg);
+    }
+    *len += size;
+}
+
+static void suffix_emit(uint8_t *out, size_t *len, uint8_t byte) {
+    if (out) {
+        out[*len] = byte;
+    }
+    (*len)++;
+}
+
+/*
+ * Encodes the PACK .. SYSCALL [ASSERT] tail shared by every instance, using the same
+ * push encodings as the argument slots. Returns its length; out may be NULL to only
+ * measure it. Nothing is allocated, so the shared NEP-17 tail can live in static storage.
+ */
+static size_t template_encode_suffix(uint8_t *out,
+                                     const neoc_hash160_t *contract_hash,
+                                     const char *method,
+                                     size_t slot_count,
+                                     const neoc_script_template_options_t *options,
+                                     size_t *hash_offset) {
+    neoc_script_arg_t arg;
+    size_t len = 0;
+
+    if (slot_count > 0) {
+        memset(&arg, 0, sizeof(arg));
+        arg.integer = (int64_t)slot_count;
+        suffix_push(out, &len, NEOC_SCRIPT_SLOT_INTEGER, &arg);
+        suffix_emit(out, &len, NEOC_OP_PACK);
+    } else {
+        suffix_emit(out, &len, NEOC_OP_NEWARRAY0);
+    }
+    if (options->push_call_flags) {
+        memset(&arg, 0, sizeof(arg));
+        arg.integer = (int64_t)options->call_flags;
+        suffix_push(out, &len, NEOC_SCRIPT_SLOT_INTEGER, &arg);
+    }
+
+    memset(&arg, 0, sizeof(arg));
+    arg.data = (const uint8_t *)method;
+    arg.data_len = strlen(method);
+    suffix_push(out, &len, NEOC_SCRIPT_SLOT_BYTES, &arg);
+
+    memset(&arg, 0, sizeof(arg));
+    arg.hash160 = contract_hash;
+    suffix_push(out, &len, NEOC_SCRIPT_SLOT_HASH160, &arg);
+    *hash_offset = len - NEOC_HASH160_SIZE;
+
+    uint32_t syscall = neoc_interop_get_hash(NEOC_INTEROP_SYSTEM_CONTRACT_CALL);
+    suffix_emit(out, &len, NEOC_OP_SYSCALL);
+    for (size_t i = 0; i < sizeof(syscall); i++) {
+        suffix_emit(out, &len, (uint8_t)(syscall >> (8 * i)));
+    }
+    if (options->append_assert) {
+        suffix_emit(out, &len, NEOC_OP_ASSERT);
+    }
+    return len;
+}
+
+neoc_error_t neoc_script_template_create(const neoc_hash160_t *contract_hash,
+                                         const char *method,
+                                         const neoc_script_slot_type_t *slot_types,
+                                         size_t slot_count,
+                                         const neoc_script_template_options_t *options,
+                                         neoc_script_template_t **tmpl) {
+    if (!contract_hash || !method || !tmpl || (slot_count > 0 && !slot_types)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid template arguments");
+    }
+    *tmpl = NULL;
+    if (slot_count > NEOC_SCRIPT_TEMPLATE_MAX_SLOTS) {
+        return neoc_error_set(NEOC_ERROR_INVALID_SIZE, "Too many template slots");
+    }
+    if (strlen(method) > 0xFFFF) {
+        return neoc_error_set(NEOC_ERROR_INVALID_SIZE, "Method name too long");
+    }
+    for (size_t i = 0; i < slot_count; i++) {
+        if (slot_types[i] != NEOC_SCRIPT_SLOT_HASH160 &&
+            slot_types[i] != NEOC_SCRIPT_SLOT_INTEGER &&
+            slot_types[i] != NEOC_SCRIPT_SLOT_BYTES) {
+            return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Unknown template slot type");
+        }
+    }
+
+    neoc_script_template_options_t defaults = {
+        .push_call_flags = true,
+        .call_flags = NEOC_CALL_FLAGS_ALL,
+        .append_assert = false
+    };
+    if (!options) {
+        options = &defaults;
+    }
+
+    /* Template and tail share one allocation */
+    size_t hash_offset = 0;
+    size_t suffix_len = template_encode_suffix(NULL, contract_hash, method, slot_count,
+                                               options, &hash_offset);
+    neoc_script_template_t *result = neoc_calloc(1, sizeof(*result) + suffix_len);
+    if (!result) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate script template");
+    }
+    if (slot_count > 0) {
+        memcpy(result->slots, slot_types, slot_count * sizeof(*slot_types));
+    }
+    result->slot_count = slot_count;
+    result->suffix = (uint8_t *)(result + 1);
+    result->suffix_len = template_encode_suffix(result->suffix, contract_hash, method, slot_count,
+                                                options, &result->hash_offset);
+
+    *tmpl = result;
+    return NEOC_SUCCESS;
+}
+
+size_t neoc_script_template_slot_count(const neoc_script_template_t *tmpl) {
+    return tmpl ? tmpl->slot_count : 0;
+}
+
+neoc_error_t neoc_script_template_size(const neoc_script_template_t *tmpl,
+                                       const neoc_script_arg_t *args,
+                                       size_t *script_len) {
+    if (!tmpl || !script_len || (tmpl->slot_count > 0 && !args)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid template arguments");
+    }
+
+    size_t total = tmpl->suffix_len;
+    for (size_t i = 0; i < tmpl->slot_count; i++) {
+        size_t size = 0;
+        neoc_error_t err = template_slot_size(tmpl->slots[i], &args[i], &size);
+        if (err != NEOC_SUCCESS) {
+            return err;
+        }
+        total += size;
+    }
+
+    *script_len = total;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_script_template_write_for_contract(const neoc_script_template_t *tmpl,
+                                                     const neoc_hash160_t *contract_hash,
+                                                     const neoc_script_arg_t *args,
+                                                     uint8_t *buffer,
+                                                     size_t capacity,
+                                                     size_t *script_len) {
+    if (!buffer) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid template arguments");
+    }
+
+    size_t needed = 0;
+    neoc_error_t err = neoc_script_template_size(tmpl, args, &needed);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    if (capacity < needed) {
+        return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Script buffer too small");
+    }
+
+    /* Arguments are pushed last-to-first so the callee sees them in parameter order */
+    uint8_t *out = buffer;
+    for (size_t i = tmpl->slot_count; i-- > 0;) {
+        out = template_write_slot(out, tmpl->slots[i], &args[i]);
+    }
+    memcpy(out, tmpl->suffix, tmpl->suffix_len);
+    if (contract_hash) {
+        memcpy(out + tmpl->hash_offset, contract_hash->data, NEOC_HASH160_SIZE);
+    }
+
+    *script_len = needed;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_script_template_write(const neoc_script_template_t *tmpl,
+                                        const neoc_script_arg_t *args,
+                                        uint8_t *buffer,
+                                        size_t capacity,
+                                        size_t *script_len) {
+    return neoc_script_template_write_for_contract(tmpl, NULL, args, buffer, capacity, script_len);
+}
+
+neoc_error_t neoc_script_template_instantiate(const neoc_script_template_t *tmpl,
+                                              const neoc_hash160_t *contract_hash,
+                                              const neoc_script_arg_t *args,
+                                              uint8_t **script,
+                                              size_t *script_len) {
+    if (!script || !script_len) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid template arguments");
+    }
+
+    size_t needed = 0;
+    neoc_error_t err = neoc_script_template_size(tmpl, args, &needed);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    uint8_t *buffer = neoc_malloc(needed);
+    if (!buffer) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate script");
+    }
+    err = neoc_script_template_write_for_contract(tmpl, contract_hash, args,
+                                                  buffer, needed, script_len);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(buffer);
+        return err;
+    }
+
+    *script = buffer;
+    return NEOC_SUCCESS;
+}
+
+/* PUSH4 PACK, PUSHDATA1 "transfer", PUSHDATA1 hash, SYSCALL id, ASSERT */
+#define NEP17_TRANSFER_SUFFIX_SIZE (2u + 10u + 22u + 5u + 1u)
+
+/*
+ * The shared NEP-17 template lives entirely in static storage. Building it must not go
+ * through neoc_malloc: an arena active on the first caller's thread would otherwise own
+ * a process-wide object and leave it dangling after neoc_arena_reset.
+ */
+static pthread_once_t nep17_transfer_once = PTHREAD_ONCE_INIT;
+static uint8_t nep17_transfer_suffix[NEP17_TRANSFER_SUFFIX_SIZE];
+static neoc_script_template_t nep17_transfer_template;
+
+static void build_nep17_transfer_template(void) {
+    static const neoc_script_slot_type_t slots[] = {
+        NEOC_SCRIPT_SLOT_HASH160,   /* from */
+        NEOC_SCRIPT_SLOT_HASH160,   /* to */
+        NEOC_SCRIPT_SLOT_INTEGER,   /* amount */
+        NEOC_SCRIPT_SLOT_BYTES      /* data */
+    };
+    static const neoc_script_template_options_t options = {
+        .push_call_flags = false,
+        .call_flags = NEOC_CALL_FLAGS_NONE,
+        .append_assert = true
+    };
+    neoc_hash160_t zero;
+    memset(&zero, 0, sizeof(zero));
+
+    neoc_script_template_t *tmpl = &nep17_transfer_template;
+    memcpy(tmpl->slots, slots, sizeof(slots));
+    tmpl->slot_count = sizeof(slots) / sizeof(slots[0]);
+    tmpl->suffix = nep17_transfer_suffix;
+    tmpl->suffix_len = template_encode_suffix(nep17_transfer_suffix, &zero, "transfer",
+                                              tmpl->slot_count, &options, &tmpl->hash_offset);
+}
+
+const neoc_script_template_t *neoc_script_template_nep17_transfer(void) {
+    pthread_once(&nep17_transfer_once, build_nep17_transfer_template);
+    return &nep17_transfer_template;
+}
+
+void neoc_script_template_free(neoc_script_template_t *tmpl) {
+    neoc_free(tmpl);
+}
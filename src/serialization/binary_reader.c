@@ -1,8 +1,17 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include "neoc/serialization/binary_reader.h"
 #include "neoc/script/opcode.h"
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 neoc_error_t neoc_binary_reader_create(const uint8_t *data,
                                         size_t size,
                                         neoc_binary_reader_t **reader) {
@@ -31,6 +40,69 @@ neoc_error_t neoc_binary_reader_create(const uint8_t *data,
     return NEOC_SUCCESS;
 }
 
+neoc_error_t neoc_binary_reader_init_view(neoc_binary_reader_t *reader,
+                                           const uint8_t *data,
+                                           size_t size) {
+    if (!reader || (!data && size > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    memset(reader, 0, sizeof(*reader));
+    reader->data = data;
+    reader->size = size;
+    reader->marker = SIZE_MAX;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_binary_reader_map_file(const char *path,
+                                          neoc_binary_reader_t **reader) {
+    if (!path || !reader) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+#ifdef _WIN32
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "File mapping not supported on this platform");
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return neoc_error_set(NEOC_ERROR_FILE_NOT_FOUND, "Failed to open file");
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 0 || (uint64_t)st.st_size > SIZE_MAX) {
+        close(fd);
+        return neoc_error_set(NEOC_ERROR_FILE, "Failed to stat file");
+    }
+    
+    size_t size = (size_t)st.st_size;
+    void *mapping = NULL;
+    if (size > 0) {
+        mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            return neoc_error_set(NEOC_ERROR_FILE, "Failed to map file");
+        }
+        // Decoding walks the file front to back
+        posix_madvise(mapping, size, POSIX_MADV_SEQUENTIAL);
+    }
+    close(fd);
+    
+    *reader = calloc(1, sizeof(neoc_binary_reader_t));
+    if (!*reader) {
+        if (mapping) {
+            munmap(mapping, size);
+        }
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate binary reader");
+    }
+    
+    (*reader)->data = mapping;
+    (*reader)->size = size;
+    (*reader)->marker = SIZE_MAX;
+    (*reader)->mapped = mapping != NULL;
+    return NEOC_SUCCESS;
+#endif
+}
+
 neoc_error_t neoc_binary_reader_read_byte(neoc_binary_reader_t *reader,
                                            uint8_t *value) {
     if (!reader || !value) {
@@ -54,7 +126,7 @@ neoc_error_t neoc_binary_reader_read_bytes(neoc_binary_reader_t *reader,
     
     if (len == 0) return NEOC_SUCCESS;
     
-    if (reader->position + len > reader->size) {
+    if (len > reader->size - reader->position) {
         return neoc_error_set(NEOC_ERROR_END_OF_STREAM, "Not enough data to read");
     }
     
@@ -188,16 +260,14 @@ neoc_error_t neoc_binary_reader_read_var_bytes(neoc_binary_reader_t *reader,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    uint64_t length = 0;
-    neoc_error_t err = neoc_binary_reader_read_var_int(reader, &length);
-    if (err != NEOC_SUCCESS) return err;
-    
-    if (length > SIZE_MAX) {
-        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Variable bytes length too large");
+    // The length is validated against the input before anything is allocated
+    const uint8_t *view = NULL;
+    neoc_error_t err = neoc_binary_reader_read_var_bytes_view(reader, &view, len);
+    if (err != NEOC_SUCCESS) {
+        *len = 0;
+        return err;
     }
     
-    *len = (size_t)length;
-    
     if (*len == 0) {
         *data = NULL;
         return NEOC_SUCCESS;
@@ -205,49 +275,70 @@ neoc_error_t neoc_binary_reader_read_var_bytes(neoc_binary_reader_t *reader,
     
     *data = malloc(*len);
     if (!*data) {
+        *len = 0;
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate data buffer");
     }
     
-    err = neoc_binary_reader_read_bytes(reader, *data, *len);
-    if (err != NEOC_SUCCESS) {
-        free(*data);
-        *data = NULL;
-        *len = 0;
-        return err;
+    memcpy(*data, view, *len);
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_binary_reader_read_bytes_view(neoc_binary_reader_t *reader,
+                                                 size_t len,
+                                                 const uint8_t **data) {
+    if (!reader || !data) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    if (len > reader->size - reader->position) {
+        return neoc_error_set(NEOC_ERROR_END_OF_STREAM, "Not enough data to read");
     }
     
+    *data = reader->data ? reader->data + reader->position : NULL;
+    reader->position += len;
     return NEOC_SUCCESS;
 }
 
+neoc_error_t neoc_binary_reader_read_var_bytes_view(neoc_binary_reader_t *reader,
+                                                     const uint8_t **data,
+                                                     size_t *len) {
+    if (!reader || !data || !len) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    uint64_t length = 0;
+    neoc_error_t err = neoc_binary_reader_read_var_int(reader, &length);
+    if (err != NEOC_SUCCESS) return err;
+    
+    // Checked against the remaining data before narrowing to size_t
+    if (length > reader->size - reader->position) {
+        return neoc_error_set(NEOC_ERROR_END_OF_STREAM, "Not enough data to read");
+    }
+    
+    *len = (size_t)length;
+    return neoc_binary_reader_read_bytes_view(reader, *len, data);
+}
+
 neoc_error_t neoc_binary_reader_read_var_string(neoc_binary_reader_t *reader,
                                                  char **str) {
     if (!reader || !str) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    uint8_t *data;
-    size_t len;
-    neoc_error_t err = neoc_binary_reader_read_var_bytes(reader, &data, &len);
+    const uint8_t *view = NULL;
+    size_t len = 0;
+    neoc_error_t err = neoc_binary_reader_read_var_bytes_view(reader, &view, &len);
     if (err != NEOC_SUCCESS) return err;
     
-    if (len == 0) {
-        *str = calloc(1, 1);  // Empty string
-        if (!*str) {
-            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate empty string");
-        }
-        return NEOC_SUCCESS;
-    }
-    
     *str = malloc(len + 1);
     if (!*str) {
-        free(data);
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate string");
     }
     
-    memcpy(*str, data, len);
+    if (len > 0) {
+        memcpy(*str, view, len);
+    }
     (*str)[len] = '\0';
-    
-    free(data);
     return NEOC_SUCCESS;
 }
 
@@ -286,7 +377,7 @@ neoc_error_t neoc_binary_reader_skip(neoc_binary_reader_t *reader,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid reader");
     }
     
-    if (reader->position + count > reader->size) {
+    if (count > reader->size - reader->position) {
         return neoc_error_set(NEOC_ERROR_END_OF_STREAM, "Not enough data to skip");
     }
     
@@ -629,6 +720,11 @@ void neoc_binary_reader_free(neoc_binary_reader_t *reader) {
             free(reader->owned_data);
             reader->owned_data = NULL;
         }
+#ifndef _WIN32
+        if (reader->mapped) {
+            munmap((void *)reader->data, reader->size);
+        }
+#endif
         free(reader);
     }
 }
@@ -5,11 +5,33 @@
 #define MIN_CAPACITY 16
 #define GROWTH_FACTOR 2
 
+static neoc_error_t flush_to_sink(neoc_binary_writer_t *writer) {
+    if (writer->position == 0) {
+        return NEOC_SUCCESS;
+    }
+
+    neoc_error_t err = writer->sink(writer->sink_ctx, writer->data, writer->position);
+    if (err != NEOC_SUCCESS) return err;
+
+    writer->flushed += writer->position;
+    writer->position = 0;
+    return NEOC_SUCCESS;
+}
+
 static neoc_error_t ensure_capacity(neoc_binary_writer_t *writer, size_t required) {
-    if (writer->position + required <= writer->capacity) {
+    if (required <= writer->capacity - writer->position) {
         return NEOC_SUCCESS;
     }
     
+    if (writer->sink) {
+        neoc_error_t err = flush_to_sink(writer);
+        if (err != NEOC_SUCCESS) return err;
+        if (required <= writer->capacity) {
+            return NEOC_SUCCESS;
+        }
+        return neoc_error_set(NEOC_ERROR_BUFFER_OVERFLOW, "Binary writer buffer overflow");
+    }
+
     if (!writer->auto_grow) {
         return neoc_error_set(NEOC_ERROR_BUFFER_OVERFLOW, "Binary writer buffer overflow");
     }
@@ -57,6 +79,47 @@ neoc_error_t neoc_binary_writer_create(size_t initial_capacity,
     return NEOC_SUCCESS;
 }
 
+neoc_error_t neoc_binary_writer_init_buffer(neoc_binary_writer_t *writer,
+                                             uint8_t *buffer,
+                                             size_t capacity) {
+    if (!writer || (!buffer && capacity > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    memset(writer, 0, sizeof(*writer));
+    writer->data = buffer;
+    writer->capacity = capacity;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_binary_writer_init_sink(neoc_binary_writer_t *writer,
+                                           uint8_t *buffer,
+                                           size_t capacity,
+                                           neoc_binary_writer_sink_t sink,
+                                           void *sink_ctx) {
+    if (!writer || !buffer || !sink) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (capacity < MIN_CAPACITY) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Sink buffer too small");
+    }
+
+    memset(writer, 0, sizeof(*writer));
+    writer->data = buffer;
+    writer->capacity = capacity;
+    writer->sink = sink;
+    writer->sink_ctx = sink_ctx;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_binary_writer_flush(neoc_binary_writer_t *writer) {
+    if (!writer) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid writer");
+    }
+
+    return writer->sink ? flush_to_sink(writer) : NEOC_SUCCESS;
+}
+
 neoc_error_t neoc_binary_writer_write_byte(neoc_binary_writer_t *writer,
                                             uint8_t value) {
     if (!writer) {
@@ -79,6 +142,16 @@ neoc_error_t neoc_binary_writer_write_bytes(neoc_binary_writer_t *writer,
     
     if (len == 0) return NEOC_SUCCESS;
     
+    /* Runs longer than the staging buffer go straight to the sink */
+    if (writer->sink && len > writer->capacity) {
+        neoc_error_t err = flush_to_sink(writer);
+        if (err != NEOC_SUCCESS) return err;
+        err = writer->sink(writer->sink_ctx, data, len);
+        if (err != NEOC_SUCCESS) return err;
+        writer->flushed += len;
+        return NEOC_SUCCESS;
+    }
+
     neoc_error_t err = ensure_capacity(writer, len);
     if (err != NEOC_SUCCESS) return err;
     
@@ -214,7 +287,7 @@ neoc_error_t neoc_binary_writer_write_var_string(neoc_binary_writer_t *writer,
 }
 
 size_t neoc_binary_writer_get_position(const neoc_binary_writer_t *writer) {
-    return writer ? writer->position : 0;
+    return writer ? writer->flushed + writer->position : 0;
 }
 
 neoc_error_t neoc_binary_writer_get_data(const neoc_binary_writer_t *writer,
@@ -251,6 +324,7 @@ neoc_error_t neoc_binary_writer_to_array(const neoc_binary_writer_t *writer,
 void neoc_binary_writer_reset(neoc_binary_writer_t *writer) {
     if (writer) {
         writer->position = 0;
+        writer->flushed = 0;
     }
 }
 
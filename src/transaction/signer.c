@@ -1,5 +1,6 @@
 #include "neoc/transaction/signer.h"
 #include "neoc/neoc_memory.h"
+#include "neoc/utils/numeric.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -152,23 +153,24 @@ size_t neoc_signer_get_size(const neoc_signer_t *signer) {
     
     // Custom contracts if present
     if (signer->scopes & NEOC_WITNESS_SCOPE_CUSTOM_CONTRACTS) {
-        size += 1;  // Count varint (assuming fits in 1 byte)
+        size += neoc_numeric_var_size(signer->allowed_contracts_count);
         size += signer->allowed_contracts_count * sizeof(neoc_hash160_t);
     }
     
     // Custom groups if present
     if (signer->scopes & NEOC_WITNESS_SCOPE_CUSTOM_GROUPS) {
-        size += 1;  // Count varint (assuming fits in 1 byte)
+        size += neoc_numeric_var_size(signer->allowed_groups_count);
         for (size_t i = 0; i < signer->allowed_groups_count; i++) {
-            size += 1;  // Length byte
             size += signer->allowed_groups_sizes[i];
         }
     }
     
     // Witness rules if present
     if (signer->scopes & NEOC_WITNESS_SCOPE_WITNESS_RULES) {
-        // Note: Implement witness rules size calculation
-        size += 1;  // Count = 0 for now
+        size += neoc_numeric_var_size(signer->rules_count);
+        for (size_t i = 0; i < signer->rules_count && signer->rules; i++) {
+            size += neoc_witness_rule_get_size(signer->rules[i]);
+        }
     }
     
     return size;
@@ -308,7 +310,7 @@ neoc_error_t neoc_signer_serialize(const neoc_signer_t *signer, neoc_binary_writ
     }
     
     // Write account hash (20 bytes)
-    neoc_error_t err = neoc_binary_writer_write_bytes(writer, signer->account.data, sizeof(neoc_hash160_t));
+    neoc_error_t err = neoc_hash160_serialize(&signer->account, writer);
     if (err != NEOC_SUCCESS) return err;
     
     // Write scopes (1 byte)
@@ -321,7 +323,7 @@ neoc_error_t neoc_signer_serialize(const neoc_signer_t *signer, neoc_binary_writ
         if (err != NEOC_SUCCESS) return err;
         
         for (size_t i = 0; i < signer->allowed_contracts_count; i++) {
-            err = neoc_binary_writer_write_bytes(writer, signer->allowed_contracts[i].data, sizeof(neoc_hash160_t));
+            err = neoc_hash160_serialize(&signer->allowed_contracts[i], writer);
             if (err != NEOC_SUCCESS) return err;
         }
     }
@@ -331,8 +333,9 @@ neoc_error_t neoc_signer_serialize(const neoc_signer_t *signer, neoc_binary_writ
         err = neoc_binary_writer_write_var_int(writer, signer->allowed_groups_count);
         if (err != NEOC_SUCCESS) return err;
         
+        // Groups are encoded EC points, written without a length prefix
         for (size_t i = 0; i < signer->allowed_groups_count; i++) {
-            err = neoc_binary_writer_write_var_bytes(writer, signer->allowed_groups[i], signer->allowed_groups_sizes[i]);
+            err = neoc_binary_writer_write_bytes(writer, signer->allowed_groups[i], signer->allowed_groups_sizes[i]);
             if (err != NEOC_SUCCESS) return err;
         }
     }
@@ -361,3 +364,98 @@ neoc_error_t neoc_signer_serialize(const neoc_signer_t *signer, neoc_binary_writ
     
     return NEOC_SUCCESS;
 }
+
+neoc_error_t neoc_signer_deserialize(neoc_binary_reader_t *reader, neoc_signer_t **signer) {
+    if (!reader || !signer) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *signer = NULL;
+
+    neoc_hash160_t account;
+    neoc_error_t err = neoc_hash160_deserialize(&account, reader);
+    if (err != NEOC_SUCCESS) return err;
+
+    uint8_t scopes = 0;
+    err = neoc_binary_reader_read_byte(reader, &scopes);
+    if (err != NEOC_SUCCESS) return err;
+
+    if ((scopes & NEOC_WITNESS_SCOPE_GLOBAL) && scopes != NEOC_WITNESS_SCOPE_GLOBAL) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Global scope cannot be combined");
+    }
+
+    neoc_signer_t *result = NULL;
+    err = neoc_signer_create(&account, scopes, &result);
+    if (err != NEOC_SUCCESS) return err;
+
+    uint64_t count = 0;
+    if (scopes & NEOC_WITNESS_SCOPE_CUSTOM_CONTRACTS) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_SIGNER_SUBITEMS, &count);
+        if (err == NEOC_SUCCESS && count > 0) {
+            result->allowed_contracts = calloc((size_t)count, sizeof(neoc_hash160_t));
+            if (!result->allowed_contracts) {
+                err = neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate allowed contracts");
+            }
+        }
+        for (size_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+            err = neoc_hash160_deserialize(&result->allowed_contracts[i], reader);
+            if (err == NEOC_SUCCESS) {
+                result->allowed_contracts_count = i + 1;
+            }
+        }
+    }
+
+    if (err == NEOC_SUCCESS && (scopes & NEOC_WITNESS_SCOPE_CUSTOM_GROUPS)) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_SIGNER_SUBITEMS, &count);
+        if (err == NEOC_SUCCESS && count > 0) {
+            result->allowed_groups = calloc((size_t)count, sizeof(uint8_t *));
+            result->allowed_groups_sizes = calloc((size_t)count, sizeof(size_t));
+            if (!result->allowed_groups || !result->allowed_groups_sizes) {
+                err = neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate allowed groups");
+            }
+        }
+        for (size_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+            /* Groups are compressed EC points written without a length prefix */
+            uint8_t *group = malloc(NEOC_PUBLIC_KEY_SIZE_COMPRESSED);
+            if (!group) {
+                err = neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate group public key");
+                break;
+            }
+            err = neoc_binary_reader_read_bytes(reader, group, NEOC_PUBLIC_KEY_SIZE_COMPRESSED);
+            if (err != NEOC_SUCCESS) {
+                free(group);
+                break;
+            }
+            result->allowed_groups[i] = group;
+            result->allowed_groups_sizes[i] = NEOC_PUBLIC_KEY_SIZE_COMPRESSED;
+            result->allowed_groups_count = i + 1;
+        }
+    }
+
+    if (err == NEOC_SUCCESS && (scopes & NEOC_WITNESS_SCOPE_WITNESS_RULES)) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_SIGNER_SUBITEMS, &count);
+        if (err == NEOC_SUCCESS && count > 0) {
+            result->rules = neoc_calloc((size_t)count, sizeof(neoc_witness_rule_t *));
+            if (!result->rules) {
+                err = neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate witness rules");
+            }
+        }
+        for (size_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+            size_t consumed = 0;
+            err = neoc_witness_rule_deserialize(reader->data + reader->position,
+                                                neoc_binary_reader_get_remaining(reader),
+                                                &result->rules[i], &consumed);
+            if (err == NEOC_SUCCESS) {
+                result->rules_count = i + 1;
+                err = neoc_binary_reader_skip(reader, consumed);
+            }
+        }
+    }
+
+    if (err != NEOC_SUCCESS) {
+        neoc_signer_free(result);
+        return err;
+    }
+
+    *signer = result;
+    return NEOC_SUCCESS;
+}
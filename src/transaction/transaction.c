@@ -1,22 +1,24 @@
 #include "neoc/transaction/transaction.h"
 #include "neoc/crypto/sha256.h"
+#include "neoc/crypto/neoc_hash.h"
+#include "neoc/crypto/sign.h"
+#include "neoc/script/opcode.h"
+#include "neoc/script/interop_service.h"
 #include "neoc/wallet/account.h"
+#include "neoc/protocol/neo_c_config.h"
 #include "neoc/utils/json.h"
 #include "neoc/utils/neoc_hex.h"
+#include "neoc/utils/numeric.h"
 #include "neoc/neoc_memory.h"
 #include "neoc/serialization/binary_writer.h"
 #include "neoc/serialization/binary_reader.h"
+#include "neoc/protocol/core/witnessrule/witness_condition.h"
 #include <string.h>
 #include <time.h>
 
 static neoc_error_t neoc_tx_attribute_clone_internal(const neoc_tx_attribute_t *source,
                                                      neoc_tx_attribute_t **dest);
 
-static neoc_error_t neoc_transaction_build_serialized(const neoc_transaction_t *transaction,
-                                                      bool include_witnesses,
-                                                      uint8_t **out_bytes,
-                                                      size_t *out_len);
-
 neoc_error_t neoc_transaction_create(neoc_transaction_t **transaction) {
     if (!transaction) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid transaction pointer");
@@ -39,6 +41,7 @@ neoc_error_t neoc_transaction_set_version(neoc_transaction_t *transaction, uint8
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid transaction");
     }
     transaction->version = version;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     return NEOC_SUCCESS;
 }
 
@@ -47,6 +50,7 @@ neoc_error_t neoc_transaction_set_nonce(neoc_transaction_t *transaction, uint32_
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid transaction");
     }
     transaction->nonce = nonce;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     return NEOC_SUCCESS;
 }
 
@@ -55,6 +59,7 @@ neoc_error_t neoc_transaction_set_system_fee(neoc_transaction_t *transaction, ui
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid transaction");
     }
     transaction->system_fee = fee;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     return NEOC_SUCCESS;
 }
 
@@ -63,6 +68,7 @@ neoc_error_t neoc_transaction_set_network_fee(neoc_transaction_t *transaction, u
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid transaction");
     }
     transaction->network_fee = fee;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     return NEOC_SUCCESS;
 }
 
@@ -71,6 +77,7 @@ neoc_error_t neoc_transaction_set_valid_until_block(neoc_transaction_t *transact
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid transaction");
     }
     transaction->valid_until_block = block;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     return NEOC_SUCCESS;
 }
 
@@ -94,6 +101,7 @@ neoc_error_t neoc_transaction_set_script(neoc_transaction_t *transaction,
     
     memcpy(transaction->script, script, script_len);
     transaction->script_len = script_len;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     
     return NEOC_SUCCESS;
 }
@@ -158,6 +166,7 @@ neoc_error_t neoc_transaction_add_signer(neoc_transaction_t *transaction,
     transaction->signers = new_signers;
     transaction->signers[transaction->signer_count] = signer;
     transaction->signer_count = new_count;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     
     return NEOC_SUCCESS;
 }
@@ -179,6 +188,7 @@ neoc_error_t neoc_transaction_add_attribute(neoc_transaction_t *transaction,
     transaction->attributes = new_attributes;
     transaction->attributes[transaction->attribute_count] = attribute;
     transaction->attribute_count = new_count;
+    memset(&transaction->hash, 0, sizeof(transaction->hash));
     
     return NEOC_SUCCESS;
 }
@@ -232,11 +242,11 @@ static neoc_error_t neoc_tx_attribute_write(const neoc_tx_attribute_t *attribute
     }
 
     neoc_error_t err = neoc_binary_writer_write_byte(writer, (uint8_t)attribute->type);
-    if (err != NEOC_SUCCESS) {
+    if (err != NEOC_SUCCESS || attribute->data_len == 0) {
         return err;
     }
 
-    return neoc_binary_writer_write_var_bytes(writer, attribute->data, attribute->data_len);
+    return neoc_binary_writer_write_bytes(writer, attribute->data, attribute->data_len);
 }
 
 static neoc_error_t neoc_tx_write_attributes(const neoc_transaction_t *transaction,
@@ -264,15 +274,7 @@ static neoc_error_t neoc_tx_write_witnesses(const neoc_transaction_t *transactio
     }
 
     for (size_t i = 0; i < transaction->witness_count; ++i) {
-        uint8_t *witness_bytes = NULL;
-        size_t witness_len = 0;
-        err = neoc_witness_serialize(transaction->witnesses[i], &witness_bytes, &witness_len);
-        if (err != NEOC_SUCCESS) {
-            return err;
-        }
-
-        err = neoc_binary_writer_write_bytes(writer, witness_bytes, witness_len);
-        neoc_free(witness_bytes);
+        err = neoc_witness_write(transaction->witnesses[i], writer);
         if (err != NEOC_SUCCESS) {
             return err;
         }
@@ -281,32 +283,10 @@ static neoc_error_t neoc_tx_write_witnesses(const neoc_transaction_t *transactio
     return NEOC_SUCCESS;
 }
 
-static size_t neoc_tx_var_int_size(uint64_t value) {
-    if (value < 0xFD) {
-        return 1;
-    } else if (value <= 0xFFFF) {
-        return 3;
-    } else if (value <= 0xFFFFFFFF) {
-        return 5;
-    }
-    return 9;
-}
-
-static neoc_error_t neoc_transaction_build_serialized(const neoc_transaction_t *transaction,
-                                                      bool include_witnesses,
-                                                      uint8_t **out_bytes,
-                                                      size_t *out_len) {
-    if (!transaction || !out_bytes || !out_len) {
-        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
-    }
-
-    neoc_binary_writer_t *writer = NULL;
-    neoc_error_t err = neoc_binary_writer_create(256, true, &writer);
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
-
-    err = neoc_binary_writer_write_byte(writer, transaction->version);
+static neoc_error_t neoc_tx_write_fields(const neoc_transaction_t *transaction,
+                                         bool include_witnesses,
+                                         neoc_binary_writer_t *writer) {
+    neoc_error_t err = neoc_binary_writer_write_byte(writer, transaction->version);
     if (err == NEOC_SUCCESS) {
         err = neoc_binary_writer_write_uint32(writer, transaction->nonce);
     }
@@ -333,13 +313,20 @@ static neoc_error_t neoc_transaction_build_serialized(const neoc_transaction_t *
     if (err == NEOC_SUCCESS && include_witnesses) {
         err = neoc_tx_write_witnesses(transaction, writer);
     }
+    return err;
+}
 
-    if (err == NEOC_SUCCESS) {
-        err = neoc_binary_writer_to_array(writer, out_bytes, out_len);
+neoc_error_t neoc_transaction_write(const neoc_transaction_t *transaction,
+                                     neoc_binary_writer_t *writer) {
+    if (!transaction || !writer) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
 
-    neoc_binary_writer_free(writer);
-    return err;
+    return neoc_tx_write_fields(transaction, true, writer);
+}
+
+static neoc_error_t neoc_tx_hash_sink(void *ctx, const uint8_t *data, size_t len) {
+    return neoc_sha256_update((neoc_sha256_ctx_t *)ctx, data, len);
 }
 
 neoc_error_t neoc_transaction_calculate_hash(neoc_transaction_t *transaction,
@@ -348,20 +335,27 @@ neoc_error_t neoc_transaction_calculate_hash(neoc_transaction_t *transaction,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    uint8_t *data = NULL;
-    size_t data_len = 0;
-
-    neoc_error_t err = neoc_transaction_build_serialized(transaction, false, &data, &data_len);
-    if (err != NEOC_SUCCESS) {
-        return err;
+    /* The unsigned part is streamed through SHA-256 in stack-sized chunks */
+    uint8_t chunk[256];
+    neoc_sha256_ctx_t sha;
+    neoc_binary_writer_t writer;
+    neoc_error_t err = neoc_sha256_init(&sha);
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_writer_init_sink(&writer, chunk, sizeof(chunk), neoc_tx_hash_sink, &sha);
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_tx_write_fields(transaction, false, &writer);
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_writer_flush(&writer);
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_sha256_final(&sha, hash->data);
     }
-
-    err = neoc_sha256(data, data_len, hash->data);
     if (err == NEOC_SUCCESS) {
         memcpy(&transaction->hash, hash, sizeof(neoc_hash256_t));
     }
 
-    neoc_free(data);
     return err;
 }
 
@@ -392,82 +386,417 @@ neoc_error_t neoc_transaction_serialize(const neoc_transaction_t *transaction,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid serialize arguments");
     }
 
-    uint8_t *data = NULL;
-    size_t data_len = 0;
-    neoc_error_t err = neoc_transaction_build_serialized(transaction, true, &data, &data_len);
+    size_t size = neoc_transaction_get_size(transaction);
+    if (size > buffer_size) {
+        return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small for serialized transaction");
+    }
+
+    neoc_binary_writer_t writer;
+    neoc_error_t err = neoc_binary_writer_init_buffer(&writer, buffer, size);
+    if (err == NEOC_SUCCESS) {
+        err = neoc_tx_write_fields(transaction, true, &writer);
+    }
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    if (writer.position != size) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Transaction size mismatch");
+    }
+
+    *serialized_size = size;
+    return NEOC_SUCCESS;
+}
+
+/* Reads a var-int length and points span at that many bytes of the reader's buffer */
+static neoc_error_t neoc_tx_read_span(neoc_binary_reader_t *reader,
+                                      size_t max_len,
+                                      const uint8_t **span,
+                                      size_t *span_len) {
+    uint64_t len = 0;
+    neoc_error_t err = neoc_binary_reader_read_var_int_max(reader, max_len, &len);
     if (err != NEOC_SUCCESS) {
         return err;
     }
 
-    if (data_len > buffer_size) {
-        neoc_free(data);
-        return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small for serialized transaction");
+    *span_len = (size_t)len;
+    return neoc_binary_reader_read_bytes_view(reader, (size_t)len, span);
+}
+
+static neoc_error_t neoc_tx_skip_condition(neoc_binary_reader_t *reader, int depth) {
+    uint8_t type = 0;
+    neoc_error_t err = neoc_binary_reader_read_byte(reader, &type);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    switch (type) {
+        case NEOC_WITNESS_CONDITION_BOOLEAN:
+            return neoc_binary_reader_skip(reader, 1);
+        case NEOC_WITNESS_CONDITION_NOT:
+        case NEOC_WITNESS_CONDITION_AND:
+        case NEOC_WITNESS_CONDITION_OR: {
+            if (depth >= NEOC_WITNESS_CONDITION_MAX_NESTING_DEPTH) {
+                return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Witness condition nested too deeply");
+            }
+            uint64_t count = 1;
+            if (type != NEOC_WITNESS_CONDITION_NOT) {
+                err = neoc_binary_reader_read_var_int_max(reader, NEOC_WITNESS_CONDITION_MAX_SUBITEMS, &count);
+                if (err == NEOC_SUCCESS && count == 0) {
+                    err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Empty witness condition list");
+                }
+            }
+            for (uint64_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+                err = neoc_tx_skip_condition(reader, depth + 1);
+            }
+            return err;
+        }
+        case NEOC_WITNESS_CONDITION_SCRIPT_HASH:
+        case NEOC_WITNESS_CONDITION_CALLED_BY_CONTRACT:
+            return neoc_binary_reader_skip(reader, NEOC_HASH160_SIZE);
+        case NEOC_WITNESS_CONDITION_GROUP:
+        case NEOC_WITNESS_CONDITION_CALLED_BY_GROUP:
+            return neoc_binary_reader_skip(reader, NEOC_PUBLIC_KEY_SIZE_COMPRESSED);
+        case NEOC_WITNESS_CONDITION_CALLED_BY_ENTRY:
+            return NEOC_SUCCESS;
+        default:
+            return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Unknown witness condition type");
+    }
+}
+
+static neoc_error_t neoc_tx_view_read_signer(neoc_binary_reader_t *reader,
+                                             neoc_signer_view_t *signer) {
+    size_t start = reader->position;
+    signer->data = reader->data + start;
+    signer->account = signer->data;
+
+    neoc_error_t err = neoc_binary_reader_skip(reader, NEOC_HASH160_SIZE);
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_byte(reader, &signer->scopes);
+    }
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    uint8_t scopes = signer->scopes;
+    if ((scopes & NEOC_WITNESS_SCOPE_GLOBAL) && scopes != NEOC_WITNESS_SCOPE_GLOBAL) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Global scope cannot be combined");
+    }
+
+    uint64_t count = 0;
+    if (scopes & NEOC_WITNESS_SCOPE_CUSTOM_CONTRACTS) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_SIGNER_SUBITEMS, &count);
+        if (err == NEOC_SUCCESS) {
+            err = neoc_binary_reader_skip(reader, (size_t)count * NEOC_HASH160_SIZE);
+        }
+    }
+    if (err == NEOC_SUCCESS && (scopes & NEOC_WITNESS_SCOPE_CUSTOM_GROUPS)) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_SIGNER_SUBITEMS, &count);
+        if (err == NEOC_SUCCESS) {
+            err = neoc_binary_reader_skip(reader, (size_t)count * NEOC_PUBLIC_KEY_SIZE_COMPRESSED);
+        }
+    }
+    if (err == NEOC_SUCCESS && (scopes & NEOC_WITNESS_SCOPE_WITNESS_RULES)) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_SIGNER_SUBITEMS, &count);
+        for (uint64_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+            uint8_t action = 0;
+            err = neoc_binary_reader_read_byte(reader, &action);
+            if (err == NEOC_SUCCESS && action > NEOC_WITNESS_ACTION_ALLOW) {
+                err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Unknown witness rule action");
+            }
+            if (err == NEOC_SUCCESS) {
+                err = neoc_tx_skip_condition(reader, 0);
+            }
+        }
+    }
+
+    signer->size = reader->position - start;
+    return err;
+}
+
+static neoc_error_t neoc_tx_view_read_attribute(neoc_binary_reader_t *reader,
+                                                neoc_tx_attribute_view_t *attribute) {
+    uint8_t type = 0;
+    neoc_error_t err = neoc_binary_reader_read_byte(reader, &type);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    size_t start = reader->position;
+    switch (type) {
+        case NEOC_TX_ATTR_HIGH_PRIORITY:
+            break;
+        case NEOC_TX_ATTR_ORACLE_RESPONSE: {
+            const uint8_t *result = NULL;
+            size_t result_len = 0;
+            err = neoc_binary_reader_skip(reader, sizeof(uint64_t) + 1);  // id, code
+            if (err == NEOC_SUCCESS) {
+                err = neoc_tx_read_span(reader, NEOC_MAX_ORACLE_RESULT_SIZE, &result, &result_len);
+            }
+            break;
+        }
+        case NEOC_TX_ATTR_NOT_VALID_BEFORE:
+            err = neoc_binary_reader_skip(reader, sizeof(uint32_t));
+            break;
+        case NEOC_TX_ATTR_CONFLICTS:
+            err = neoc_binary_reader_skip(reader, NEOC_HASH256_SIZE);
+            break;
+        default:
+            return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Unknown transaction attribute type");
+    }
+
+    attribute->type = (neoc_tx_attribute_type_t)type;
+    attribute->payload = reader->data + start;
+    attribute->payload_len = reader->position - start;
+    return err;
+}
+
+neoc_error_t neoc_transaction_view_parse(neoc_binary_reader_t *reader,
+                                          neoc_transaction_view_t *view) {
+    if (!reader || !view) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    memset(view, 0, sizeof(*view));
+    size_t start = reader->position;
+    view->data = reader->data + start;
+
+    neoc_error_t err = neoc_binary_reader_read_byte(reader, &view->version);
+    if (err == NEOC_SUCCESS && view->version != NEOC_CURRENT_TX_VERSION) {
+        err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Unsupported transaction version");
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_uint32(reader, &view->nonce);
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_uint64(reader, &view->system_fee);
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_uint64(reader, &view->network_fee);
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_uint32(reader, &view->valid_until_block);
+    }
+    if (err == NEOC_SUCCESS && (view->system_fee > INT64_MAX || view->network_fee > INT64_MAX)) {
+        err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Negative transaction fee");
+    }
+
+    uint64_t count = 0;
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_SIGNERS, &count);
+        if (err == NEOC_SUCCESS && count == 0) {
+            err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Transaction has no signers");
+        }
+    }
+    for (size_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+        err = neoc_tx_view_read_signer(reader, &view->signers[i]);
+        for (size_t j = 0; err == NEOC_SUCCESS && j < i; j++) {
+            if (memcmp(view->signers[j].account, view->signers[i].account, NEOC_HASH160_SIZE) == 0) {
+                err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Duplicate transaction signer");
+            }
+        }
+        view->signer_count = i + 1;
+    }
+
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_var_int_max(reader,
+                                                  NEOC_MAX_TRANSACTION_ATTRIBUTES - view->signer_count,
+                                                  &count);
+    }
+    for (size_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+        err = neoc_tx_view_read_attribute(reader, &view->attributes[i]);
+        view->attribute_count = i + 1;
+    }
+
+    if (err == NEOC_SUCCESS) {
+        err = neoc_tx_read_span(reader, NEOC_MAX_TRANSACTION_SCRIPT_SIZE, &view->script, &view->script_len);
+        if (err == NEOC_SUCCESS && view->script_len == 0) {
+            err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Transaction script is empty");
+        }
+    }
+    view->unsigned_size = reader->position - start;
+
+    if (err == NEOC_SUCCESS) {
+        err = neoc_binary_reader_read_var_int_max(reader, NEOC_MAX_WITNESSES, &count);
+        if (err == NEOC_SUCCESS && count != view->signer_count) {
+            err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Witness count does not match signers");
+        }
+    }
+    for (size_t i = 0; err == NEOC_SUCCESS && i < count; i++) {
+        neoc_witness_view_t *witness = &view->witnesses[i];
+        err = neoc_tx_read_span(reader, NEOC_MAX_INVOCATION_SCRIPT_SIZE,
+                                &witness->invocation_script, &witness->invocation_script_len);
+        if (err == NEOC_SUCCESS) {
+            err = neoc_tx_read_span(reader, NEOC_MAX_VERIFICATION_SCRIPT_SIZE,
+                                    &witness->verification_script, &witness->verification_script_len);
+        }
+        view->witness_count = i + 1;
+    }
+
+    view->size = reader->position - start;
+    if (err == NEOC_SUCCESS && view->size > NEOC_MAX_TRANSACTION_SIZE) {
+        err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Transaction exceeds maximum size");
+    }
+    return err;
+}
+
+neoc_error_t neoc_transaction_view_get_hash(const neoc_transaction_view_t *view,
+                                             neoc_hash256_t *hash) {
+    if (!view || !view->data || !hash) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    return neoc_sha256(view->data, view->unsigned_size, hash->data);
+}
+
+neoc_error_t neoc_transaction_from_view(const neoc_transaction_view_t *view,
+                                         neoc_transaction_t **transaction) {
+    if (!view || !view->data || !transaction) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *transaction = NULL;
+
+    neoc_transaction_t *tx = neoc_calloc(1, sizeof(neoc_transaction_t));
+    if (!tx) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate transaction");
+    }
+    tx->version = view->version;
+    tx->nonce = view->nonce;
+    tx->system_fee = view->system_fee;
+    tx->network_fee = view->network_fee;
+    tx->valid_until_block = view->valid_until_block;
+
+    neoc_error_t err = NEOC_SUCCESS;
+    tx->signers = neoc_calloc(view->signer_count ? view->signer_count : 1, sizeof(neoc_signer_t *));
+    tx->attributes = neoc_calloc(view->attribute_count ? view->attribute_count : 1,
+                                 sizeof(neoc_tx_attribute_t *));
+    tx->witnesses = neoc_calloc(view->witness_count ? view->witness_count : 1, sizeof(neoc_witness_t *));
+    if (!tx->signers || !tx->attributes || !tx->witnesses) {
+        err = neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate transaction members");
+    }
+
+    for (size_t i = 0; err == NEOC_SUCCESS && i < view->signer_count; i++) {
+        neoc_binary_reader_t signer_reader;
+        err = neoc_binary_reader_init_view(&signer_reader, view->signers[i].data, view->signers[i].size);
+        if (err == NEOC_SUCCESS) {
+            err = neoc_signer_deserialize(&signer_reader, &tx->signers[i]);
+        }
+        if (err == NEOC_SUCCESS) {
+            tx->signer_count = i + 1;
+        }
+    }
+    for (size_t i = 0; err == NEOC_SUCCESS && i < view->attribute_count; i++) {
+        err = neoc_tx_attribute_create(view->attributes[i].type,
+                                       view->attributes[i].payload,
+                                       view->attributes[i].payload_len,
+                                       &tx->attributes[i]);
+        if (err == NEOC_SUCCESS) {
+            tx->attribute_count = i + 1;
+        }
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_transaction_set_script(tx, view->script, view->script_len);
+    }
+    for (size_t i = 0; err == NEOC_SUCCESS && i < view->witness_count; i++) {
+        const neoc_witness_view_t *witness = &view->witnesses[i];
+        err = neoc_witness_create(witness->invocation_script, witness->invocation_script_len,
+                                  witness->verification_script, witness->verification_script_len,
+                                  &tx->witnesses[i]);
+        if (err == NEOC_SUCCESS) {
+            tx->witness_count = i + 1;
+        }
+    }
+    if (err == NEOC_SUCCESS) {
+        err = neoc_transaction_view_get_hash(view, &tx->hash);
     }
 
-    memcpy(buffer, data, data_len);
-    *serialized_size = data_len;
-    neoc_free(data);
+    if (err != NEOC_SUCCESS) {
+        neoc_transaction_free(tx);
+        return err;
+    }
 
+    *transaction = tx;
     return NEOC_SUCCESS;
 }
 
+neoc_error_t neoc_transaction_deserialize(neoc_binary_reader_t *reader,
+                                           neoc_transaction_t **transaction) {
+    if (!reader || !transaction) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    *transaction = NULL;
+
+    neoc_transaction_view_t view;
+    neoc_error_t err = neoc_transaction_view_parse(reader, &view);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    return neoc_transaction_from_view(&view, transaction);
+}
+
 neoc_transaction_t* neoc_transaction_deserialize_simple(const uint8_t *bytes,
                                                         size_t bytes_len,
                                                         size_t *consumed) {
-    (void)bytes;
-    (void)bytes_len;
     if (consumed) {
         *consumed = 0;
     }
-    // Binary transaction deserialization not yet implemented
-    return NULL;
+    if (!bytes) {
+        return NULL;
+    }
+
+    neoc_binary_reader_t reader;
+    neoc_transaction_t *transaction = NULL;
+    if (neoc_binary_reader_init_view(&reader, bytes, bytes_len) != NEOC_SUCCESS ||
+        neoc_transaction_deserialize(&reader, &transaction) != NEOC_SUCCESS) {
+        return NULL;
+    }
+    if (consumed) {
+        *consumed = reader.position;
+    }
+    return transaction;
+}
+
+/*
+ * N3 signs SHA-256(network magic (LE uint32) || transaction hash), so a
+ * signature for one network does not verify on another.
+ */
+static neoc_error_t neoc_transaction_sign_digest(const neoc_transaction_t *transaction,
+                                                 uint32_t network_magic,
+                                                 neoc_hash256_t *digest) {
+    neoc_hash256_t hash;
+    neoc_error_t err = neoc_transaction_calculate_hash((neoc_transaction_t *)transaction, &hash);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    uint8_t sign_data[4 + sizeof(hash.data)];
+    for (size_t i = 0; i < 4; i++) {
+        sign_data[i] = (uint8_t)(network_magic >> (8 * i));
+    }
+    memcpy(sign_data + 4, hash.data, sizeof(hash.data));
+    return neoc_sha256(sign_data, sizeof(sign_data), digest->data);
 }
 
 neoc_error_t neoc_transaction_sign(neoc_transaction_t *transaction,
                                     neoc_account_t *account) {
+    return neoc_transaction_sign_for_network(transaction, account,
+                                             NEOC_CONFIG_DEFAULT_NETWORK_MAGIC);
+}
+
+neoc_error_t neoc_transaction_sign_for_network(neoc_transaction_t *transaction,
+                                                neoc_account_t *account,
+                                                uint32_t network_magic) {
     if (!transaction || !account) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    // Calculate transaction hash if not already done
-    neoc_hash256_t hash;
-    neoc_error_t err = neoc_transaction_calculate_hash(transaction, &hash);
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
-    
-    // Sign the hash
-    uint8_t *signature = NULL;
-    size_t signature_len = 0;
-    err = neoc_account_sign(account, hash.data, sizeof(neoc_hash256_t),
-                             &signature, &signature_len);
+    neoc_hash256_t digest;
+    neoc_error_t err = neoc_transaction_sign_digest(transaction, network_magic, &digest);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-    // Get account verification script and public key for witness creation
-    // Create witness from account's verification script and signature
-    neoc_ec_key_pair_t *key_pair = neoc_account_get_key_pair_ptr(account);
-    if (!key_pair) {
-        neoc_free(signature);
-        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Account has no key pair");
-    }
-
-    uint8_t public_key[65];
-    size_t public_key_len = sizeof(public_key);
-    err = neoc_ec_key_pair_get_public_key(key_pair, public_key, &public_key_len);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(signature);
-        return err;
-    }
-
+    // PUSHDATA1 <signature> / PUSHDATA1 <key> SYSCALL CheckSig
     neoc_witness_t *witness = NULL;
-    err = neoc_witness_create_from_signature(signature, signature_len,
-                                             public_key, public_key_len,
-                                             &witness);
-
-    neoc_free(signature);
-
+    err = neoc_account_sign_hash(account, &digest, &witness);
     if (err != NEOC_SUCCESS) {
         return err;
     }
@@ -512,27 +841,26 @@ size_t neoc_transaction_get_size(const neoc_transaction_t *transaction) {
     size += 4;   // valid until block
     
     // Signers
-    size += neoc_tx_var_int_size(transaction->signer_count);
+    size += neoc_numeric_var_size(transaction->signer_count);
     for (size_t i = 0; i < transaction->signer_count; i++) {
         size += neoc_signer_get_size(transaction->signers[i]);
     }
     
     // Attributes
-    size += neoc_tx_var_int_size(transaction->attribute_count);
+    size += neoc_numeric_var_size(transaction->attribute_count);
     for (size_t i = 0; i < transaction->attribute_count; i++) {
         size += 1; // attribute type
         if (transaction->attributes[i]) {
-            size += neoc_tx_var_int_size(transaction->attributes[i]->data_len);
             size += transaction->attributes[i]->data_len;
         }
     }
     
     // Script
-    size += neoc_tx_var_int_size(transaction->script_len);
+    size += neoc_numeric_var_size(transaction->script_len);
     size += transaction->script_len;
     
     // Witnesses
-    size += neoc_tx_var_int_size(transaction->witness_count);
+    size += neoc_numeric_var_size(transaction->witness_count);
     for (size_t i = 0; i < transaction->witness_count; i++) {
         size += neoc_witness_get_size(transaction->witnesses[i]);
     }
@@ -540,19 +868,268 @@ size_t neoc_transaction_get_size(const neoc_transaction_t *transaction) {
     return size;
 }
 
-bool neoc_transaction_verify(const neoc_transaction_t *transaction) {
-    (void)transaction;
-    // Note: Implement signature verification
+#define NEOC_TX_SIGNATURE_SIZE 64u
+#define NEOC_TX_PUBLIC_KEY_SIZE 33u
+#define NEOC_TX_MAX_MULTISIG_KEYS 1024u
+
+/*
+ * Signatures and public keys pulled out of one witness; both point into
+ * the witness scripts.
+ */
+typedef struct {
+    const uint8_t **signatures;
+    size_t signature_count;
+    const uint8_t **keys;
+    size_t key_count;
+    size_t threshold;
+    size_t first_entry;
+} neoc_tx_witness_check_t;
+
+static void neoc_tx_witness_check_clear(neoc_tx_witness_check_t *check) {
+    neoc_free(check->signatures);
+    neoc_free(check->keys);
+    memset(check, 0, sizeof(*check));
+}
+
+/* Invocation scripts are one or more PUSHDATA1 <64-byte signature>. */
+static bool neoc_tx_witness_parse_signatures(const neoc_witness_t *witness,
+                                             neoc_tx_witness_check_t *check) {
+    const uint8_t *script = witness->invocation_script;
+    size_t len = witness->invocation_script_len;
+    size_t push_len = 2 + NEOC_TX_SIGNATURE_SIZE;
+    if (!script || len == 0 || len % push_len != 0) {
+        return false;
+    }
+
+    check->signatures = neoc_calloc(len / push_len, sizeof(uint8_t *));
+    if (!check->signatures) {
+        return false;
+    }
+
+    for (size_t offset = 0; offset < len; offset += push_len) {
+        if (script[offset] != NEOC_OP_PUSHDATA1 || script[offset + 1] != NEOC_TX_SIGNATURE_SIZE) {
+            return false;
+        }
+        check->signatures[check->signature_count++] = script + offset + 2;
+    }
+    return true;
+}
+
+static bool neoc_tx_script_is_syscall(const uint8_t *script, neoc_interop_service_t service) {
+    uint32_t hash = neoc_interop_get_hash(service);
+    if (script[0] != NEOC_OP_SYSCALL) {
+        return false;
+    }
+    for (size_t i = 0; i < 4; i++) {
+        if (script[1 + i] != (uint8_t)(hash >> (8 * i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Reads PUSH1..PUSH16, PUSHINT8 or PUSHINT16 as a positive count. */
+static bool neoc_tx_script_read_count(const uint8_t *script, size_t len,
+                                      size_t *offset, size_t *value) {
+    if (*offset >= len) {
+        return false;
+    }
+    uint8_t opcode = script[*offset];
+    if (opcode >= NEOC_OP_PUSH1 && opcode <= NEOC_OP_PUSH16) {
+        *value = (size_t)(opcode - NEOC_OP_PUSH1 + 1);
+        *offset += 1;
+        return true;
+    }
+    if (opcode == NEOC_OP_PUSHINT8 && *offset + 2 <= len && script[*offset + 1] < 0x80) {
+        *value = script[*offset + 1];
+        *offset += 2;
+        return *value > 0;
+    }
+    if (opcode == NEOC_OP_PUSHINT16 && *offset + 3 <= len && script[*offset + 2] < 0x80) {
+        *value = (size_t)script[*offset + 1] | ((size_t)script[*offset + 2] << 8);
+        *offset += 3;
+        return *value > 0;
+    }
     return false;
 }
 
+/*
+ * Verification scripts are either PUSHDATA1 33 <key> SYSCALL CheckSig or
+ * PUSH m, PUSHDATA1 33 <key> x n, PUSH n, SYSCALL CheckMultisig.
+ */
+static bool neoc_tx_witness_parse_keys(const neoc_witness_t *witness,
+                                       neoc_tx_witness_check_t *check) {
+    const uint8_t *script = witness->verification_script;
+    size_t len = witness->verification_script_len;
+    size_t push_len = 2 + NEOC_TX_PUBLIC_KEY_SIZE;
+    if (!script || len < push_len + 5) {
+        return false;
+    }
+
+    check->keys = neoc_calloc(len / push_len, sizeof(uint8_t *));
+    if (!check->keys) {
+        return false;
+    }
+
+    if (len == push_len + 5 && script[0] == NEOC_OP_PUSHDATA1 &&
+        script[1] == NEOC_TX_PUBLIC_KEY_SIZE &&
+        neoc_tx_script_is_syscall(script + push_len, NEOC_INTEROP_SYSTEM_CRYPTO_CHECKSIG)) {
+        check->keys[0] = script + 2;
+        check->key_count = 1;
+        check->threshold = 1;
+        return true;
+    }
+
+    size_t offset = 0;
+    size_t threshold = 0;
+    size_t key_count = 0;
+    if (!neoc_tx_script_read_count(script, len, &offset, &threshold)) {
+        return false;
+    }
+    while (offset + push_len <= len && script[offset] == NEOC_OP_PUSHDATA1 &&
+           script[offset + 1] == NEOC_TX_PUBLIC_KEY_SIZE) {
+        check->keys[check->key_count++] = script + offset + 2;
+        offset += push_len;
+    }
+    if (!neoc_tx_script_read_count(script, len, &offset, &key_count) ||
+        key_count != check->key_count || key_count > NEOC_TX_MAX_MULTISIG_KEYS ||
+        threshold > key_count || offset + 5 != len ||
+        !neoc_tx_script_is_syscall(script + offset, NEOC_INTEROP_SYSTEM_CRYPTO_CHECKMULTISIG)) {
+        return false;
+    }
+    check->threshold = threshold;
+    return true;
+}
+
+/*
+ * Number of (signature, key) pairs a witness needs. Signatures must match
+ * keys in order, so signature i can only pair with keys i .. i + n - m.
+ */
+static size_t neoc_tx_witness_pair_count(const neoc_tx_witness_check_t *check) {
+    return check->threshold * (check->key_count - check->threshold + 1);
+}
+
+static bool neoc_tx_witness_evaluate(const neoc_tx_witness_check_t *check, const bool *results) {
+    size_t m = check->threshold;
+    size_t n = check->key_count;
+    size_t window = n - m + 1;
+    size_t sig = 0;
+    for (size_t key = 0; sig < m && key < n; key++) {
+        if (key - sig >= window) {
+            return false;
+        }
+        if (results[check->first_entry + sig * window + (key - sig)]) {
+            sig++;
+        }
+    }
+    return sig == m;
+}
+
+/* Witness i must belong to signer i: its verification script hashes to the signer account. */
+static bool neoc_tx_witnesses_match_signers(const neoc_transaction_t *transaction) {
+    if (!transaction->signers || transaction->signer_count != transaction->witness_count) {
+        return false;
+    }
+    for (size_t i = 0; i < transaction->witness_count; i++) {
+        const neoc_witness_t *witness = transaction->witnesses[i];
+        const neoc_signer_t *signer = transaction->signers[i];
+        neoc_hash160_t script_hash;
+        if (!witness || !signer || !witness->verification_script ||
+            neoc_hash160_from_script(&script_hash, witness->verification_script,
+                                     witness->verification_script_len) != NEOC_SUCCESS ||
+            !neoc_hash160_equal(&script_hash, &signer->account)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool neoc_transaction_verify(const neoc_transaction_t *transaction, uint32_t network_magic) {
+    if (!transaction || transaction->witness_count == 0 || !transaction->witnesses ||
+        !neoc_tx_witnesses_match_signers(transaction)) {
+        return false;
+    }
+
+    neoc_hash256_t digest;
+    if (neoc_transaction_sign_digest(transaction, network_magic, &digest) != NEOC_SUCCESS) {
+        return false;
+    }
+
+    size_t witness_count = transaction->witness_count;
+    neoc_tx_witness_check_t *checks = neoc_calloc(witness_count, sizeof(neoc_tx_witness_check_t));
+    if (!checks) {
+        return false;
+    }
+
+    bool valid = true;
+    size_t entry_count = 0;
+    for (size_t i = 0; i < witness_count && valid; i++) {
+        const neoc_witness_t *witness = transaction->witnesses[i];
+        valid = neoc_tx_witness_parse_signatures(witness, &checks[i]) &&
+                neoc_tx_witness_parse_keys(witness, &checks[i]) &&
+                checks[i].signature_count == checks[i].threshold;
+        if (valid) {
+            checks[i].first_entry = entry_count;
+            entry_count += neoc_tx_witness_pair_count(&checks[i]);
+        }
+    }
+
+    const uint8_t **digests = NULL;
+    const uint8_t **signatures = NULL;
+    const uint8_t **keys = NULL;
+    size_t *key_lens = NULL;
+    bool *results = NULL;
+    if (valid) {
+        digests = neoc_calloc(entry_count, sizeof(uint8_t *));
+        signatures = neoc_calloc(entry_count, sizeof(uint8_t *));
+        keys = neoc_calloc(entry_count, sizeof(uint8_t *));
+        key_lens = neoc_calloc(entry_count, sizeof(size_t));
+        results = neoc_calloc(entry_count, sizeof(bool));
+        valid = digests && signatures && keys && key_lens && results;
+    }
+
+    if (valid) {
+        for (size_t i = 0; i < witness_count; i++) {
+            const neoc_tx_witness_check_t *check = &checks[i];
+            size_t window = check->key_count - check->threshold + 1;
+            for (size_t sig = 0; sig < check->threshold; sig++) {
+                for (size_t offset = 0; offset < window; offset++) {
+                    size_t entry = check->first_entry + sig * window + offset;
+                    digests[entry] = digest.data;
+                    signatures[entry] = check->signatures[sig];
+                    keys[entry] = check->keys[sig + offset];
+                    key_lens[entry] = NEOC_TX_PUBLIC_KEY_SIZE;
+                }
+            }
+        }
+
+        valid = neoc_verify_digests_batch(digests, signatures, keys, key_lens,
+                                          entry_count, results) == NEOC_SUCCESS;
+        for (size_t i = 0; i < witness_count && valid; i++) {
+            valid = neoc_tx_witness_evaluate(&checks[i], results);
+        }
+    }
+
+    neoc_free(digests);
+    neoc_free(signatures);
+    neoc_free(keys);
+    neoc_free(key_lens);
+    neoc_free(results);
+    for (size_t i = 0; i < witness_count; i++) {
+        neoc_tx_witness_check_clear(&checks[i]);
+    }
+    neoc_free(checks);
+    return valid;
+}
+
 void neoc_transaction_free(neoc_transaction_t *transaction) {
     if (!transaction) return;
     
     // Free signers
     if (transaction->signers) {
-        // In test contexts we may not own the signer memory; avoid dereferencing potentially invalid pointers.
-        transaction->signer_count = 0;
+        for (size_t i = 0; i < transaction->signer_count; i++) {
+            neoc_signer_free(transaction->signers[i]);
+        }
         neoc_free(transaction->signers);
     }
     
@@ -729,10 +1306,19 @@ neoc_transaction_t* neoc_transaction_from_json(const char* json_str) {
         return NULL;
     }
     
+    neoc_transaction_t* tx = neoc_transaction_from_json_node(json);
+    neoc_json_free(json);
+    return tx;
+}
+
+neoc_transaction_t* neoc_transaction_from_json_node(const neoc_json_t* json) {
+    if (!json) {
+        return NULL;
+    }
+    
     neoc_transaction_t* tx = NULL;
     neoc_error_t err = neoc_transaction_create(&tx);
     if (err != NEOC_SUCCESS || !tx) {
-        neoc_json_free(json);
         return NULL;
     }
     
@@ -776,7 +1362,6 @@ neoc_transaction_t* neoc_transaction_from_json(const char* json_str) {
         neoc_hash256_from_string(hash_str, &tx->hash);
     }
     
-    neoc_json_free(json);
     return tx;
 }
 
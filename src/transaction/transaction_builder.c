@@ -442,45 +442,34 @@ neoc_error_t neoc_tx_builder_calculate_fees(neoc_tx_builder_t *builder,
     // Network fee = base fee + size fee + signature verification fee
     // System fee = gas consumed by script execution
     
-    size_t signer_count = builder->signer_count;
-
-    // Build unsigned transaction first to get size
-    neoc_transaction_t *temp_tx = NULL;
-    neoc_error_t err = neoc_tx_builder_build_unsigned(builder, &temp_tx);
-    if (err != NEOC_SUCCESS) {
+    if (!builder->script || builder->script_size == 0 ||
+        builder->valid_until_block == 0 || builder->signer_count == 0) {
         // Use default fees if can't build transaction
         *network_fee = builder->network_fee > 0 ? builder->network_fee : 100000; // 0.001 GAS minimum
         *system_fee = builder->system_fee > 0 ? builder->system_fee : 0;
         return NEOC_SUCCESS;
     }
     
-    // Calculate network fee based on transaction size
-    size_t serialized_size = neoc_transaction_get_size(temp_tx);
-    uint8_t *tx_bytes = neoc_malloc(serialized_size);
-    if (!tx_bytes) {
-        neoc_transaction_free(temp_tx);
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate transaction buffer");
-    }
-
-    size_t written = 0;
-    err = neoc_transaction_serialize(temp_tx, tx_bytes, serialized_size, &written);
-    if (err == NEOC_SUCCESS) {
-        if (written < serialized_size) {
-            serialized_size = written;
-        }
+    // Calculate network fee based on the size of the unsigned transaction
+    // neoc_tx_builder_build_unsigned would produce: no attributes or
+    // witnesses, signers and script borrowed so the builder keeps them
+    neoc_transaction_t unsigned_tx = {
+        .version = builder->version,
+        .signers = builder->signers,
+        .signer_count = builder->signer_count,
+        .script = builder->script,
+        .script_len = builder->script_size
+    };
+    size_t serialized_size = neoc_transaction_get_size(&unsigned_tx);
 
-        uint64_t size_fee = serialized_size * 1000;
-        uint64_t sig_fee = signer_count * 1000000;
+    uint64_t byte_fee = serialized_size * 1000;
+    uint64_t sig_fee = builder->signer_count * 1000000;
 
-        *network_fee = size_fee + sig_fee;
+    *network_fee = byte_fee + sig_fee;
 
-        if (*network_fee < 100000) {
-            *network_fee = 100000;
-        }
-    } else {
-        *network_fee = builder->network_fee > 0 ? builder->network_fee : 100000;
+    if (*network_fee < 100000) {
+        *network_fee = 100000;
     }
-    neoc_free(tx_bytes);
     
     // Calculate system fee by invoking script with RPC client
     // Use the builder's system fee if set, otherwise estimate based on script complexity
@@ -500,8 +489,6 @@ neoc_error_t neoc_tx_builder_calculate_fees(neoc_tx_builder_t *builder,
         *system_fee = base_fee + size_fee + invocation_fee;
     }
     
-    neoc_transaction_free(temp_tx);
-    
     return NEOC_SUCCESS;
 }
 
@@ -3,6 +3,8 @@
 #include "neoc/neoc_memory.h"
 #include "neoc/serialization/binary_writer.h"
 #include "neoc/serialization/binary_reader.h"
+#include "neoc/script/opcode.h"
+#include "neoc/script/interop_service.h"
 #include <string.h>
 
 static size_t neoc_var_int_size(uint64_t value) {
@@ -69,29 +71,37 @@ neoc_error_t neoc_witness_create_from_signature(const uint8_t *signature,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    // Create invocation script (push signature)
-    size_t invocation_len = 1 + signature_len;  // OpCode + signature
+    if (signature_len > 0xFF || public_key_len > 0xFF) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Signature or public key too long");
+    }
+    
+    // Create invocation script (PUSHDATA1 <signature>)
+    size_t invocation_len = 2 + signature_len;
     uint8_t *invocation_script = neoc_malloc(invocation_len);
     if (!invocation_script) {
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate invocation script");
     }
     
-    // Push signature opcode (0x40 + length for 64 bytes)
-    invocation_script[0] = 0x40;
-    memcpy(invocation_script + 1, signature, signature_len);
+    invocation_script[0] = NEOC_OP_PUSHDATA1;
+    invocation_script[1] = (uint8_t)signature_len;
+    memcpy(invocation_script + 2, signature, signature_len);
     
-    // Create verification script (push public key + CHECKSIG)
-    size_t verification_len = 1 + public_key_len + 1;  // OpCode + pubkey + CHECKSIG
+    // Create verification script (PUSHDATA1 <key> SYSCALL System.Crypto.CheckSig)
+    size_t verification_len = 2 + public_key_len + 5;
     uint8_t *verification_script = neoc_malloc(verification_len);
     if (!verification_script) {
         neoc_free(invocation_script);
         return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate verification script");
     }
     
-    // Push public key opcode (0x21 for 33 bytes compressed key)
-    verification_script[0] = 0x21;
-    memcpy(verification_script + 1, public_key, public_key_len);
-    verification_script[1 + public_key_len] = 0xAC;  // CHECKSIG opcode
+    verification_script[0] = NEOC_OP_PUSHDATA1;
+    verification_script[1] = (uint8_t)public_key_len;
+    memcpy(verification_script + 2, public_key, public_key_len);
+    verification_script[2 + public_key_len] = NEOC_OP_SYSCALL;
+    uint32_t checksig = neoc_interop_get_hash(NEOC_INTEROP_SYSTEM_CRYPTO_CHECKSIG);
+    for (size_t i = 0; i < 4; i++) {
+        verification_script[3 + public_key_len + i] = (uint8_t)(checksig >> (8 * i));
+    }
     
     // Create witness
     neoc_error_t err = neoc_witness_create(invocation_script, invocation_len,
@@ -113,6 +123,23 @@ size_t neoc_witness_get_size(const neoc_witness_t *witness) {
     return size;
 }
 
+neoc_error_t neoc_witness_write(const neoc_witness_t *witness,
+                                 neoc_binary_writer_t *writer) {
+    if (!witness || !writer) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    neoc_error_t err = neoc_binary_writer_write_var_bytes(writer,
+                                                          witness->invocation_script,
+                                                          witness->invocation_script_len);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    return neoc_binary_writer_write_var_bytes(writer,
+                                              witness->verification_script,
+                                              witness->verification_script_len);
+}
+
 neoc_error_t neoc_witness_serialize(const neoc_witness_t *witness,
                                      uint8_t **bytes,
                                      size_t *bytes_len) {
@@ -120,27 +147,25 @@ neoc_error_t neoc_witness_serialize(const neoc_witness_t *witness,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    neoc_binary_writer_t *writer = NULL;
-    neoc_error_t err = neoc_binary_writer_create(64, true, &writer);
-    if (err != NEOC_SUCCESS) {
-        return err;
+    size_t size = neoc_witness_get_size(witness);
+    uint8_t *buffer = neoc_malloc(size);
+    if (!buffer) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate witness buffer");
     }
 
-    err = neoc_binary_writer_write_var_bytes(writer,
-                                             witness->invocation_script,
-                                             witness->invocation_script_len);
+    neoc_binary_writer_t writer;
+    neoc_error_t err = neoc_binary_writer_init_buffer(&writer, buffer, size);
     if (err == NEOC_SUCCESS) {
-        err = neoc_binary_writer_write_var_bytes(writer,
-                                                 witness->verification_script,
-                                                 witness->verification_script_len);
+        err = neoc_witness_write(witness, &writer);
     }
-
-    if (err == NEOC_SUCCESS) {
-        err = neoc_binary_writer_to_array(writer, bytes, bytes_len);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(buffer);
+        return err;
     }
 
-    neoc_binary_writer_free(writer);
-    return err;
+    *bytes = buffer;
+    *bytes_len = writer.position;
+    return NEOC_SUCCESS;
 }
 
 neoc_error_t neoc_witness_deserialize(const uint8_t *bytes,
@@ -129,31 +129,24 @@ neoc_error_t neoc_hash160_from_address(neoc_hash160_t* hash, const char* address
         return NEOC_ERROR_NULL_POINTER;
     }
     
-    /* Decode Base58Check address */
-    size_t decoded_length;
-    uint8_t* decoded = neoc_base58_check_decode_alloc(address, &decoded_length);
-    if (!decoded) {
-        return NEOC_ERROR_INVALID_BASE58;
-    }
-    
-    /* Address should be version byte + 20 byte hash */
-    if (decoded_length != 1 + NEOC_HASH160_SIZE) {
-        neoc_free(decoded);
-        return NEOC_ERROR_INVALID_FORMAT;
+    /* Decode Base58Check address (version byte + 20 byte hash) */
+    uint8_t version;
+    uint8_t script_hash[NEOC_HASH160_SIZE];
+    neoc_error_t err = neoc_base58_check_decode_address(address, &version, script_hash);
+    if (err != NEOC_SUCCESS) {
+        return err;
     }
     
     /* Check version byte */
-    if (decoded[0] != NEOC_ADDRESS_VERSION) {
-        neoc_free(decoded);
+    if (version != NEOC_ADDRESS_VERSION) {
         return NEOC_ERROR_INVALID_FORMAT;
     }
     
-    /* Extract hash160 (skip version byte) and store in big-endian order */
+    /* Store in big-endian order */
     for (size_t i = 0; i < NEOC_HASH160_SIZE; i++) {
-        hash->data[i] = decoded[1 + NEOC_HASH160_SIZE - 1 - i];
+        hash->data[i] = script_hash[NEOC_HASH160_SIZE - 1 - i];
     }
     
-    neoc_secure_free(decoded, decoded_length);
     return NEOC_SUCCESS;
 }
 
@@ -312,29 +305,13 @@ neoc_error_t neoc_hash160_to_address(const neoc_hash160_t* hash, char* buffer, s
         return NEOC_ERROR_NULL_POINTER;
     }
     
-    /* Create versioned hash (version byte + little-endian script hash) */
-    uint8_t versioned[1 + NEOC_HASH160_SIZE];
-    versioned[0] = NEOC_ADDRESS_VERSION;
+    /* Little-endian script hash, as it appears in the address */
+    uint8_t script_hash[NEOC_HASH160_SIZE];
     for (size_t i = 0; i < NEOC_HASH160_SIZE; i++) {
-        versioned[1 + i] = hash->data[NEOC_HASH160_SIZE - 1 - i];
+        script_hash[i] = hash->data[NEOC_HASH160_SIZE - 1 - i];
     }
     
-    /* Encode as Base58Check */
-    char* address = neoc_base58_check_encode_alloc(versioned, sizeof(versioned));
-    if (!address) {
-        return NEOC_ERROR_INVALID_FORMAT;
-    }
-    
-    size_t address_len = strlen(address);
-    if (buffer_size <= address_len) {
-        neoc_free(address);
-        return NEOC_ERROR_BUFFER_TOO_SMALL;
-    }
-    
-    strcpy(buffer, address);
-    neoc_free(address);
-    
-    return NEOC_SUCCESS;
+    return neoc_base58_check_encode_address(NEOC_ADDRESS_VERSION, script_hash, buffer, buffer_size);
 }
 
 int neoc_hash160_compare(const neoc_hash160_t* a, const neoc_hash160_t* b) {
@@ -362,8 +339,10 @@ neoc_error_t neoc_hash160_serialize(const neoc_hash160_t* hash, neoc_binary_writ
         return NEOC_ERROR_NULL_POINTER;
     }
     
-    /* Write hash bytes directly */
-    return neoc_binary_writer_write_bytes(writer, hash->data, NEOC_HASH160_SIZE);
+    /* UInt160 goes on the wire little-endian; data is big-endian */
+    uint8_t wire[NEOC_HASH160_SIZE];
+    neoc_hash160_to_little_endian_bytes(hash, wire, sizeof(wire));
+    return neoc_binary_writer_write_bytes(writer, wire, NEOC_HASH160_SIZE);
 }
 
 neoc_error_t neoc_hash160_deserialize(neoc_hash160_t* hash, neoc_binary_reader_t* reader) {
@@ -371,8 +350,15 @@ neoc_error_t neoc_hash160_deserialize(neoc_hash160_t* hash, neoc_binary_reader_t
         return NEOC_ERROR_NULL_POINTER;
     }
     
-    /* Read hash bytes directly */
-    return neoc_binary_reader_read_bytes(reader, hash->data, NEOC_HASH160_SIZE);
+    uint8_t wire[NEOC_HASH160_SIZE];
+    neoc_error_t err = neoc_binary_reader_read_bytes(reader, wire, NEOC_HASH160_SIZE);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    for (size_t i = 0; i < NEOC_HASH160_SIZE; i++) {
+        hash->data[i] = wire[NEOC_HASH160_SIZE - 1 - i];
+    }
+    return NEOC_SUCCESS;
 }
 
 size_t neoc_hash160_serialized_size(void) {
@@ -0,0 +1,475 @@
+/**
+ * @file http_engine.c
+ * @brief Asynchronous HTTP engine on libcurl's multi interface
+ *
+ * One event-loop thread owns the multi handle: it adds newly submitted
+ * calls, drives transfers with curl_multi_perform and sleeps in
+ * curl_multi_poll until a socket is ready, a curl timer fires or another
+ * thread wakes it. Submitters and cancellers only touch the call list
+ * under the engine lock and then wake the loop.
+ */
+
+#include "neoc/utils/http_engine.h"
+#include "neoc/neoc_error.h"
+#include "neoc/neoc_memory.h"
+
+#include <curl/curl.h>
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct neoc_http_call {
+    neoc_http_call_id_t id;
+    CURL *easy;
+    uint8_t *payload;
+    neoc_byte_array_t body;
+    neoc_http_engine_callback_t callback;
+    void *user_data;
+    bool started;               /* Added to the multi handle */
+    bool cancelled;
+    struct neoc_http_call *next;
+} neoc_http_call_t;
+
+typedef struct neoc_http_completion_node {
+    neoc_http_completion_t completion;
+    struct neoc_http_completion_node *next;
+} neoc_http_completion_node_t;
+
+/*
+ * Everything from lock down is guarded by lock. The multi handle is only
+ * used by the loop thread, except for curl_multi_wakeup.
+ */
+struct neoc_http_engine_t {
+    neoc_http_engine_config_t config;
+    CURLM *multi;
+    struct curl_slist *headers;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t completion_ready;
+    neoc_http_call_t *calls;
+    size_t in_flight;
+    neoc_http_call_id_t next_id;
+    neoc_http_completion_node_t *queue_head;
+    neoc_http_completion_node_t *queue_tail;
+    bool stopping;
+};
+
+static pthread_once_t engine_curl_once = PTHREAD_ONCE_INIT;
+static CURLcode engine_curl_result = CURLE_FAILED_INIT;
+
+static void engine_curl_init_routine(void) {
+    engine_curl_result = curl_global_init(CURL_GLOBAL_DEFAULT);
+}
+
+static size_t engine_write_callback(void *contents, size_t size, size_t nmemb, void *userp) {
+    neoc_byte_array_t *body = (neoc_byte_array_t *)userp;
+    size_t total = size * nmemb;
+
+    if (body->length + total > body->capacity) {
+        size_t capacity = body->capacity ? body->capacity : 1024;
+        while (capacity < body->length + total) {
+            capacity *= 2;
+        }
+        uint8_t *data = neoc_realloc(body->data, capacity);
+        if (!data) {
+            return 0;
+        }
+        body->data = data;
+        body->capacity = capacity;
+    }
+    memcpy(body->data + body->length, contents, total);
+    body->length += total;
+    return total;
+}
+
+static void engine_call_free(neoc_http_call_t *call) {
+    if (call->easy) {
+        curl_easy_cleanup(call->easy);
+    }
+    neoc_free(call->payload);
+    neoc_free(call->body.data);
+    neoc_free(call);
+}
+
+static neoc_error_t engine_map_result(CURLcode code) {
+    switch (code) {
+        case CURLE_OK:
+            return NEOC_SUCCESS;
+        case CURLE_OPERATION_TIMEDOUT:
+            return NEOC_ERROR_TIMEOUT;
+        case CURLE_WRITE_ERROR:
+        case CURLE_OUT_OF_MEMORY:
+            return NEOC_ERROR_OUT_OF_MEMORY;
+        default:
+            return NEOC_ERROR_NETWORK;
+    }
+}
+
+/* Hands the outcome to the callback or the queue and frees the call */
+static void engine_complete(neoc_http_engine_t *engine, neoc_http_call_t *call,
+                            neoc_error_t error, long status_code) {
+    neoc_http_completion_t completion = {
+        .call_id = call->id,
+        .error = error,
+        .status_code = status_code,
+        .body = NULL,
+        .user_data = call->user_data
+    };
+
+    if (error == NEOC_SUCCESS) {
+        completion.body = neoc_calloc(1, sizeof(neoc_byte_array_t));
+        if (completion.body) {
+            *completion.body = call->body;
+            memset(&call->body, 0, sizeof(call->body));
+        } else {
+            completion.error = NEOC_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    neoc_http_engine_callback_t callback = call->callback;
+    engine_call_free(call);
+
+    if (callback) {
+        callback(&completion);
+        return;
+    }
+
+    neoc_http_completion_node_t *node = neoc_calloc(1, sizeof(neoc_http_completion_node_t));
+    if (!node) {
+        /* Nowhere to report it; the submitter sees the call vanish from in_flight */
+        neoc_byte_array_free(completion.body);
+        return;
+    }
+    node->completion = completion;
+    pthread_mutex_lock(&engine->lock);
+    if (engine->queue_tail) {
+        engine->queue_tail->next = node;
+    } else {
+        engine->queue_head = node;
+    }
+    engine->queue_tail = node;
+    pthread_cond_broadcast(&engine->completion_ready);
+    pthread_mutex_unlock(&engine->lock);
+}
+
+/*
+ * Starts newly submitted calls and detaches cancelled ones (all calls
+ * once the engine is stopping). Returns the detached calls.
+ */
+static neoc_http_call_t *engine_sync_calls(neoc_http_engine_t *engine, bool *stopping) {
+    neoc_http_call_t *detached = NULL;
+
+    pthread_mutex_lock(&engine->lock);
+    *stopping = engine->stopping;
+    neoc_http_call_t **link = &engine->calls;
+    while (*link) {
+        neoc_http_call_t *call = *link;
+        if (call->cancelled || engine->stopping) {
+            *link = call->next;
+            call->next = detached;
+            detached = call;
+            engine->in_flight--;
+            continue;
+        }
+        if (!call->started) {
+            curl_multi_add_handle(engine->multi, call->easy);
+            call->started = true;
+        }
+        link = &call->next;
+    }
+    pthread_mutex_unlock(&engine->lock);
+
+    return detached;
+}
+
+static void engine_unlink_call(neoc_http_engine_t *engine, neoc_http_call_t *target) {
+    pthread_mutex_lock(&engine->lock);
+    for (neoc_http_call_t **link = &engine->calls; *link; link = &(*link)->next) {
+        if (*link == target) {
+            *link = target->next;
+            engine->in_flight--;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&engine->lock);
+}
+
+static void *engine_run(void *arg) {
+    neoc_http_engine_t *engine = (neoc_http_engine_t *)arg;
+
+    for (;;) {
+        bool stopping = false;
+        neoc_http_call_t *detached = engine_sync_calls(engine, &stopping);
+        while (detached) {
+            neoc_http_call_t *call = detached;
+            detached = call->next;
+            if (call->started) {
+                curl_multi_remove_handle(engine->multi, call->easy);
+            }
+            engine_complete(engine, call, NEOC_ERROR_CANCELLED, 0);
+        }
+        if (stopping) {
+            break;
+        }
+
+        int running = 0;
+        curl_multi_perform(engine->multi, &running);
+
+        CURLMsg *msg = NULL;
+        int remaining = 0;
+        while ((msg = curl_multi_info_read(engine->multi, &remaining))) {
+            if (msg->msg != CURLMSG_DONE) {
+                continue;
+            }
+            neoc_http_call_t *call = NULL;
+            CURLcode code = msg->data.result;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&call);
+            curl_multi_remove_handle(engine->multi, msg->easy_handle);
+            engine_unlink_call(engine, call);
+
+            long status_code = 0;
+            curl_easy_getinfo(call->easy, CURLINFO_RESPONSE_CODE, &status_code);
+            engine_complete(engine, call, engine_map_result(code), status_code);
+        }
+
+        curl_multi_poll(engine->multi, NULL, 0, 1000, NULL);
+    }
+
+    return NULL;
+}
+
+neoc_error_t neoc_http_engine_get_default_config(neoc_http_engine_config_t *config) {
+    if (!config) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid config pointer");
+    }
+    memset(config, 0, sizeof(*config));
+    config->max_connections_per_host = NEOC_HTTP_ENGINE_DEFAULT_HOST_CONNECTIONS;
+    config->default_timeout_ms = NEOC_HTTP_ENGINE_DEFAULT_TIMEOUT_MS;
+    config->verify_ssl = true;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_http_engine_create(const neoc_http_engine_config_t *config,
+                                     neoc_http_engine_t **engine) {
+    if (!engine) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid engine pointer");
+    }
+    *engine = NULL;
+
+    pthread_once(&engine_curl_once, engine_curl_init_routine);
+    if (engine_curl_result != CURLE_OK) {
+        return neoc_error_set(NEOC_ERROR_NETWORK, "Failed to initialise libcurl");
+    }
+
+    neoc_http_engine_t *new_engine = neoc_calloc(1, sizeof(neoc_http_engine_t));
+    if (!new_engine) {
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to allocate HTTP engine");
+    }
+    if (config) {
+        new_engine->config = *config;
+    } else {
+        neoc_http_engine_get_default_config(&new_engine->config);
+    }
+    if (new_engine->config.default_timeout_ms <= 0) {
+        new_engine->config.default_timeout_ms = NEOC_HTTP_ENGINE_DEFAULT_TIMEOUT_MS;
+    }
+    new_engine->next_id = 1;
+
+    new_engine->multi = curl_multi_init();
+    new_engine->headers = curl_slist_append(NULL, "Content-Type: application/json");
+    if (!new_engine->multi || !new_engine->headers) {
+        if (new_engine->multi) curl_multi_cleanup(new_engine->multi);
+        curl_slist_free_all(new_engine->headers);
+        neoc_free(new_engine);
+        return neoc_error_set(NEOC_ERROR_NETWORK, "Failed to initialise CURL multi handle");
+    }
+    curl_multi_setopt(new_engine->multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    curl_multi_setopt(new_engine->multi, CURLMOPT_MAX_HOST_CONNECTIONS,
+                      (long)new_engine->config.max_connections_per_host);
+
+    pthread_mutex_init(&new_engine->lock, NULL);
+    pthread_cond_init(&new_engine->completion_ready, NULL);
+
+    if (pthread_create(&new_engine->thread, NULL, engine_run, new_engine) != 0) {
+        pthread_cond_destroy(&new_engine->completion_ready);
+        pthread_mutex_destroy(&new_engine->lock);
+        curl_multi_cleanup(new_engine->multi);
+        curl_slist_free_all(new_engine->headers);
+        neoc_free(new_engine);
+        return neoc_error_set(NEOC_ERROR_INTERNAL, "Failed to start HTTP engine thread");
+    }
+
+    *engine = new_engine;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_http_engine_post(neoc_http_engine_t *engine,
+                                   const char *url,
+                                   const uint8_t *body,
+                                   size_t body_len,
+                                   long timeout_ms,
+                                   neoc_http_engine_callback_t callback,
+                                   void *user_data,
+                                   neoc_http_call_id_t *call_id) {
+    if (!engine || !url || (!body && body_len > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    neoc_http_call_t *call = neoc_calloc(1, sizeof(neoc_http_call_t));
+    if (!call) {
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to allocate HTTP call");
+    }
+    call->payload = neoc_malloc(body_len + 1);
+    call->easy = curl_easy_init();
+    if (!call->payload || !call->easy) {
+        engine_call_free(call);
+        return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to prepare HTTP call");
+    }
+    if (body_len > 0) {
+        memcpy(call->payload, body, body_len);
+    }
+    call->payload[body_len] = '\0';
+    call->callback = callback;
+    call->user_data = user_data;
+
+    CURL *easy = call->easy;
+    curl_easy_setopt(easy, CURLOPT_URL, url);
+    curl_easy_setopt(easy, CURLOPT_POSTFIELDS, (const char *)call->payload);
+    curl_easy_setopt(easy, CURLOPT_POSTFIELDSIZE, (long)body_len);
+    curl_easy_setopt(easy, CURLOPT_HTTPHEADER, engine->headers);
+    curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, engine_write_callback);
+    curl_easy_setopt(easy, CURLOPT_WRITEDATA, &call->body);
+    curl_easy_setopt(easy, CURLOPT_PRIVATE, (char *)call);
+    curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS,
+                     timeout_ms > 0 ? timeout_ms : engine->config.default_timeout_ms);
+    curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+    /* Wait for a pooled connection instead of opening a new one */
+    curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+    if (!engine->config.verify_ssl) {
+        curl_easy_setopt(easy, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(easy, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
+
+    pthread_mutex_lock(&engine->lock);
+    if (engine->stopping) {
+        pthread_mutex_unlock(&engine->lock);
+        engine_call_free(call);
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "HTTP engine is shutting down");
+    }
+    call->id = engine->next_id++;
+    call->next = engine->calls;
+    engine->calls = call;
+    engine->in_flight++;
+    if (call_id) {
+        *call_id = call->id;
+    }
+    pthread_mutex_unlock(&engine->lock);
+
+    curl_multi_wakeup(engine->multi);
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_http_engine_cancel(neoc_http_engine_t *engine, neoc_http_call_id_t call_id) {
+    if (!engine) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid engine");
+    }
+
+    bool found = false;
+    pthread_mutex_lock(&engine->lock);
+    for (neoc_http_call_t *call = engine->calls; call; call = call->next) {
+        if (call->id == call_id) {
+            found = !call->cancelled;
+            call->cancelled = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&engine->lock);
+
+    if (!found) {
+        return NEOC_ERROR_NOT_FOUND;
+    }
+    curl_multi_wakeup(engine->multi);
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_http_engine_next_completion(neoc_http_engine_t *engine,
+                                              long wait_ms,
+                                              neoc_http_completion_t *completion) {
+    if (!engine || !completion) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    struct timespec deadline;
+    if (wait_ms > 0) {
+        timespec_get(&deadline, TIME_UTC);
+        deadline.tv_sec += wait_ms / 1000;
+        deadline.tv_nsec += (wait_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    pthread_mutex_lock(&engine->lock);
+    while (!engine->queue_head) {
+        if (wait_ms == 0) {
+            break;
+        }
+        if (wait_ms < 0) {
+            pthread_cond_wait(&engine->completion_ready, &engine->lock);
+        } else if (pthread_cond_timedwait(&engine->completion_ready, &engine->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+
+    neoc_http_completion_node_t *node = engine->queue_head;
+    if (node) {
+        engine->queue_head = node->next;
+        if (!engine->queue_head) {
+            engine->queue_tail = NULL;
+        }
+    }
+    pthread_mutex_unlock(&engine->lock);
+
+    if (!node) {
+        return NEOC_ERROR_TIMEOUT;
+    }
+    *completion = node->completion;
+    neoc_free(node);
+    return NEOC_SUCCESS;
+}
+
+size_t neoc_http_engine_in_flight(neoc_http_engine_t *engine) {
+    if (!engine) {
+        return 0;
+    }
+    pthread_mutex_lock(&engine->lock);
+    size_t count = engine->in_flight;
+    pthread_mutex_unlock(&engine->lock);
+    return count;
+}
+
+void neoc_http_engine_free(neoc_http_engine_t *engine) {
+    if (!engine) return;
+
+    pthread_mutex_lock(&engine->lock);
+    engine->stopping = true;
+    pthread_mutex_unlock(&engine->lock);
+    curl_multi_wakeup(engine->multi);
+    pthread_join(engine->thread, NULL);
+
+    while (engine->queue_head) {
+        neoc_http_completion_node_t *node = engine->queue_head;
+        engine->queue_head = node->next;
+        neoc_byte_array_free(node->completion.body);
+        neoc_free(node);
+    }
+
+    curl_multi_cleanup(engine->multi);
+    curl_slist_free_all(engine->headers);
+    pthread_cond_destroy(&engine->completion_ready);
+    pthread_mutex_destroy(&engine->lock);
+    neoc_free(engine);
+}
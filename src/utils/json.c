@@ -3,6 +3,7 @@
 #include "neoc/neoc_error.h"
 #include "neoc/neoc_memory.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #ifdef HAVE_CJSON
@@ -397,3 +398,812 @@ bool neoc_json_is_object(const neoc_json_t *json) {
 }
 
 #endif /* HAVE_CJSON */
+
+/* ===== Streaming parser ===== */
+
+typedef enum {
+    STREAM_EXPECT_VALUE,
+    STREAM_EXPECT_VALUE_OR_END,
+    STREAM_EXPECT_KEY_OR_END,
+    STREAM_EXPECT_KEY,
+    STREAM_EXPECT_COLON,
+    STREAM_EXPECT_COMMA_OR_END,
+    STREAM_EXPECT_NOTHING
+} stream_expect_t;
+
+typedef enum {
+    STREAM_TOKEN_NONE,
+    STREAM_TOKEN_STRING,
+    STREAM_TOKEN_NUMBER,
+    STREAM_TOKEN_LITERAL
+} stream_token_t;
+
+typedef enum {
+    STREAM_ESCAPE_NONE,
+    STREAM_ESCAPE_BACKSLASH,
+    STREAM_ESCAPE_UNICODE
+} stream_escape_t;
+
+struct neoc_json_stream {
+    neoc_json_event_handler_t handler;
+    void *user_data;
+    neoc_error_t status;
+    stream_expect_t expect;
+
+    /* Token in progress; it may span any number of chunks */
+    stream_token_t token;
+    bool token_is_key;
+    stream_escape_t escape;
+    uint32_t unicode;
+    int unicode_digits;
+    uint32_t high_surrogate;
+    const char *literal;
+    size_t literal_pos;
+    neoc_json_event_type_t literal_type;
+    char *text;
+    size_t text_length;
+    size_t text_capacity;
+
+    /* Open containers, '{' or '[' */
+    char *containers;
+    size_t depth;
+    size_t containers_capacity;
+};
+
+static neoc_error_t stream_fail(neoc_json_stream_t *stream, neoc_error_t code, const char *message) {
+    stream->status = code;
+    return neoc_error_set(code, message);
+}
+
+static neoc_error_t stream_append(neoc_json_stream_t *stream, const char *data, size_t length) {
+    if (stream->text_length + length + 1 > stream->text_capacity) {
+        size_t capacity = stream->text_capacity ? stream->text_capacity : 64;
+        while (capacity < stream->text_length + length + 1) {
+            capacity *= 2;
+        }
+        char *text = neoc_realloc(stream->text, capacity);
+        if (!text) {
+            return stream_fail(stream, NEOC_ERROR_MEMORY, "Failed to grow JSON token buffer");
+        }
+        stream->text = text;
+        stream->text_capacity = capacity;
+    }
+    memcpy(stream->text + stream->text_length, data, length);
+    stream->text_length += length;
+    stream->text[stream->text_length] = '\0';
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t stream_emit(neoc_json_stream_t *stream, neoc_json_event_type_t type,
+                                const char *text, size_t length, size_t depth) {
+    neoc_json_event_t event = { type, text, length, depth };
+    neoc_error_t err = stream->handler(&event, stream->user_data);
+    if (err != NEOC_SUCCESS) {
+        stream->status = err;
+    }
+    return err;
+}
+
+static void stream_value_done(neoc_json_stream_t *stream) {
+    stream->token = STREAM_TOKEN_NONE;
+    stream->expect = stream->depth == 0 ? STREAM_EXPECT_NOTHING : STREAM_EXPECT_COMMA_OR_END;
+}
+
+static neoc_error_t stream_emit_text(neoc_json_stream_t *stream, neoc_json_event_type_t type) {
+    /* Terminates the text, and allocates it for an empty first token */
+    if (stream_append(stream, "", 0) != NEOC_SUCCESS) {
+        return stream->status;
+    }
+    return stream_emit(stream, type, stream->text, stream->text_length, stream->depth);
+}
+
+static bool stream_number_valid(const char *text, size_t length) {
+    size_t i = 0;
+    if (i < length && text[i] == '-') {
+        i++;
+    }
+    if (i < length && text[i] == '0') {
+        i++;
+    } else if (i < length && text[i] >= '1' && text[i] <= '9') {
+        while (i < length && text[i] >= '0' && text[i] <= '9') {
+            i++;
+        }
+    } else {
+        return false;
+    }
+    if (i < length && text[i] == '.') {
+        size_t start = ++i;
+        while (i < length && text[i] >= '0' && text[i] <= '9') {
+            i++;
+        }
+        if (i == start) {
+            return false;
+        }
+    }
+    if (i < length && (text[i] == 'e' || text[i] == 'E')) {
+        i++;
+        if (i < length && (text[i] == '+' || text[i] == '-')) {
+            i++;
+        }
+        size_t start = i;
+        while (i < length && text[i] >= '0' && text[i] <= '9') {
+            i++;
+        }
+        if (i == start) {
+            return false;
+        }
+    }
+    return i == length;
+}
+
+static neoc_error_t stream_number_done(neoc_json_stream_t *stream) {
+    if (!stream_number_valid(stream->text, stream->text_length)) {
+        return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Invalid JSON number");
+    }
+    if (stream_emit_text(stream, NEOC_JSON_EVENT_NUMBER) != NEOC_SUCCESS) {
+        return stream->status;
+    }
+    stream_value_done(stream);
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t stream_string_done(neoc_json_stream_t *stream) {
+    if (stream->token_is_key) {
+        if (stream_emit_text(stream, NEOC_JSON_EVENT_KEY) != NEOC_SUCCESS) {
+            return stream->status;
+        }
+        stream->token = STREAM_TOKEN_NONE;
+        stream->expect = STREAM_EXPECT_COLON;
+        return NEOC_SUCCESS;
+    }
+    if (stream_emit_text(stream, NEOC_JSON_EVENT_STRING) != NEOC_SUCCESS) {
+        return stream->status;
+    }
+    stream_value_done(stream);
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t stream_code_unit(neoc_json_stream_t *stream, uint32_t unit) {
+    uint32_t code_point = unit;
+    if (stream->high_surrogate) {
+        if (unit < 0xDC00 || unit > 0xDFFF) {
+            return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Unpaired UTF-16 surrogate in JSON string");
+        }
+        code_point = 0x10000 + ((stream->high_surrogate - 0xD800) << 10) + (unit - 0xDC00);
+        stream->high_surrogate = 0;
+    } else if (unit >= 0xD800 && unit <= 0xDBFF) {
+        stream->high_surrogate = unit;
+        return NEOC_SUCCESS;
+    } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
+        return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Unpaired UTF-16 surrogate in JSON string");
+    }
+
+    char utf8[4];
+    size_t length;
+    if (code_point < 0x80) {
+        utf8[0] = (char)code_point;
+        length = 1;
+    } else if (code_point < 0x800) {
+        utf8[0] = (char)(0xC0 | (code_point >> 6));
+        utf8[1] = (char)(0x80 | (code_point & 0x3F));
+        length = 2;
+    } else if (code_point < 0x10000) {
+        utf8[0] = (char)(0xE0 | (code_point >> 12));
+        utf8[1] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        utf8[2] = (char)(0x80 | (code_point & 0x3F));
+        length = 3;
+    } else {
+        utf8[0] = (char)(0xF0 | (code_point >> 18));
+        utf8[1] = (char)(0x80 | ((code_point >> 12) & 0x3F));
+        utf8[2] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        utf8[3] = (char)(0x80 | (code_point & 0x3F));
+        length = 4;
+    }
+    return stream_append(stream, utf8, length);
+}
+
+static int stream_hex_value(unsigned char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/* Consumes string bytes up to and including the closing quote */
+static size_t stream_scan_string(neoc_json_stream_t *stream, const char *data, size_t length) {
+    size_t i = 0;
+    while (i < length && stream->status == NEOC_SUCCESS) {
+        unsigned char c = (unsigned char)data[i];
+
+        if (stream->escape == STREAM_ESCAPE_NONE) {
+            if (stream->high_surrogate && c != '\\') {
+                stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Unpaired UTF-16 surrogate in JSON string");
+                break;
+            }
+            if (c == '"') {
+                stream_string_done(stream);
+                return i + 1;
+            }
+            if (c == '\\') {
+                stream->escape = STREAM_ESCAPE_BACKSLASH;
+                i++;
+                continue;
+            }
+            if (c < 0x20) {
+                stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Control character in JSON string");
+                break;
+            }
+            /* Copy the whole run of plain bytes at once */
+            size_t end = i + 1;
+            while (end < length) {
+                unsigned char r = (unsigned char)data[end];
+                if (r == '"' || r == '\\' || r < 0x20) {
+                    break;
+                }
+                end++;
+            }
+            stream_append(stream, data + i, end - i);
+            i = end;
+            continue;
+        }
+
+        i++;
+        if (stream->escape == STREAM_ESCAPE_BACKSLASH) {
+            if (c == 'u') {
+                stream->escape = STREAM_ESCAPE_UNICODE;
+                stream->unicode = 0;
+                stream->unicode_digits = 0;
+                continue;
+            }
+            if (stream->high_surrogate) {
+                stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Unpaired UTF-16 surrogate in JSON string");
+                break;
+            }
+            char out;
+            switch (c) {
+                case '"': out = '"'; break;
+                case '\\': out = '\\'; break;
+                case '/': out = '/'; break;
+                case 'b': out = '\b'; break;
+                case 'f': out = '\f'; break;
+                case 'n': out = '\n'; break;
+                case 'r': out = '\r'; break;
+                case 't': out = '\t'; break;
+                default:
+                    stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Invalid escape in JSON string");
+                    return i;
+            }
+            stream->escape = STREAM_ESCAPE_NONE;
+            stream_append(stream, &out, 1);
+            continue;
+        }
+
+        int digit = stream_hex_value(c);
+        if (digit < 0) {
+            stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Invalid \\u escape in JSON string");
+            break;
+        }
+        stream->unicode = (stream->unicode << 4) | (uint32_t)digit;
+        if (++stream->unicode_digits == 4) {
+            stream->escape = STREAM_ESCAPE_NONE;
+            stream_code_unit(stream, stream->unicode);
+        }
+    }
+    return i;
+}
+
+static neoc_error_t stream_open(neoc_json_stream_t *stream, char container) {
+    if (stream->depth >= NEOC_JSON_STREAM_MAX_DEPTH) {
+        return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "JSON nesting too deep");
+    }
+    if (stream->depth == stream->containers_capacity) {
+        size_t capacity = stream->containers_capacity ? stream->containers_capacity * 2 : 16;
+        char *containers = neoc_realloc(stream->containers, capacity);
+        if (!containers) {
+            return stream_fail(stream, NEOC_ERROR_MEMORY, "Failed to grow JSON nesting stack");
+        }
+        stream->containers = containers;
+        stream->containers_capacity = capacity;
+    }
+
+    neoc_json_event_type_t type = container == '{' ? NEOC_JSON_EVENT_OBJECT_START
+                                                   : NEOC_JSON_EVENT_ARRAY_START;
+    if (stream_emit(stream, type, NULL, 0, stream->depth) != NEOC_SUCCESS) {
+        return stream->status;
+    }
+    stream->containers[stream->depth++] = container;
+    stream->expect = container == '{' ? STREAM_EXPECT_KEY_OR_END : STREAM_EXPECT_VALUE_OR_END;
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t stream_close(neoc_json_stream_t *stream, char closer) {
+    char expected = closer == '}' ? '{' : '[';
+    if (stream->depth == 0 || stream->containers[stream->depth - 1] != expected) {
+        return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Mismatched JSON bracket");
+    }
+    stream->depth--;
+    neoc_json_event_type_t type = closer == '}' ? NEOC_JSON_EVENT_OBJECT_END
+                                                : NEOC_JSON_EVENT_ARRAY_END;
+    if (stream_emit(stream, type, NULL, 0, stream->depth) != NEOC_SUCCESS) {
+        return stream->status;
+    }
+    stream_value_done(stream);
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t stream_start_value(neoc_json_stream_t *stream, char c) {
+    stream->text_length = 0;
+    switch (c) {
+        case '{':
+        case '[':
+            return stream_open(stream, c);
+        case '"':
+            stream->token = STREAM_TOKEN_STRING;
+            stream->token_is_key = false;
+            return NEOC_SUCCESS;
+        case 't':
+            stream->literal = "true";
+            stream->literal_type = NEOC_JSON_EVENT_TRUE;
+            break;
+        case 'f':
+            stream->literal = "false";
+            stream->literal_type = NEOC_JSON_EVENT_FALSE;
+            break;
+        case 'n':
+            stream->literal = "null";
+            stream->literal_type = NEOC_JSON_EVENT_NULL;
+            break;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                stream->token = STREAM_TOKEN_NUMBER;
+                return stream_append(stream, &c, 1);
+            }
+            return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Unexpected character in JSON value");
+    }
+    stream->token = STREAM_TOKEN_LITERAL;
+    stream->literal_pos = 1;
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t stream_structural(neoc_json_stream_t *stream, char c) {
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        return NEOC_SUCCESS;
+    }
+
+    switch (stream->expect) {
+        case STREAM_EXPECT_NOTHING:
+            return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Unexpected data after JSON value");
+        case STREAM_EXPECT_COLON:
+            if (c != ':') {
+                return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Expected ':' in JSON object");
+            }
+            stream->expect = STREAM_EXPECT_VALUE;
+            return NEOC_SUCCESS;
+        case STREAM_EXPECT_KEY_OR_END:
+            if (c == '}') {
+                return stream_close(stream, c);
+            }
+            /* fall through */
+        case STREAM_EXPECT_KEY:
+            if (c != '"') {
+                return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Expected key in JSON object");
+            }
+            stream->token = STREAM_TOKEN_STRING;
+            stream->token_is_key = true;
+            stream->text_length = 0;
+            return NEOC_SUCCESS;
+        case STREAM_EXPECT_COMMA_OR_END:
+            if (c == ',') {
+                stream->expect = stream->containers[stream->depth - 1] == '{' ? STREAM_EXPECT_KEY
+                                                                              : STREAM_EXPECT_VALUE;
+                return NEOC_SUCCESS;
+            }
+            if (c == '}' || c == ']') {
+                return stream_close(stream, c);
+            }
+            return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Expected ',' or closing bracket in JSON");
+        case STREAM_EXPECT_VALUE_OR_END:
+            if (c == ']') {
+                return stream_close(stream, c);
+            }
+            /* fall through */
+        case STREAM_EXPECT_VALUE:
+        default:
+            return stream_start_value(stream, c);
+    }
+}
+
+neoc_error_t neoc_json_stream_create(neoc_json_event_handler_t handler,
+                                     void *user_data,
+                                     neoc_json_stream_t **stream) {
+    if (!handler || !stream) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    *stream = neoc_calloc(1, sizeof(neoc_json_stream_t));
+    if (!*stream) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate JSON stream");
+    }
+    (*stream)->handler = handler;
+    (*stream)->user_data = user_data;
+    (*stream)->status = NEOC_SUCCESS;
+    (*stream)->expect = STREAM_EXPECT_VALUE;
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_json_stream_feed(neoc_json_stream_t *stream, const char *data, size_t length) {
+    if (!stream || (!data && length > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    size_t i = 0;
+    while (i < length && stream->status == NEOC_SUCCESS) {
+        char c = data[i];
+        switch (stream->token) {
+            case STREAM_TOKEN_STRING:
+                i += stream_scan_string(stream, data + i, length - i);
+                break;
+            case STREAM_TOKEN_NUMBER:
+                if ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+                    stream_append(stream, &c, 1);
+                    i++;
+                } else {
+                    /* The terminating byte is structural; look at it again */
+                    stream_number_done(stream);
+                }
+                break;
+            case STREAM_TOKEN_LITERAL:
+                if (c != stream->literal[stream->literal_pos]) {
+                    stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Invalid JSON literal");
+                    break;
+                }
+                i++;
+                if (stream->literal[++stream->literal_pos] == '\0' &&
+                    stream_emit(stream, stream->literal_type, NULL, 0, stream->depth) == NEOC_SUCCESS) {
+                    stream_value_done(stream);
+                }
+                break;
+            case STREAM_TOKEN_NONE:
+            default:
+                stream_structural(stream, c);
+                i++;
+                break;
+        }
+    }
+    return stream->status;
+}
+
+neoc_error_t neoc_json_stream_finish(neoc_json_stream_t *stream) {
+    if (!stream) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (stream->status != NEOC_SUCCESS) {
+        return stream->status;
+    }
+
+    /* A root-level number only ends with the input */
+    if (stream->token == STREAM_TOKEN_NUMBER && stream_number_done(stream) != NEOC_SUCCESS) {
+        return stream->status;
+    }
+    if (stream->token != STREAM_TOKEN_NONE || stream->expect != STREAM_EXPECT_NOTHING) {
+        return stream_fail(stream, NEOC_ERROR_INVALID_FORMAT, "Unexpected end of JSON input");
+    }
+    return NEOC_SUCCESS;
+}
+
+void neoc_json_stream_free(neoc_json_stream_t *stream) {
+    if (!stream) {
+        return;
+    }
+    neoc_free(stream->text);
+    neoc_free(stream->containers);
+    neoc_free(stream);
+}
+
+/* ===== Element splitter ===== */
+
+#ifdef HAVE_CJSON
+
+typedef struct {
+    cJSON *node;
+    char *key;              /* Key in the parent object; skeleton containers only */
+    size_t path_index;
+    bool split;             /* Elements of this array go to the handler */
+    bool in_element;        /* Part of an element being built */
+    bool element_root;
+} splitter_frame_t;
+
+struct neoc_json_splitter {
+    neoc_json_stream_t *stream;
+    neoc_json_element_handler_t handler;
+    void *user_data;
+    char **paths;
+    size_t path_count;
+    cJSON *root;
+    splitter_frame_t *frames;
+    size_t depth;
+    size_t frames_capacity;
+    char *key;              /* Key of the next object member */
+    size_t key_capacity;
+};
+
+/* Whether the array about to open under the pending key is one of the split paths */
+static bool splitter_path_matches(const neoc_json_splitter_t *splitter, const char *path) {
+    const char *cursor = path;
+    for (size_t i = 1; i <= splitter->depth; i++) {
+        const char *key = i < splitter->depth ? splitter->frames[i].key : splitter->key;
+        if (!key) {
+            return false;
+        }
+        size_t length = strlen(key);
+        if (strncmp(cursor, key, length) != 0) {
+            return false;
+        }
+        cursor += length;
+        if (i < splitter->depth) {
+            if (*cursor != '.') {
+                return false;
+            }
+            cursor++;
+        }
+    }
+    return *cursor == '\0';
+}
+
+static neoc_error_t splitter_push(neoc_json_splitter_t *splitter, const splitter_frame_t *frame) {
+    if (splitter->depth == splitter->frames_capacity) {
+        size_t capacity = splitter->frames_capacity ? splitter->frames_capacity * 2 : 8;
+        splitter_frame_t *frames = neoc_realloc(splitter->frames, capacity * sizeof(splitter_frame_t));
+        if (!frames) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to grow JSON splitter stack");
+        }
+        splitter->frames = frames;
+        splitter->frames_capacity = capacity;
+    }
+    splitter->frames[splitter->depth++] = *frame;
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t splitter_attach(neoc_json_splitter_t *splitter, cJSON *node, bool container) {
+    splitter_frame_t frame = { node, NULL, 0, false, false, false };
+
+    if (splitter->depth == 0) {
+        splitter->root = node;
+        return container ? splitter_push(splitter, &frame) : NEOC_SUCCESS;
+    }
+
+    const splitter_frame_t *parent = &splitter->frames[splitter->depth - 1];
+    if (parent->split) {
+        if (!container) {
+            neoc_error_t err = splitter->handler(parent->path_index, node, splitter->user_data);
+            cJSON_Delete(node);
+            return err;
+        }
+        frame.path_index = parent->path_index;
+        frame.in_element = true;
+        frame.element_root = true;
+        neoc_error_t err = splitter_push(splitter, &frame);
+        if (err != NEOC_SUCCESS) {
+            cJSON_Delete(node);
+        }
+        return err;
+    }
+
+    bool in_object = cJSON_IsObject(parent->node);
+    if (in_object) {
+        cJSON_AddItemToObject(parent->node, splitter->key, node);
+    } else {
+        cJSON_AddItemToArray(parent->node, node);
+    }
+    if (!container) {
+        return NEOC_SUCCESS;
+    }
+
+    frame.in_element = parent->in_element;
+    if (!parent->in_element && in_object) {
+        if (cJSON_IsArray(node)) {
+            for (size_t i = 0; i < splitter->path_count; i++) {
+                if (splitter_path_matches(splitter, splitter->paths[i])) {
+                    frame.split = true;
+                    frame.path_index = i;
+                    break;
+                }
+            }
+        }
+        frame.key = neoc_strdup(splitter->key);
+        if (!frame.key) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to copy JSON key");
+        }
+    }
+    neoc_error_t err = splitter_push(splitter, &frame);
+    if (err != NEOC_SUCCESS) {
+        neoc_free(frame.key);
+    }
+    return err;
+}
+
+static neoc_error_t splitter_close(neoc_json_splitter_t *splitter) {
+    splitter_frame_t frame = splitter->frames[--splitter->depth];
+    neoc_free(frame.key);
+    if (!frame.element_root) {
+        return NEOC_SUCCESS;
+    }
+    neoc_error_t err = splitter->handler(frame.path_index, frame.node, splitter->user_data);
+    cJSON_Delete(frame.node);
+    return err;
+}
+
+static neoc_error_t splitter_set_key(neoc_json_splitter_t *splitter, const char *key, size_t length) {
+    if (length + 1 > splitter->key_capacity) {
+        size_t capacity = splitter->key_capacity ? splitter->key_capacity : 32;
+        while (capacity < length + 1) {
+            capacity *= 2;
+        }
+        char *buffer = neoc_realloc(splitter->key, capacity);
+        if (!buffer) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to grow JSON key buffer");
+        }
+        splitter->key = buffer;
+        splitter->key_capacity = capacity;
+    }
+    memcpy(splitter->key, key, length + 1);
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t splitter_on_event(const neoc_json_event_t *event, void *user_data) {
+    neoc_json_splitter_t *splitter = user_data;
+    cJSON *node = NULL;
+    bool container = false;
+
+    switch (event->type) {
+        case NEOC_JSON_EVENT_KEY:
+            return splitter_set_key(splitter, event->text, event->length);
+        case NEOC_JSON_EVENT_OBJECT_END:
+        case NEOC_JSON_EVENT_ARRAY_END:
+            return splitter_close(splitter);
+        case NEOC_JSON_EVENT_OBJECT_START:
+            node = cJSON_CreateObject();
+            container = true;
+            break;
+        case NEOC_JSON_EVENT_ARRAY_START:
+            node = cJSON_CreateArray();
+            container = true;
+            break;
+        case NEOC_JSON_EVENT_STRING:
+            node = cJSON_CreateString(event->text);
+            break;
+        case NEOC_JSON_EVENT_NUMBER:
+            node = cJSON_CreateNumber(strtod(event->text, NULL));
+            break;
+        case NEOC_JSON_EVENT_TRUE:
+            node = cJSON_CreateTrue();
+            break;
+        case NEOC_JSON_EVENT_FALSE:
+            node = cJSON_CreateFalse();
+            break;
+        case NEOC_JSON_EVENT_NULL:
+        default:
+            node = cJSON_CreateNull();
+            break;
+    }
+    if (!node) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate JSON node");
+    }
+    return splitter_attach(splitter, node, container);
+}
+
+neoc_error_t neoc_json_splitter_create(const char *const *paths,
+                                       size_t path_count,
+                                       neoc_json_element_handler_t handler,
+                                       void *user_data,
+                                       neoc_json_splitter_t **splitter) {
+    if ((!paths && path_count > 0) || !handler || !splitter) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    neoc_json_splitter_t *created = neoc_calloc(1, sizeof(neoc_json_splitter_t));
+    if (!created) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate JSON splitter");
+    }
+    created->handler = handler;
+    created->user_data = user_data;
+
+    if (path_count > 0) {
+        created->paths = neoc_calloc(path_count, sizeof(char *));
+        if (!created->paths) {
+            neoc_json_splitter_free(created);
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate JSON splitter paths");
+        }
+        created->path_count = path_count;
+        for (size_t i = 0; i < path_count; i++) {
+            created->paths[i] = paths[i] ? neoc_strdup(paths[i]) : NULL;
+            if (!created->paths[i]) {
+                neoc_json_splitter_free(created);
+                return neoc_error_set(paths[i] ? NEOC_ERROR_MEMORY : NEOC_ERROR_INVALID_ARGUMENT,
+                                      "Invalid JSON splitter path");
+            }
+        }
+    }
+
+    neoc_error_t err = neoc_json_stream_create(splitter_on_event, created, &created->stream);
+    if (err != NEOC_SUCCESS) {
+        neoc_json_splitter_free(created);
+        return err;
+    }
+
+    *splitter = created;
+    return NEOC_SUCCESS;
+}
+
+neoc_json_stream_t *neoc_json_splitter_stream(neoc_json_splitter_t *splitter) {
+    return splitter ? splitter->stream : NULL;
+}
+
+neoc_error_t neoc_json_splitter_finish(neoc_json_splitter_t *splitter, const neoc_json_t **skeleton) {
+    if (!splitter || !skeleton) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+
+    neoc_error_t err = neoc_json_stream_finish(splitter->stream);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    *skeleton = splitter->root;
+    return NEOC_SUCCESS;
+}
+
+void neoc_json_splitter_free(neoc_json_splitter_t *splitter) {
+    if (!splitter) {
+        return;
+    }
+
+    /* Elements still being built are not attached to the skeleton */
+    for (size_t i = 0; i < splitter->depth; i++) {
+        if (splitter->frames[i].element_root) {
+            cJSON_Delete(splitter->frames[i].node);
+        }
+        neoc_free(splitter->frames[i].key);
+    }
+    for (size_t i = 0; i < splitter->path_count; i++) {
+        neoc_free(splitter->paths[i]);
+    }
+    cJSON_Delete(splitter->root);
+    neoc_json_stream_free(splitter->stream);
+    neoc_free(splitter->frames);
+    neoc_free(splitter->paths);
+    neoc_free(splitter->key);
+    neoc_free(splitter);
+}
+
+#else /* HAVE_CJSON */
+
+neoc_error_t neoc_json_splitter_create(const char *const *paths,
+                                       size_t path_count,
+                                       neoc_json_element_handler_t handler,
+                                       void *user_data,
+                                       neoc_json_splitter_t **splitter) {
+    (void)paths; (void)path_count; (void)handler; (void)user_data; (void)splitter;
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "JSON support not compiled");
+}
+
+neoc_json_stream_t *neoc_json_splitter_stream(neoc_json_splitter_t *splitter) {
+    (void)splitter;
+    return NULL;
+}
+
+neoc_error_t neoc_json_splitter_finish(neoc_json_splitter_t *splitter, const neoc_json_t **skeleton) {
+    (void)splitter; (void)skeleton;
+    return neoc_error_set(NEOC_ERROR_NOT_IMPLEMENTED, "JSON support not compiled");
+}
+
+void neoc_json_splitter_free(neoc_json_splitter_t *splitter) {
+    (void)splitter;
+}
+
+#endif /* HAVE_CJSON */
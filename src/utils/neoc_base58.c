@@ -1,6 +1,12 @@
 /**
  * @file neoc_base58.c
  * @brief Base58 encoding/decoding utilities
+ *
+ * The codec works on 32-bit limbs in base 58^5, so every long division or
+ * multiply-add step moves five Base58 digits instead of one. Working
+ * buffers live on the stack up to a few hundred bytes of input. 25-byte
+ * payloads (version + script hash + checksum, i.e. every address) go
+ * through fixed-size routines with no length bookkeeping at all.
  */
 
 #include "neoc/utils/neoc_base58.h"
@@ -10,16 +16,161 @@
 
 const char NEOC_BASE58_ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
-static int neoc_base58_decode_char(char c) {
-    const char *position = strchr(NEOC_BASE58_ALPHABET, c);
-    if (!position) {
-        return -1;
+/* Digit value of each character, -1 outside the alphabet */
+static const int8_t neoc_base58_values[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8, -1, -1, -1, -1, -1, -1,
+    -1,  9, 10, 11, 12, 13, 14, 15, 16, -1, 17, 18, 19, 20, 21, -1,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, -1, -1, -1, -1, -1,
+    -1, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, -1, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+#define NEOC_BASE58_GROUP_DIGITS 5
+#define NEOC_BASE58_GROUP 656356768u  /* 58^5 */
+#define NEOC_BASE58_STACK_LIMBS 192
+#define NEOC_BASE58_STACK_BYTES 256
+#define NEOC_BASE58_ADDRESS_BYTES (NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH + NEOC_BASE58_CHECKSUM_LENGTH)
+#define NEOC_BASE58_ADDRESS_LIMBS 7
+
+/* 58^n for a leading group of n < 5 digits */
+static const uint32_t neoc_base58_powers[NEOC_BASE58_GROUP_DIGITS + 1] = {
+    1u, 58u, 3364u, 195112u, 11316496u, NEOC_BASE58_GROUP
+};
+
+static uint32_t neoc_base58_load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void neoc_base58_store_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/* Value of the next group of digits, or -1 on a character outside the alphabet */
+static int64_t neoc_base58_group_value(const char *digits, size_t count) {
+    uint32_t value = 0;
+    for (size_t k = 0; k < count; k++) {
+        int v = neoc_base58_values[(unsigned char)digits[k]];
+        if (v < 0) {
+            return -1;
+        }
+        value = value * 58 + (uint32_t)v;
+    }
+    return value;
+}
+
+/* Writes a group value as count digits, most significant first */
+static void neoc_base58_put_group(char *out, uint32_t value, size_t count) {
+    for (size_t k = count; k > 0; k--) {
+        out[k - 1] = NEOC_BASE58_ALPHABET[value % 58];
+        value /= 58;
+    }
+}
+
+/*
+ * Encodes a 25-byte payload. Seven 32-bit limbs (the first holding one
+ * byte) are divided by 58^5 seven times: 256^25 < 58^35, so that covers
+ * every value. Returns the encoded length, at most 35.
+ */
+static size_t neoc_base58_encode_25(const uint8_t in[NEOC_BASE58_ADDRESS_BYTES], char *out) {
+    uint32_t limbs[NEOC_BASE58_ADDRESS_LIMBS];
+    limbs[0] = in[0];
+    for (int i = 1; i < NEOC_BASE58_ADDRESS_LIMBS; i++) {
+        limbs[i] = neoc_base58_load_be32(in + 1 + 4 * (i - 1));
+    }
+
+    uint32_t groups[NEOC_BASE58_ADDRESS_LIMBS];
+    for (int g = NEOC_BASE58_ADDRESS_LIMBS - 1; g >= 0; g--) {
+        uint64_t rem = 0;
+        for (int i = 0; i < NEOC_BASE58_ADDRESS_LIMBS; i++) {
+            uint64_t cur = (rem << 32) | limbs[i];
+            limbs[i] = (uint32_t)(cur / NEOC_BASE58_GROUP);
+            rem = cur % NEOC_BASE58_GROUP;
+        }
+        groups[g] = (uint32_t)rem;
+    }
+
+    char digits[NEOC_BASE58_ADDRESS_LIMBS * NEOC_BASE58_GROUP_DIGITS];
+    for (int g = 0; g < NEOC_BASE58_ADDRESS_LIMBS; g++) {
+        neoc_base58_put_group(digits + NEOC_BASE58_GROUP_DIGITS * g, groups[g], NEOC_BASE58_GROUP_DIGITS);
+    }
+
+    size_t zeros = 0;
+    while (zeros < NEOC_BASE58_ADDRESS_BYTES && in[zeros] == 0) {
+        zeros++;
+    }
+    size_t first = 0;
+    while (first < sizeof(digits) && digits[first] == '1') {
+        first++;
+    }
+    memset(out, '1', zeros);
+    memcpy(out + zeros, digits + first, sizeof(digits) - first);
+    return zeros + sizeof(digits) - first;
+}
+
+/*
+ * Decodes exactly 25 bytes. Fails with INVALID_BASE58 on a character
+ * outside the alphabet and INVALID_FORMAT if the string does not encode a
+ * 25-byte value (too large, or leading '1's not matching leading zeros).
+ */
+static neoc_error_t neoc_base58_decode_25(const char *encoded, size_t len,
+                                          uint8_t out[NEOC_BASE58_ADDRESS_BYTES]) {
+    if (len == 0 || len > NEOC_BASE58_ADDRESS_MAX_LENGTH) {
+        return NEOC_ERROR_INVALID_FORMAT;
+    }
+
+    uint32_t limbs[NEOC_BASE58_ADDRESS_LIMBS] = { 0 };
+    size_t count = len % NEOC_BASE58_GROUP_DIGITS ? len % NEOC_BASE58_GROUP_DIGITS : NEOC_BASE58_GROUP_DIGITS;
+    for (size_t i = 0; i < len; i += count, count = NEOC_BASE58_GROUP_DIGITS) {
+        int64_t value = neoc_base58_group_value(encoded + i, count);
+        if (value < 0) {
+            return NEOC_ERROR_INVALID_BASE58;
+        }
+        uint64_t carry = (uint64_t)value;
+        for (int j = NEOC_BASE58_ADDRESS_LIMBS - 1; j >= 0; j--) {
+            uint64_t cur = (uint64_t)limbs[j] * neoc_base58_powers[count] + carry;
+            limbs[j] = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+        if (carry != 0) {
+            return NEOC_ERROR_INVALID_FORMAT;
+        }
+    }
+    if (limbs[0] > 0xFF) {
+        return NEOC_ERROR_INVALID_FORMAT;
     }
-    return (int)(position - NEOC_BASE58_ALPHABET);
+
+    out[0] = (uint8_t)limbs[0];
+    for (int i = 1; i < NEOC_BASE58_ADDRESS_LIMBS; i++) {
+        neoc_base58_store_be32(out + 1 + 4 * (i - 1), limbs[i]);
+    }
+
+    size_t ones = 0;
+    while (ones < len && encoded[ones] == '1') {
+        ones++;
+    }
+    size_t zeros = 0;
+    while (zeros < NEOC_BASE58_ADDRESS_BYTES && out[zeros] == 0) {
+        zeros++;
+    }
+    return ones == zeros ? NEOC_SUCCESS : NEOC_ERROR_INVALID_FORMAT;
 }
 
 bool neoc_base58_is_valid_char(char c) {
-    return strchr(NEOC_BASE58_ALPHABET, c) != NULL;
+    return neoc_base58_values[(unsigned char)c] >= 0;
 }
 
 bool neoc_base58_is_valid_string(const char *str) {
@@ -58,34 +209,84 @@ size_t neoc_base58_decode_buffer_size(const char *base58_string) {
     return zeros + estimated;
 }
 
-char* neoc_base58_encode_alloc(const uint8_t *data, size_t data_length) {
-    if (!data) {
-        neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+typedef neoc_error_t (*neoc_base58_encode_fn)(const uint8_t *data, size_t data_len,
+                                              char *buffer, size_t buffer_size);
+typedef neoc_error_t (*neoc_base58_decode_fn)(const char *encoded, uint8_t *buffer,
+                                              size_t buffer_size, size_t *decoded_length);
+
+/* Encodes on the stack when it fits so the result is allocated once, at its exact size */
+static char *neoc_base58_encode_alloc_with(neoc_base58_encode_fn encode, size_t buffer_size,
+                                           const uint8_t *data, size_t data_length) {
+    if (buffer_size > 2 * NEOC_BASE58_STACK_BYTES) {
+        char *buffer = neoc_malloc(buffer_size);
+        if (!buffer) {
+            neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 buffer");
+            return NULL;
+        }
+        if (encode(data, data_length, buffer, buffer_size) != NEOC_SUCCESS) {
+            neoc_free(buffer);
+            return NULL;
+        }
+        return buffer;
+    }
+
+    char stack_buffer[2 * NEOC_BASE58_STACK_BYTES];
+    if (encode(data, data_length, stack_buffer, buffer_size) != NEOC_SUCCESS) {
         return NULL;
     }
-    
-    size_t buffer_size = neoc_base58_encode_buffer_size(data_length);
-    char *buffer = neoc_malloc(buffer_size);
-    if (!buffer) {
+    size_t length = strlen(stack_buffer) + 1;
+    char *result = neoc_malloc(length);
+    if (!result) {
         neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 buffer");
         return NULL;
     }
-    
-    neoc_error_t err = neoc_base58_encode(data, data_length, buffer, buffer_size);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(buffer);
+    memcpy(result, stack_buffer, length);
+    return result;
+}
+
+static uint8_t *neoc_base58_decode_alloc_with(neoc_base58_decode_fn decode, size_t buffer_size,
+                                              const char *base58_string, size_t *decoded_length) {
+    size_t actual_length = 0;
+    if (buffer_size > NEOC_BASE58_STACK_BYTES) {
+        uint8_t *buffer = neoc_malloc(buffer_size);
+        if (!buffer) {
+            neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 decode buffer");
+            return NULL;
+        }
+        if (decode(base58_string, buffer, buffer_size, &actual_length) != NEOC_SUCCESS) {
+            neoc_free(buffer);
+            return NULL;
+        }
+        if (decoded_length) {
+            *decoded_length = actual_length;
+        }
+        return buffer;
+    }
+
+    uint8_t stack_buffer[NEOC_BASE58_STACK_BYTES];
+    if (decode(base58_string, stack_buffer, buffer_size, &actual_length) != NEOC_SUCCESS) {
         return NULL;
     }
-    
-    size_t actual_length = strlen(buffer) + 1;
-    if (actual_length < buffer_size) {
-        char *resized = neoc_realloc(buffer, actual_length);
-        if (resized) {
-            buffer = resized;
-        }
+    /* Keep the result non-NULL for an empty payload */
+    uint8_t *result = neoc_malloc(actual_length > 0 ? actual_length : 1);
+    if (!result) {
+        neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 decode buffer");
+        return NULL;
     }
-    
-    return buffer;
+    memcpy(result, stack_buffer, actual_length);
+    if (decoded_length) {
+        *decoded_length = actual_length;
+    }
+    return result;
+}
+
+char* neoc_base58_encode_alloc(const uint8_t *data, size_t data_length) {
+    if (!data) {
+        neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+        return NULL;
+    }
+    return neoc_base58_encode_alloc_with(neoc_base58_encode, neoc_base58_encode_buffer_size(data_length),
+                                         data, data_length);
 }
 
 uint8_t* neoc_base58_decode_alloc(const char *base58_string, size_t *decoded_length) {
@@ -99,32 +300,7 @@ uint8_t* neoc_base58_decode_alloc(const char *base58_string, size_t *decoded_len
         neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid Base58 input");
         return NULL;
     }
-    
-    uint8_t *buffer = neoc_malloc(buffer_size);
-    if (!buffer) {
-        neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 decode buffer");
-        return NULL;
-    }
-    
-    size_t actual_length = 0;
-    neoc_error_t err = neoc_base58_decode(base58_string, buffer, buffer_size, &actual_length);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(buffer);
-        return NULL;
-    }
-    
-    if (decoded_length) {
-        *decoded_length = actual_length;
-    }
-    
-    if (actual_length > 0 && actual_length < buffer_size) {
-        uint8_t *resized = neoc_realloc(buffer, actual_length);
-        if (resized) {
-            buffer = resized;
-        }
-    }
-    
-    return buffer;
+    return neoc_base58_decode_alloc_with(neoc_base58_decode, buffer_size, base58_string, decoded_length);
 }
 
 size_t neoc_base58_check_encode_buffer_size(size_t data_length) {
@@ -144,29 +320,9 @@ char* neoc_base58_check_encode_alloc(const uint8_t *data, size_t data_length) {
         neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
         return NULL;
     }
-    
-    size_t buffer_size = neoc_base58_check_encode_buffer_size(data_length);
-    char *buffer = neoc_malloc(buffer_size);
-    if (!buffer) {
-        neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58Check buffer");
-        return NULL;
-    }
-    
-    neoc_error_t err = neoc_base58_check_encode(data, data_length, buffer, buffer_size);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(buffer);
-        return NULL;
-    }
-    
-    size_t actual_length = strlen(buffer) + 1;
-    if (actual_length < buffer_size) {
-        char *resized = neoc_realloc(buffer, actual_length);
-        if (resized) {
-            buffer = resized;
-        }
-    }
-    
-    return buffer;
+    return neoc_base58_encode_alloc_with(neoc_base58_check_encode,
+                                         neoc_base58_check_encode_buffer_size(data_length),
+                                         data, data_length);
 }
 
 uint8_t* neoc_base58_check_decode_alloc(const char *base58_string, size_t *decoded_length) {
@@ -181,16 +337,10 @@ uint8_t* neoc_base58_check_decode_alloc(const char *base58_string, size_t *decod
         return NULL;
     }
     
-    uint8_t *buffer = neoc_malloc(buffer_size);
-    if (!buffer) {
-        neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58Check buffer");
-        return NULL;
-    }
-    
     size_t actual_length = 0;
-    neoc_error_t err = neoc_base58_check_decode(base58_string, buffer, buffer_size, &actual_length);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(buffer);
+    uint8_t *buffer = neoc_base58_decode_alloc_with(neoc_base58_check_decode, buffer_size,
+                                                    base58_string, &actual_length);
+    if (!buffer) {
         return NULL;
     }
     
@@ -203,14 +353,6 @@ uint8_t* neoc_base58_check_decode_alloc(const char *base58_string, size_t *decod
     if (decoded_length) {
         *decoded_length = actual_length;
     }
-    
-    if (actual_length > 0 && actual_length < buffer_size) {
-        uint8_t *resized = neoc_realloc(buffer, actual_length);
-        if (resized) {
-            buffer = resized;
-        }
-    }
-    
     return buffer;
 }
 
@@ -227,49 +369,97 @@ neoc_error_t neoc_base58_encode(const uint8_t *data, size_t data_len,
         buffer[0] = '\0';
         return NEOC_SUCCESS;
     }
+
+    if (data_len == NEOC_BASE58_ADDRESS_BYTES) {
+        char encoded[NEOC_BASE58_ADDRESS_MAX_LENGTH];
+        size_t length = neoc_base58_encode_25(data, encoded);
+        if (length + 1 > buffer_size) {
+            return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
+        }
+        memcpy(buffer, encoded, length);
+        buffer[length] = '\0';
+        return NEOC_SUCCESS;
+    }
     
     size_t zeros = 0;
     while (zeros < data_len && data[zeros] == 0) {
         ++zeros;
     }
     
-    size_t size = data_len * 138 / 100 + 1;
-    uint8_t *buf = neoc_calloc(size, 1);
-    if (!buf) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 buffer");
+    /*
+     * Big-endian 32-bit limbs of the value, then its base 58^5 groups,
+     * least significant first. Each group takes more than 29 bits off.
+     */
+    size_t bytes = data_len - zeros;
+    size_t limb_count = (bytes + 3) / 4;
+    size_t group_capacity = bytes * 8 / 29 + 1;
+    uint32_t stack_scratch[NEOC_BASE58_STACK_LIMBS];
+    uint32_t *scratch = stack_scratch;
+    if (limb_count + group_capacity > NEOC_BASE58_STACK_LIMBS) {
+        scratch = neoc_malloc((limb_count + group_capacity) * sizeof(uint32_t));
+        if (!scratch) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 buffer");
+        }
     }
+    uint32_t *limbs = scratch;
+    uint32_t *groups = scratch + limb_count;
 
-    size_t length = 0;
-    for (size_t i = zeros; i < data_len; ++i) {
-        int carry = data[i];
-        size_t j = 0;
-        for (; j < length || carry != 0; ++j) {
-            carry += 256 * buf[j];
-            buf[j] = (uint8_t)(carry % 58);
-            carry /= 58;
-            if (j >= length) {
-                length = j + 1;
-            }
+    const uint8_t *p = data + zeros;
+    size_t head = bytes - 4 * (limb_count > 0 ? limb_count - 1 : 0);
+    if (limb_count > 0) {
+        limbs[0] = 0;
+        for (size_t k = 0; k < head; k++) {
+            limbs[0] = (limbs[0] << 8) | *p++;
         }
     }
+    for (size_t i = 1; i < limb_count; i++, p += 4) {
+        limbs[i] = neoc_base58_load_be32(p);
+    }
 
-    size_t result_len = zeros + length;
+    size_t group_count = 0;
+    for (size_t start = 0; start < limb_count;) {
+        uint64_t rem = 0;
+        for (size_t i = start; i < limb_count; i++) {
+            uint64_t cur = (rem << 32) | limbs[i];
+            limbs[i] = (uint32_t)(cur / NEOC_BASE58_GROUP);
+            rem = cur % NEOC_BASE58_GROUP;
+        }
+        groups[group_count++] = (uint32_t)rem;
+        while (start < limb_count && limbs[start] == 0) {
+            ++start;
+        }
+    }
+
+    /* The last group is the nonzero top of the value; the others are full width */
+    size_t top_digits = 0;
+    if (group_count > 0) {
+        for (uint32_t v = groups[group_count - 1]; v != 0; v /= 58) {
+            ++top_digits;
+        }
+    }
+    size_t result_len = zeros + (group_count > 0 ? top_digits + NEOC_BASE58_GROUP_DIGITS * (group_count - 1) : 0);
     if (result_len + 1 > buffer_size) {
-        neoc_free(buf);
+        if (scratch != stack_scratch) {
+            neoc_free(scratch);
+        }
         return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
     }
 
-    size_t out_index = 0;
-    for (; out_index < zeros; ++out_index) {
-        buffer[out_index] = '1';
+    memset(buffer, '1', zeros);
+    char *out = buffer + zeros;
+    if (group_count > 0) {
+        neoc_base58_put_group(out, groups[group_count - 1], top_digits);
+        out += top_digits;
+        for (size_t g = group_count - 1; g > 0; g--) {
+            neoc_base58_put_group(out, groups[g - 1], NEOC_BASE58_GROUP_DIGITS);
+            out += NEOC_BASE58_GROUP_DIGITS;
+        }
     }
+    *out = '\0';
 
-    for (size_t k = 0; k < length; ++k) {
-        buffer[out_index + k] = NEOC_BASE58_ALPHABET[buf[length - 1 - k]];
+    if (scratch != stack_scratch) {
+        neoc_free(scratch);
     }
-    out_index += length;
-    buffer[out_index] = '\0';
-    neoc_free(buf);
     return NEOC_SUCCESS;
 }
 
@@ -285,52 +475,70 @@ neoc_error_t neoc_base58_decode(const char *encoded, uint8_t *buffer,
         ++zeros;
     }
 
-    size_t size = encoded_len * 733 / 1000 + 1;
-    uint8_t *buf = neoc_calloc(size, 1);
-    if (!buf) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 buffer");
+    /* Little-endian 32-bit limbs, grown by one multiply-add per five digits */
+    size_t digits = encoded_len - zeros;
+    size_t limb_capacity = (digits * 733 / 1000 + 1) / 4 + 1;
+    uint32_t stack_limbs[NEOC_BASE58_STACK_LIMBS];
+    uint32_t *limbs = stack_limbs;
+    if (limb_capacity > NEOC_BASE58_STACK_LIMBS) {
+        limbs = neoc_malloc(limb_capacity * sizeof(uint32_t));
+        if (!limbs) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate Base58 buffer");
+        }
     }
 
-    size_t length = 0;
-    for (size_t i = zeros; i < encoded_len; ++i) {
-        int carry = neoc_base58_decode_char(encoded[i]);
-        if (carry < 0) {
-            neoc_free(buf);
+    size_t used = 0;
+    size_t count = digits % NEOC_BASE58_GROUP_DIGITS ? digits % NEOC_BASE58_GROUP_DIGITS : NEOC_BASE58_GROUP_DIGITS;
+    for (size_t i = zeros; i < encoded_len; i += count, count = NEOC_BASE58_GROUP_DIGITS) {
+        int64_t value = neoc_base58_group_value(encoded + i, count);
+        if (value < 0) {
+            if (limbs != stack_limbs) {
+                neoc_free(limbs);
+            }
             return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid base58 character");
         }
-
-        size_t j = 0;
-        for (; j < length || carry != 0; ++j) {
-            carry += 58 * buf[j];
-            buf[j] = (uint8_t)(carry % 256);
-            carry >>= 8;
-            if (j >= length) {
-                length = j + 1;
-            }
+        uint64_t carry = (uint64_t)value;
+        for (size_t j = 0; j < used; j++) {
+            uint64_t cur = (uint64_t)limbs[j] * neoc_base58_powers[count] + carry;
+            limbs[j] = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+        if (carry != 0) {
+            limbs[used++] = (uint32_t)carry;
         }
     }
 
-    size_t skip = 0;
-    while (skip < length && buf[length - 1 - skip] == 0) {
-        ++skip;
+    size_t top_bytes = 0;
+    if (used > 0) {
+        uint32_t top = limbs[used - 1];
+        top_bytes = (top >> 24) ? 4 : (top >> 16) ? 3 : (top >> 8) ? 2 : 1;
     }
-
-    size_t result_len = zeros + (length - skip);
+    size_t result_len = zeros + (used > 0 ? top_bytes + 4 * (used - 1) : 0);
     if (buffer_size < result_len) {
-        neoc_free(buf);
+        if (limbs != stack_limbs) {
+            neoc_free(limbs);
+        }
         return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
     }
 
     memset(buffer, 0, zeros);
-    for (size_t k = 0; k < length - skip; ++k) {
-        buffer[zeros + k] = buf[length - 1 - k];
+    uint8_t *out = buffer + zeros;
+    if (used > 0) {
+        for (size_t k = top_bytes; k > 0; k--) {
+            *out++ = (uint8_t)(limbs[used - 1] >> (8 * (k - 1)));
+        }
+        for (size_t j = used - 1; j > 0; j--, out += 4) {
+            neoc_base58_store_be32(out, limbs[j - 1]);
+        }
     }
 
     if (decoded_length) {
         *decoded_length = result_len;
     }
 
-    neoc_free(buf);
+    if (limbs != stack_limbs) {
+        neoc_free(limbs);
+    }
     return NEOC_SUCCESS;
 }
 
@@ -340,26 +548,27 @@ neoc_error_t neoc_base58_check_encode(const uint8_t *data, size_t data_len,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
     }
     
-    // Add checksum
-    uint8_t hash[32];
-    neoc_error_t err = neoc_sha256_double(data, data_len, hash);
-    if (err != NEOC_SUCCESS) {
-        return err;
+    uint8_t stack_payload[NEOC_BASE58_STACK_BYTES];
+    uint8_t *payload = stack_payload;
+    if (data_len > sizeof(stack_payload) - NEOC_BASE58_CHECKSUM_LENGTH) {
+        payload = neoc_malloc(data_len + NEOC_BASE58_CHECKSUM_LENGTH);
+        if (!payload) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate data with checksum");
+        }
     }
     
     // Append checksum
-    uint8_t *data_with_checksum = neoc_malloc(data_len + 4);
-    if (!data_with_checksum) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate data with checksum");
+    uint8_t hash[32];
+    neoc_error_t err = neoc_sha256_double(data, data_len, hash);
+    if (err == NEOC_SUCCESS) {
+        memcpy(payload, data, data_len);
+        memcpy(payload + data_len, hash, NEOC_BASE58_CHECKSUM_LENGTH);
+        err = neoc_base58_encode(payload, data_len + NEOC_BASE58_CHECKSUM_LENGTH, buffer, buffer_size);
     }
     
-    memcpy(data_with_checksum, data, data_len);
-    memcpy(data_with_checksum + data_len, hash, 4);
-    
-    // Encode with checksum
-    err = neoc_base58_encode(data_with_checksum, data_len + 4, buffer, buffer_size);
-    neoc_free(data_with_checksum);
-    
+    if (payload != stack_payload) {
+        neoc_free(payload);
+    }
     return err;
 }
 
@@ -374,50 +583,111 @@ neoc_error_t neoc_base58_check_decode(const char *encoded, uint8_t *buffer,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid Base58 input");
     }
 
-    uint8_t *temp_buffer = neoc_malloc(temp_size);
-    if (!temp_buffer) {
-        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate temp buffer");
+    uint8_t stack_buffer[NEOC_BASE58_STACK_BYTES];
+    uint8_t *temp_buffer = stack_buffer;
+    if (temp_size > sizeof(stack_buffer)) {
+        temp_buffer = neoc_malloc(temp_size);
+        if (!temp_buffer) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate temp buffer");
+        }
     }
     
     size_t temp_len = 0;
     neoc_error_t err = neoc_base58_decode(encoded, temp_buffer, temp_size, &temp_len);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(temp_buffer);
-        return err;
-    }
-    
-    if (temp_len < 4) {
-        neoc_free(temp_buffer);
-        return neoc_error_set(NEOC_ERROR_INVALID_SIZE, "Decoded data too short for checksum");
+    if (err == NEOC_SUCCESS && temp_len < NEOC_BASE58_CHECKSUM_LENGTH) {
+        err = neoc_error_set(NEOC_ERROR_INVALID_SIZE, "Decoded data too short for checksum");
     }
     
     // Verify checksum
+    size_t result_len = temp_len - NEOC_BASE58_CHECKSUM_LENGTH;
     uint8_t hash[32];
-    err = neoc_sha256_double(temp_buffer, temp_len - 4, hash);
-    if (err != NEOC_SUCCESS) {
-        neoc_free(temp_buffer);
-        return err;
+    if (err == NEOC_SUCCESS) {
+        err = neoc_sha256_double(temp_buffer, result_len, hash);
+    }
+    if (err == NEOC_SUCCESS && memcmp(temp_buffer + result_len, hash, NEOC_BASE58_CHECKSUM_LENGTH) != 0) {
+        err = neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Checksum verification failed");
+    }
+    if (err == NEOC_SUCCESS && buffer_size < result_len) {
+        err = neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
     }
     
-    if (memcmp(temp_buffer + temp_len - 4, hash, 4) != 0) {
-        neoc_free(temp_buffer);
-        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Checksum verification failed");
+    // Copy data without checksum
+    if (err == NEOC_SUCCESS) {
+        memcpy(buffer, temp_buffer, result_len);
+        if (decoded_length) {
+            *decoded_length = result_len;
+        }
     }
     
-    // Check buffer size
-    size_t result_len = temp_len - 4;
-    if (buffer_size < result_len) {
+    if (temp_buffer != stack_buffer) {
         neoc_free(temp_buffer);
+    }
+    return err;
+}
+
+neoc_error_t neoc_base58_check_encode_address(uint8_t version,
+                                             const uint8_t script_hash[NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH - 1],
+                                             char *buffer, size_t buffer_size) {
+    if (!script_hash || !buffer) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+    }
+
+    uint8_t payload[NEOC_BASE58_ADDRESS_BYTES];
+    payload[0] = version;
+    memcpy(payload + 1, script_hash, NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH - 1);
+    uint8_t hash[32];
+    neoc_error_t err = neoc_sha256_double(payload, NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH, hash);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    memcpy(payload + NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH, hash, NEOC_BASE58_CHECKSUM_LENGTH);
+
+    char encoded[NEOC_BASE58_ADDRESS_MAX_LENGTH];
+    size_t length = neoc_base58_encode_25(payload, encoded);
+    if (buffer_size <= length) {
         return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
     }
-    
-    // Copy data without checksum
-    memcpy(buffer, temp_buffer, result_len);
-    neoc_free(temp_buffer);
-    
-    if (decoded_length) {
-        *decoded_length = result_len;
+    memcpy(buffer, encoded, length);
+    buffer[length] = '\0';
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_base58_check_decode_address(const char *address, uint8_t *version,
+                                             uint8_t script_hash[NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH - 1]) {
+    if (!address || !script_hash) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
     }
-    
+
+    /* Only look one character past the longest possible address */
+    size_t length = 0;
+    while (length <= NEOC_BASE58_ADDRESS_MAX_LENGTH && address[length] != '\0') {
+        ++length;
+    }
+    if (length > NEOC_BASE58_ADDRESS_MAX_LENGTH) {
+        return neoc_base58_is_valid_string(address)
+            ? neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Not a Base58Check address")
+            : neoc_error_set(NEOC_ERROR_INVALID_BASE58, "Invalid base58 character");
+    }
+
+    uint8_t payload[NEOC_BASE58_ADDRESS_BYTES];
+    neoc_error_t err = neoc_base58_decode_25(address, length, payload);
+    if (err != NEOC_SUCCESS) {
+        return neoc_error_set(err, err == NEOC_ERROR_INVALID_BASE58 ? "Invalid base58 character"
+                                                                    : "Not a Base58Check address");
+    }
+
+    uint8_t hash[32];
+    err = neoc_sha256_double(payload, NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH, hash);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    if (memcmp(payload + NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH, hash, NEOC_BASE58_CHECKSUM_LENGTH) != 0) {
+        return neoc_error_set(NEOC_ERROR_INVALID_BASE58, "Checksum verification failed");
+    }
+
+    if (version) {
+        *version = payload[0];
+    }
+    memcpy(script_hash, payload + 1, NEOC_BASE58_ADDRESS_PAYLOAD_LENGTH - 1);
     return NEOC_SUCCESS;
 }
@@ -0,0 +1,62 @@
+/**
+ * @file neoc_cpu_features.c
+ * @brief Runtime detection of the x86 instruction sets used by the SIMD paths
+ */
+
+#include "neoc/utils/neoc_cpu_features.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NEOC_CPU_X86 1
+#include <cpuid.h>
+#endif
+
+#define NEOC_CPU_FEATURES_UNKNOWN (-1)
+
+static atomic_int neoc_cpu_feature_cache = NEOC_CPU_FEATURES_UNKNOWN;
+
+unsigned int neoc_cpu_features(void) {
+    int cached = atomic_load_explicit(&neoc_cpu_feature_cache, memory_order_relaxed);
+    if (cached != NEOC_CPU_FEATURES_UNKNOWN) {
+        return (unsigned int)cached;
+    }
+
+    unsigned int features = 0;
+#ifdef NEOC_CPU_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        bool sse2 = (edx & (1u << 26)) != 0;
+        bool ssse3 = (ecx & (1u << 9)) != 0;
+        bool sse41 = (ecx & (1u << 19)) != 0;
+        bool osxsave = (ecx & (1u << 27)) != 0;
+        bool avx = (ecx & (1u << 28)) != 0;
+
+        if (sse2) {
+            features |= NEOC_CPU_FEATURE_SSE2;
+        }
+
+        /* AVX registers are only usable if the OS saves them (XCR0 bits 1-2) */
+        bool ymm_enabled = false;
+        if (osxsave && avx) {
+            unsigned int xcr0_lo, xcr0_hi;
+            __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+            ymm_enabled = (xcr0_lo & 6u) == 6u;
+        }
+
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            if (ymm_enabled && (ebx & (1u << 5))) {
+                features |= NEOC_CPU_FEATURE_AVX2;
+            }
+            if (ssse3 && sse41 && (ebx & (1u << 29))) {
+                features |= NEOC_CPU_FEATURE_SHANI;
+            }
+        }
+    }
+#endif
+
+    /* Every thread computes the same value, so a racing store is harmless */
+    atomic_store_explicit(&neoc_cpu_feature_cache, (int)features, memory_order_relaxed);
+    return features;
+}
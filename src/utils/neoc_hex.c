@@ -5,10 +5,201 @@
 
 #include "neoc/utils/neoc_hex.h"
 #include "neoc/neoc_memory.h"
+#include "neoc/serialization/binary_writer.h"
+#include "neoc/utils/neoc_cpu_features.h"
 #include <string.h>
-#include <stdio.h>
 #include <ctype.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NEOC_HEX_X86 1
+#include <immintrin.h>
+#endif
+
+#define NEOC_HEX_STREAM_CHUNK 256
+
+static const char neoc_hex_digits_lower[16] = "0123456789abcdef";
+static const char neoc_hex_digits_upper[16] = "0123456789ABCDEF";
+
+/* Nibble value of each hex character with bit 4 set; 0 for anything else */
+static const uint8_t neoc_hex_values[256] = {
+    ['0'] = 0x10, ['1'] = 0x11, ['2'] = 0x12, ['3'] = 0x13, ['4'] = 0x14,
+    ['5'] = 0x15, ['6'] = 0x16, ['7'] = 0x17, ['8'] = 0x18, ['9'] = 0x19,
+    ['a'] = 0x1a, ['b'] = 0x1b, ['c'] = 0x1c, ['d'] = 0x1d, ['e'] = 0x1e, ['f'] = 0x1f,
+    ['A'] = 0x1a, ['B'] = 0x1b, ['C'] = 0x1c, ['D'] = 0x1d, ['E'] = 0x1e, ['F'] = 0x1f
+};
+
+#ifdef NEOC_HEX_X86
+
+/* 16 bytes to 32 characters; SSE2 is baseline on x86-64 but not on i386 */
+__attribute__((target("sse2")))
+static void neoc_hex_encode_sse2(const uint8_t *data, char *out, bool uppercase) {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i alpha = _mm_set1_epi8(uppercase ? 'A' - '0' - 10 : 'a' - '0' - 10);
+
+    __m128i x = _mm_loadu_si128((const __m128i *)data);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+    __m128i lo = _mm_and_si128(x, mask);
+    hi = _mm_add_epi8(_mm_add_epi8(hi, zero), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), alpha));
+    lo = _mm_add_epi8(_mm_add_epi8(lo, zero), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), alpha));
+    _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i *)(out + 16), _mm_unpackhi_epi8(hi, lo));
+}
+
+/*
+ * Nibble values of 16 characters, or false if any is not a hex digit.
+ * Characters >= 0x80 are negative as signed bytes and fail both ranges.
+ */
+__attribute__((target("sse2")))
+static bool neoc_hex_values_sse2(__m128i c, __m128i *values) {
+    __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    if (_mm_movemask_epi8(_mm_or_si128(digit, alpha)) != 0xFFFF) {
+        return false;
+    }
+    *values = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+                           _mm_and_si128(alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+    return true;
+}
+
+/* 32 characters to 16 bytes; out may overlap hex at or below it */
+__attribute__((target("sse2")))
+static bool neoc_hex_decode_sse2(const char *hex, uint8_t *out) {
+    __m128i a, b;
+    if (!neoc_hex_values_sse2(_mm_loadu_si128((const __m128i *)hex), &a) ||
+        !neoc_hex_values_sse2(_mm_loadu_si128((const __m128i *)(hex + 16)), &b)) {
+        return false;
+    }
+    /* Each 16-bit lane holds high nibble in its low byte, low nibble above */
+    const __m128i low_byte = _mm_set1_epi16(0x00FF);
+    a = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(a, low_byte), 4), _mm_srli_epi16(a, 8));
+    b = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b, low_byte), 4), _mm_srli_epi16(b, 8));
+    _mm_storeu_si128((__m128i *)out, _mm_packus_epi16(a, b));
+    return true;
+}
+
+/* 32 bytes to 64 characters */
+__attribute__((target("avx2")))
+static void neoc_hex_encode_avx2(const uint8_t *data, char *out, bool uppercase) {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i zero = _mm256_set1_epi8('0');
+    const __m256i alpha = _mm256_set1_epi8(uppercase ? 'A' - '0' - 10 : 'a' - '0' - 10);
+
+    __m256i x = _mm256_loadu_si256((const __m256i *)data);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), mask);
+    __m256i lo = _mm256_and_si256(x, mask);
+    hi = _mm256_add_epi8(_mm256_add_epi8(hi, zero), _mm256_and_si256(_mm256_cmpgt_epi8(hi, nine), alpha));
+    lo = _mm256_add_epi8(_mm256_add_epi8(lo, zero), _mm256_and_si256(_mm256_cmpgt_epi8(lo, nine), alpha));
+    /* The unpacks work within 128-bit halves, so swap the middle quarters back */
+    __m256i first = _mm256_unpacklo_epi8(hi, lo);
+    __m256i second = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256((__m256i *)out, _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256((__m256i *)(out + 32), _mm256_permute2x128_si256(first, second, 0x31));
+}
+
+__attribute__((target("avx2")))
+static bool neoc_hex_values_avx2(__m256i c, __m256i *values) {
+    __m256i lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+    __m256i digit = _mm256_andnot_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('9')),
+                                        _mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)));
+    __m256i alpha = _mm256_andnot_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('f')),
+                                        _mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)));
+    if (_mm256_movemask_epi8(_mm256_or_si256(digit, alpha)) != -1) {
+        return false;
+    }
+    *values = _mm256_or_si256(_mm256_and_si256(digit, _mm256_sub_epi8(c, _mm256_set1_epi8('0'))),
+                              _mm256_and_si256(alpha, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+    return true;
+}
+
+/* 64 characters to 32 bytes */
+__attribute__((target("avx2")))
+static bool neoc_hex_decode_avx2(const char *hex, uint8_t *out) {
+    __m256i a, b;
+    if (!neoc_hex_values_avx2(_mm256_loadu_si256((const __m256i *)hex), &a) ||
+        !neoc_hex_values_avx2(_mm256_loadu_si256((const __m256i *)(hex + 32)), &b)) {
+        return false;
+    }
+    const __m256i low_byte = _mm256_set1_epi16(0x00FF);
+    a = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(a, low_byte), 4), _mm256_srli_epi16(a, 8));
+    b = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b, low_byte), 4), _mm256_srli_epi16(b, 8));
+    /* packus interleaves the 128-bit halves of a and b; restore the order */
+    _mm256_storeu_si256((__m256i *)out, _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    return true;
+}
+
+#endif /* NEOC_HEX_X86 */
+
+/* Encodes len bytes as 2 * len characters, no prefix or terminator */
+static void neoc_hex_encode_span(const uint8_t *data, size_t len, char *out, bool uppercase) {
+    size_t i = 0;
+#ifdef NEOC_HEX_X86
+    unsigned int features = len >= 16 ? neoc_cpu_features() : 0;
+    if (len >= 32 && (features & NEOC_CPU_FEATURE_AVX2)) {
+        for (; i + 32 <= len; i += 32) {
+            neoc_hex_encode_avx2(data + i, out + 2 * i, uppercase);
+        }
+    }
+    if (features & NEOC_CPU_FEATURE_SSE2) {
+        for (; i + 16 <= len; i += 16) {
+            neoc_hex_encode_sse2(data + i, out + 2 * i, uppercase);
+        }
+    }
+#endif
+    const char *digits = uppercase ? neoc_hex_digits_upper : neoc_hex_digits_lower;
+    for (; i < len; i++) {
+        out[2 * i] = digits[data[i] >> 4];
+        out[2 * i + 1] = digits[data[i] & 0x0F];
+    }
+}
+
+/*
+ * Decodes 2 * len characters into len bytes, false on a non-hex character.
+ * Every block is read before it is written and out never runs ahead of
+ * hex, so out == (uint8_t *)hex decodes in place.
+ */
+static bool neoc_hex_decode_span(const char *hex, size_t len, uint8_t *out) {
+    size_t i = 0;
+#ifdef NEOC_HEX_X86
+    unsigned int features = len >= 16 ? neoc_cpu_features() : 0;
+    if (len >= 32 && (features & NEOC_CPU_FEATURE_AVX2)) {
+        for (; i + 32 <= len; i += 32) {
+            if (!neoc_hex_decode_avx2(hex + 2 * i, out + i)) {
+                return false;
+            }
+        }
+    }
+    if (features & NEOC_CPU_FEATURE_SSE2) {
+        for (; i + 16 <= len; i += 16) {
+            if (!neoc_hex_decode_sse2(hex + 2 * i, out + i)) {
+                return false;
+            }
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        uint8_t high = neoc_hex_values[(unsigned char)hex[2 * i]];
+        uint8_t low = neoc_hex_values[(unsigned char)hex[2 * i + 1]];
+        if (!(high & low & 0x10)) {
+            return false;
+        }
+        out[i] = (uint8_t)((high << 4) | (low & 0x0F));
+    }
+    return true;
+}
+
+static const char* neoc_hex_skip_prefix(const char *hex_string) {
+    if (hex_string && hex_string[0] == '0' && (hex_string[1] == 'x' || hex_string[1] == 'X')) {
+        return hex_string + 2;
+    }
+    return hex_string;
+}
+
 neoc_error_t neoc_hex_encode(const uint8_t *data, size_t data_length, 
                             char *buffer, size_t buffer_size,
                             bool uppercase, bool include_prefix) {
@@ -17,23 +208,16 @@ neoc_error_t neoc_hex_encode(const uint8_t *data, size_t data_length,
     }
     
     size_t prefix_len = include_prefix ? 2 : 0;
-    size_t required_size = prefix_len + data_length * 2 + 1;
-    
-    if (buffer_size < required_size) {
+    if (data_length > (SIZE_MAX - prefix_len - 1) / 2 ||
+        buffer_size < prefix_len + data_length * 2 + 1) {
         return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
     }
     
-    size_t offset = 0;
     if (include_prefix) {
         buffer[0] = '0';
         buffer[1] = 'x';
-        offset = 2;
-    }
-    
-    const char* format = uppercase ? "%02X" : "%02x";
-    for (size_t i = 0; i < data_length; i++) {
-        sprintf(buffer + offset + (i * 2), format, data[i]);
     }
+    neoc_hex_encode_span(data, data_length, buffer + prefix_len, uppercase);
     buffer[prefix_len + data_length * 2] = '\0';
     
     return NEOC_SUCCESS;
@@ -45,13 +229,7 @@ neoc_error_t neoc_hex_decode(const char *hex_string, uint8_t *buffer,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
     }
     
-    // Skip "0x" prefix if present
-    const char* hex = hex_string;
-    if (strlen(hex_string) >= 2 && hex_string[0] == '0' && 
-        (hex_string[1] == 'x' || hex_string[1] == 'X')) {
-        hex = hex_string + 2;
-    }
-    
+    const char* hex = neoc_hex_skip_prefix(hex_string);
     size_t hex_len = strlen(hex);
     if (hex_len % 2 != 0) {
         return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Hex string must have even length");
@@ -62,23 +240,8 @@ neoc_error_t neoc_hex_decode(const char *hex_string, uint8_t *buffer,
         return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
     }
     
-    for (size_t i = 0; i < output_len; i++) {
-        char high = hex[i * 2];
-        char low = hex[i * 2 + 1];
-        
-        int high_val = (high >= '0' && high <= '9') ? high - '0' :
-                      (high >= 'a' && high <= 'f') ? high - 'a' + 10 :
-                      (high >= 'A' && high <= 'F') ? high - 'A' + 10 : -1;
-        
-        int low_val = (low >= '0' && low <= '9') ? low - '0' :
-                     (low >= 'a' && low <= 'f') ? low - 'a' + 10 :
-                     (low >= 'A' && low <= 'F') ? low - 'A' + 10 : -1;
-        
-        if (high_val == -1 || low_val == -1) {
-            return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid hex character");
-        }
-        
-        buffer[i] = (uint8_t)((high_val << 4) | low_val);
+    if (!neoc_hex_decode_span(hex, output_len, buffer)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid hex character");
     }
     
     if (decoded_length) {
@@ -88,6 +251,108 @@ neoc_error_t neoc_hex_decode(const char *hex_string, uint8_t *buffer,
     return NEOC_SUCCESS;
 }
 
+neoc_error_t neoc_hex_encode_in_place(uint8_t *buffer, size_t data_length,
+                                      size_t buffer_size, bool uppercase) {
+    if (!buffer) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+    }
+    if (data_length > (SIZE_MAX - 1) / 2 || buffer_size < data_length * 2 + 1) {
+        return neoc_error_set(NEOC_ERROR_BUFFER_TOO_SMALL, "Buffer too small");
+    }
+
+    /*
+     * Work from the end: the characters for byte i land at 2i and 2i + 1,
+     * never below i, so nothing unread is overwritten. Blocks are loaded
+     * before they are stored, which covers the overlap inside a block.
+     */
+    char *out = (char *)buffer;
+    out[data_length * 2] = '\0';
+    size_t whole = data_length - data_length % 16;
+    for (size_t i = data_length; i > whole; i--) {
+        uint8_t byte = buffer[i - 1];
+        const char *digits = uppercase ? neoc_hex_digits_upper : neoc_hex_digits_lower;
+        out[2 * (i - 1)] = digits[byte >> 4];
+        out[2 * (i - 1) + 1] = digits[byte & 0x0F];
+    }
+    for (size_t i = whole; i > 0; i -= 16) {
+        uint8_t block[16];
+        memcpy(block, buffer + i - 16, sizeof(block));
+        neoc_hex_encode_span(block, sizeof(block), out + 2 * (i - 16), uppercase);
+    }
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_hex_decode_in_place(char *hex_string, size_t *decoded_length) {
+    if (!hex_string) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+    }
+
+    const char *hex = neoc_hex_skip_prefix(hex_string);
+    size_t hex_len = strlen(hex);
+    if (hex_len % 2 != 0) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Hex string must have even length");
+    }
+    if (!neoc_hex_decode_span(hex, hex_len / 2, (uint8_t *)hex_string)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid hex character");
+    }
+    if (decoded_length) {
+        *decoded_length = hex_len / 2;
+    }
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_hex_encode_to_writer(neoc_binary_writer_t *writer,
+                                       const uint8_t *data, size_t data_length,
+                                       bool uppercase) {
+    if (!writer || (!data && data_length > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+    }
+
+    char chunk[2 * NEOC_HEX_STREAM_CHUNK];
+    for (size_t i = 0; i < data_length; i += NEOC_HEX_STREAM_CHUNK) {
+        size_t n = data_length - i < NEOC_HEX_STREAM_CHUNK ? data_length - i : NEOC_HEX_STREAM_CHUNK;
+        neoc_hex_encode_span(data + i, n, chunk, uppercase);
+        neoc_error_t err = neoc_binary_writer_write_bytes(writer, (const uint8_t *)chunk, 2 * n);
+        if (err != NEOC_SUCCESS) {
+            return err;
+        }
+    }
+    return NEOC_SUCCESS;
+}
+
+neoc_error_t neoc_hex_decode_to_writer(neoc_binary_writer_t *writer,
+                                       const char *hex, size_t hex_length) {
+    if (!writer || (!hex && hex_length > 0)) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid parameters");
+    }
+    if (hex_length >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) {
+        hex += 2;
+        hex_length -= 2;
+    }
+    if (hex_length % 2 != 0) {
+        return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Hex string must have even length");
+    }
+
+    /* Validate everything before writing so a bad character leaves the writer untouched */
+    uint8_t chunk[NEOC_HEX_STREAM_CHUNK];
+    size_t total = hex_length / 2;
+    for (size_t i = 0; i < total; i += NEOC_HEX_STREAM_CHUNK) {
+        size_t n = total - i < NEOC_HEX_STREAM_CHUNK ? total - i : NEOC_HEX_STREAM_CHUNK;
+        if (!neoc_hex_decode_span(hex + 2 * i, n, chunk)) {
+            return neoc_error_set(NEOC_ERROR_INVALID_FORMAT, "Invalid hex character");
+        }
+    }
+    for (size_t i = 0; i < total; i += NEOC_HEX_STREAM_CHUNK) {
+        size_t n = total - i < NEOC_HEX_STREAM_CHUNK ? total - i : NEOC_HEX_STREAM_CHUNK;
+        neoc_hex_decode_span(hex + 2 * i, n, chunk);
+        neoc_error_t err = neoc_binary_writer_write_bytes(writer, chunk, n);
+        if (err != NEOC_SUCCESS) {
+            return err;
+        }
+    }
+    return NEOC_SUCCESS;
+}
+
 bool neoc_hex_is_valid_char(char c) {
     return (c >= '0' && c <= '9') || 
            (c >= 'a' && c <= 'f') || 
@@ -302,14 +567,6 @@ neoc_error_t neoc_hex_decode_reverse(const char *hex, uint8_t **data, size_t *da
     return NEOC_SUCCESS;
 }
 
-static const char* neoc_hex_skip_prefix(const char *hex_string) {
-    if (hex_string && strlen(hex_string) >= 2 && hex_string[0] == '0' &&
-        (hex_string[1] == 'x' || hex_string[1] == 'X')) {
-        return hex_string + 2;
-    }
-    return hex_string;
-}
-
 neoc_error_t neoc_hex_normalize(const char* hex_string,
                                char* buffer, size_t buffer_size,
                                bool uppercase) {
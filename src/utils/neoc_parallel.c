@@ -0,0 +1,87 @@
+/**
+ * @file neoc_parallel.c
+ * @brief Fork-join loop over an index range for the batch APIs
+ */
+
+#include "neoc/utils/neoc_parallel.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+typedef struct {
+    size_t count;
+    size_t chunk;
+    neoc_parallel_fn fn;
+    void *ctx;
+    atomic_size_t next;
+    atomic_int error;
+} neoc_parallel_job_t;
+
+static void *neoc_parallel_worker(void *arg) {
+    neoc_parallel_job_t *job = (neoc_parallel_job_t *)arg;
+    while (atomic_load(&job->error) == NEOC_SUCCESS) {
+        size_t begin = atomic_fetch_add(&job->next, job->chunk);
+        if (begin >= job->count) {
+            break;
+        }
+        size_t end = job->count - begin < job->chunk ? job->count : begin + job->chunk;
+        neoc_error_t err = job->fn(begin, end, job->ctx);
+        if (err != NEOC_SUCCESS) {
+            // Keep the first failure
+            int expected = NEOC_SUCCESS;
+            atomic_compare_exchange_strong(&job->error, &expected, (int)err);
+            break;
+        }
+    }
+    return NULL;
+}
+
+size_t neoc_parallel_cpu_count(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? (size_t)online : 1;
+}
+
+neoc_error_t neoc_parallel_for(size_t count,
+                               size_t max_threads,
+                               size_t chunk,
+                               neoc_parallel_fn fn,
+                               void *ctx) {
+    if (!fn) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    if (count == 0) {
+        return NEOC_SUCCESS;
+    }
+    if (chunk == 0) {
+        chunk = 1;
+    }
+
+    size_t threads = max_threads ? max_threads : neoc_parallel_cpu_count();
+    if (threads > NEOC_PARALLEL_MAX_THREADS) {
+        threads = NEOC_PARALLEL_MAX_THREADS;
+    }
+    size_t chunks = count / chunk + (count % chunk != 0);
+    if (threads > chunks) {
+        threads = chunks;
+    }
+
+    neoc_parallel_job_t job = { .count = count, .chunk = chunk, .fn = fn, .ctx = ctx };
+    atomic_init(&job.next, 0);
+    atomic_init(&job.error, NEOC_SUCCESS);
+
+    pthread_t helpers[NEOC_PARALLEL_MAX_THREADS];
+    size_t started = 0;
+    for (size_t i = 0; i + 1 < threads; i++) {
+        if (pthread_create(&helpers[started], NULL, neoc_parallel_worker, &job) == 0) {
+            started++;
+        }
+    }
+
+    neoc_parallel_worker(&job);
+
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(helpers[i], NULL);
+    }
+    return (neoc_error_t)atomic_load(&job.error);
+}
@@ -13,26 +13,212 @@
 #include "neoc/neoc_memory.h"
 
 #include <curl/curl.h>
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
 
+/**
+ * In-flight request count for one scheme://host:port origin.
+ */
+typedef struct {
+    char *origin;
+    size_t active;
+} neoc_host_slot_t;
+
+/*
+ * Sessions keep idle easy handles for reuse and share one connection,
+ * DNS and TLS session cache between them, so consecutive requests to the
+ * same node reuse a kept-alive connection instead of reconnecting.
+ * Everything below the config is guarded by pool_lock; the share cache
+ * uses its own per-data locks.
+ */
 struct neoc_url_session_t {
     neoc_url_session_config_t config;
+    CURLSH *share;
+    pthread_mutex_t share_locks[CURL_LOCK_DATA_LAST];
+    pthread_mutex_t pool_lock;
+    pthread_cond_t host_available;
+    CURL **idle_handles;
+    size_t idle_count;
+    neoc_host_slot_t *hosts;
+    size_t host_count;
 };
 
+static pthread_once_t curl_init_once = PTHREAD_ONCE_INIT;
+static CURLcode curl_init_result = CURLE_FAILED_INIT;
+
+static void curl_init_routine(void) {
+    curl_init_result = curl_global_init(CURL_GLOBAL_DEFAULT);
+}
+
 static neoc_error_t ensure_curl_init(void) {
-    static int initialized = 0;
-    if (!initialized) {
-        CURLcode rc = curl_global_init(CURL_GLOBAL_DEFAULT);
-        if (rc != CURLE_OK) {
-            return neoc_error_set(NEOC_ERROR_NETWORK, "Failed to initialise libcurl");
+    pthread_once(&curl_init_once, curl_init_routine);
+    if (curl_init_result != CURLE_OK) {
+        return neoc_error_set(NEOC_ERROR_NETWORK, "Failed to initialise libcurl");
+    }
+    return NEOC_SUCCESS;
+}
+
+static void share_lock(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr) {
+    (void)handle;
+    (void)access;
+    neoc_url_session_t *session = (neoc_url_session_t *)userptr;
+    pthread_mutex_lock(&session->share_locks[data]);
+}
+
+static void share_unlock(CURL *handle, curl_lock_data data, void *userptr) {
+    (void)handle;
+    neoc_url_session_t *session = (neoc_url_session_t *)userptr;
+    pthread_mutex_unlock(&session->share_locks[data]);
+}
+
+static neoc_error_t session_init_pool(neoc_url_session_t *session) {
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; ++i) {
+        pthread_mutex_init(&session->share_locks[i], NULL);
+    }
+    pthread_mutex_init(&session->pool_lock, NULL);
+    pthread_cond_init(&session->host_available, NULL);
+
+    if (session->config.max_idle_handles > 0) {
+        session->idle_handles = neoc_calloc(session->config.max_idle_handles, sizeof(CURL *));
+        if (!session->idle_handles) {
+            return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to allocate handle pool");
+        }
+    }
+
+    session->share = curl_share_init();
+    if (!session->share) {
+        return neoc_error_set(NEOC_ERROR_NETWORK, "Failed to initialise CURL share handle");
+    }
+    curl_share_setopt(session->share, CURLSHOPT_LOCKFUNC, share_lock);
+    curl_share_setopt(session->share, CURLSHOPT_UNLOCKFUNC, share_unlock);
+    curl_share_setopt(session->share, CURLSHOPT_USERDATA, session);
+    curl_share_setopt(session->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(session->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(session->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    return NEOC_SUCCESS;
+}
+
+static void session_free_pool(neoc_url_session_t *session) {
+    for (size_t i = 0; i < session->idle_count; ++i) {
+        curl_easy_cleanup(session->idle_handles[i]);
+    }
+    neoc_free(session->idle_handles);
+    /* Handles are gone, so the shared connection cache can be torn down */
+    if (session->share) {
+        curl_share_cleanup(session->share);
+    }
+    for (size_t i = 0; i < session->host_count; ++i) {
+        neoc_free(session->hosts[i].origin);
+    }
+    neoc_free(session->hosts);
+    pthread_cond_destroy(&session->host_available);
+    pthread_mutex_destroy(&session->pool_lock);
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; ++i) {
+        pthread_mutex_destroy(&session->share_locks[i]);
+    }
+}
+
+static CURL *session_acquire_handle(neoc_url_session_t *session) {
+    CURL *curl = NULL;
+    pthread_mutex_lock(&session->pool_lock);
+    if (session->idle_count > 0) {
+        curl = session->idle_handles[--session->idle_count];
+    }
+    pthread_mutex_unlock(&session->pool_lock);
+
+    if (!curl) {
+        curl = curl_easy_init();
+    }
+    return curl;
+}
+
+static void session_release_handle(neoc_url_session_t *session, CURL *curl) {
+    /* Reset clears per-request options but keeps the handle's caches */
+    curl_easy_reset(curl);
+    pthread_mutex_lock(&session->pool_lock);
+    if (session->idle_count < session->config.max_idle_handles) {
+        session->idle_handles[session->idle_count++] = curl;
+        curl = NULL;
+    }
+    pthread_mutex_unlock(&session->pool_lock);
+    if (curl) {
+        curl_easy_cleanup(curl);
+    }
+}
+
+/* Length of the scheme://host:port prefix of a URL */
+static size_t url_origin_length(const char *url) {
+    const char *start = strstr(url, "://");
+    start = start ? start + 3 : url;
+    size_t host_len = strcspn(start, "/?#");
+    return (size_t)(start - url) + host_len;
+}
+
+static neoc_host_slot_t *session_find_host(neoc_url_session_t *session, const char *url, size_t len) {
+    for (size_t i = 0; i < session->host_count; ++i) {
+        if (strlen(session->hosts[i].origin) == len &&
+            strncmp(session->hosts[i].origin, url, len) == 0) {
+            return &session->hosts[i];
         }
-        initialized = 1;
     }
+    return NULL;
+}
+
+/*
+ * Blocks until the request's origin is below max_connections_per_host.
+ * Since each in-flight request holds at most one connection, this also
+ * bounds the connections opened to any single node.
+ */
+static neoc_error_t session_enter_host(neoc_url_session_t *session, const char *url) {
+    if (session->config.max_connections_per_host == 0) {
+        return NEOC_SUCCESS;
+    }
+
+    size_t len = url_origin_length(url);
+    pthread_mutex_lock(&session->pool_lock);
+    neoc_host_slot_t *slot = session_find_host(session, url, len);
+    if (!slot) {
+        neoc_host_slot_t *hosts = neoc_realloc(session->hosts,
+                                               (session->host_count + 1) * sizeof(neoc_host_slot_t));
+        char *origin = hosts ? neoc_malloc(len + 1) : NULL;
+        if (!origin) {
+            if (hosts) session->hosts = hosts;
+            pthread_mutex_unlock(&session->pool_lock);
+            return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to track host");
+        }
+        memcpy(origin, url, len);
+        origin[len] = '\0';
+        session->hosts = hosts;
+        slot = &session->hosts[session->host_count++];
+        slot->origin = origin;
+        slot->active = 0;
+    }
+    while (slot->active >= session->config.max_connections_per_host) {
+        pthread_cond_wait(&session->host_available, &session->pool_lock);
+        /* The host array may have moved while waiting */
+        slot = session_find_host(session, url, len);
+    }
+    slot->active++;
+    pthread_mutex_unlock(&session->pool_lock);
     return NEOC_SUCCESS;
 }
 
+static void session_leave_host(neoc_url_session_t *session, const char *url) {
+    if (session->config.max_connections_per_host == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&session->pool_lock);
+    neoc_host_slot_t *slot = session_find_host(session, url, url_origin_length(url));
+    if (slot && slot->active > 0) {
+        slot->active--;
+    }
+    pthread_cond_broadcast(&session->host_available);
+    pthread_mutex_unlock(&session->pool_lock);
+}
+
 static void free_headers(neoc_http_header_t *headers, size_t count) {
     if (!headers) return;
     for (size_t i = 0; i < count; ++i) {
@@ -143,12 +329,7 @@ neoc_error_t neoc_url_session_create(neoc_url_session_t **session) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid session pointer");
     }
     neoc_url_session_config_t config;
-    config.timeout_seconds = 60;
-    config.follow_redirects = true;
-    config.verify_ssl = true;
-    config.user_agent = NULL;
-    config.default_headers = NULL;
-    config.default_header_count = 0;
+    neoc_url_session_get_default_config(&config);
     return neoc_url_session_create_with_config(&config, session);
 }
 
@@ -169,6 +350,8 @@ neoc_error_t neoc_url_session_create_with_config(const neoc_url_session_config_t
         new_session->config.timeout_seconds = config->timeout_seconds;
         new_session->config.follow_redirects = config->follow_redirects;
         new_session->config.verify_ssl = config->verify_ssl;
+        new_session->config.max_idle_handles = config->max_idle_handles;
+        new_session->config.max_connections_per_host = config->max_connections_per_host;
         if (config->user_agent) {
             new_session->config.user_agent = neoc_strdup(config->user_agent);
             if (!new_session->config.user_agent) {
@@ -188,9 +371,12 @@ neoc_error_t neoc_url_session_create_with_config(const neoc_url_session_config_t
             new_session->config.default_header_count = config->default_header_count;
         }
     } else {
-        new_session->config.timeout_seconds = 60;
-        new_session->config.follow_redirects = true;
-        new_session->config.verify_ssl = true;
+        neoc_url_session_get_default_config(&new_session->config);
+    }
+    err = session_init_pool(new_session);
+    if (err != NEOC_SUCCESS) {
+        neoc_url_session_free(new_session);
+        return err;
     }
     *session = new_session;
     return NEOC_SUCCESS;
@@ -198,6 +384,7 @@ neoc_error_t neoc_url_session_create_with_config(const neoc_url_session_config_t
 
 void neoc_url_session_free(neoc_url_session_t *session) {
     if (!session) return;
+    session_free_pool(session);
     free_headers(session->config.default_headers, session->config.default_header_count);
     if (session->config.user_agent) {
         neoc_free(session->config.user_agent);
@@ -349,19 +536,26 @@ neoc_error_t neoc_url_session_perform_request(neoc_url_session_t *session,
 
     *response = NULL;
 
-    CURL *curl = curl_easy_init();
+    neoc_error_t err = session_enter_host(session, request->url);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+
+    CURL *curl = session_acquire_handle(session);
     if (!curl) {
+        session_leave_host(session, request->url);
         return neoc_error_set(NEOC_ERROR_NETWORK, "Failed to initialise CURL easy handle");
     }
 
     neoc_http_response_t *resp = neoc_calloc(1, sizeof(neoc_http_response_t));
     if (!resp) {
-        curl_easy_cleanup(curl);
+        session_release_handle(session, curl);
+        session_leave_host(session, request->url);
         return neoc_error_set(NEOC_ERROR_OUT_OF_MEMORY, "Failed to allocate response");
     }
 
-    neoc_error_t err = NEOC_SUCCESS;
-
+    curl_easy_setopt(curl, CURLOPT_SHARE, session->share);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
     curl_easy_setopt(curl, CURLOPT_URL, request->url);
     curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION,
                      request->follow_redirects ? 1L : (session->config.follow_redirects ? 1L : 0L));
@@ -381,7 +575,8 @@ neoc_error_t neoc_url_session_perform_request(neoc_url_session_t *session,
     err = fill_curl_headers(request, &session->config, &headers);
     if (err != NEOC_SUCCESS) {
         neoc_http_response_free(resp);
-        curl_easy_cleanup(curl);
+        session_release_handle(session, curl);
+        session_leave_host(session, request->url);
         return err;
     }
     if (headers) {
@@ -430,9 +625,10 @@ neoc_error_t neoc_url_session_perform_request(neoc_url_session_t *session,
         }
     }
 
+    session_release_handle(session, curl);
+    session_leave_host(session, request->url);
     curl_slist_free_all(headers);
     if (response_body.data) neoc_free(response_body.data);
-    curl_easy_cleanup(curl);
 
     if (err != NEOC_SUCCESS) {
         neoc_http_response_free(resp);
@@ -484,5 +680,7 @@ neoc_error_t neoc_url_session_get_default_config(neoc_url_session_config_t *conf
     config->timeout_seconds = 60;
     config->follow_redirects = true;
     config->verify_ssl = true;
+    config->max_idle_handles = NEOC_URL_SESSION_DEFAULT_IDLE_HANDLES;
+    config->max_connections_per_host = NEOC_URL_SESSION_DEFAULT_HOST_CONNECTIONS;
     return NEOC_SUCCESS;
 }
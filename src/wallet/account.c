@@ -9,6 +9,7 @@
 #include "neoc/wallet/multi_sig.h"
 #include "neoc/wallet/nep6.h"
 #include "neoc/neoc_memory.h"
+#include "neoc/neo_constants.h"
 #include "neoc/crypto/ec_key_pair.h"
 #include "neoc/crypto/ecdsa_signature.h"
 #include "neoc/crypto/neoc_hash.h"
@@ -442,16 +443,19 @@ neoc_error_t neoc_account_sign(const neoc_account_t *account,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Account sign expects 32-byte hash");
     }
     
-    neoc_ecdsa_signature_t *ecdsa_sig = NULL;
-    neoc_error_t err = neoc_ec_key_pair_sign(account->key_pair, data, &ecdsa_sig);
+    uint8_t signature_bytes[NEOC_SIGNATURE_SIZE];
+    neoc_error_t err = neoc_sign_hash_fast(data, account->key_pair, signature_bytes);
     if (err != NEOC_SUCCESS) {
         return err;
     }
     
-    err = neoc_ecdsa_signature_to_bytes(ecdsa_sig, signature, signature_len);
-    neoc_ecdsa_signature_free(ecdsa_sig);
+    *signature = neoc_memdup(signature_bytes, sizeof(signature_bytes));
+    if (!*signature) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate signature");
+    }
+    *signature_len = sizeof(signature_bytes);
     
-    return err;
+    return NEOC_SUCCESS;
 }
 
 neoc_error_t neoc_account_sign_hash(const neoc_account_t *account,
@@ -465,17 +469,9 @@ neoc_error_t neoc_account_sign_hash(const neoc_account_t *account,
         return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Account has no key pair for signing");
     }
     
-    // Sign hash
-    neoc_ecdsa_signature_t *ecdsa_sig = NULL;
-    neoc_error_t err = neoc_ec_key_pair_sign(account->key_pair, hash->data, &ecdsa_sig);
-    if (err != NEOC_SUCCESS) {
-        return err;
-    }
-    
-    uint8_t *signature_bytes = NULL;
-    size_t signature_len = 0;
-    err = neoc_ecdsa_signature_to_bytes(ecdsa_sig, &signature_bytes, &signature_len);
-    neoc_ecdsa_signature_free(ecdsa_sig);
+    // Sign hash (witnesses carry r || s only, so no recovery ID is computed)
+    uint8_t signature_bytes[NEOC_SIGNATURE_SIZE];
+    neoc_error_t err = neoc_sign_hash_fast(hash->data, account->key_pair, signature_bytes);
     if (err != NEOC_SUCCESS) {
         return err;
     }
@@ -483,8 +479,8 @@ neoc_error_t neoc_account_sign_hash(const neoc_account_t *account,
     // Create invocation script from signature
     uint8_t *invocation_script = NULL;
     size_t invocation_len = 0;
-    err = neoc_script_create_single_sig_invocation(signature_bytes, signature_len, &invocation_script, &invocation_len);
-    neoc_free(signature_bytes);
+    err = neoc_script_create_single_sig_invocation(signature_bytes, sizeof(signature_bytes),
+                                                   &invocation_script, &invocation_len);
     if (err != NEOC_SUCCESS) {
         return err;
     }
@@ -1546,6 +1542,10 @@ void neoc_account_free(neoc_account_t *account) {
         neoc_free(account->label);
     }
     
+    if (account->verification_script) {
+        neoc_free(account->verification_script);
+    }
+    
     neoc_account_clear_encrypted_key(account);
     
     // Free multi-sig data if present
@@ -3,10 +3,109 @@
 #include "neoc/types/neoc_hash160.h"
 #include "neoc/neoc_memory.h"
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 
 #define INITIAL_ACCOUNT_CAPACITY 10
+#define INITIAL_INDEX_CAPACITY 32
+#define INDEX_NOT_FOUND SIZE_MAX
+
+/*
+ * Accounts are indexed by script hash with linear probing. A slot holds the
+ * account's position + 1 (0 is empty) and the table is kept at most half
+ * full. Removal shifts the rest of the probe run back instead of leaving
+ * tombstones, so lookups never slow down as accounts come and go.
+ */
+static size_t neoc_wallet_index_home(const neoc_hash160_t *script_hash, size_t mask) {
+    /* Script hashes are already uniform; the mix only guards against crafted low bits */
+    uint64_t h;
+    memcpy(&h, script_hash->data, sizeof(h));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (size_t)h & mask;
+}
+
+static size_t neoc_wallet_index_find(const neoc_wallet_t *wallet, const neoc_hash160_t *script_hash) {
+    if (wallet->index_capacity == 0) {
+        return INDEX_NOT_FOUND;
+    }
+    size_t mask = wallet->index_capacity - 1;
+    for (size_t slot = neoc_wallet_index_home(script_hash, mask);; slot = (slot + 1) & mask) {
+        size_t entry = wallet->account_index[slot];
+        if (entry == 0) {
+            return INDEX_NOT_FOUND;
+        }
+        if (memcmp(wallet->accounts[entry - 1]->script_hash.data, script_hash->data, NEOC_HASH160_SIZE) == 0) {
+            return slot;
+        }
+    }
+}
+
+/* Addresses are looked up through their script hash */
+static size_t neoc_wallet_index_find_address(const neoc_wallet_t *wallet, const char *address) {
+    neoc_hash160_t script_hash;
+    if (neoc_hash160_from_address(&script_hash, address) != NEOC_SUCCESS) {
+        return INDEX_NOT_FOUND;
+    }
+    size_t slot = neoc_wallet_index_find(wallet, &script_hash);
+    if (slot != INDEX_NOT_FOUND &&
+        strcmp(wallet->accounts[wallet->account_index[slot] - 1]->address, address) != 0) {
+        return INDEX_NOT_FOUND;
+    }
+    return slot;
+}
+
+static void neoc_wallet_index_insert(neoc_wallet_t *wallet, size_t position) {
+    size_t mask = wallet->index_capacity - 1;
+    size_t slot = neoc_wallet_index_home(&wallet->accounts[position]->script_hash, mask);
+    while (wallet->account_index[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    wallet->account_index[slot] = position + 1;
+}
+
+static void neoc_wallet_index_erase(neoc_wallet_t *wallet, size_t slot) {
+    size_t mask = wallet->index_capacity - 1;
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask; wallet->account_index[next] != 0; next = (next + 1) & mask) {
+        const neoc_account_t *account = wallet->accounts[wallet->account_index[next] - 1];
+        size_t home = neoc_wallet_index_home(&account->script_hash, mask);
+        /* The entry can fill the hole if the hole lies on its probe path */
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            wallet->account_index[hole] = wallet->account_index[next];
+            hole = next;
+        }
+    }
+    wallet->account_index[hole] = 0;
+}
+
+/* Grows the index so count accounts keep it at most half full */
+static neoc_error_t neoc_wallet_index_reserve(neoc_wallet_t *wallet, size_t count) {
+    size_t capacity = wallet->index_capacity ? wallet->index_capacity : INITIAL_INDEX_CAPACITY;
+    while (capacity / 2 < count) {
+        if (capacity > SIZE_MAX / (2 * sizeof(size_t))) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Account index too large");
+        }
+        capacity *= 2;
+    }
+    if (capacity == wallet->index_capacity) {
+        return NEOC_SUCCESS;
+    }
+
+    size_t *index = calloc(capacity, sizeof(size_t));
+    if (!index) {
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate account index");
+    }
+    free(wallet->account_index);
+    wallet->account_index = index;
+    wallet->index_capacity = capacity;
+    for (size_t i = 0; i < wallet->account_count; i++) {
+        neoc_wallet_index_insert(wallet, i);
+    }
+    return NEOC_SUCCESS;
+}
 
 neoc_error_t neoc_wallet_create(const char *name, neoc_wallet_t **wallet) {
     if (!wallet) {
@@ -81,10 +180,8 @@ neoc_error_t neoc_wallet_add_account(neoc_wallet_t *wallet, neoc_account_t *acco
     }
     
     // Check if account already exists
-    for (size_t i = 0; i < wallet->account_count; i++) {
-        if (strcmp(wallet->accounts[i]->address, account->address) == 0) {
-            return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Account already exists in wallet");
-        }
+    if (neoc_wallet_index_find(wallet, &account->script_hash) != INDEX_NOT_FOUND) {
+        return neoc_error_set(NEOC_ERROR_INVALID_STATE, "Account already exists in wallet");
     }
     
     // Resize array if needed
@@ -99,8 +196,15 @@ neoc_error_t neoc_wallet_add_account(neoc_wallet_t *wallet, neoc_account_t *acco
         wallet->account_capacity = new_capacity;
     }
     
+    neoc_error_t err = neoc_wallet_index_reserve(wallet, wallet->account_count + 1);
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    
     // Add account
-    wallet->accounts[wallet->account_count++] = account;
+    wallet->accounts[wallet->account_count] = account;
+    neoc_wallet_index_insert(wallet, wallet->account_count);
+    wallet->account_count++;
     
     // Set as default if it's the first account
     if (wallet->account_count == 1) {
@@ -111,24 +215,38 @@ neoc_error_t neoc_wallet_add_account(neoc_wallet_t *wallet, neoc_account_t *acco
     return NEOC_SUCCESS;
 }
 
-neoc_error_t neoc_wallet_remove_account(neoc_wallet_t *wallet, const char *address) {
-    if (!wallet || !address) {
+neoc_error_t neoc_wallet_reserve_accounts(neoc_wallet_t *wallet, size_t count) {
+    if (!wallet) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    // Find account
-    size_t index = (size_t)-1;
-    for (size_t i = 0; i < wallet->account_count; i++) {
-        if (strcmp(wallet->accounts[i]->address, address) == 0) {
-            index = i;
-            break;
+    if (count > wallet->account_capacity) {
+        if (count > SIZE_MAX / sizeof(neoc_account_t*)) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Account array too large");
+        }
+        neoc_account_t **new_accounts = realloc(wallet->accounts, count * sizeof(neoc_account_t*));
+        if (!new_accounts) {
+            return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to resize account array");
         }
+        wallet->accounts = new_accounts;
+        wallet->account_capacity = count;
+    }
+    
+    return neoc_wallet_index_reserve(wallet, count);
+}
+
+neoc_error_t neoc_wallet_remove_account(neoc_wallet_t *wallet, const char *address) {
+    if (!wallet || !address) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
     
-    if (index == (size_t)-1) {
+    // Find account
+    size_t slot = neoc_wallet_index_find_address(wallet, address);
+    if (slot == INDEX_NOT_FOUND) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Account not found");
     }
     
+    size_t index = wallet->account_index[slot] - 1;
     neoc_account_t *account = wallet->accounts[index];
     
     // Update default account if needed
@@ -141,9 +259,13 @@ neoc_error_t neoc_wallet_remove_account(neoc_wallet_t *wallet, const char *addre
         }
     }
     
-    // Remove account from array
-    for (size_t i = index; i < wallet->account_count - 1; i++) {
-        wallet->accounts[i] = wallet->accounts[i + 1];
+    // Move the last account into the gap
+    neoc_wallet_index_erase(wallet, slot);
+    size_t last = wallet->account_count - 1;
+    if (index != last) {
+        neoc_account_t *moved = wallet->accounts[last];
+        wallet->account_index[neoc_wallet_index_find(wallet, &moved->script_hash)] = index + 1;
+        wallet->accounts[index] = moved;
     }
     wallet->account_count--;
     
@@ -158,13 +280,8 @@ neoc_account_t* neoc_wallet_get_account_by_address(const neoc_wallet_t *wallet,
         return NULL;
     }
     
-    for (size_t i = 0; i < wallet->account_count; i++) {
-        if (strcmp(wallet->accounts[i]->address, address) == 0) {
-            return wallet->accounts[i];
-        }
-    }
-    
-    return NULL;
+    size_t slot = neoc_wallet_index_find_address(wallet, address);
+    return slot != INDEX_NOT_FOUND ? wallet->accounts[wallet->account_index[slot] - 1] : NULL;
 }
 
 neoc_account_t* neoc_wallet_get_account_by_index(const neoc_wallet_t *wallet, size_t index) {
@@ -180,13 +297,8 @@ neoc_account_t* neoc_wallet_get_account_by_script_hash(const neoc_wallet_t *wall
         return NULL;
     }
     
-    for (size_t i = 0; i < wallet->account_count; i++) {
-        if (memcmp(&wallet->accounts[i]->script_hash, script_hash, sizeof(neoc_hash160_t)) == 0) {
-            return wallet->accounts[i];
-        }
-    }
-    
-    return NULL;
+    size_t slot = neoc_wallet_index_find(wallet, script_hash);
+    return slot != INDEX_NOT_FOUND ? wallet->accounts[wallet->account_index[slot] - 1] : NULL;
 }
 
 neoc_account_t** neoc_wallet_get_accounts(const neoc_wallet_t *wallet, size_t *count) {
@@ -216,6 +328,18 @@ neoc_error_t neoc_wallet_get_default_account_out(const neoc_wallet_t *wallet,
     return NEOC_SUCCESS;
 }
 
+/* Makes an account already in the wallet its default */
+static void neoc_wallet_make_default(neoc_wallet_t *wallet, neoc_account_t *account) {
+    // Update old default
+    if (wallet->default_account) {
+        wallet->default_account->is_default = false;
+    }
+    
+    // Set new default
+    wallet->default_account = account;
+    account->is_default = true;
+}
+
 neoc_error_t neoc_wallet_set_default_account_str(neoc_wallet_t *wallet, const char *address) {
     if (!wallet || !address) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
@@ -226,15 +350,7 @@ neoc_error_t neoc_wallet_set_default_account_str(neoc_wallet_t *wallet, const ch
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Account not found");
     }
     
-    // Update old default
-    if (wallet->default_account) {
-        wallet->default_account->is_default = false;
-    }
-    
-    // Set new default
-    wallet->default_account = account;
-    account->is_default = true;
-
+    neoc_wallet_make_default(wallet, account);
     return NEOC_SUCCESS;
 }
 
@@ -244,12 +360,13 @@ neoc_error_t neoc_wallet_set_default_account_hash(neoc_wallet_t *wallet,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
 
-    char address[NEOC_ADDRESS_LENGTH];
-    neoc_error_t err = neoc_hash160_to_address(script_hash, address, sizeof(address));
-    if (err != NEOC_SUCCESS) {
-        return err;
+    neoc_account_t *account = neoc_wallet_get_account_by_script_hash(wallet, script_hash);
+    if (!account) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Account not found");
     }
-    return neoc_wallet_set_default_account_str(wallet, address);
+    
+    neoc_wallet_make_default(wallet, account);
+    return NEOC_SUCCESS;
 }
 
 neoc_error_t neoc_wallet_set_default_account_account(neoc_wallet_t *wallet,
@@ -258,20 +375,7 @@ neoc_error_t neoc_wallet_set_default_account_account(neoc_wallet_t *wallet,
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
     }
 
-    const char *address = neoc_account_get_address_ptr(account);
-    if (!address) {
-        // Attempt to derive address from script hash if available
-        char address_buffer[NEOC_ADDRESS_LENGTH];
-        neoc_error_t err = neoc_hash160_to_address(neoc_account_get_script_hash_ptr(account),
-                                                   address_buffer,
-                                                   sizeof(address_buffer));
-        if (err != NEOC_SUCCESS) {
-            return err;
-        }
-        return neoc_wallet_set_default_account_str(wallet, address_buffer);
-    }
-
-    return neoc_wallet_set_default_account_str(wallet, address);
+    return neoc_wallet_set_default_account_hash(wallet, neoc_account_get_script_hash_ptr(account));
 }
 
 neoc_account_t* neoc_wallet_create_account(neoc_wallet_t *wallet, const char *label) {
@@ -387,6 +491,89 @@ neoc_error_t neoc_wallet_unlock_all(neoc_wallet_t *wallet, const char *passphras
     return NEOC_SUCCESS;
 }
 
+neoc_error_t neoc_wallet_unlock_all_parallel(neoc_wallet_t *wallet,
+                                             const char *password,
+                                             const neoc_nep2_params_t *params,
+                                             size_t threads,
+                                             neoc_nep2_progress_fn progress,
+                                             void *user_data,
+                                             neoc_error_t *results) {
+    if (!wallet || !password) {
+        return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "Invalid arguments");
+    }
+    
+    // Collect the accounts that hold an encrypted key
+    size_t encrypted = 0;
+    for (size_t i = 0; i < wallet->account_count; i++) {
+        if (results) {
+            results[i] = NEOC_SUCCESS;
+        }
+        if (wallet->accounts[i]->encrypted_key) {
+            encrypted++;
+        }
+    }
+    if (encrypted == 0) {
+        return NEOC_SUCCESS;
+    }
+    
+    size_t *positions = neoc_malloc(encrypted * sizeof(size_t));
+    const char **keys = neoc_malloc(encrypted * sizeof(char *));
+    neoc_error_t *key_results = neoc_malloc(encrypted * sizeof(neoc_error_t));
+    uint8_t *private_keys = neoc_malloc(encrypted * 32);
+    if (!positions || !keys || !key_results || !private_keys) {
+        neoc_free(positions);
+        neoc_free(keys);
+        neoc_free(key_results);
+        neoc_free(private_keys);
+        return neoc_error_set(NEOC_ERROR_MEMORY, "Failed to allocate unlock batch");
+    }
+    for (size_t i = 0, k = 0; i < wallet->account_count; i++) {
+        if (wallet->accounts[i]->encrypted_key) {
+            positions[k] = i;
+            keys[k++] = (const char *)wallet->accounts[i]->encrypted_key;
+        }
+    }
+    
+    neoc_error_t err = neoc_nep2_decrypt_batch(keys, password, params, encrypted, threads,
+                                               private_keys, key_results, progress, user_data);
+    
+    // Install the key pairs of the accounts that decrypted
+    neoc_error_t first_failure = NEOC_SUCCESS;
+    for (size_t k = 0; err == NEOC_SUCCESS && k < encrypted; k++) {
+        neoc_account_t *account = wallet->accounts[positions[k]];
+        neoc_error_t account_err = key_results[k];
+        if (account_err == NEOC_SUCCESS) {
+            neoc_ec_key_pair_t *key_pair = NULL;
+            account_err = neoc_ec_key_pair_create_from_private_key(private_keys + 32 * k, &key_pair);
+            if (account_err == NEOC_SUCCESS) {
+                neoc_ec_key_pair_free(account->key_pair);
+                account->key_pair = key_pair;
+                account->is_locked = false;
+            }
+        }
+        if (results) {
+            results[positions[k]] = account_err;
+        }
+        if (account_err != NEOC_SUCCESS && first_failure == NEOC_SUCCESS) {
+            first_failure = account_err;
+        }
+    }
+    
+    neoc_secure_memzero(private_keys, encrypted * 32);
+    neoc_free(private_keys);
+    neoc_free(key_results);
+    neoc_free(keys);
+    neoc_free(positions);
+    
+    if (err != NEOC_SUCCESS) {
+        return err;
+    }
+    if (first_failure != NEOC_SUCCESS) {
+        return neoc_error_set(first_failure, "Failed to unlock all accounts");
+    }
+    return NEOC_SUCCESS;
+}
+
 neoc_error_t neoc_wallet_to_nep6(const neoc_wallet_t *wallet, neoc_nep6_wallet_t **nep6_wallet) {
     if (!wallet || !nep6_wallet) {
         return neoc_error_set(NEOC_ERROR_INVALID_ARGUMENT, "wallet_to_nep6: invalid arguments");
@@ -577,6 +764,7 @@ void neoc_wallet_free(neoc_wallet_t *wallet) {
         neoc_account_free(wallet->accounts[i]);
     }
     free(wallet->accounts);
+    free(wallet->account_index);
     
     // Free wallet fields
     if (wallet->name) {
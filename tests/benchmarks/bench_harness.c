@@ -0,0 +1,274 @@
+/**
+ * @file bench_harness.c
+ * @brief Warmup, batch sizing, sampling and reporting for neoc_bench
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench_harness.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "neoc/neoc.h"
+#include "neoc/neoc_memory.h"
+
+/* Batch sizes stop growing here so a mis-estimated no-op cannot spin forever */
+#define BENCH_MAX_BATCH (1u << 24)
+
+struct bench {
+    bench_options_t options;
+    bench_result_t *results;
+    size_t count;
+    size_t capacity;
+    double *samples;
+    bool header_printed;
+};
+
+void bench_default_options(bench_options_t *options) {
+    memset(options, 0, sizeof(*options));
+    options->warmup_time = 0.1;
+    options->min_time = 0.5;
+    options->sample_time = 0.005;
+    options->min_samples = 30;
+    options->max_samples = 2000;
+}
+
+void bench_smoke_options(bench_options_t *options) {
+    bench_default_options(options);
+    options->warmup_time = 0.0;
+    options->min_time = 0.0;
+    options->sample_time = 0.0001;
+    options->min_samples = 2;
+    options->max_samples = 2;
+}
+
+bench_t *bench_create(const bench_options_t *options) {
+    bench_t *bench = calloc(1, sizeof(*bench));
+    if (!bench) {
+        return NULL;
+    }
+    bench->options = *options;
+    if (bench->options.min_samples == 0) {
+        bench->options.min_samples = 1;
+    }
+    if (bench->options.max_samples < bench->options.min_samples) {
+        bench->options.max_samples = bench->options.min_samples;
+    }
+    bench->samples = malloc(bench->options.max_samples * sizeof(*bench->samples));
+    if (!bench->samples) {
+        free(bench);
+        return NULL;
+    }
+    return bench;
+}
+
+void bench_free(bench_t *bench) {
+    if (!bench) {
+        return;
+    }
+    free(bench->results);
+    free(bench->samples);
+    free(bench);
+}
+
+double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted array */
+static double percentile(const double *sorted, size_t count, double p) {
+    size_t rank = (size_t)ceil(p * (double)count);
+    if (rank == 0) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+static double time_batch(bench_fn fn, void *state, uint64_t batch) {
+    double start = bench_now();
+    for (uint64_t i = 0; i < batch; i++) {
+        fn(state);
+    }
+    return bench_now() - start;
+}
+
+/* Warm up with doubling batches; returns a batch size lasting about sample_time */
+static uint64_t calibrate(const bench_options_t *options, bench_fn fn, void *state) {
+    uint64_t batch = 1;
+    double per_op = 0.0;
+    double start = bench_now();
+    do {
+        double elapsed = time_batch(fn, state, batch);
+        per_op = elapsed / (double)batch;
+        if (elapsed < options->sample_time && batch < BENCH_MAX_BATCH) {
+            batch *= 2;
+        }
+    } while (bench_now() - start < options->warmup_time);
+
+    if (per_op <= 0.0) {
+        return BENCH_MAX_BATCH;
+    }
+    double target = ceil(options->sample_time / per_op);
+    if (target < 1.0) {
+        return 1;
+    }
+    return target > (double)BENCH_MAX_BATCH ? BENCH_MAX_BATCH : (uint64_t)target;
+}
+
+static void format_duration(double ns, char *buffer, size_t size) {
+    if (ns < 1e3) {
+        snprintf(buffer, size, "%.1f ns", ns);
+    } else if (ns < 1e6) {
+        snprintf(buffer, size, "%.2f us", ns / 1e3);
+    } else if (ns < 1e9) {
+        snprintf(buffer, size, "%.2f ms", ns / 1e6);
+    } else {
+        snprintf(buffer, size, "%.2f s", ns / 1e9);
+    }
+}
+
+static void print_result(bench_t *bench, const bench_result_t *result) {
+    if (!bench->header_printed) {
+        printf("%-44s %11s %11s %11s %11s %9s %10s\n",
+               "case", "mean", "p50", "p99", "max", "allocs/op", "ops");
+        bench->header_printed = true;
+    }
+    char mean[24], p50[24], p99[24], max[24];
+    format_duration(result->mean_ns, mean, sizeof(mean));
+    format_duration(result->p50_ns, p50, sizeof(p50));
+    format_duration(result->p99_ns, p99, sizeof(p99));
+    format_duration(result->max_ns, max, sizeof(max));
+    printf("%-44s %11s %11s %11s %11s %9.2f %10llu\n", result->name, mean, p50, p99, max,
+           result->allocs_per_op, (unsigned long long)result->iterations);
+    fflush(stdout);
+}
+
+static bench_result_t *append_result(bench_t *bench) {
+    if (bench->count == bench->capacity) {
+        size_t capacity = bench->capacity ? bench->capacity * 2 : 32;
+        bench_result_t *results = realloc(bench->results, capacity * sizeof(*results));
+        if (!results) {
+            return NULL;
+        }
+        bench->results = results;
+        bench->capacity = capacity;
+    }
+    bench_result_t *result = &bench->results[bench->count++];
+    memset(result, 0, sizeof(*result));
+    return result;
+}
+
+void bench_run(bench_t *bench, const char *suite, const char *name,
+               bench_fn fn, void *state) {
+    char full_name[sizeof(((bench_result_t *)0)->name)];
+    snprintf(full_name, sizeof(full_name), "%s/%s", suite, name);
+    if (bench->options.filter && !strstr(full_name, bench->options.filter)) {
+        return;
+    }
+    if (bench->options.list_only) {
+        printf("%s\n", full_name);
+        return;
+    }
+
+    const bench_options_t *options = &bench->options;
+    uint64_t batch = calibrate(options, fn, state);
+
+    neoc_memory_stats_t before, after;
+    neoc_get_memory_stats(&before);
+    double total = 0.0;
+    size_t count = 0;
+    while (count < options->max_samples &&
+           (count < options->min_samples || total < options->min_time)) {
+        double elapsed = time_batch(fn, state, batch);
+        bench->samples[count++] = elapsed * 1e9 / (double)batch;
+        total += elapsed;
+    }
+    neoc_get_memory_stats(&after);
+
+    bench_result_t *result = append_result(bench);
+    if (!result) {
+        fprintf(stderr, "bench: out of memory recording %s\n", full_name);
+        return;
+    }
+    uint64_t iterations = batch * (uint64_t)count;
+    memcpy(result->name, full_name, sizeof(full_name));
+    result->iterations = iterations;
+    result->samples = count;
+    result->mean_ns = total * 1e9 / (double)iterations;
+    qsort(bench->samples, count, sizeof(*bench->samples), compare_doubles);
+    result->p50_ns = percentile(bench->samples, count, 0.50);
+    result->p99_ns = percentile(bench->samples, count, 0.99);
+    result->max_ns = bench->samples[count - 1];
+    result->allocs_per_op = (double)(after.allocation_count - before.allocation_count) /
+                            (double)iterations;
+    result->bytes_per_op = (double)(after.total_allocated - before.total_allocated) /
+                           (double)iterations;
+
+    if (!options->quiet) {
+        print_result(bench, result);
+    }
+}
+
+size_t bench_result_count(const bench_t *bench) {
+    return bench->count;
+}
+
+const bench_result_t *bench_result(const bench_t *bench, size_t index) {
+    return index < bench->count ? &bench->results[index] : NULL;
+}
+
+static void write_json_string(FILE *file, const char *text) {
+    fputc('"', file);
+    for (const unsigned char *p = (const unsigned char *)text; *p; p++) {
+        if (*p == '"' || *p == '\\') {
+            fprintf(file, "\\%c", *p);
+        } else if (*p < 0x20) {
+            fprintf(file, "\\u%04x", *p);
+        } else {
+            fputc(*p, file);
+        }
+    }
+    fputc('"', file);
+}
+
+int bench_write_json(const bench_t *bench, const char *path) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        return -1;
+    }
+
+    fprintf(file, "{\n  \"schema\": 1,\n  \"library_version\": ");
+    write_json_string(file, neoc_get_version());
+    fprintf(file, ",\n  \"timestamp\": %lld,\n", (long long)time(NULL));
+    fprintf(file, "  \"options\": {\"warmup_time\": %g, \"min_time\": %g, "
+                  "\"sample_time\": %g, \"min_samples\": %zu, \"max_samples\": %zu},\n",
+            bench->options.warmup_time, bench->options.min_time, bench->options.sample_time,
+            bench->options.min_samples, bench->options.max_samples);
+    fprintf(file, "  \"results\": [");
+    for (size_t i = 0; i < bench->count; i++) {
+        const bench_result_t *r = &bench->results[i];
+        fprintf(file, "%s\n    {\"name\": ", i == 0 ? "" : ",");
+        write_json_string(file, r->name);
+        fprintf(file, ", \"iterations\": %llu, \"samples\": %zu, "
+                      "\"mean_ns\": %.3f, \"p50_ns\": %.3f, \"p99_ns\": %.3f, \"max_ns\": %.3f, "
+                      "\"ops_per_sec\": %.3f, \"allocs_per_op\": %.4f, \"bytes_per_op\": %.2f}",
+                (unsigned long long)r->iterations, r->samples,
+                r->mean_ns, r->p50_ns, r->p99_ns, r->max_ns,
+                r->mean_ns > 0.0 ? 1e9 / r->mean_ns : 0.0,
+                r->allocs_per_op, r->bytes_per_op);
+    }
+    fprintf(file, "\n  ]\n}\n");
+
+    return fclose(file) == 0 ? 0 : -1;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file bench_harness.h
+ * @brief Small benchmark harness behind the neoc_bench target
+ *
+ * A case is a function performing one operation on state owned by the
+ * suite. Each case is warmed up, given a batch size so that one timed
+ * sample lasts about sample_time, and sampled until both min_samples and
+ * min_time are reached. Times come from the monotonic wall clock.
+ *
+ * The reported p50/p99/max are taken over per-sample averages, so for
+ * operations much shorter than sample_time they describe batch means
+ * rather than single calls. Allocations per op count neoc_malloc calls
+ * made while sampling, as reported by neoc_get_memory_stats.
+ */
+
+#ifndef NEOC_BENCH_HARNESS_H
+#define NEOC_BENCH_HARNESS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Abort the run when a benchmarked call fails; unlike assert it survives NDEBUG */
+#define BENCH_CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #expr); \
+            abort(); \
+        } \
+    } while (0)
+
+/** One operation on suite-owned state */
+typedef void (*bench_fn)(void *state);
+
+typedef struct {
+    double warmup_time;   ///< Seconds spent warming each case up
+    double min_time;      ///< Minimum seconds of timed samples per case
+    double sample_time;   ///< Target duration of one sample in seconds
+    size_t min_samples;   ///< Minimum number of samples per case
+    size_t max_samples;   ///< Sampling stops here even before min_time
+    const char *filter;   ///< Substring of "suite/name" to run, or NULL for all
+    bool list_only;       ///< Print case names without running them
+    bool quiet;           ///< Suppress the per-case text report
+} bench_options_t;
+
+typedef struct {
+    char name[96];          ///< "suite/name"
+    uint64_t iterations;    ///< Operations timed across all samples
+    size_t samples;         ///< Number of samples
+    double mean_ns;         ///< Total time divided by iterations
+    double p50_ns;          ///< Median per-op time over samples
+    double p99_ns;          ///< 99th percentile per-op time over samples
+    double max_ns;          ///< Slowest sample's per-op time
+    double allocs_per_op;   ///< neoc_malloc calls per operation
+    double bytes_per_op;    ///< Bytes requested from neoc_malloc per operation
+} bench_result_t;
+
+typedef struct bench bench_t;
+
+/** Options used by a full run */
+void bench_default_options(bench_options_t *options);
+
+/** Options for a quick run that only checks every case works */
+void bench_smoke_options(bench_options_t *options);
+
+bench_t *bench_create(const bench_options_t *options);
+void bench_free(bench_t *bench);
+
+/** Current monotonic time in seconds */
+double bench_now(void);
+
+/**
+ * @brief Measure one case and record its result
+ *
+ * Cases not matching the filter are skipped; in list mode the name is
+ * printed instead.
+ */
+void bench_run(bench_t *bench, const char *suite, const char *name,
+               bench_fn fn, void *state);
+
+size_t bench_result_count(const bench_t *bench);
+const bench_result_t *bench_result(const bench_t *bench, size_t index);
+
+/**
+ * @brief Write all results as JSON for regression tracking
+ *
+ * @return 0 on success, -1 if the file could not be written
+ */
+int bench_write_json(const bench_t *bench, const char *path);
+
+#endif /* NEOC_BENCH_HARNESS_H */
@@ -0,0 +1,228 @@
+/**
+ * @file benchmark_chain_file.c
+ * @brief Decoding a large raw transaction dump with copying and borrowing readers
+ *
+ * Writes a synthetic chain file of var-bytes framed transactions (1 GiB by
+ * default; pass the size in MiB and optionally a path) and walks it twice,
+ * each pass in a forked child so peak RSS is measured separately:
+ *
+ *   copying reader: the file is read into memory, neoc_binary_reader_create
+ *                   copies it, and every record is copied out with
+ *                   neoc_binary_reader_read_var_bytes and copied again into
+ *                   its own reader before neoc_transaction_view_parse.
+ *   mapped view:    neoc_binary_reader_map_file, and each record is a
+ *                   neoc_binary_reader_read_var_bytes_view slice parsed
+ *                   through a stack reader from neoc_binary_reader_init_view.
+ *
+ * The file is in the page cache for both passes.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "neoc/neoc.h"
+#include "neoc/serialization/binary_reader.h"
+#include "neoc/transaction/transaction.h"
+#include "neoc/transaction/signer.h"
+#include "neoc/transaction/witness.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* A NEP-17 transfer shaped transaction: one signer, a 100 byte script, one witness */
+static size_t build_transaction(uint32_t nonce, uint8_t *out, size_t capacity) {
+    neoc_transaction_t *tx = NULL;
+    neoc_error_t err = neoc_transaction_create(&tx);
+    assert(err == NEOC_SUCCESS);
+    neoc_transaction_set_nonce(tx, nonce);
+    neoc_transaction_set_system_fee(tx, 997775);
+    neoc_transaction_set_network_fee(tx, 1234520);
+    neoc_transaction_set_valid_until_block(tx, 4005760);
+
+    neoc_hash160_t account;
+    err = neoc_hash160_from_hex(&account, "69ecca587293047be4c59159bf8bc399985c160d");
+    assert(err == NEOC_SUCCESS);
+    neoc_signer_t *signer = NULL;
+    err = neoc_signer_create_called_by_entry(&account, &signer);
+    assert(err == NEOC_SUCCESS);
+    err = neoc_transaction_add_signer(tx, signer);
+    assert(err == NEOC_SUCCESS);
+
+    uint8_t script[100];
+    memset(script, 0x0c, sizeof(script));
+    err = neoc_transaction_set_script(tx, script, sizeof(script));
+    assert(err == NEOC_SUCCESS);
+
+    uint8_t invocation[66];
+    uint8_t verification[40];
+    memset(invocation, 0x0c, sizeof(invocation));
+    memset(verification, 0x21, sizeof(verification));
+    neoc_witness_t *witness = NULL;
+    err = neoc_witness_create(invocation, sizeof(invocation), verification, sizeof(verification), &witness);
+    assert(err == NEOC_SUCCESS);
+    neoc_transaction_add_witness(tx, witness);
+
+    size_t len = 0;
+    err = neoc_transaction_serialize(tx, out, capacity, &len);
+    assert(err == NEOC_SUCCESS);
+    neoc_transaction_free(tx);
+    return len;
+}
+
+static size_t write_chain_file(const char *path, size_t target_bytes, size_t *file_bytes) {
+    uint8_t record[1024];
+    size_t tx_len = build_transaction(0, record + 3, sizeof(record) - 3);
+    assert(tx_len >= 0xFD && tx_len <= 0xFFFF);
+    record[0] = 0xFD;
+    record[1] = (uint8_t)tx_len;
+    record[2] = (uint8_t)(tx_len >> 8);
+    size_t record_len = tx_len + 3;
+
+    FILE *file = fopen(path, "wb");
+    assert(file != NULL);
+    static uint8_t chunk[1 << 20];
+    size_t records = 0;
+    size_t written = 0;
+    while (written < target_bytes) {
+        size_t filled = 0;
+        while (filled + record_len <= sizeof(chunk) && written + filled < target_bytes) {
+            memcpy(chunk + filled, record, record_len);
+            /* Vary the nonce so records are not byte-identical */
+            uint32_t nonce = (uint32_t)records++;
+            memcpy(chunk + filled + 4, &nonce, sizeof(nonce));
+            filled += record_len;
+        }
+        size_t n = fwrite(chunk, 1, filled, file);
+        assert(n == filled);
+        written += filled;
+    }
+    fclose(file);
+    *file_bytes = written;
+    return records;
+}
+
+static size_t decode_copying(const char *path) {
+    FILE *file = fopen(path, "rb");
+    assert(file != NULL);
+    fseek(file, 0, SEEK_END);
+    size_t size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *contents = malloc(size);
+    assert(contents != NULL);
+    size_t n = fread(contents, 1, size, file);
+    assert(n == size);
+    fclose(file);
+
+    neoc_binary_reader_t *reader = NULL;
+    neoc_error_t err = neoc_binary_reader_create(contents, size, &reader);
+    assert(err == NEOC_SUCCESS);
+
+    size_t count = 0;
+    while (!neoc_binary_reader_is_at_end(reader)) {
+        uint8_t *record = NULL;
+        size_t record_len = 0;
+        err = neoc_binary_reader_read_var_bytes(reader, &record, &record_len);
+        assert(err == NEOC_SUCCESS);
+
+        neoc_binary_reader_t *tx_reader = NULL;
+        err = neoc_binary_reader_create(record, record_len, &tx_reader);
+        assert(err == NEOC_SUCCESS);
+        neoc_transaction_view_t view;
+        err = neoc_transaction_view_parse(tx_reader, &view);
+        assert(err == NEOC_SUCCESS);
+        count += view.witness_count;
+
+        neoc_binary_reader_free(tx_reader);
+        free(record);
+    }
+
+    neoc_binary_reader_free(reader);
+    free(contents);
+    return count;
+}
+
+static size_t decode_mapped(const char *path) {
+    neoc_binary_reader_t *reader = NULL;
+    neoc_error_t err = neoc_binary_reader_map_file(path, &reader);
+    assert(err == NEOC_SUCCESS);
+
+    size_t count = 0;
+    while (!neoc_binary_reader_is_at_end(reader)) {
+        const uint8_t *record = NULL;
+        size_t record_len = 0;
+        err = neoc_binary_reader_read_var_bytes_view(reader, &record, &record_len);
+        assert(err == NEOC_SUCCESS);
+
+        neoc_binary_reader_t tx_reader;
+        err = neoc_binary_reader_init_view(&tx_reader, record, record_len);
+        assert(err == NEOC_SUCCESS);
+        neoc_transaction_view_t view;
+        err = neoc_transaction_view_parse(&tx_reader, &view);
+        assert(err == NEOC_SUCCESS);
+        count += view.witness_count;
+    }
+
+    neoc_binary_reader_free(reader);
+    return count;
+}
+
+/* Runs one pass in a child process and reports its time and peak RSS */
+static void run(const char *name, size_t (*decode)(const char *path), const char *path,
+                size_t file_bytes, size_t records) {
+    fflush(stdout);
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        double start = now_seconds();
+        size_t decoded = decode(path);
+        double elapsed = now_seconds() - start;
+        assert(decoded == records);
+
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        printf("%-15s: %7.3f s, %6.2f GiB/s, %6.1f ns/tx, peak RSS %7.1f MiB\n",
+               name, elapsed, (double)file_bytes / elapsed / (1 << 30),
+               elapsed * 1e9 / (double)records, (double)usage.ru_maxrss / 1024);
+        exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+int main(int argc, char **argv) {
+    size_t megabytes = argc > 1 ? strtoul(argv[1], NULL, 10) : 1024;
+    const char *path = argc > 2 ? argv[2] : "/tmp/neoc_chain_dump.bin";
+
+    printf("=================================================\n");
+    printf("        NeoC SDK Chain File Decode Benchmarks\n");
+    printf("=================================================\n");
+
+    neoc_error_t err = neoc_init();
+    assert(err == NEOC_SUCCESS);
+
+    size_t file_bytes = 0;
+    size_t records = write_chain_file(path, megabytes << 20, &file_bytes);
+    printf("Wall clock time, %zu MiB file, %zu transactions\n\n", megabytes, records);
+
+    run("mapped view", decode_mapped, path, file_bytes, records);
+    run("copying reader", decode_copying, path, file_bytes, records);
+
+    remove(path);
+    neoc_cleanup();
+
+    printf("\n=================================================\n");
+    printf("               Benchmarks Complete\n");
+    printf("=================================================\n");
+
+    return 0;
+}
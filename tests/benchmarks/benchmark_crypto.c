@@ -9,38 +9,49 @@
 #include <assert.h>
 #include <stdlib.h>
 #include "neoc/neoc.h"
-#include "neoc/crypto/ecdsa.h"
+#include "neoc/crypto/sign.h"
+#include "neoc/crypto/neoc_hash.h"
+#include "neoc/crypto/hash.h"
+#include "neoc/crypto/nep2.h"
 #include "neoc/utils/neoc_base58.h"
-#include "neoc/crypto/base64.h"
-#include "neoc/crypto/scrypt.h"
+#include "neoc/utils/neoc_base64.h"
+#include "neoc/utils/neoc_hex.h"
 #include "neoc/crypto/ec_key_pair.h"
 #include "neoc/wallet/account.h"
 
 #define ITERATIONS 1000
 #define WARMUP_ITERATIONS 100
+#define BATCH_SIZE 2048
+#define BATCH_KEYS 64
+#define HASH_BATCH_SIZE 4096
+#define HASH_BATCH_ROUNDS 50
 
-// Timing utilities
+// Timing utilities (monotonic wall clock)
 typedef struct {
     const char *name;
-    clock_t start;
-    clock_t end;
+    double start;
     int iterations;
 } benchmark_t;
 
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
 static void benchmark_start(benchmark_t *bench, const char *name, int iterations) {
     bench->name = name;
     bench->iterations = iterations;
-    bench->start = clock();
+    bench->start = now_seconds();
 }
 
 static void benchmark_end(benchmark_t *bench) {
-    bench->end = clock();
-    double cpu_time_used = ((double)(bench->end - bench->start)) / CLOCKS_PER_SEC;
-    double ops_per_sec = bench->iterations / cpu_time_used;
-    double us_per_op = (cpu_time_used * 1000000) / bench->iterations;
+    double elapsed = now_seconds() - bench->start;
+    double ops_per_sec = bench->iterations / elapsed;
+    double us_per_op = (elapsed * 1000000) / bench->iterations;
     
     printf("%-30s: %8.2f ops/sec, %8.2f μs/op (%d iterations in %.3fs)\n",
-           bench->name, ops_per_sec, us_per_op, bench->iterations, cpu_time_used);
+           bench->name, ops_per_sec, us_per_op, bench->iterations, elapsed);
 }
 
 // Benchmark key generation
@@ -51,7 +62,7 @@ static void benchmark_key_generation(void) {
     // Warmup
     for (int i = 0; i < WARMUP_ITERATIONS; i++) {
         neoc_ec_key_pair_t *key_pair = NULL;
-        neoc_ec_key_pair_create(&key_pair);
+        neoc_ec_key_pair_create_random(&key_pair);
         neoc_ec_key_pair_free(key_pair);
     }
     
@@ -59,7 +70,22 @@ static void benchmark_key_generation(void) {
     benchmark_start(&bench, "EC Key Pair Generation", ITERATIONS);
     for (int i = 0; i < ITERATIONS; i++) {
         neoc_ec_key_pair_t *key_pair = NULL;
-        neoc_error_t err = neoc_ec_key_pair_create(&key_pair);
+        neoc_error_t err = neoc_ec_key_pair_create_random(&key_pair);
+        assert(err == NEOC_SUCCESS);
+        neoc_ec_key_pair_free(key_pair);
+    }
+    benchmark_end(&bench);
+    
+    // Benchmark key import (exercises curve setup and public key derivation)
+    uint8_t private_key[32];
+    for (int i = 0; i < 32; i++) {
+        private_key[i] = (uint8_t)(i + 1);
+    }
+    benchmark_start(&bench, "EC Key Import (private key)", ITERATIONS * 5);
+    for (int i = 0; i < ITERATIONS * 5; i++) {
+        neoc_ec_key_pair_t *key_pair = NULL;
+        private_key[31] = (uint8_t)i;
+        neoc_error_t err = neoc_ec_key_pair_create_from_private_key(private_key, &key_pair);
         assert(err == NEOC_SUCCESS);
         neoc_ec_key_pair_free(key_pair);
     }
@@ -83,7 +109,7 @@ static void benchmark_signing(void) {
     
     // Create a key pair for signing
     neoc_ec_key_pair_t *key_pair = NULL;
-    neoc_error_t err = neoc_ec_key_pair_create(&key_pair);
+    neoc_error_t err = neoc_ec_key_pair_create_random(&key_pair);
     assert(err == NEOC_SUCCESS);
     
     // Test data
@@ -94,44 +120,118 @@ static void benchmark_signing(void) {
     
     // Warmup
     for (int i = 0; i < WARMUP_ITERATIONS; i++) {
-        uint8_t signature[64];
-        size_t sig_len = sizeof(signature);
-        neoc_ecdsa_sign(key_pair, message, sizeof(message), signature, &sig_len);
+        neoc_signature_data_t *sig_data = NULL;
+        neoc_sign_message(message, sizeof(message), key_pair, &sig_data);
+        neoc_signature_data_free(sig_data);
     }
     
     // Benchmark signing
     benchmark_start(&bench, "ECDSA Sign", ITERATIONS);
     for (int i = 0; i < ITERATIONS; i++) {
-        uint8_t signature[64];
-        size_t sig_len = sizeof(signature);
-        err = neoc_ecdsa_sign(key_pair, message, sizeof(message), signature, &sig_len);
+        neoc_signature_data_t *sig_data = NULL;
+        err = neoc_sign_message(message, sizeof(message), key_pair, &sig_data);
+        assert(err == NEOC_SUCCESS);
+        neoc_signature_data_free(sig_data);
+    }
+    benchmark_end(&bench);
+    
+    // Benchmark witness signing (no recovery ID)
+    uint8_t message_hash[32];
+    err = neoc_sha256(message, sizeof(message), message_hash);
+    assert(err == NEOC_SUCCESS);
+    benchmark_start(&bench, "ECDSA Sign (hash, no recovery)", ITERATIONS);
+    for (int i = 0; i < ITERATIONS; i++) {
+        uint8_t fast_signature[64];
+        err = neoc_sign_hash_fast(message_hash, key_pair, fast_signature);
         assert(err == NEOC_SUCCESS);
     }
     benchmark_end(&bench);
     
     // Create a signature for verification
-    uint8_t signature[64];
-    size_t sig_len = sizeof(signature);
-    err = neoc_ecdsa_sign(key_pair, message, sizeof(message), signature, &sig_len);
+    neoc_signature_data_t *signature = NULL;
+    err = neoc_sign_message(message, sizeof(message), key_pair, &signature);
     assert(err == NEOC_SUCCESS);
     
     // Get public key
-    neoc_ec_public_key_t *pub_key = neoc_ec_key_pair_get_public_key(key_pair);
-    assert(pub_key != NULL);
+    neoc_ec_public_key_t *pub_key = NULL;
+    err = neoc_ec_key_pair_get_public_key_object(key_pair, &pub_key);
+    assert(err == NEOC_SUCCESS);
     
     // Benchmark verification
     benchmark_start(&bench, "ECDSA Verify", ITERATIONS);
     for (int i = 0; i < ITERATIONS; i++) {
-        bool valid = false;
-        err = neoc_ecdsa_verify(pub_key, message, sizeof(message), signature, sig_len, &valid);
-        assert(err == NEOC_SUCCESS);
+        bool valid = neoc_verify_signature(message, sizeof(message), signature, pub_key);
         assert(valid == true);
+        (void)valid;
     }
     benchmark_end(&bench);
     
+    neoc_signature_data_free(signature);
+    neoc_ec_public_key_free(pub_key);
     neoc_ec_key_pair_free(key_pair);
 }
 
+// Benchmark witness-style batch verification (wall clock, batch uses threads)
+static void benchmark_batch_verification(void) {
+    printf("\n=== Batch Verification Benchmarks ===\n");
+    
+    neoc_ec_key_pair_t *key_pairs[BATCH_KEYS];
+    for (int i = 0; i < BATCH_KEYS; i++) {
+        neoc_error_t err = neoc_ec_key_pair_create_random(&key_pairs[i]);
+        assert(err == NEOC_SUCCESS);
+    }
+    
+    static uint8_t message_bytes[BATCH_SIZE][32];
+    static const uint8_t *messages[BATCH_SIZE];
+    static size_t message_lens[BATCH_SIZE];
+    static neoc_signature_data_t *sig_data[BATCH_SIZE];
+    static const neoc_signature_data_t *signatures[BATCH_SIZE];
+    static const neoc_ec_public_key_t *public_keys[BATCH_SIZE];
+    static bool results[BATCH_SIZE];
+    
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        memset(message_bytes[i], i & 0xFF, sizeof(message_bytes[i]));
+        message_bytes[i][0] = (uint8_t)(i >> 8);
+        messages[i] = message_bytes[i];
+        message_lens[i] = sizeof(message_bytes[i]);
+        neoc_error_t err = neoc_sign_message(messages[i], message_lens[i],
+                                             key_pairs[i % BATCH_KEYS], &sig_data[i]);
+        assert(err == NEOC_SUCCESS);
+        signatures[i] = sig_data[i];
+        public_keys[i] = key_pairs[i % BATCH_KEYS]->public_key;
+    }
+    
+    double start = now_seconds();
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        results[i] = neoc_verify_signature(messages[i], message_lens[i],
+                                           signatures[i], public_keys[i]);
+        assert(results[i]);
+    }
+    double elapsed = now_seconds() - start;
+    printf("%-30s: %8.2f sigs/sec, %8.2f μs/sig (%d signatures in %.3fs)\n",
+           "Verify (one at a time)", BATCH_SIZE / elapsed, elapsed * 1e6 / BATCH_SIZE,
+           BATCH_SIZE, elapsed);
+    
+    start = now_seconds();
+    neoc_error_t err = neoc_verify_signatures_batch(messages, message_lens, signatures,
+                                                    public_keys, BATCH_SIZE, results);
+    elapsed = now_seconds() - start;
+    assert(err == NEOC_SUCCESS);
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        assert(results[i]);
+    }
+    printf("%-30s: %8.2f sigs/sec, %8.2f μs/sig (%d signatures in %.3fs)\n",
+           "Verify (batch)", BATCH_SIZE / elapsed, elapsed * 1e6 / BATCH_SIZE,
+           BATCH_SIZE, elapsed);
+    
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        neoc_signature_data_free(sig_data[i]);
+    }
+    for (int i = 0; i < BATCH_KEYS; i++) {
+        neoc_ec_key_pair_free(key_pairs[i]);
+    }
+}
+
 // Benchmark encoding operations
 static void benchmark_encoding(void) {
     printf("\n=== Encoding Benchmarks ===\n");
@@ -139,7 +239,7 @@ static void benchmark_encoding(void) {
     
     // Test data
     uint8_t binary_data[256];
-    for (int i = 0; i < sizeof(binary_data); i++) {
+    for (size_t i = 0; i < sizeof(binary_data); i++) {
         binary_data[i] = i;
     }
     
@@ -167,6 +267,25 @@ static void benchmark_encoding(void) {
     }
     benchmark_end(&bench);
     
+    // Benchmark address conversion (ops/sec = addresses/sec)
+    neoc_hash160_t script_hash;
+    memcpy(script_hash.data, binary_data + 100, sizeof(script_hash.data));
+    char address[NEOC_BASE58_ADDRESS_MAX_LENGTH + 1];
+    benchmark_start(&bench, "Address Encode", ITERATIONS * 100);
+    for (int i = 0; i < ITERATIONS * 100; i++) {
+        script_hash.data[0] = (uint8_t)i;
+        neoc_error_t err = neoc_hash160_to_address(&script_hash, address, sizeof(address));
+        assert(err == NEOC_SUCCESS);
+    }
+    benchmark_end(&bench);
+    
+    benchmark_start(&bench, "Address Decode", ITERATIONS * 100);
+    for (int i = 0; i < ITERATIONS * 100; i++) {
+        neoc_error_t err = neoc_hash160_from_address(&script_hash, address);
+        assert(err == NEOC_SUCCESS);
+    }
+    benchmark_end(&bench);
+    
     // Benchmark Base64 encoding
     benchmark_start(&bench, "Base64 Encode", ITERATIONS * 10);
     for (int i = 0; i < ITERATIONS * 10; i++) {
@@ -181,13 +300,66 @@ static void benchmark_encoding(void) {
     // Benchmark Base64 decoding
     benchmark_start(&bench, "Base64 Decode", ITERATIONS * 10);
     for (int i = 0; i < ITERATIONS * 10; i++) {
-        decoded_len = sizeof(decoded);
-        neoc_error_t err = neoc_base64_decode(encoded, decoded, &decoded_len);
+        decoded_len = 0;
+        neoc_error_t err = neoc_base64_decode(encoded, decoded, sizeof(decoded), &decoded_len);
         assert(err == NEOC_SUCCESS);
     }
     benchmark_end(&bench);
 }
 
+// The per-byte sprintf encoder neoc_hex_encode used to be, kept as a baseline
+static void hex_encode_sprintf(const uint8_t *data, size_t len, char *out) {
+    for (size_t i = 0; i < len; i++) {
+        sprintf(out + i * 2, "%02x", data[i]);
+    }
+}
+
+// Benchmark hex encoding and decoding at hash and large script sizes
+static void benchmark_hex(void) {
+    printf("\n=== Hex Codec Benchmarks ===\n");
+    benchmark_t bench;
+
+    static uint8_t data[65536];
+    static char hex[2 * sizeof(data) + 1];
+    static uint8_t decoded[sizeof(data)];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    const size_t sizes[] = { 32, sizeof(data) };
+    const int iterations[] = { ITERATIONS * 1000, 200 };
+    char name[64];
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t len = sizes[s];
+        const char *label = len == 32 ? "32 B" : "64 KB";
+
+        snprintf(name, sizeof(name), "Hex Encode sprintf (%s)", label);
+        benchmark_start(&bench, name, iterations[s]);
+        for (int i = 0; i < iterations[s]; i++) {
+            hex_encode_sprintf(data, len, hex);
+        }
+        benchmark_end(&bench);
+
+        snprintf(name, sizeof(name), "Hex Encode (%s)", label);
+        benchmark_start(&bench, name, iterations[s]);
+        for (int i = 0; i < iterations[s]; i++) {
+            neoc_error_t err = neoc_hex_encode(data, len, hex, sizeof(hex), false, false);
+            assert(err == NEOC_SUCCESS);
+        }
+        benchmark_end(&bench);
+
+        snprintf(name, sizeof(name), "Hex Decode (%s)", label);
+        benchmark_start(&bench, name, iterations[s]);
+        for (int i = 0; i < iterations[s]; i++) {
+            neoc_error_t err = neoc_hex_decode(hex, decoded, sizeof(decoded), NULL);
+            assert(err == NEOC_SUCCESS);
+        }
+        benchmark_end(&bench);
+        assert(memcmp(decoded, data, len) == 0);
+    }
+}
+
 // Benchmark hashing operations
 static void benchmark_hashing(void) {
     printf("\n=== Hashing Benchmarks ===\n");
@@ -195,7 +367,7 @@ static void benchmark_hashing(void) {
     
     // Test data
     uint8_t data[1024];
-    for (int i = 0; i < sizeof(data); i++) {
+    for (size_t i = 0; i < sizeof(data); i++) {
         data[i] = i & 0xFF;
     }
     
@@ -238,48 +410,138 @@ static void benchmark_hashing(void) {
     benchmark_end(&bench);
 }
 
+// Runs one batch hash configuration and reports per-message cost
+static void report_hash_batch(const char *name, size_t msg_len, double elapsed) {
+    double messages = (double)HASH_BATCH_SIZE * HASH_BATCH_ROUNDS;
+    printf("%-30s: %8.1f ns/msg, %8.1f MB/s\n",
+           name, elapsed * 1e9 / messages, messages * (double)msg_len / elapsed / 1e6);
+}
+
+// Benchmark batched SHA256 / Hash160 on each backend the CPU supports
+static void benchmark_batch_hashing(void) {
+    printf("\n=== Batch Hashing Benchmarks ===\n");
+    printf("Wall clock, %d messages per batch\n", HASH_BATCH_SIZE);
+
+    static uint8_t message_bytes[HASH_BATCH_SIZE][64];
+    static const uint8_t *messages[HASH_BATCH_SIZE];
+    static size_t lens[HASH_BATCH_SIZE];
+    static uint8_t hashes[HASH_BATCH_SIZE * 32];
+    for (int i = 0; i < HASH_BATCH_SIZE; i++) {
+        memset(message_bytes[i], i & 0xFF, sizeof(message_bytes[i]));
+        message_bytes[i][0] = (uint8_t)(i >> 8);
+        messages[i] = message_bytes[i];
+    }
+
+    /* 64 bytes: a Merkle node pair; 40 bytes: a single-sig verification script */
+    const size_t sizes[] = { 64, 40 };
+    const neoc_hash_backend_t backends[] = {
+        NEOC_HASH_BACKEND_SCALAR, NEOC_HASH_BACKEND_SSE2,
+        NEOC_HASH_BACKEND_AVX2, NEOC_HASH_BACKEND_SHANI
+    };
+    char name[64];
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (int i = 0; i < HASH_BATCH_SIZE; i++) {
+            lens[i] = sizes[s];
+        }
+        const char *kind = s == 0 ? "SHA256" : "Hash160";
+
+        double start = now_seconds();
+        for (int r = 0; r < HASH_BATCH_ROUNDS; r++) {
+            for (int i = 0; i < HASH_BATCH_SIZE; i++) {
+                neoc_error_t err = s == 0 ? neoc_hash_sha256(messages[i], lens[i], hashes + 32 * i)
+                                          : neoc_hash_hash160(messages[i], lens[i], hashes + 20 * i);
+                assert(err == NEOC_SUCCESS);
+            }
+        }
+        snprintf(name, sizeof(name), "%s %zuB one-shot", kind, sizes[s]);
+        report_hash_batch(name, sizes[s], now_seconds() - start);
+
+        for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+            if (neoc_hash_set_backend(backends[b]) != NEOC_SUCCESS) {
+                continue;
+            }
+            start = now_seconds();
+            for (int r = 0; r < HASH_BATCH_ROUNDS; r++) {
+                neoc_error_t err = s == 0 ? neoc_hash_sha256_batch(messages, lens, HASH_BATCH_SIZE, hashes)
+                                          : neoc_hash_hash160_batch(messages, lens, HASH_BATCH_SIZE, hashes);
+                assert(err == NEOC_SUCCESS);
+            }
+            snprintf(name, sizeof(name), "%s %zuB batch %s", kind, sizes[s],
+                     neoc_hash_backend_name(backends[b]));
+            report_hash_batch(name, sizes[s], now_seconds() - start);
+        }
+    }
+    neoc_hash_set_backend(NEOC_HASH_BACKEND_AUTO);
+    printf("Auto-selected backend: %s\n", neoc_hash_backend_name(neoc_hash_get_backend()));
+}
+
 // Benchmark key derivation
 static void benchmark_key_derivation(void) {
     printf("\n=== Key Derivation Benchmarks ===\n");
     benchmark_t bench;
     
     const char *password = "TestPassword123!";
-    uint8_t salt[8] = {1, 2, 3, 4, 5, 6, 7, 8};
-    uint8_t derived_key[32];
-    
-    // Benchmark Scrypt (low parameters for speed)
-    neoc_scrypt_params_t params = {
-        .n = 256,    // Low N for benchmarking
-        .r = 1,
-        .p = 1
-    };
+    uint8_t private_key[32];
+    for (int i = 0; i < 32; i++) {
+        private_key[i] = (uint8_t)(0x40 + i);
+    }
+    char encrypted[64];
     
-    benchmark_start(&bench, "Scrypt (N=256)", 10);  // Fewer iterations for slow operation
+    // Benchmark NEP-2 (scrypt) with light parameters
+    benchmark_start(&bench, "NEP-2 Encrypt (light)", 10);  // Fewer iterations for slow operation
     for (int i = 0; i < 10; i++) {
-        neoc_error_t err = neoc_scrypt(
-            (uint8_t*)password, strlen(password),
-            salt, sizeof(salt),
-            params.n, params.r, params.p,
-            derived_key, sizeof(derived_key)
-        );
+        neoc_error_t err = neoc_nep2_encrypt(private_key, password, &NEOC_NEP2_LIGHT_PARAMS,
+                                             encrypted, sizeof(encrypted));
         assert(err == NEOC_SUCCESS);
     }
     benchmark_end(&bench);
     
-    // Benchmark with higher parameters (more realistic)
-    params.n = 16384;  // Standard N
-    
-    benchmark_start(&bench, "Scrypt (N=16384)", 3);  // Very few iterations
+    // Benchmark with standard parameters (more realistic)
+    benchmark_start(&bench, "NEP-2 Encrypt (default)", 3);  // Very few iterations
     for (int i = 0; i < 3; i++) {
-        neoc_error_t err = neoc_scrypt(
-            (uint8_t*)password, strlen(password),
-            salt, sizeof(salt),
-            params.n, params.r, params.p,
-            derived_key, sizeof(derived_key)
-        );
+        neoc_error_t err = neoc_nep2_encrypt(private_key, password, &NEOC_NEP2_DEFAULT_PARAMS,
+                                             encrypted, sizeof(encrypted));
         assert(err == NEOC_SUCCESS);
     }
     benchmark_end(&bench);
+    
+    // Wallet unlock: decrypt a set of keys one by one, then as a batch (wall clock)
+    enum { UNLOCK_KEYS = 16 };
+    static char unlock_keys[UNLOCK_KEYS][64];
+    const char *unlock_key_ptrs[UNLOCK_KEYS];
+    for (int i = 0; i < UNLOCK_KEYS; i++) {
+        private_key[0] = (uint8_t)(0x40 + i);
+        neoc_error_t err = neoc_nep2_encrypt(private_key, password, &NEOC_NEP2_DEFAULT_PARAMS,
+                                             unlock_keys[i], sizeof(unlock_keys[i]));
+        assert(err == NEOC_SUCCESS);
+        unlock_key_ptrs[i] = unlock_keys[i];
+    }
+    uint8_t decrypted[UNLOCK_KEYS * 32];
+    neoc_error_t results[UNLOCK_KEYS];
+    
+    double start = now_seconds();
+    for (int i = 0; i < UNLOCK_KEYS; i++) {
+        neoc_error_t err = neoc_nep2_decrypt(unlock_key_ptrs[i], password, &NEOC_NEP2_DEFAULT_PARAMS,
+                                             decrypted + 32 * i, 32);
+        assert(err == NEOC_SUCCESS);
+    }
+    double serial = now_seconds() - start;
+    
+    start = now_seconds();
+    neoc_error_t err = neoc_nep2_decrypt_batch(unlock_key_ptrs, password, &NEOC_NEP2_DEFAULT_PARAMS,
+                                               UNLOCK_KEYS, 0, decrypted, results, NULL, NULL);
+    assert(err == NEOC_SUCCESS);
+    double batched = now_seconds() - start;
+    for (int i = 0; i < UNLOCK_KEYS; i++) {
+        assert(results[i] == NEOC_SUCCESS);
+    }
+    (void)err;
+    
+    printf("%-30s: %8.2f keys/sec wall clock (%d keys in %.3fs)\n",
+           "NEP-2 Decrypt serial", UNLOCK_KEYS / serial, UNLOCK_KEYS, serial);
+    printf("%-30s: %8.2f keys/sec wall clock (%d keys in %.3fs)\n",
+           "NEP-2 Decrypt batch", UNLOCK_KEYS / batched, UNLOCK_KEYS, batched);
 }
 
 int main(void) {
@@ -287,7 +549,7 @@ int main(void) {
     printf("         NeoC SDK Crypto Benchmarks\n");
     printf("=================================================\n");
     printf("CPU: Performance measured in operations per second\n");
-    printf("All times are CPU time, not wall clock time\n");
+    printf("All times are monotonic wall clock time\n");
     
     // Initialize NeoC
     neoc_error_t err = neoc_init();
@@ -296,8 +558,11 @@ int main(void) {
     // Run benchmarks
     benchmark_key_generation();
     benchmark_signing();
+    benchmark_batch_verification();
     benchmark_encoding();
+    benchmark_hex();
     benchmark_hashing();
+    benchmark_batch_hashing();
     benchmark_key_derivation();
     
     // Cleanup
@@ -0,0 +1,116 @@
+/**
+ * @file benchmark_memory.c
+ * @brief Allocation throughput benchmarks for neoc_malloc/neoc_free
+ *
+ * Measures alloc/free pairs per second at 1, 4 and 16 threads while a
+ * large set of long-lived allocations is outstanding, which is where the
+ * allocation tracker's lookup cost shows up.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "neoc/neoc.h"
+#include "neoc/neoc_memory.h"
+
+#define LIVE_OBJECTS 50000
+#define RING_SIZE 1024
+#define OPS_PER_THREAD 200000
+
+typedef struct {
+    int ops;
+    unsigned int seed;
+} worker_args_t;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void *alloc_free_worker(void *arg) {
+    worker_args_t *args = (worker_args_t *)arg;
+    void *ring[RING_SIZE];
+    unsigned int seed = args->seed;
+
+    for (int i = 0; i < RING_SIZE; i++) {
+        ring[i] = neoc_malloc(64);
+        assert(ring[i] != NULL);
+    }
+    /* FIFO churn: always release the oldest object, as long-lived wallets do */
+    for (int done = 0; done < args->ops; done++) {
+        int slot = done % RING_SIZE;
+        neoc_free(ring[slot]);
+        seed = seed * 1103515245u + 12345u;
+        ring[slot] = neoc_malloc(16 + (seed >> 16) % 240);
+        assert(ring[slot] != NULL);
+    }
+    for (int i = 0; i < RING_SIZE; i++) {
+        neoc_free(ring[i]);
+    }
+    return NULL;
+}
+
+static void benchmark_threads(int thread_count) {
+    pthread_t threads[16];
+    worker_args_t args[16];
+
+    double start = now_seconds();
+    for (int t = 0; t < thread_count; t++) {
+        args[t].ops = OPS_PER_THREAD;
+        args[t].seed = (unsigned int)(t + 1) * 2654435761u;
+        pthread_create(&threads[t], NULL, alloc_free_worker, &args[t]);
+    }
+    for (int t = 0; t < thread_count; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double elapsed = now_seconds() - start;
+
+    double total_ops = (double)thread_count * OPS_PER_THREAD;
+    printf("%2d thread(s): %12.0f alloc+free/sec, %8.1f ns/pair (%.0f pairs in %.3fs)\n",
+           thread_count, total_ops / elapsed, elapsed * 1e9 / total_ops,
+           total_ops, elapsed);
+}
+
+int main(void) {
+    printf("=================================================\n");
+    printf("        NeoC SDK Allocation Benchmarks\n");
+    printf("=================================================\n");
+    printf("Wall clock time, %d live objects outstanding\n\n", LIVE_OBJECTS);
+
+    neoc_error_t err = neoc_init();
+    assert(err == NEOC_SUCCESS);
+
+    /* Simulate a wallet holding many live objects */
+    void **live = calloc(LIVE_OBJECTS, sizeof(void *));
+    assert(live != NULL);
+    for (int i = 0; i < LIVE_OBJECTS; i++) {
+        live[i] = neoc_malloc(64);
+        assert(live[i] != NULL);
+    }
+
+    const int thread_counts[] = {1, 4, 16};
+    for (size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++) {
+        benchmark_threads(thread_counts[i]);
+    }
+
+    for (int i = 0; i < LIVE_OBJECTS; i++) {
+        neoc_free(live[i]);
+    }
+    free(live);
+
+    neoc_memory_stats_t stats;
+    neoc_get_memory_stats(&stats);
+    printf("\nOutstanding bytes after cleanup: %zu\n", stats.current_allocated);
+
+    neoc_cleanup();
+
+    printf("\n=================================================\n");
+    printf("               Benchmarks Complete\n");
+    printf("=================================================\n");
+
+    return 0;
+}
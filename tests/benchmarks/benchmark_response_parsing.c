@@ -0,0 +1,198 @@
+/**
+ * @file benchmark_response_parsing.c
+ * @brief Benchmarks for RPC response parsing with heap and arena allocation
+ *
+ * Parses a synthetic full getblock result (header plus transactions) with
+ * neoc_neo_block_from_json/neoc_neo_block_free, with
+ * neoc_neo_block_from_json_arena/neoc_arena_reset, and with the streaming
+ * neoc_neo_block_decoder_t fed in 16 KiB chunks the way a curl write
+ * callback delivers them. The peak number of bytes held in JSON trees is
+ * tracked through cJSON hooks.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include "neoc/neoc.h"
+#include "neoc/neoc_memory.h"
+#include "neoc/protocol/core/response/neo_block.h"
+#include <cjson/cJSON.h>
+
+#define ITERATIONS 200
+#define TX_PER_BLOCK 500
+#define CHUNK_SIZE 16384
+
+static size_t json_live_bytes;
+static size_t json_peak_bytes;
+
+/* cJSON hooks that track live bytes; the size is kept in front of each block */
+static void *tracking_malloc(size_t size) {
+    size_t *block = malloc(sizeof(max_align_t) + size);
+    if (!block) {
+        return NULL;
+    }
+    *block = size;
+    json_live_bytes += size;
+    if (json_live_bytes > json_peak_bytes) {
+        json_peak_bytes = json_live_bytes;
+    }
+    return (char *)block + sizeof(max_align_t);
+}
+
+static void tracking_free(void *ptr) {
+    if (!ptr) {
+        return;
+    }
+    size_t *block = (size_t *)((char *)ptr - sizeof(max_align_t));
+    json_live_bytes -= *block;
+    free(block);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static char *build_getblock_result(int tx_count) {
+    static const char *header =
+        "{\"hash\":\"0x1d5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f00\","
+        "\"size\":1024,\"version\":0,"
+        "\"previousblockhash\":\"0x2a5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f01\","
+        "\"merkleroot\":\"0x3b5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f02\","
+        "\"time\":1700000000000,\"nonce\":\"7F0A3D2C1B4E5F60\",\"index\":4000000,"
+        "\"primary\":3,\"nextconsensus\":\"NgPkjjLTNcQad99iRYeXRUuowE4gxLAnDL\","
+        "\"witnesses\":[],\"confirmations\":12,\"tx\":[";
+    static const char *tx_format =
+        "%s{\"hash\":\"0x%064x\",\"size\":252,\"version\":0,\"nonce\":%d,"
+        "\"sender\":\"NgPkjjLTNcQad99iRYeXRUuowE4gxLAnDL\",\"sysfee\":\"997775\","
+        "\"netfee\":\"1234520\",\"validuntilblock\":4005760,"
+        "\"signers\":[{\"account\":\"0x69ecca587293047be4c59159bf8bc399985c160d\","
+        "\"scopes\":\"CalledByEntry\"}],\"attributes\":[],"
+        "\"script\":\"0c14ebb1e52e0fa2ae21ea3df4bd3e6bd1b8b2c3d4e5110c146d0b0a69ecca587293047be4c59159bf8bc399985c160d14c01f0c087472616e736665720c14cf76e28bd0062c4a478ee35561011319f3cfa4d241627d5b52\","
+        "\"witnesses\":[{\"invocation\":\"DEBAbF6m7VRQ0L3N7E3gHG0tS9JpyyqW1Il9xWgPUk0Dh2TvlAUDY3c5NFbk0tK4e5Lx1lpNWk3gcqLqoMhQ8p7v\","
+        "\"verification\":\"DCEDAjGr3rU9OyG3w8Jl6hJ6F5RzdTSTi1yBhrswtvZWk0VBVuezJw==\"}]}";
+
+    size_t capacity = strlen(header) + (size_t)tx_count * 1024 + 8;
+    char *json = malloc(capacity);
+    assert(json != NULL);
+
+    size_t len = (size_t)snprintf(json, capacity, "%s", header);
+    for (int i = 0; i < tx_count; i++) {
+        len += (size_t)snprintf(json + len, capacity - len, tx_format,
+                                i == 0 ? "" : ",", (unsigned int)i, i);
+    }
+    snprintf(json + len, capacity - len, "]}");
+    return json;
+}
+
+static void report(const char *name, double elapsed, size_t allocations) {
+    printf("%-24s: %8.2f blocks/sec, %9.1f us/block, %8.1f neoc allocs/block, %8.1f KiB peak JSON\n",
+           name, ITERATIONS / elapsed, elapsed * 1e6 / ITERATIONS,
+           (double)allocations / ITERATIONS, (double)json_peak_bytes / 1024);
+    json_peak_bytes = json_live_bytes;
+}
+
+static void benchmark_heap(const char *json) {
+    neoc_memory_stats_t before, after;
+    neoc_get_memory_stats(&before);
+
+    double start = now_seconds();
+    for (int i = 0; i < ITERATIONS; i++) {
+        neoc_neo_block_t *block = neoc_neo_block_from_json(json);
+        assert(block != NULL && block->transaction_count == TX_PER_BLOCK);
+        neoc_neo_block_free(block);
+    }
+    double elapsed = now_seconds() - start;
+
+    neoc_get_memory_stats(&after);
+    report("getblock (heap)", elapsed, after.allocation_count - before.allocation_count);
+}
+
+static void benchmark_arena(const char *json) {
+    neoc_arena_t *arena = NULL;
+    neoc_error_t err = neoc_arena_create(0, &arena);
+    assert(err == NEOC_SUCCESS);
+
+    neoc_memory_stats_t before, after;
+    neoc_get_memory_stats(&before);
+
+    double start = now_seconds();
+    for (int i = 0; i < ITERATIONS; i++) {
+        neoc_neo_block_t *block = neoc_neo_block_from_json_arena(json, arena);
+        assert(block != NULL && block->transaction_count == TX_PER_BLOCK);
+        neoc_arena_reset(arena);
+    }
+    double elapsed = now_seconds() - start;
+
+    neoc_get_memory_stats(&after);
+    report("getblock (arena)", elapsed, after.allocation_count - before.allocation_count);
+    neoc_arena_free(arena);
+}
+
+static void benchmark_streamed(const char *json) {
+    size_t length = strlen(json);
+    neoc_memory_stats_t before, after;
+    neoc_get_memory_stats(&before);
+
+    double start = now_seconds();
+    for (int i = 0; i < ITERATIONS; i++) {
+        neoc_neo_block_decoder_t *decoder = NULL;
+        neoc_error_t err = neoc_neo_block_decoder_create(false, &decoder);
+        assert(err == NEOC_SUCCESS);
+        neoc_json_stream_t *stream = neoc_neo_block_decoder_stream(decoder);
+        for (size_t offset = 0; offset < length; offset += CHUNK_SIZE) {
+            size_t n = length - offset < CHUNK_SIZE ? length - offset : CHUNK_SIZE;
+            err = neoc_json_stream_feed(stream, json + offset, n);
+            assert(err == NEOC_SUCCESS);
+        }
+        err = neoc_json_stream_finish(stream);
+        assert(err == NEOC_SUCCESS);
+
+        neoc_neo_block_t *block = NULL;
+        err = neoc_neo_block_decoder_finish(decoder, &block);
+        assert(err == NEOC_SUCCESS && block->transaction_count == TX_PER_BLOCK);
+        neoc_neo_block_decoder_free(decoder);
+        neoc_neo_block_free(block);
+    }
+    double elapsed = now_seconds() - start;
+
+    neoc_get_memory_stats(&after);
+    report("getblock (streamed)", elapsed, after.allocation_count - before.allocation_count);
+}
+
+int main(void) {
+    printf("=================================================\n");
+    printf("      NeoC SDK Response Parsing Benchmarks\n");
+    printf("=================================================\n");
+    printf("Wall clock time, %d transactions per block\n\n", TX_PER_BLOCK);
+
+    neoc_error_t err = neoc_init();
+    assert(err == NEOC_SUCCESS);
+
+    cJSON_Hooks hooks = { tracking_malloc, tracking_free };
+    cJSON_InitHooks(&hooks);
+
+    char *json = build_getblock_result(TX_PER_BLOCK);
+    printf("Response size %zu bytes\n\n", strlen(json));
+
+    /* Warm up allocator and caches */
+    neoc_neo_block_free(neoc_neo_block_from_json(json));
+    json_peak_bytes = json_live_bytes;
+
+    benchmark_heap(json);
+    benchmark_arena(json);
+    benchmark_streamed(json);
+
+    free(json);
+    neoc_cleanup();
+
+    printf("\n=================================================\n");
+    printf("               Benchmarks Complete\n");
+    printf("=================================================\n");
+
+    return 0;
+}
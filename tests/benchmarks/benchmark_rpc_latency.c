@@ -0,0 +1,115 @@
+/**
+ * @file benchmark_rpc_latency.c
+ * @brief Sequential JSON-RPC latency against a loopback stub node
+ *
+ * Starts the loopback stub node (tests/support/stub_http_server.c) answering
+ * every POST with a getblockcount result, then issues sequential calls:
+ * once with a fresh URL session per call (a new connection every time)
+ * and once through a single neoc_service_t, whose session reuses its
+ * connection.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "neoc/neoc.h"
+#include "neoc/protocol/service.h"
+#include "neoc/protocol/core/request.h"
+#include "neoc/protocol/core/response.h"
+#include "neoc/utils/url_session.h"
+#include "stub_http_server.h"
+
+#define CALLS 10000
+
+static const char *STUB_BODY = "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":4000000}";
+
+static stub_http_server_t stub;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void report(const char *name, double elapsed, int connections) {
+    printf("%-34s: %8.1f calls/sec, %7.1f us/call, %5d connection(s)\n",
+           name, CALLS / elapsed, elapsed * 1e6 / CALLS, connections);
+}
+
+static void benchmark_fresh_sessions(const char *url) {
+    const char *payload = "{\"jsonrpc\":\"2.0\",\"method\":\"getblockcount\",\"params\":[],\"id\":1}";
+    int before = atomic_load(&stub.connections);
+
+    double start = now_seconds();
+    for (int i = 0; i < CALLS; i++) {
+        neoc_url_session_t *session = NULL;
+        neoc_error_t err = neoc_url_session_create(&session);
+        assert(err == NEOC_SUCCESS);
+        neoc_http_response_t *response = NULL;
+        err = neoc_url_session_post_json(session, url, payload, &response);
+        assert(err == NEOC_SUCCESS && response->status_code == 200);
+        neoc_http_response_free(response);
+        neoc_url_session_free(session);
+    }
+    double elapsed = now_seconds() - start;
+
+    report("getblockcount (session per call)", elapsed,
+           atomic_load(&stub.connections) - before);
+}
+
+static void benchmark_service(const char *url) {
+    neoc_service_config_t *config = NULL;
+    neoc_error_t err = neoc_service_config_create_default(url, &config);
+    assert(err == NEOC_SUCCESS);
+    neoc_service_t *service = NULL;
+    err = neoc_service_create(NEOC_SERVICE_TYPE_HTTP, config, &service);
+    assert(err == NEOC_SUCCESS);
+    neoc_service_config_free(config);
+
+    int before = atomic_load(&stub.connections);
+
+    double start = now_seconds();
+    for (int i = 0; i < CALLS; i++) {
+        neoc_request_t *request = neoc_request_create("getblockcount", "[]", service);
+        assert(request != NULL);
+        neoc_response_t *response = NULL;
+        err = neoc_service_send_request(service, request, &response);
+        assert(err == NEOC_SUCCESS && response != NULL);
+        neoc_response_free(response);
+        neoc_request_free(request);
+    }
+    double elapsed = now_seconds() - start;
+
+    report("getblockcount (neoc_service_t)", elapsed,
+           atomic_load(&stub.connections) - before);
+    neoc_service_free(service);
+}
+
+int main(void) {
+    printf("=================================================\n");
+    printf("        NeoC SDK RPC Latency Benchmarks\n");
+    printf("=================================================\n");
+    printf("Wall clock time, %d sequential calls to a loopback stub\n\n", CALLS);
+
+    neoc_error_t err = neoc_init();
+    assert(err == NEOC_SUCCESS);
+
+    int started = stub_http_server_start_fixed(&stub, STUB_BODY);
+    assert(started == 0);
+    const char *url = stub.url;
+
+    benchmark_fresh_sessions(url);
+    benchmark_service(url);
+
+    stub_http_server_stop(&stub);
+    neoc_cleanup();
+
+    printf("\n=================================================\n");
+    printf("               Benchmarks Complete\n");
+    printf("=================================================\n");
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file benchmark_rpc_pipeline.c
+ * @brief JSON handling cost of an invokefunction call against a loopback stub node
+ *
+ * Compares the text pipeline an invokefunction call used to take (print the
+ * parameter tree, parse it back into a request object, print the request,
+ * print the result node and parse that text again) with neoc_rpc_call_json,
+ * which prints the parameters straight into the client's request buffer and
+ * hands back the parsed result node. Allocations are counted through cJSON
+ * hooks and the neoc allocator statistics; the HTTP transport is the same
+ * for both.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <cjson/cJSON.h>
+#include "neoc/neoc.h"
+#include "neoc/neoc_memory.h"
+#include "neoc/protocol/rpc_client.h"
+#include "stub_http_server.h"
+
+#define CALLS 5000
+#define STACK_ITEMS 32
+
+static char *stub_response;
+static stub_http_server_t stub;
+static size_t cjson_allocations;
+
+static void *counting_malloc(size_t size) {
+    cjson_allocations++;
+    return malloc(size);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* An invokefunction result with STACK_ITEMS integers on the stack */
+static char *build_stub_response(void) {
+    size_t capacity = 1024 + STACK_ITEMS * 64;
+    char *body = malloc(capacity);
+    assert(body != NULL);
+
+    size_t len = (size_t)snprintf(body, capacity,
+        "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":{"
+        "\"script\":\"EMAfDAhkZWNpbWFscwwU++3+LtIiZZK2SMTal7nJzV3BpqZBYn1bUg==\","
+        "\"state\":\"HALT\",\"gasconsumed\":\"2007570\",\"exception\":null,\"stack\":[");
+    for (int i = 0; i < STACK_ITEMS; i++) {
+        len += (size_t)snprintf(body + len, capacity - len, "%s{\"type\":\"Integer\",\"value\":\"%d\"}",
+                                i == 0 ? "" : ",", 100000000 + i);
+    }
+    snprintf(body + len, capacity - len, "]}}");
+    return body;
+}
+
+/* invokefunction parameters as neoc_neo_invoke_function builds them */
+static cJSON *build_params(void) {
+    cJSON *params = cJSON_CreateArray();
+    cJSON_AddItemToArray(params, cJSON_CreateString("0xd2a4cff31913016155e38e474a2c06d08be276cf"));
+    cJSON_AddItemToArray(params, cJSON_CreateString("balanceOf"));
+    cJSON *args = cJSON_CreateArray();
+    cJSON *arg = cJSON_CreateObject();
+    cJSON_AddStringToObject(arg, "type", "Hash160");
+    cJSON_AddStringToObject(arg, "value", "0x69ecca587293047be4c59159bf8bc399985c160d");
+    cJSON_AddItemToArray(args, arg);
+    cJSON_AddItemToArray(params, args);
+    cJSON *signers = cJSON_CreateArray();
+    cJSON *signer = cJSON_CreateObject();
+    cJSON_AddStringToObject(signer, "account", "0x69ecca587293047be4c59159bf8bc399985c160d");
+    cJSON_AddStringToObject(signer, "scopes", "CalledByEntry");
+    cJSON_AddItemToArray(signers, signer);
+    cJSON_AddItemToArray(params, signers);
+    return params;
+}
+
+static int stack_size(const cJSON *result) {
+    return cJSON_GetArraySize(cJSON_GetObjectItem(result, "stack"));
+}
+
+/*
+ * The removed steps are replayed in-process around neoc_rpc_call_raw: the
+ * parameter text was parsed back and wrapped in a request object that was
+ * printed again, and the caller re-parsed the printed result.
+ */
+static int call_text_pipeline(neoc_rpc_client_t *client, cJSON *params) {
+    char *params_text = cJSON_PrintUnformatted(params);
+    cJSON *request = cJSON_CreateObject();
+    cJSON_AddStringToObject(request, "jsonrpc", "2.0");
+    cJSON_AddStringToObject(request, "method", "invokefunction");
+    cJSON_AddNumberToObject(request, "id", 1);
+    cJSON_AddItemToObject(request, "params", cJSON_Parse(params_text));
+    free(cJSON_PrintUnformatted(request));
+    cJSON_Delete(request);
+
+    char *raw = NULL;
+    neoc_error_t err = neoc_rpc_call_raw(client, "invokefunction", params_text, &raw);
+    assert(err == NEOC_SUCCESS);
+    free(params_text);
+
+    cJSON *result = cJSON_Parse(raw);
+    int items = stack_size(result);
+    cJSON_Delete(result);
+    neoc_free(raw);
+    return items;
+}
+
+static int call_json_pipeline(neoc_rpc_client_t *client, cJSON *params) {
+    cJSON *result = NULL;
+    neoc_error_t err = neoc_rpc_call_json(client, "invokefunction", params, &result);
+    assert(err == NEOC_SUCCESS);
+    int items = stack_size(result);
+    cJSON_Delete(result);
+    return items;
+}
+
+static void run(const char *name, const char *url,
+                int (*call)(neoc_rpc_client_t *client, cJSON *params)) {
+    neoc_rpc_client_t *client = NULL;
+    neoc_error_t err = neoc_rpc_client_create(url, &client);
+    assert(err == NEOC_SUCCESS);
+    cJSON *params = build_params();
+
+    /* Warm up the connection and the client's buffers */
+    assert(call(client, params) == STACK_ITEMS);
+
+    neoc_memory_stats_t before, after;
+    neoc_get_memory_stats(&before);
+    size_t cjson_before = cjson_allocations;
+
+    double start = now_seconds();
+    for (int i = 0; i < CALLS; i++) {
+        assert(call(client, params) == STACK_ITEMS);
+    }
+    double elapsed = now_seconds() - start;
+
+    neoc_get_memory_stats(&after);
+    printf("%-22s: %7.1f us/call, %6.1f cJSON allocs/call, %5.1f neoc allocs/call\n",
+           name, elapsed * 1e6 / CALLS,
+           (double)(cjson_allocations - cjson_before) / CALLS,
+           (double)(after.allocation_count - before.allocation_count) / CALLS);
+
+    cJSON_Delete(params);
+    neoc_rpc_client_free(client);
+}
+
+int main(void) {
+    printf("=================================================\n");
+    printf("       NeoC SDK RPC JSON Pipeline Benchmarks\n");
+    printf("=================================================\n");
+    printf("Wall clock time, %d sequential invokefunction calls, %d stack items\n\n",
+           CALLS, STACK_ITEMS);
+
+    neoc_error_t err = neoc_init();
+    assert(err == NEOC_SUCCESS);
+
+    cJSON_Hooks hooks = { counting_malloc, free };
+    cJSON_InitHooks(&hooks);
+
+    stub_response = build_stub_response();
+    int started = stub_http_server_start_fixed(&stub, stub_response);
+    assert(started == 0);
+    const char *url = stub.url;
+
+    run("text round-trips", url, call_text_pipeline);
+    run("neoc_rpc_call_json", url, call_json_pipeline);
+
+    stub_http_server_stop(&stub);
+    free(stub_response);
+    neoc_cleanup();
+
+    printf("\n=================================================\n");
+    printf("               Benchmarks Complete\n");
+    printf("=================================================\n");
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file benchmark_wallet.c
+ * @brief Bulk import of watch-only accounts and account lookups
+ *
+ * Builds watch-only accounts for N distinct script hashes (1,000,000 by
+ * default; pass a different N as the first argument), adds them to one
+ * wallet and then times lookups by address and by script hash, followed by
+ * removal of every tenth account. Account construction is timed apart from
+ * the wallet operations.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include "neoc/neoc.h"
+#include "neoc/wallet/wallet.h"
+#include "neoc/wallet/account.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void make_hash(size_t seed, neoc_hash160_t *hash) {
+    uint64_t x = (uint64_t)seed * 0x9E3779B97F4A7C15ULL + 1;
+    for (size_t i = 0; i < NEOC_HASH160_SIZE; i++) {
+        x ^= x >> 29;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        hash->data[i] = (uint8_t)(x >> 56);
+    }
+}
+
+static void report(const char *name, size_t count, double elapsed) {
+    printf("%-30s: %10.0f ops/sec, %8.3f us/op (%zu ops in %.3fs)\n",
+           name, (double)count / elapsed, elapsed * 1e6 / (double)count, count, elapsed);
+}
+
+int main(int argc, char **argv) {
+    size_t count = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    assert(count > 0);
+    neoc_error_t err = neoc_init();
+    assert(err == NEOC_SUCCESS);
+
+    printf("=== Wallet Import Benchmark (%zu watch-only accounts) ===\n", count);
+
+    neoc_account_t **accounts = malloc(count * sizeof(*accounts));
+    assert(accounts);
+    double start = now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        neoc_hash160_t hash;
+        char address[NEOC_ADDRESS_LENGTH];
+        make_hash(i, &hash);
+        err = neoc_hash160_to_address(&hash, address, sizeof(address));
+        assert(err == NEOC_SUCCESS);
+        err = neoc_account_create_from_address(address, &accounts[i]);
+        assert(err == NEOC_SUCCESS);
+    }
+    report("Create watch-only accounts", count, now_seconds() - start);
+
+    neoc_wallet_t *wallet = NULL;
+    err = neoc_wallet_create("bench", &wallet);
+    assert(err == NEOC_SUCCESS);
+    start = now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        err = neoc_wallet_add_account(wallet, accounts[i]);
+        assert(err == NEOC_SUCCESS);
+    }
+    report("Wallet add account", count, now_seconds() - start);
+
+    start = now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        neoc_account_t *found = neoc_wallet_get_account_by_address(wallet, accounts[i]->address);
+        assert(found == accounts[i]);
+        (void)found;
+    }
+    report("Lookup by address", count, now_seconds() - start);
+
+    start = now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        neoc_account_t *found = neoc_wallet_get_account_by_script_hash(wallet, &accounts[i]->script_hash);
+        assert(found == accounts[i]);
+        (void)found;
+    }
+    report("Lookup by script hash", count, now_seconds() - start);
+
+    /* remove_account frees the account, so copy the address out first */
+    size_t removed = 0;
+    start = now_seconds();
+    for (size_t i = 0; i < count; i += 10) {
+        char address[NEOC_ADDRESS_LENGTH];
+        strcpy(address, accounts[i]->address);
+        err = neoc_wallet_remove_account(wallet, address);
+        assert(err == NEOC_SUCCESS);
+        removed++;
+    }
+    report("Remove account", removed, now_seconds() - start);
+    assert(neoc_wallet_get_account_count_value(wallet) == count - removed);
+
+    neoc_wallet_free(wallet);
+    free(accounts);
+    neoc_cleanup();
+    return 0;
+}
@@ -0,0 +1,802 @@
+/**
+ * @file neoc_bench.c
+ * @brief Unified benchmark runner for hashing, signing, HD key derivation,
+ *        encoding, serialization, transactions, invocation scripts and RPC
+ *        response parsing
+ *
+ * Usage: neoc_bench [--filter TEXT] [--json PATH] [--min-time SECONDS]
+ *                   [--smoke] [--list] [--quiet]
+ *
+ * Case names are "suite/case"; --filter runs the cases whose name contains
+ * TEXT. --json writes every result for regression tracking and --smoke
+ * runs each case a handful of times to check that it still works.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_harness.h"
+#include "neoc/neoc.h"
+#include "neoc/crypto/bip32.h"
+#include "neoc/crypto/bip39.h"
+#include "neoc/crypto/ec_key_pair.h"
+#include "neoc/crypto/hash.h"
+#include "neoc/crypto/neoc_hash.h"
+#include "neoc/crypto/sign.h"
+#include "neoc/contract/contract_parameter.h"
+#include "neoc/contract/gas_token.h"
+#include "neoc/protocol/core/response/neo_block.h"
+#include "neoc/script/script_builder_full.h"
+#include "neoc/script/script_template.h"
+#include "neoc/serialization/binary_reader.h"
+#include "neoc/serialization/binary_writer.h"
+#include "neoc/transaction/transaction.h"
+#include "neoc/transaction/transaction_builder.h"
+#include "neoc/types/neoc_hash160.h"
+#include "neoc/utils/neoc_base58.h"
+#include "neoc/utils/neoc_base64.h"
+#include "neoc/utils/neoc_hex.h"
+#include "neoc/wallet/account.h"
+
+#define HASH_BATCH 64
+#define WRITER_RESET_AT 65536
+#define VAR_INT_COUNT 1000
+#define BLOCK_TX_COUNT 50
+
+static void fill_pattern(uint8_t *data, size_t len, uint8_t seed) {
+    for (size_t i = 0; i < len; i++) {
+        data[i] = (uint8_t)(i * 131 + seed);
+    }
+}
+
+/* ===== Hashing ===== */
+
+typedef struct {
+    uint8_t data[1024];
+    size_t len;
+    uint8_t digest[32];
+    const uint8_t *messages[HASH_BATCH];
+    size_t lens[HASH_BATCH];
+    uint8_t digests[HASH_BATCH * 32];
+} hash_state_t;
+
+static void case_sha256(void *state) {
+    hash_state_t *s = state;
+    BENCH_CHECK(neoc_sha256(s->data, s->len, s->digest) == NEOC_SUCCESS);
+}
+
+static void case_hash256(void *state) {
+    hash_state_t *s = state;
+    BENCH_CHECK(neoc_hash_hash256(s->data, s->len, s->digest) == NEOC_SUCCESS);
+}
+
+static void case_ripemd160(void *state) {
+    hash_state_t *s = state;
+    BENCH_CHECK(neoc_hash_ripemd160(s->data, s->len, s->digest) == NEOC_SUCCESS);
+}
+
+static void case_hash160(void *state) {
+    hash_state_t *s = state;
+    BENCH_CHECK(neoc_hash_hash160(s->data, s->len, s->digest) == NEOC_SUCCESS);
+}
+
+static void case_sha256_batch(void *state) {
+    hash_state_t *s = state;
+    BENCH_CHECK(neoc_hash_sha256_batch(s->messages, s->lens, HASH_BATCH, s->digests) == NEOC_SUCCESS);
+}
+
+static void case_hash160_batch(void *state) {
+    hash_state_t *s = state;
+    BENCH_CHECK(neoc_hash_hash160_batch(s->messages, s->lens, HASH_BATCH, s->digests) == NEOC_SUCCESS);
+}
+
+static void suite_hashing(bench_t *bench) {
+    hash_state_t s;
+    fill_pattern(s.data, sizeof(s.data), 7);
+    for (size_t i = 0; i < HASH_BATCH; i++) {
+        s.messages[i] = s.data + i * 8;
+        s.lens[i] = 33;
+    }
+
+    s.len = 32;
+    bench_run(bench, "hashing", "sha256 32B", case_sha256, &s);
+    s.len = 1024;
+    bench_run(bench, "hashing", "sha256 1KiB", case_sha256, &s);
+    bench_run(bench, "hashing", "hash256 1KiB", case_hash256, &s);
+    s.len = 32;
+    bench_run(bench, "hashing", "ripemd160 32B", case_ripemd160, &s);
+    s.len = 33;
+    bench_run(bench, "hashing", "hash160 33B", case_hash160, &s);
+    bench_run(bench, "hashing", "sha256 batch 64x33B", case_sha256_batch, &s);
+    bench_run(bench, "hashing", "hash160 batch 64x33B", case_hash160_batch, &s);
+}
+
+/* ===== Signing ===== */
+
+typedef struct {
+    neoc_ec_key_pair_t *key_pair;
+    neoc_ec_public_key_t *public_key;
+    neoc_signature_data_t *signature;
+    uint8_t message[64];
+    uint8_t hash[32];
+    uint8_t raw_signature[64];
+} sign_state_t;
+
+static void case_key_generation(void *state) {
+    (void)state;
+    neoc_ec_key_pair_t *key_pair = NULL;
+    BENCH_CHECK(neoc_ec_key_pair_create_random(&key_pair) == NEOC_SUCCESS);
+    neoc_ec_key_pair_free(key_pair);
+}
+
+static void case_sign_message(void *state) {
+    sign_state_t *s = state;
+    neoc_signature_data_t *signature = NULL;
+    BENCH_CHECK(neoc_sign_message(s->message, sizeof(s->message), s->key_pair, &signature) == NEOC_SUCCESS);
+    neoc_signature_data_free(signature);
+}
+
+static void case_sign_hash(void *state) {
+    sign_state_t *s = state;
+    BENCH_CHECK(neoc_sign_hash_fast(s->hash, s->key_pair, s->raw_signature) == NEOC_SUCCESS);
+}
+
+static void case_verify(void *state) {
+    sign_state_t *s = state;
+    BENCH_CHECK(neoc_verify_signature(s->message, sizeof(s->message), s->signature, s->public_key));
+}
+
+static void suite_signing(bench_t *bench) {
+    sign_state_t s;
+    memset(&s, 0, sizeof(s));
+    fill_pattern(s.message, sizeof(s.message), 3);
+    BENCH_CHECK(neoc_sha256(s.message, sizeof(s.message), s.hash) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_ec_key_pair_create_random(&s.key_pair) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_ec_key_pair_get_public_key_object(s.key_pair, &s.public_key) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_sign_message(s.message, sizeof(s.message), s.key_pair, &s.signature) == NEOC_SUCCESS);
+
+    bench_run(bench, "signing", "key pair generation", case_key_generation, &s);
+    bench_run(bench, "signing", "sign message 64B", case_sign_message, &s);
+    bench_run(bench, "signing", "sign hash", case_sign_hash, &s);
+    bench_run(bench, "signing", "verify message 64B", case_verify, &s);
+
+    neoc_signature_data_free(s.signature);
+    neoc_ec_public_key_free(s.public_key);
+    neoc_ec_key_pair_free(s.key_pair);
+}
+
+/* ===== HD key derivation ===== */
+
+#define HD_RANGE_COUNT 256
+#define HD_SEED_BATCH 8
+
+typedef struct {
+    neoc_bip32_key_t master;
+    neoc_bip32_key_t change;          // m/44'/888'/0'/0
+    neoc_bip32_key_t change_public;
+    neoc_bip32_context_t *context;
+    neoc_bip32_key_t keys[HD_RANGE_COUNT];
+    uint8_t seeds[HD_SEED_BATCH * 64];
+    uint32_t next_index;
+} hd_state_t;
+
+static const uint32_t hd_change_path[] = {
+    BIP32_HARDENED_KEY_START | BIP32_NEO_PURPOSE,
+    BIP32_HARDENED_KEY_START | BIP32_NEO_COIN_TYPE,
+    BIP32_HARDENED_KEY_START | BIP32_NEO_ACCOUNT,
+    BIP32_NEO_CHANGE
+};
+
+static void case_hd_derive_path(void *state) {
+    hd_state_t *s = state;
+    uint32_t indices[5];
+    memcpy(indices, hd_change_path, sizeof(hd_change_path));
+    indices[4] = s->next_index++ & 0x7FFFFFFF;
+    BENCH_CHECK(neoc_bip32_derive_path_indices(&s->master, indices, 5, &s->keys[0]) == NEOC_SUCCESS);
+}
+
+static void case_hd_context_derive(void *state) {
+    hd_state_t *s = state;
+    uint32_t indices[5];
+    memcpy(indices, hd_change_path, sizeof(hd_change_path));
+    indices[4] = s->next_index++ & 0x7FFFFFFF;
+    BENCH_CHECK(neoc_bip32_context_derive(s->context, indices, 5, &s->keys[0]) == NEOC_SUCCESS);
+}
+
+static void case_hd_range_private(void *state) {
+    hd_state_t *s = state;
+    BENCH_CHECK(neoc_bip32_derive_range(&s->change, 0, HD_RANGE_COUNT, s->keys) == NEOC_SUCCESS);
+}
+
+static void case_hd_range_public(void *state) {
+    hd_state_t *s = state;
+    BENCH_CHECK(neoc_bip32_derive_range(&s->change_public, 0, HD_RANGE_COUNT, s->keys) == NEOC_SUCCESS);
+}
+
+static const char *const hd_mnemonic =
+    "void come effort suffer camp survey warrior heavy shoot primary clutch crush "
+    "open amazing screen patrol group space point ten exist slush involve unfold";
+
+static void case_bip39_validate(void *state) {
+    (void)state;
+    BENCH_CHECK(neoc_bip39_validate_mnemonic(hd_mnemonic, NEOC_BIP39_LANG_ENGLISH));
+}
+
+static void case_bip39_seed(void *state) {
+    hd_state_t *s = state;
+    BENCH_CHECK(neoc_bip39_mnemonic_to_seed_buffer(hd_mnemonic, "TREZOR", s->seeds) == NEOC_SUCCESS);
+}
+
+static void case_bip39_seed_batch(void *state) {
+    hd_state_t *s = state;
+    const char *mnemonics[HD_SEED_BATCH];
+    neoc_error_t results[HD_SEED_BATCH];
+    for (size_t i = 0; i < HD_SEED_BATCH; i++) {
+        mnemonics[i] = hd_mnemonic;
+    }
+    BENCH_CHECK(neoc_bip39_mnemonic_to_seed_batch(mnemonics, NULL, HD_SEED_BATCH, 0,
+                                                  s->seeds, results) == NEOC_SUCCESS);
+    for (size_t i = 0; i < HD_SEED_BATCH; i++) {
+        BENCH_CHECK(results[i] == NEOC_SUCCESS);
+    }
+}
+
+static void suite_hd(bench_t *bench) {
+    static hd_state_t s;
+    uint8_t seed[64];
+    memset(&s, 0, sizeof(s));
+    fill_pattern(seed, sizeof(seed), 9);
+    BENCH_CHECK(neoc_bip32_from_seed_raw(seed, sizeof(seed), &s.master) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_bip32_derive_path_indices(&s.master, hd_change_path, 4, &s.change) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_bip32_get_public_key(&s.change, &s.change_public) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_bip32_context_create(&s.master, &s.context) == NEOC_SUCCESS);
+
+    bench_run(bench, "hd", "derive path m/44'/888'/0'/0/i", case_hd_derive_path, &s);
+    bench_run(bench, "hd", "context derive m/44'/888'/0'/0/i", case_hd_context_derive, &s);
+    bench_run(bench, "hd", "derive range 256 private", case_hd_range_private, &s);
+    bench_run(bench, "hd", "derive range 256 public", case_hd_range_public, &s);
+    bench_run(bench, "hd", "bip39 validate 24 words", case_bip39_validate, &s);
+    bench_run(bench, "hd", "bip39 mnemonic to seed", case_bip39_seed, &s);
+    bench_run(bench, "hd", "bip39 seed batch 8", case_bip39_seed_batch, &s);
+
+    neoc_bip32_context_free(s.context);
+}
+
+/* ===== Encoding ===== */
+
+typedef struct {
+    uint8_t data[256];
+    size_t len;
+    char text[1024];
+    uint8_t decoded[512];
+    neoc_hash160_t script_hash;
+    char address[NEOC_ADDRESS_LENGTH];
+} encoding_state_t;
+
+static void case_hex_encode(void *state) {
+    encoding_state_t *s = state;
+    BENCH_CHECK(neoc_hex_encode(s->data, s->len, s->text, sizeof(s->text), false, false) == NEOC_SUCCESS);
+}
+
+static void case_hex_decode(void *state) {
+    encoding_state_t *s = state;
+    BENCH_CHECK(neoc_hex_decode(s->text, s->decoded, sizeof(s->decoded), NULL) == NEOC_SUCCESS);
+}
+
+static void case_base64_encode(void *state) {
+    encoding_state_t *s = state;
+    BENCH_CHECK(neoc_base64_encode(s->data, s->len, s->text, sizeof(s->text)) == NEOC_SUCCESS);
+}
+
+static void case_base64_decode(void *state) {
+    encoding_state_t *s = state;
+    BENCH_CHECK(neoc_base64_decode(s->text, s->decoded, sizeof(s->decoded), NULL) == NEOC_SUCCESS);
+}
+
+static void case_base58_encode(void *state) {
+    encoding_state_t *s = state;
+    BENCH_CHECK(neoc_base58_encode(s->data, s->len, s->text, sizeof(s->text)) == NEOC_SUCCESS);
+}
+
+static void case_base58_decode(void *state) {
+    encoding_state_t *s = state;
+    BENCH_CHECK(neoc_base58_decode(s->text, s->decoded, sizeof(s->decoded), NULL) == NEOC_SUCCESS);
+}
+
+static void case_address_encode(void *state) {
+    encoding_state_t *s = state;
+    BENCH_CHECK(neoc_hash160_to_address(&s->script_hash, s->address, sizeof(s->address)) == NEOC_SUCCESS);
+}
+
+static void case_address_decode(void *state) {
+    encoding_state_t *s = state;
+    neoc_hash160_t hash;
+    BENCH_CHECK(neoc_hash160_from_address(&hash, s->address) == NEOC_SUCCESS);
+}
+
+static void suite_encoding(bench_t *bench) {
+    encoding_state_t s;
+    fill_pattern(s.data, sizeof(s.data), 11);
+    memcpy(s.script_hash.data, s.data, sizeof(s.script_hash.data));
+    BENCH_CHECK(neoc_hash160_to_address(&s.script_hash, s.address, sizeof(s.address)) == NEOC_SUCCESS);
+
+    s.len = sizeof(s.data);
+    case_hex_encode(&s);
+    bench_run(bench, "encoding", "hex encode 256B", case_hex_encode, &s);
+    bench_run(bench, "encoding", "hex decode 256B", case_hex_decode, &s);
+    case_base64_encode(&s);
+    bench_run(bench, "encoding", "base64 encode 256B", case_base64_encode, &s);
+    bench_run(bench, "encoding", "base64 decode 256B", case_base64_decode, &s);
+    s.len = 32;
+    case_base58_encode(&s);
+    bench_run(bench, "encoding", "base58 encode 32B", case_base58_encode, &s);
+    bench_run(bench, "encoding", "base58 decode 32B", case_base58_decode, &s);
+    bench_run(bench, "encoding", "address encode", case_address_encode, &s);
+    bench_run(bench, "encoding", "address decode", case_address_decode, &s);
+}
+
+/* ===== Serialization ===== */
+
+typedef struct {
+    neoc_binary_writer_t *writer;
+    neoc_binary_reader_t *reader;
+    neoc_binary_reader_t *var_int_reader;
+    neoc_hash160_t hash;
+    neoc_script_builder_t *script;
+    const neoc_contract_parameter_t *params[4];
+    uint8_t data[4096];
+    uint64_t counter;
+} serialization_state_t;
+
+static void reset_writer_if_full(serialization_state_t *s) {
+    if (neoc_binary_writer_get_position(s->writer) >= WRITER_RESET_AT) {
+        neoc_binary_writer_reset(s->writer);
+    }
+}
+
+static void case_writer_create(void *state) {
+    (void)state;
+    neoc_binary_writer_t *writer = NULL;
+    BENCH_CHECK(neoc_binary_writer_create(64, true, &writer) == NEOC_SUCCESS);
+    neoc_binary_writer_free(writer);
+}
+
+static void case_writer_byte(void *state) {
+    serialization_state_t *s = state;
+    reset_writer_if_full(s);
+    BENCH_CHECK(neoc_binary_writer_write_byte(s->writer, (uint8_t)s->counter++) == NEOC_SUCCESS);
+}
+
+static void case_writer_uint32(void *state) {
+    serialization_state_t *s = state;
+    reset_writer_if_full(s);
+    BENCH_CHECK(neoc_binary_writer_write_uint32(s->writer, (uint32_t)s->counter++) == NEOC_SUCCESS);
+}
+
+static void case_writer_var_int(void *state) {
+    serialization_state_t *s = state;
+    reset_writer_if_full(s);
+    BENCH_CHECK(neoc_binary_writer_write_var_int(s->writer, s->counter++ * 977) == NEOC_SUCCESS);
+}
+
+static void case_writer_bytes(void *state) {
+    serialization_state_t *s = state;
+    reset_writer_if_full(s);
+    BENCH_CHECK(neoc_binary_writer_write_bytes(s->writer, s->data, 256) == NEOC_SUCCESS);
+}
+
+static void case_reader_uint32(void *state) {
+    serialization_state_t *s = state;
+    uint32_t value;
+    if (neoc_binary_reader_get_remaining(s->reader) < sizeof(value)) {
+        BENCH_CHECK(neoc_binary_reader_seek(s->reader, 0) == NEOC_SUCCESS);
+    }
+    BENCH_CHECK(neoc_binary_reader_read_uint32(s->reader, &value) == NEOC_SUCCESS);
+}
+
+static void case_reader_var_int(void *state) {
+    serialization_state_t *s = state;
+    uint64_t value;
+    if (neoc_binary_reader_get_remaining(s->var_int_reader) == 0) {
+        BENCH_CHECK(neoc_binary_reader_seek(s->var_int_reader, 0) == NEOC_SUCCESS);
+    }
+    BENCH_CHECK(neoc_binary_reader_read_var_int(s->var_int_reader, &value) == NEOC_SUCCESS);
+}
+
+static void case_hash160_serialize(void *state) {
+    serialization_state_t *s = state;
+    reset_writer_if_full(s);
+    BENCH_CHECK(neoc_hash160_serialize(&s->hash, s->writer) == NEOC_SUCCESS);
+}
+
+static void case_hash160_deserialize(void *state) {
+    serialization_state_t *s = state;
+    neoc_hash160_t hash;
+    BENCH_CHECK(neoc_binary_reader_seek(s->reader, 0) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_hash160_deserialize(&hash, s->reader) == NEOC_SUCCESS);
+}
+
+static void case_contract_call_script(void *state) {
+    serialization_state_t *s = state;
+    neoc_script_builder_reset(s->script);
+    BENCH_CHECK(neoc_script_builder_contract_call(s->script, &NEOC_GAS_TOKEN_HASH, "transfer",
+                                                  s->params, 4, NEOC_CALL_FLAGS_ALL) == NEOC_SUCCESS);
+}
+
+static void suite_serialization(bench_t *bench) {
+    serialization_state_t s;
+    memset(&s, 0, sizeof(s));
+    fill_pattern(s.data, sizeof(s.data), 5);
+    memcpy(s.hash.data, s.data, sizeof(s.hash.data));
+    BENCH_CHECK(neoc_binary_writer_create(WRITER_RESET_AT + 1024, true, &s.writer) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_binary_reader_create(s.data, sizeof(s.data), &s.reader) == NEOC_SUCCESS);
+
+    for (uint64_t i = 0; i < VAR_INT_COUNT; i++) {
+        BENCH_CHECK(neoc_binary_writer_write_var_int(s.writer, i * 977) == NEOC_SUCCESS);
+    }
+    uint8_t *var_ints = NULL;
+    size_t var_ints_len = 0;
+    BENCH_CHECK(neoc_binary_writer_to_array(s.writer, &var_ints, &var_ints_len) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_binary_reader_create(var_ints, var_ints_len, &s.var_int_reader) == NEOC_SUCCESS);
+    neoc_binary_writer_reset(s.writer);
+
+    neoc_contract_parameter_t *from = NULL, *to = NULL, *amount = NULL, *data = NULL;
+    BENCH_CHECK(neoc_contract_param_create_hash160(&s.hash, &from) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_contract_param_create_byte_array(s.data + 20, 20, &to) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_contract_param_create_integer(100000000, &amount) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_contract_param_create_string("memo", &data) == NEOC_SUCCESS);
+    s.params[0] = from;
+    s.params[1] = to;
+    s.params[2] = amount;
+    s.params[3] = data;
+    BENCH_CHECK(neoc_script_builder_create(&s.script) == NEOC_SUCCESS);
+
+    bench_run(bench, "serialization", "writer create/free", case_writer_create, &s);
+    bench_run(bench, "serialization", "write byte", case_writer_byte, &s);
+    bench_run(bench, "serialization", "write uint32", case_writer_uint32, &s);
+    bench_run(bench, "serialization", "write var_int", case_writer_var_int, &s);
+    bench_run(bench, "serialization", "write bytes 256B", case_writer_bytes, &s);
+    bench_run(bench, "serialization", "read uint32", case_reader_uint32, &s);
+    bench_run(bench, "serialization", "read var_int", case_reader_var_int, &s);
+    bench_run(bench, "serialization", "hash160 serialize", case_hash160_serialize, &s);
+    bench_run(bench, "serialization", "hash160 deserialize", case_hash160_deserialize, &s);
+    bench_run(bench, "serialization", "contract call script", case_contract_call_script, &s);
+
+    neoc_script_builder_free(s.script);
+    neoc_contract_param_free(from);
+    neoc_contract_param_free(to);
+    neoc_contract_param_free(amount);
+    neoc_contract_param_free(data);
+    neoc_binary_reader_free(s.var_int_reader);
+    free(var_ints);
+    neoc_binary_reader_free(s.reader);
+    neoc_binary_writer_free(s.writer);
+}
+
+/* ===== Transactions ===== */
+
+typedef struct {
+    neoc_account_t *account;
+    char to_address[NEOC_ADDRESS_LENGTH];
+    neoc_transaction_t *signed_tx;
+    uint8_t *serialized;
+    size_t serialized_size;
+    uint32_t nonce;
+} tx_state_t;
+
+static neoc_transaction_t *build_transfer(tx_state_t *s, bool sign) {
+    neoc_tx_builder_t *builder = NULL;
+    neoc_transaction_t *tx = NULL;
+    BENCH_CHECK(neoc_tx_builder_create_nep17_transfer(&NEOC_GAS_TOKEN_HASH, s->account, s->to_address,
+                                                      100000000, NULL, 0, &builder) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_tx_builder_set_nonce(builder, s->nonce++) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_tx_builder_set_valid_until_block(builder, 5000000) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_tx_builder_add_system_fee(builder, 997775) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_tx_builder_add_network_fee(builder, 1234520) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_tx_builder_build_unsigned(builder, &tx) == NEOC_SUCCESS);
+    neoc_tx_builder_free(builder);
+    if (sign) {
+        BENCH_CHECK(neoc_transaction_sign(tx, s->account) == NEOC_SUCCESS);
+    }
+    return tx;
+}
+
+static void case_tx_build(void *state) {
+    neoc_transaction_free(build_transfer(state, false));
+}
+
+static void case_tx_build_sign(void *state) {
+    neoc_transaction_free(build_transfer(state, true));
+}
+
+static void case_tx_hash(void *state) {
+    tx_state_t *s = state;
+    neoc_hash256_t hash;
+    BENCH_CHECK(neoc_transaction_calculate_hash(s->signed_tx, &hash) == NEOC_SUCCESS);
+}
+
+static void case_tx_serialize(void *state) {
+    tx_state_t *s = state;
+    size_t written = 0;
+    BENCH_CHECK(neoc_transaction_serialize(s->signed_tx, s->serialized, s->serialized_size,
+                                           &written) == NEOC_SUCCESS);
+}
+
+static void case_tx_deserialize(void *state) {
+    tx_state_t *s = state;
+    neoc_binary_reader_t reader;
+    neoc_transaction_t *tx = NULL;
+    BENCH_CHECK(neoc_binary_reader_init_view(&reader, s->serialized, s->serialized_size) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_transaction_deserialize(&reader, &tx) == NEOC_SUCCESS);
+    neoc_transaction_free(tx);
+}
+
+static void suite_transaction(bench_t *bench) {
+    tx_state_t s;
+    memset(&s, 0, sizeof(s));
+    BENCH_CHECK(neoc_account_create(&s.account) == NEOC_SUCCESS);
+    neoc_hash160_t to_hash;
+    memset(to_hash.data, 0x5A, sizeof(to_hash.data));
+    BENCH_CHECK(neoc_hash160_to_address(&to_hash, s.to_address, sizeof(s.to_address)) == NEOC_SUCCESS);
+
+    s.signed_tx = build_transfer(&s, true);
+    s.serialized_size = neoc_transaction_get_size(s.signed_tx);
+    s.serialized = malloc(s.serialized_size);
+    BENCH_CHECK(s.serialized != NULL);
+    case_tx_serialize(&s);
+
+    bench_run(bench, "transaction", "build nep17 transfer", case_tx_build, &s);
+    bench_run(bench, "transaction", "build and sign nep17 transfer", case_tx_build_sign, &s);
+    bench_run(bench, "transaction", "hash", case_tx_hash, &s);
+    bench_run(bench, "transaction", "serialize", case_tx_serialize, &s);
+    bench_run(bench, "transaction", "deserialize", case_tx_deserialize, &s);
+
+    free(s.serialized);
+    neoc_transaction_free(s.signed_tx);
+    neoc_account_free(s.account);
+}
+
+/* ===== Invocation scripts ===== */
+
+#define SCRIPT_MULTI_COUNT 100
+#define SCRIPT_BATCH_COUNT 2000
+
+typedef struct {
+    neoc_hash160_t token;
+    neoc_hash160_t from;
+    neoc_hash160_t to;
+    uint64_t amount;
+    const neoc_script_template_t *nep17;
+    uint8_t buffer[256];
+    neoc_gas_token_t *gas;
+    neoc_fungible_token_transfer_request_t transfers[SCRIPT_BATCH_COUNT];
+} script_state_t;
+
+/* The per-call builder sequence that neoc_script_create_nep17_transfer used to run */
+static void case_script_nep17_builder(void *state) {
+    script_state_t *s = state;
+    neoc_script_builder_t *builder = NULL;
+    uint8_t *script = NULL;
+    size_t script_len = 0;
+    BENCH_CHECK(neoc_script_builder_create(&builder) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_emit(builder, NEOC_OP_PUSHNULL) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_push_integer(builder, (int64_t)s->amount) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_push_data(builder, s->to.data, sizeof(s->to.data)) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_push_data(builder, s->from.data, sizeof(s->from.data)) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_push_integer(builder, 4) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_emit(builder, NEOC_OP_PACK) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_push_string(builder, "transfer") == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_push_data(builder, s->token.data, sizeof(s->token.data)) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_emit_syscall(builder, NEOC_INTEROP_SYSTEM_CONTRACT_CALL) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_emit(builder, NEOC_OP_ASSERT) == NEOC_SUCCESS);
+    BENCH_CHECK(neoc_script_builder_to_array(builder, &script, &script_len) == NEOC_SUCCESS);
+    neoc_script_builder_free(builder);
+    free(script);
+    s->amount++;
+}
+
+static void case_script_nep17_helper(void *state) {
+    script_state_t *s = state;
+    uint8_t *script = NULL;
+    size_t script_len = 0;
+    BENCH_CHECK(neoc_script_create_nep17_transfer(&s->token, &s->from, &s->to, s->amount++,
+                                                  NULL, 0, &script, &script_len) == NEOC_SUCCESS);
+    neoc_free(script);
+}
+
+static void case_script_nep17_template(void *state) {
+    script_state_t *s = state;
+    neoc_script_arg_t args[4] = {{0}};
+    args[0].hash160 = &s->from;
+    args[1].hash160 = &s->to;
+    args[2].integer = (int64_t)s->amount++;
+    size_t script_len = 0;
+    BENCH_CHECK(neoc_script_template_write_for_contract(s->nep17, &s->token, args, s->buffer,
+                                                        sizeof(s->buffer), &script_len) == NEOC_SUCCESS);
+}
+
+static void case_script_gas_multi(void *state) {
+    script_state_t *s = state;
+    uint8_t *script = NULL;
+    size_t script_len = 0;
+    BENCH_CHECK(neoc_gas_token_build_multi_transfer_script(s->gas, &s->from, s->transfers,
+                                                           SCRIPT_MULTI_COUNT, &script,
+                                                           &script_len) == NEOC_SUCCESS);
+    neoc_free(script);
+}
+
+/* Large enough to need more than one transaction at the default script limit */
+static void case_script_batch_split(void *state) {
+    script_state_t *s = state;
+    neoc_fungible_token_batch_t *batch = NULL;
+    BENCH_CHECK(neoc_fungible_token_build_batch_transfer(&s->token, &s->from, s->transfers,
+                                                         SCRIPT_BATCH_COUNT, 0, &batch) == NEOC_SUCCESS);
+    BENCH_CHECK(batch->chunk_count > 1);
+    neoc_fungible_token_batch_free(batch);
+}
+
+static void suite_script(bench_t *bench) {
+    script_state_t *s = calloc(1, sizeof(*s));
+    BENCH_CHECK(s != NULL);
+    fill_pattern(s->token.data, sizeof(s->token.data), 1);
+    fill_pattern(s->from.data, sizeof(s->from.data), 2);
+    fill_pattern(s->to.data, sizeof(s->to.data), 3);
+    s->amount = 150000000;
+    s->nep17 = neoc_script_template_nep17_transfer();
+    BENCH_CHECK(s->nep17 != NULL);
+    BENCH_CHECK(neoc_gas_token_create(&s->gas) == NEOC_SUCCESS);
+    for (size_t i = 0; i < SCRIPT_BATCH_COUNT; i++) {
+        fill_pattern(s->transfers[i].to.data, sizeof(s->transfers[i].to.data), (uint8_t)i);
+        s->transfers[i].amount = 100000000 + i;
+    }
+
+    bench_run(bench, "script", "nep17 transfer builder", case_script_nep17_builder, s);
+    bench_run(bench, "script", "nep17 transfer helper", case_script_nep17_helper, s);
+    bench_run(bench, "script", "nep17 transfer template", case_script_nep17_template, s);
+    bench_run(bench, "script", "gas multi transfer 100", case_script_gas_multi, s);
+    bench_run(bench, "script", "nep17 batch 2000 split", case_script_batch_split, s);
+
+    neoc_gas_token_free(s->gas);
+    free(s);
+}
+
+/* ===== Response parsing ===== */
+
+typedef struct {
+    char *json;
+    neoc_arena_t *arena;
+} response_state_t;
+
+/* A getblock result shaped like a mainnet block, with tx_count NEP-17 transfers */
+static char *build_getblock_result(int tx_count) {
+    static const char *header =
+        "{\"hash\":\"0x1d5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f00\","
+        "\"size\":1024,\"version\":0,"
+        "\"previousblockhash\":\"0x2a5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f01\","
+        "\"merkleroot\":\"0x3b5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f02\","
+        "\"time\":1700000000000,\"nonce\":\"7F0A3D2C1B4E5F60\",\"index\":4000000,"
+        "\"primary\":3,\"nextconsensus\":\"NgPkjjLTNcQad99iRYeXRUuowE4gxLAnDL\","
+        "\"witnesses\":[],\"confirmations\":12,\"tx\":[";
+    static const char *tx_format =
+        "%s{\"hash\":\"0x%064x\",\"size\":252,\"version\":0,\"nonce\":%d,"
+        "\"sender\":\"NgPkjjLTNcQad99iRYeXRUuowE4gxLAnDL\",\"sysfee\":\"997775\","
+        "\"netfee\":\"1234520\",\"validuntilblock\":4005760,"
+        "\"signers\":[{\"account\":\"0x69ecca587293047be4c59159bf8bc399985c160d\","
+        "\"scopes\":\"CalledByEntry\"}],\"attributes\":[],"
+        "\"script\":\"0c14ebb1e52e0fa2ae21ea3df4bd3e6bd1b8b2c3d4e5110c146d0b0a69ecca587293047be4c59159bf8bc399985c160d14c01f0c087472616e736665720c14cf76e28bd0062c4a478ee35561011319f3cfa4d241627d5b52\","
+        "\"witnesses\":[{\"invocation\":\"DEBAbF6m7VRQ0L3N7E3gHG0tS9JpyyqW1Il9xWgPUk0Dh2TvlAUDY3c5NFbk0tK4e5Lx1lpNWk3gcqLqoMhQ8p7v\","
+        "\"verification\":\"DCEDAjGr3rU9OyG3w8Jl6hJ6F5RzdTSTi1yBhrswtvZWk0VBVuezJw==\"}]}";
+
+    size_t capacity = strlen(header) + (size_t)tx_count * 1024 + 8;
+    char *json = malloc(capacity);
+    BENCH_CHECK(json != NULL);
+
+    size_t len = (size_t)snprintf(json, capacity, "%s", header);
+    for (int i = 0; i < tx_count; i++) {
+        len += (size_t)snprintf(json + len, capacity - len, tx_format,
+                                i == 0 ? "" : ",", (unsigned int)i, i);
+    }
+    snprintf(json + len, capacity - len, "]}");
+    return json;
+}
+
+static void case_getblock_heap(void *state) {
+    response_state_t *s = state;
+    neoc_neo_block_t *block = neoc_neo_block_from_json(s->json);
+    BENCH_CHECK(block != NULL && block->transaction_count == BLOCK_TX_COUNT);
+    neoc_neo_block_free(block);
+}
+
+static void case_getblock_arena(void *state) {
+    response_state_t *s = state;
+    neoc_neo_block_t *block = neoc_neo_block_from_json_arena(s->json, s->arena);
+    BENCH_CHECK(block != NULL && block->transaction_count == BLOCK_TX_COUNT);
+    neoc_arena_reset(s->arena);
+}
+
+static void suite_response(bench_t *bench) {
+    response_state_t s;
+    s.json = build_getblock_result(BLOCK_TX_COUNT);
+    BENCH_CHECK(neoc_arena_create(0, &s.arena) == NEOC_SUCCESS);
+
+    bench_run(bench, "response", "getblock 50 tx (heap)", case_getblock_heap, &s);
+    bench_run(bench, "response", "getblock 50 tx (arena)", case_getblock_arena, &s);
+
+    neoc_arena_free(s.arena);
+    free(s.json);
+}
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "usage: %s [--filter TEXT] [--json PATH] [--min-time SECONDS] [--smoke] [--list] [--quiet]\n",
+            program);
+}
+
+int main(int argc, char **argv) {
+    bench_options_t options;
+    bench_default_options(&options);
+    const char *json_path = NULL;
+    const char *filter = NULL;
+    double min_time = -1.0;
+    bool list_only = false;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--smoke") == 0) {
+            bench_smoke_options(&options);
+        } else if (strcmp(argv[i], "--list") == 0) {
+            list_only = true;
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_time = strtod(argv[++i], NULL);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    options.filter = filter;
+    options.list_only = list_only;
+    options.quiet = quiet;
+    if (min_time >= 0.0) {
+        options.min_time = min_time;
+    }
+
+    if (neoc_init() != NEOC_SUCCESS) {
+        fprintf(stderr, "neoc_init failed\n");
+        return 1;
+    }
+    bench_t *bench = bench_create(&options);
+    if (!bench) {
+        fprintf(stderr, "out of memory\n");
+        neoc_cleanup();
+        return 1;
+    }
+
+    suite_hashing(bench);
+    suite_signing(bench);
+    suite_hd(bench);
+    suite_encoding(bench);
+    suite_serialization(bench);
+    suite_transaction(bench);
+    suite_script(bench);
+    suite_response(bench);
+
+    int status = 0;
+    if (json_path && !list_only) {
+        if (bench_write_json(bench, json_path) != 0) {
+            fprintf(stderr, "could not write %s\n", json_path);
+            status = 1;
+        } else if (!quiet) {
+            printf("Wrote %zu results to %s\n", bench_result_count(bench), json_path);
+        }
+    }
+
+    bench_free(bench);
+    neoc_cleanup();
+    return status;
+}
@@ -210,8 +210,8 @@ run_benchmarks() {
     print_header "Running Performance Benchmarks"
     
     local benchmarks=(
+        "neoc_bench"
         "benchmark_crypto"
-        "benchmark_serialization"
     )
     
     local bench_failed=0
@@ -219,13 +219,18 @@ run_benchmarks() {
     for benchmark in "${benchmarks[@]}"; do
         echo -e "\n${BLUE}Running: $benchmark${NC}"
         
+        local args=()
+        if [ "$benchmark" = "neoc_bench" ]; then
+            args=(--json "$TEST_RESULTS_DIR/neoc_bench.json")
+        fi
+        
         if [ -x "$BUILD_DIR/tests/benchmarks/$benchmark" ]; then
-            if "$BUILD_DIR/tests/benchmarks/$benchmark" > "$TEST_RESULTS_DIR/$benchmark.txt"; then
+            if "$BUILD_DIR/tests/benchmarks/$benchmark" "${args[@]}" > "$TEST_RESULTS_DIR/$benchmark.txt"; then
                 print_success "$benchmark completed"
                 
                 # Extract and display key metrics
                 if [ "$VERBOSE" -eq 1 ]; then
-                    grep -E "ops/sec|μs/op" "$TEST_RESULTS_DIR/$benchmark.txt" | head -5
+                    grep -E "ops/sec|μs/op|^[a-z]+/" "$TEST_RESULTS_DIR/$benchmark.txt" | head -5
                 fi
                 ((PASSED_TESTS++))
             else
@@ -0,0 +1,206 @@
+/**
+ * @file stub_http_server.c
+ * @brief Loopback HTTP/1.1 stub node shared by the RPC tests and benchmarks
+ */
+
+#define _GNU_SOURCE
+#include "stub_http_server.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+typedef struct {
+    stub_http_server_t *server;
+    int fd;
+} stub_connection_t;
+
+/* Reads more bytes, growing the buffer when it is full. Returns false on EOF or error. */
+static bool stub_read(int fd, char **buffer, size_t *capacity, size_t *filled) {
+    if (*filled + 1 >= *capacity) {
+        char *grown = realloc(*buffer, *capacity * 2);
+        if (!grown) {
+            return false;
+        }
+        *buffer = grown;
+        *capacity *= 2;
+    }
+    ssize_t n = recv(fd, *buffer + *filled, *capacity - 1 - *filled, 0);
+    if (n <= 0) {
+        return false;
+    }
+    *filled += (size_t)n;
+    (*buffer)[*filled] = '\0';
+    return true;
+}
+
+static bool stub_reply(int fd, const char *body) {
+    size_t body_len = strlen(body);
+    char header[128];
+    int header_len = snprintf(header, sizeof(header),
+                              "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+                              "Content-Length: %zu\r\n\r\n", body_len);
+    return send(fd, header, (size_t)header_len, MSG_NOSIGNAL | MSG_MORE) == header_len &&
+           send(fd, body, body_len, MSG_NOSIGNAL) == (ssize_t)body_len;
+}
+
+/* Serves requests on one connection until the client closes it */
+static void *stub_connection(void *arg) {
+    stub_connection_t connection = *(stub_connection_t *)arg;
+    free(arg);
+    stub_http_server_t *server = connection.server;
+    int fd = connection.fd;
+    size_t capacity = 16384;
+    char *buffer = calloc(1, capacity);
+    size_t filled = 0;
+
+    while (buffer) {
+        char *header_end = NULL;
+        while (!(header_end = strstr(buffer, "\r\n\r\n"))) {
+            if (!stub_read(fd, &buffer, &capacity, &filled)) {
+                goto done;
+            }
+        }
+
+        size_t content_length = 0;
+        const char *cl = strcasestr(buffer, "Content-Length:");
+        if (cl && cl < header_end) {
+            content_length = strtoul(cl + 15, NULL, 10);
+        }
+        size_t header_len = (size_t)(header_end + 4 - buffer);
+        size_t request_len = header_len + content_length;
+        while (filled < request_len) {
+            if (!stub_read(fd, &buffer, &capacity, &filled)) {
+                goto done;
+            }
+        }
+        atomic_fetch_add(&server->requests, 1);
+
+        bool sent;
+        if (server->fixed_body) {
+            sent = stub_reply(fd, server->fixed_body);
+        } else {
+            char path[256] = "/";
+            const char *target = memchr(buffer, ' ', header_len);
+            if (target) {
+                target++;
+                size_t path_len = strcspn(target, " \r\n");
+                if (path_len < sizeof(path)) {
+                    memcpy(path, target, path_len);
+                    path[path_len] = '\0';
+                }
+            }
+
+            char saved = buffer[request_len];
+            buffer[request_len] = '\0';
+            char *body = server->handler(path, buffer + header_len, server->user_data);
+            buffer[request_len] = saved;
+
+            if (!body) {
+                /* Unanswered: hold the connection until the client drops it */
+                while (recv(fd, buffer, capacity, 0) > 0) {
+                }
+                goto done;
+            }
+            sent = stub_reply(fd, body);
+            free(body);
+        }
+        if (!sent) {
+            goto done;
+        }
+
+        memmove(buffer, buffer + request_len, filled - request_len);
+        filled -= request_len;
+        buffer[filled] = '\0';
+    }
+
+done:
+    free(buffer);
+    close(fd);
+    return NULL;
+}
+
+static void *stub_accept(void *arg) {
+    stub_http_server_t *server = arg;
+    for (;;) {
+        int fd = accept(server->listener, NULL, NULL);
+        if (fd < 0) {
+            return NULL;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        atomic_fetch_add(&server->connections, 1);
+
+        stub_connection_t *connection = malloc(sizeof(*connection));
+        pthread_t thread;
+        if (!connection) {
+            close(fd);
+            continue;
+        }
+        connection->server = server;
+        connection->fd = fd;
+        if (pthread_create(&thread, NULL, stub_connection, connection) != 0) {
+            free(connection);
+            close(fd);
+            continue;
+        }
+        pthread_detach(thread);
+    }
+}
+
+static int stub_start(stub_http_server_t *server, stub_http_handler_t handler, void *user_data,
+                      const char *fixed_body) {
+    memset(server, 0, sizeof(*server));
+    server->handler = handler;
+    server->user_data = user_data;
+    server->fixed_body = fixed_body;
+
+    server->listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (server->listener < 0) {
+        return -1;
+    }
+    int one = 1;
+    setsockopt(server->listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    if (bind(server->listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(server->listener, 128) != 0 ||
+        getsockname(server->listener, (struct sockaddr *)&addr, &len) != 0) {
+        close(server->listener);
+        return -1;
+    }
+    server->port = ntohs(addr.sin_port);
+    snprintf(server->url, sizeof(server->url), "http://127.0.0.1:%u/", server->port);
+
+    if (pthread_create(&server->accept_thread, NULL, stub_accept, server) != 0) {
+        close(server->listener);
+        return -1;
+    }
+    return 0;
+}
+
+int stub_http_server_start(stub_http_server_t *server, stub_http_handler_t handler, void *user_data) {
+    return stub_start(server, handler, user_data, NULL);
+}
+
+int stub_http_server_start_fixed(stub_http_server_t *server, const char *body) {
+    return stub_start(server, NULL, NULL, body);
+}
+
+void stub_http_server_stop(stub_http_server_t *server) {
+    /* shutdown wakes the blocked accept; close alone does not */
+    shutdown(server->listener, SHUT_RDWR);
+    pthread_join(server->accept_thread, NULL);
+    close(server->listener);
+}
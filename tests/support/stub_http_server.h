@@ -0,0 +1,71 @@
+/**
+ * @file stub_http_server.h
+ * @brief Loopback HTTP/1.1 stub node shared by the RPC tests and benchmarks
+ *
+ * Listens on an ephemeral 127.0.0.1 port and serves keep-alive connections,
+ * one thread per connection. Each request is answered with a 200 JSON
+ * response whose body comes from the handler, or from a fixed body when the
+ * server is started without one.
+ */
+
+#ifndef NEOC_TESTS_STUB_HTTP_SERVER_H
+#define NEOC_TESTS_STUB_HTTP_SERVER_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Produces the response body for one request
+ *
+ * @param path Request target, e.g. "/" or "/hang"
+ * @param body NUL-terminated request body
+ * @param user_data Pointer given to stub_http_server_start
+ * @return Response body allocated with malloc (freed by the server), or NULL to
+ *         leave the request unanswered and hold the connection until the client
+ *         drops it
+ */
+typedef char *(*stub_http_handler_t)(const char *path, const char *body, void *user_data);
+
+typedef struct {
+    int listener;
+    unsigned short port;
+    char url[64];               ///< "http://127.0.0.1:<port>/"
+    atomic_int connections;     ///< Connections accepted so far
+    atomic_int requests;        ///< Requests read so far, answered or not
+    stub_http_handler_t handler;
+    void *user_data;
+    const char *fixed_body;
+    pthread_t accept_thread;
+} stub_http_server_t;
+
+/**
+ * @brief Start a server that answers through handler
+ *
+ * The server struct is used by the connection threads and must stay valid
+ * until every client has disconnected; the tests keep it in static storage.
+ *
+ * @return 0 on success, -1 when the listener could not be set up
+ */
+int stub_http_server_start(stub_http_server_t *server, stub_http_handler_t handler, void *user_data);
+
+/**
+ * @brief Start a server that answers every request with the same body
+ *
+ * body is not copied and must outlive the server.
+ */
+int stub_http_server_start_fixed(stub_http_server_t *server, const char *body);
+
+/**
+ * @brief Stop accepting connections and close the listener
+ */
+void stub_http_server_stop(stub_http_server_t *server);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NEOC_TESTS_STUB_HTTP_SERVER_H
@@ -6,6 +6,7 @@
 #include "unity.h"
 #include <neoc/neoc.h>
 #include <neoc/utils/neoc_base58.h>
+#include <openssl/sha.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -291,6 +292,170 @@ void test_base58_round_trip(void) {
     }
 }
 
+/* ===== LIMB CODEC AND ADDRESS TESTS ===== */
+
+/* Digit-at-a-time encoder the limb codec is checked against */
+static void reference_encode(const uint8_t *data, size_t len, char *out) {
+    uint8_t digits[512] = { 0 };
+    size_t length = 0;
+    size_t zeros = 0;
+    while (zeros < len && data[zeros] == 0) {
+        zeros++;
+    }
+    for (size_t i = zeros; i < len; i++) {
+        int carry = data[i];
+        for (size_t j = 0; j < length || carry != 0; j++) {
+            carry += 256 * digits[j];
+            digits[j] = (uint8_t)(carry % 58);
+            carry /= 58;
+            if (j >= length) {
+                length = j + 1;
+            }
+        }
+    }
+    memset(out, '1', zeros);
+    for (size_t k = 0; k < length; k++) {
+        out[zeros + k] = NEOC_BASE58_ALPHABET[digits[length - 1 - k]];
+    }
+    out[zeros + length] = '\0';
+}
+
+static void reference_address(uint8_t version, const uint8_t script_hash[20], char *out) {
+    uint8_t payload[25];
+    uint8_t hash[32];
+    payload[0] = version;
+    memcpy(payload + 1, script_hash, 20);
+    SHA256(payload, 21, hash);
+    SHA256(hash, 32, hash);
+    memcpy(payload + 21, hash, 4);
+    reference_encode(payload, sizeof(payload), out);
+}
+
+/* Every length up to 300 with 0-2 leading zero bytes, across the stack and heap paths */
+void test_base58_limb_codec_matches_reference(void) {
+    static uint8_t data[300];
+    static char expected[512];
+    static char encoded[512];
+    static uint8_t decoded[300];
+    uint32_t x = 0x2468ace1u;
+
+    for (size_t len = 0; len <= sizeof(data); len++) {
+        for (size_t i = 0; i < len; i++) {
+            x = x * 1103515245u + 12345u;
+            data[i] = (uint8_t)(x >> 16);
+        }
+        for (size_t i = 0; i < len && i < len % 3; i++) {
+            data[i] = 0;
+        }
+
+        reference_encode(data, len, expected);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_base58_encode(data, len, encoded, sizeof(encoded)));
+        TEST_ASSERT_EQUAL_STRING(expected, encoded);
+        TEST_ASSERT_TRUE(strlen(encoded) < neoc_base58_encode_buffer_size(len));
+
+        size_t decoded_len = 0;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_base58_decode(encoded, decoded, sizeof(decoded), &decoded_len));
+        TEST_ASSERT_EQUAL_UINT(len, decoded_len);
+        if (len > 0) {
+            TEST_ASSERT_EQUAL_MEMORY(data, decoded, len);
+            TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL,
+                                  neoc_base58_decode(encoded, decoded, len - 1, NULL));
+        }
+        TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL,
+                              neoc_base58_encode(data, len, encoded, strlen(expected)));
+    }
+
+    char *alloc_encoded = neoc_base58_check_encode_alloc(data, sizeof(data));
+    TEST_ASSERT_NOT_NULL(alloc_encoded);
+    size_t alloc_len = 0;
+    uint8_t *alloc_decoded = neoc_base58_check_decode_alloc(alloc_encoded, &alloc_len);
+    TEST_ASSERT_NOT_NULL(alloc_decoded);
+    TEST_ASSERT_EQUAL_UINT(sizeof(data), alloc_len);
+    TEST_ASSERT_EQUAL_MEMORY(data, alloc_decoded, sizeof(data));
+    neoc_free(alloc_encoded);
+    neoc_free(alloc_decoded);
+
+    TEST_ASSERT_FALSE(neoc_base58_is_valid_char('\0'));
+    TEST_ASSERT_FALSE(neoc_base58_is_valid_char((char)0xC1));
+}
+
+void test_base58_address_encoding(void) {
+    /* Script hash of NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8ke, in address byte order */
+    const uint8_t known[20] = {
+        0x09, 0xa5, 0x58, 0x74, 0xc2, 0xda, 0x4b, 0x86, 0xe5, 0xd4,
+        0x9f, 0xf5, 0x30, 0xa1, 0xb1, 0x53, 0xeb, 0x12, 0xc7, 0xd6
+    };
+    char address[NEOC_BASE58_ADDRESS_MAX_LENGTH + 1];
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_base58_check_encode_address(0x35, known, address, sizeof(address)));
+    TEST_ASSERT_EQUAL_STRING("NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8ke", address);
+
+    uint8_t version = 0;
+    uint8_t script_hash[20];
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_base58_check_decode_address(address, &version, script_hash));
+    TEST_ASSERT_EQUAL_HEX8(0x35, version);
+    TEST_ASSERT_EQUAL_MEMORY(known, script_hash, 20);
+
+    /* Leading zero bytes, including an all-zero payload, become leading '1's */
+    char expected[64];
+    uint8_t hash[20];
+    uint32_t x = 0x13579bdfu;
+    for (int i = 0; i < 200; i++) {
+        for (size_t k = 0; k < sizeof(hash); k++) {
+            x = x * 1103515245u + 12345u;
+            hash[k] = (uint8_t)(x >> 16);
+        }
+        for (int k = 0; k < i % 22 && k < 20; k++) {
+            hash[k] = 0;
+        }
+        uint8_t v = (uint8_t)(i % 4 == 0 ? 0 : i);
+
+        reference_address(v, hash, expected);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_base58_check_encode_address(v, hash, address, sizeof(address)));
+        TEST_ASSERT_EQUAL_STRING(expected, address);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_base58_check_decode_address(address, NULL, script_hash));
+        TEST_ASSERT_EQUAL_MEMORY(hash, script_hash, 20);
+
+        uint8_t versioned[21];
+        size_t decoded_len = 0;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_base58_check_decode(address, versioned, sizeof(versioned), &decoded_len));
+        TEST_ASSERT_EQUAL_UINT(21, decoded_len);
+        TEST_ASSERT_EQUAL_HEX8(v, versioned[0]);
+    }
+
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL,
+                          neoc_base58_check_encode_address(0x35, known, address, 34));
+}
+
+void test_base58_address_decoding_rejects(void) {
+    uint8_t script_hash[20];
+    memset(script_hash, 0xAA, sizeof(script_hash));
+
+    /* Bad character or checksum */
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_BASE58,
+                          neoc_base58_check_decode_address("NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8k0", NULL, script_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_BASE58,
+                          neoc_base58_check_decode_address("NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8kf", NULL, script_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_BASE58,
+                          neoc_base58_check_decode_address("NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8ke0000", NULL, script_hash));
+
+    /* Not a 25-byte value */
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT,
+                          neoc_base58_check_decode_address("", NULL, script_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT,
+                          neoc_base58_check_decode_address("NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8keas", NULL, script_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT,
+                          neoc_base58_check_decode_address("1NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8ke", NULL, script_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT,
+                          neoc_base58_check_decode_address("zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz", NULL, script_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT,
+                          neoc_base58_check_decode_address("3yxU3u1igY8WkgtjK92fbJQCd4BZi", NULL, script_hash));
+
+    /* Failures leave the output alone */
+    for (size_t i = 0; i < sizeof(script_hash); i++) {
+        TEST_ASSERT_EQUAL_HEX8(0xAA, script_hash[i]);
+    }
+}
+
 /* ===== MAIN TEST RUNNER ===== */
 
 int main(void) {
@@ -304,6 +469,9 @@ int main(void) {
     RUN_TEST(test_base58_check_decoding_with_invalid_characters);
     RUN_TEST(test_base58_check_decoding_with_invalid_checksum);
     RUN_TEST(test_base58_round_trip);
+    RUN_TEST(test_base58_limb_codec_matches_reference);
+    RUN_TEST(test_base58_address_encoding);
+    RUN_TEST(test_base58_address_decoding_rejects);
     
     UNITY_END();
     return 0;
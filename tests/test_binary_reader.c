@@ -7,6 +7,8 @@
 #include <neoc/neoc.h>
 #include <neoc/serialization/binary_reader.h>
 #include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
 #include <stdio.h>
 
 void setUp(void) {
@@ -258,6 +260,111 @@ void test_empty_reader(void) {
     }
 }
 
+/* ===== BORROWING READER TESTS ===== */
+
+void test_view_reader_returns_slices(void) {
+    uint8_t data[] = {0x03, 0xAA, 0xBB, 0xCC, 0x00, 0x02, 'h', 'i', 0x11, 0x22};
+    
+    neoc_binary_reader_t reader;
+    neoc_error_t err = neoc_binary_reader_init_view(&reader, data, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_NULL(reader.owned_data);
+    
+    const uint8_t *slice = NULL;
+    size_t len = 0;
+    err = neoc_binary_reader_read_var_bytes_view(&reader, &slice, &len);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_PTR(data + 1, slice);
+    TEST_ASSERT_EQUAL_UINT32(3, len);
+    
+    // Empty field
+    err = neoc_binary_reader_read_var_bytes_view(&reader, &slice, &len);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_UINT32(0, len);
+    
+    char *str = NULL;
+    err = neoc_binary_reader_read_var_string(&reader, &str);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_STRING("hi", str);
+    free(str);
+    
+    err = neoc_binary_reader_read_bytes_view(&reader, 2, &slice);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_PTR(data + 8, slice);
+    TEST_ASSERT_TRUE(neoc_binary_reader_is_at_end(&reader));
+    
+    err = neoc_binary_reader_read_bytes_view(&reader, 1, &slice);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_END_OF_STREAM, err);
+    
+    // Data is read in place, not copied
+    data[9] = 0x33;
+    TEST_ASSERT_EQUAL_UINT8(0x33, slice[1]);
+}
+
+void test_view_reader_rejects_oversized_lengths(void) {
+    // Var-int length of 2^64 - 1 followed by a single byte
+    uint8_t data[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+    
+    neoc_binary_reader_t reader;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&reader, data, sizeof(data)));
+    
+    const uint8_t *slice = NULL;
+    size_t len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_END_OF_STREAM,
+                          neoc_binary_reader_read_var_bytes_view(&reader, &slice, &len));
+    
+    uint8_t *copy = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_seek(&reader, 0));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_END_OF_STREAM, neoc_binary_reader_read_var_bytes(&reader, &copy, &len));
+    TEST_ASSERT_NULL(copy);
+    
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_seek(&reader, 9));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_END_OF_STREAM, neoc_binary_reader_skip(&reader, SIZE_MAX));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_END_OF_STREAM, neoc_binary_reader_read_bytes_view(&reader, SIZE_MAX, &slice));
+    
+    // Empty views are valid
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&reader, NULL, 0));
+    TEST_ASSERT_TRUE(neoc_binary_reader_is_at_end(&reader));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, neoc_binary_reader_init_view(&reader, NULL, 1));
+}
+
+void test_mapped_file_reader(void) {
+    const char *path = "test_binary_reader_mapped.bin";
+    const uint8_t contents[] = {0x04, 'N', 'E', 'O', '3', 0x78, 0x56, 0x34, 0x12};
+    FILE *file = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(contents), fwrite(contents, 1, sizeof(contents), file));
+    fclose(file);
+    
+    neoc_binary_reader_t *reader = NULL;
+    neoc_error_t err = neoc_binary_reader_map_file(path, &reader);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(contents), reader->size);
+    
+    const uint8_t *slice = NULL;
+    size_t len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_read_var_bytes_view(reader, &slice, &len));
+    TEST_ASSERT_EQUAL_UINT32(4, len);
+    TEST_ASSERT_EQUAL_MEMORY("NEO3", slice, 4);
+    
+    uint32_t value = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_read_uint32(reader, &value));
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, value);
+    TEST_ASSERT_TRUE(neoc_binary_reader_is_at_end(reader));
+    neoc_binary_reader_free(reader);
+    
+    // Empty files map to an empty reader
+    file = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    fclose(file);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_map_file(path, &reader));
+    TEST_ASSERT_TRUE(neoc_binary_reader_is_at_end(reader));
+    neoc_binary_reader_free(reader);
+    
+    remove(path);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_FILE_NOT_FOUND, neoc_binary_reader_map_file(path, &reader));
+}
+
 /* ===== MAIN TEST RUNNER ===== */
 
 int main(void) {
@@ -273,6 +380,9 @@ int main(void) {
     RUN_TEST(test_read_bool);
     RUN_TEST(test_reader_position);
     RUN_TEST(test_empty_reader);
+    RUN_TEST(test_view_reader_returns_slices);
+    RUN_TEST(test_view_reader_rejects_oversized_lengths);
+    RUN_TEST(test_mapped_file_reader);
     
     UNITY_END();
     return 0;
@@ -309,6 +309,65 @@ void test_writer_auto_grow(void) {
     neoc_free(writer);
 }
 
+typedef struct {
+    uint8_t data[64];
+    size_t len;
+    size_t calls;
+} sink_capture_t;
+
+static neoc_error_t capture_sink(void *ctx, const uint8_t *data, size_t len) {
+    sink_capture_t *capture = ctx;
+    TEST_ASSERT_TRUE(capture->len + len <= sizeof(capture->data));
+    memcpy(capture->data + capture->len, data, len);
+    capture->len += len;
+    capture->calls++;
+    return NEOC_SUCCESS;
+}
+
+void test_fixed_buffer_writer(void) {
+    uint8_t buffer[6];
+    neoc_binary_writer_t writer;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_init_buffer(&writer, buffer, sizeof(buffer)));
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_write_uint32(&writer, 0x04030201));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_OVERFLOW, neoc_binary_writer_write_uint32(&writer, 0));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_write_uint16(&writer, 0x0605));
+
+    uint8_t expected[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    test_and_compare(&writer, expected, sizeof(expected));
+    TEST_ASSERT_EQUAL_PTR(buffer, writer.data);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_OVERFLOW, neoc_binary_writer_write_byte(&writer, 0));
+}
+
+void test_sink_writer_streams_in_order(void) {
+    uint8_t staging[16];
+    sink_capture_t capture;
+    memset(&capture, 0, sizeof(capture));
+    neoc_binary_writer_t writer;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_binary_writer_init_sink(&writer, staging, sizeof(staging), capture_sink, &capture));
+
+    uint8_t expected[40];
+    for (size_t i = 0; i < sizeof(expected); i++) {
+        expected[i] = (uint8_t)i;
+    }
+
+    /* Small writes fill the staging buffer; the 20 byte run bypasses it */
+    for (size_t i = 0; i < 12; i += 4) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_write_bytes(&writer, expected + i, 4));
+    }
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_write_bytes(&writer, expected + 12, 20));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_write_uint64(&writer, 0x2726252423222120ULL));
+    TEST_ASSERT_EQUAL_UINT(40, neoc_binary_writer_get_position(&writer));
+    TEST_ASSERT_EQUAL_UINT(32, capture.len);
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_flush(&writer));
+    TEST_ASSERT_EQUAL_UINT(40, capture.len);
+    TEST_ASSERT_EQUAL_UINT(3, capture.calls);
+    TEST_ASSERT_EQUAL_MEMORY(expected, capture.data, sizeof(expected));
+    TEST_ASSERT_EQUAL_UINT(40, neoc_binary_writer_get_position(&writer));
+}
+
 /* ===== MAIN TEST RUNNER ===== */
 
 int main(void) {
@@ -324,6 +383,8 @@ int main(void) {
     RUN_TEST(test_write_bytes);
     RUN_TEST(test_write_bool);
     RUN_TEST(test_writer_auto_grow);
+    RUN_TEST(test_fixed_buffer_writer);
+    RUN_TEST(test_sink_writer_streams_in_order);
     
     UNITY_END();
     return 0;
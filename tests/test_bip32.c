@@ -350,6 +350,251 @@ void test_bip32_with_bip39(void) {
     neoc_ec_key_pair_free(&ec_key);
 }
 
+static void create_test_master(neoc_bip32_key_t *master) {
+    const char* seed_hex = "000102030405060708090a0b0c0d0e0f";
+    neoc_bytes_t* seed_bytes = neoc_bytes_from_hex(seed_hex);
+    TEST_ASSERT_NOT_NULL(seed_bytes);
+    neoc_error_t err = neoc_bip32_from_seed(seed_bytes->data, seed_bytes->length, master);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    neoc_bytes_free(seed_bytes);
+}
+
+static void assert_hex_equal(const char *expected_hex, const uint8_t *actual, size_t len) {
+    neoc_bytes_t *expected = neoc_bytes_from_hex(expected_hex);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_EQUAL_INT((int)len, (int)expected->length);
+    TEST_ASSERT_EQUAL_MEMORY(expected->data, actual, len);
+    neoc_bytes_free(expected);
+}
+
+static void assert_bip32_keys_equal(const neoc_bip32_key_t *expected, const neoc_bip32_key_t *actual) {
+    TEST_ASSERT_EQUAL_UINT8(expected->depth, actual->depth);
+    TEST_ASSERT_EQUAL_UINT32(expected->child_number, actual->child_number);
+    TEST_ASSERT_EQUAL_INT(expected->is_private, actual->is_private);
+    TEST_ASSERT_EQUAL_MEMORY(expected->version, actual->version, 4);
+    TEST_ASSERT_EQUAL_MEMORY(expected->parent_fingerprint, actual->parent_fingerprint, BIP32_FINGERPRINT_SIZE);
+    TEST_ASSERT_EQUAL_MEMORY(expected->chain_code, actual->chain_code, BIP32_CHAIN_CODE_SIZE);
+    TEST_ASSERT_EQUAL_MEMORY(expected->key, actual->key, 33);
+}
+
+#define RANGE_COUNT 150
+
+void test_bip32_derive_range(void) {
+    neoc_bip32_key_t master_key;
+    create_test_master(&master_key);
+
+    neoc_bip32_key_t account;
+    neoc_error_t err = neoc_bip32_derive_path(&master_key, "m/44'/888'/0'/0", &account);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    static neoc_bip32_key_t keys[RANGE_COUNT];
+    err = neoc_bip32_derive_range(&account, 10, RANGE_COUNT, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    for (uint32_t i = 0; i < RANGE_COUNT; i++) {
+        neoc_bip32_key_t expected;
+        err = neoc_bip32_derive_child(&account, 10 + i, &expected);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        assert_bip32_keys_equal(&expected, &keys[i]);
+    }
+
+    // Hardened ranges from a private parent
+    err = neoc_bip32_derive_range(&master_key, BIP32_HARDENED_KEY_START | 44, 3, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    neoc_bip32_key_t expected;
+    err = neoc_bip32_derive_child(&master_key, BIP32_HARDENED_KEY_START | 46, &expected);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    assert_bip32_keys_equal(&expected, &keys[2]);
+}
+
+void test_bip32_derive_range_public(void) {
+    neoc_bip32_key_t master_key;
+    create_test_master(&master_key);
+
+    neoc_bip32_key_t account, account_public;
+    neoc_error_t err = neoc_bip32_derive_path(&master_key, "m/44'/888'/0'/0", &account);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    err = neoc_bip32_get_public_key(&account, &account_public);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    static neoc_bip32_key_t keys[RANGE_COUNT];
+    err = neoc_bip32_derive_range(&account_public, 0, RANGE_COUNT, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    for (uint32_t i = 0; i < RANGE_COUNT; i++) {
+        neoc_bip32_key_t child, expected;
+        err = neoc_bip32_derive_child(&account, i, &child);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        err = neoc_bip32_get_public_key(&child, &expected);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        TEST_ASSERT_FALSE(keys[i].is_private);
+        TEST_ASSERT_EQUAL_MEMORY(expected.key, keys[i].key, 33);
+        TEST_ASSERT_EQUAL_MEMORY(expected.chain_code, keys[i].chain_code, BIP32_CHAIN_CODE_SIZE);
+        TEST_ASSERT_EQUAL_UINT32(i, keys[i].child_number);
+    }
+}
+
+void test_bip32_derive_range_invalid(void) {
+    neoc_bip32_key_t master_key, master_public;
+    create_test_master(&master_key);
+    neoc_error_t err = neoc_bip32_get_public_key(&master_key, &master_public);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    neoc_bip32_key_t keys[4];
+    err = neoc_bip32_derive_range(&master_public, BIP32_HARDENED_KEY_START - 2, 4, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, err);
+
+    err = neoc_bip32_derive_range(&master_key, UINT32_MAX - 1, 4, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, err);
+
+    err = neoc_bip32_derive_range(&master_key, 0, 0, NULL);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    err = neoc_bip32_derive_range(NULL, 0, 4, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, err);
+}
+
+void test_bip32_context_derive(void) {
+    neoc_bip32_key_t master_key;
+    create_test_master(&master_key);
+
+    neoc_bip32_context_t *context = NULL;
+    neoc_error_t err = neoc_bip32_context_create(&master_key, &context);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    // More accounts than cache slots so entries get evicted and rebuilt
+    for (uint32_t round = 0; round < 2; round++) {
+        for (uint32_t account = 0; account < 20; account++) {
+            uint32_t indices[] = {
+                BIP32_HARDENED_KEY_START | 44,
+                BIP32_HARDENED_KEY_START | 888,
+                BIP32_HARDENED_KEY_START | account,
+                0,
+                round * 7 + account
+            };
+            neoc_bip32_key_t expected, derived;
+            err = neoc_bip32_derive_path_indices(&master_key, indices, 5, &expected);
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+            err = neoc_bip32_context_derive(context, indices, 5, &derived);
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+            assert_bip32_keys_equal(&expected, &derived);
+        }
+    }
+
+    uint32_t parent[] = {
+        BIP32_HARDENED_KEY_START | 44,
+        BIP32_HARDENED_KEY_START | 888,
+        BIP32_HARDENED_KEY_START | 0,
+        0
+    };
+    neoc_bip32_key_t keys[8];
+    err = neoc_bip32_context_derive_range(context, parent, 4, 100, 8, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    uint32_t indices[5] = {parent[0], parent[1], parent[2], parent[3], 105};
+    neoc_bip32_key_t expected;
+    err = neoc_bip32_derive_path_indices(&master_key, indices, 5, &expected);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    assert_bip32_keys_equal(&expected, &keys[5]);
+
+    neoc_bip32_key_t root;
+    err = neoc_bip32_context_derive(context, NULL, 0, &root);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    assert_bip32_keys_equal(&master_key, &root);
+
+    neoc_bip32_context_free(context);
+}
+
+void test_bip32_context_public(void) {
+    neoc_bip32_key_t master_key;
+    create_test_master(&master_key);
+
+    neoc_bip32_key_t account, account_public;
+    neoc_error_t err = neoc_bip32_derive_path(&master_key, "m/44'/888'/0'", &account);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    err = neoc_bip32_get_public_key(&account, &account_public);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    neoc_bip32_context_t *context = NULL;
+    err = neoc_bip32_context_create(&account_public, &context);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    for (uint32_t i = 0; i < 5; i++) {
+        uint32_t indices[] = {0, i};
+        neoc_bip32_key_t private_child, expected, derived;
+        err = neoc_bip32_derive_path_indices(&account, indices, 2, &private_child);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        err = neoc_bip32_get_public_key(&private_child, &expected);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        err = neoc_bip32_context_derive(context, indices, 2, &derived);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        TEST_ASSERT_FALSE(derived.is_private);
+        TEST_ASSERT_EQUAL_MEMORY(expected.key, derived.key, 33);
+    }
+
+    uint32_t hardened[] = {0, BIP32_HARDENED_KEY_START | 1};
+    neoc_bip32_key_t derived;
+    err = neoc_bip32_context_derive(context, hardened, 2, &derived);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, err);
+
+    neoc_bip32_context_free(context);
+}
+
+/* Pinned m/44'/888'/0'/0/7 from seed 000102...0f */
+#define PINNED_PRIVATE_KEY "00fd0e686140fdbe75267b551caed40e2fbee769563870036889f09836ec788af8"
+#define PINNED_CHAIN_CODE "88cede7934669fc534a7f55543901fafa764e3f54d84dfd4355265414fc9e380"
+#define PINNED_PUBLIC_KEY "02ceb49e2204c3a160e60d036697efcb97b7d876318fbba93d692cd1586dfdc0cc"
+
+void test_bip32_pinned_vector(void) {
+    neoc_bip32_key_t master_key;
+    create_test_master(&master_key);
+
+    neoc_bip32_key_t derived;
+    neoc_error_t err = neoc_bip32_derive_path(&master_key, "m/44'/888'/0'/0/7", &derived);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_TRUE(derived.is_private);
+    assert_hex_equal(PINNED_PRIVATE_KEY, derived.key, 33);
+    assert_hex_equal(PINNED_CHAIN_CODE, derived.chain_code, BIP32_CHAIN_CODE_SIZE);
+
+    neoc_bip32_key_t derived_public;
+    err = neoc_bip32_get_public_key(&derived, &derived_public);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    assert_hex_equal(PINNED_PUBLIC_KEY, derived_public.key, 33);
+
+    // Batch and cached paths must land on the same keys
+    neoc_bip32_key_t account, account_public;
+    err = neoc_bip32_derive_path(&master_key, "m/44'/888'/0'/0", &account);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    err = neoc_bip32_get_public_key(&account, &account_public);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    neoc_bip32_key_t keys[8];
+    err = neoc_bip32_derive_range(&account, 0, 8, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    assert_hex_equal(PINNED_PRIVATE_KEY, keys[7].key, 33);
+    assert_hex_equal(PINNED_CHAIN_CODE, keys[7].chain_code, BIP32_CHAIN_CODE_SIZE);
+
+    err = neoc_bip32_derive_range(&account_public, 0, 8, keys);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_FALSE(keys[7].is_private);
+    assert_hex_equal(PINNED_PUBLIC_KEY, keys[7].key, 33);
+    assert_hex_equal(PINNED_CHAIN_CODE, keys[7].chain_code, BIP32_CHAIN_CODE_SIZE);
+
+    neoc_bip32_context_t *context = NULL;
+    err = neoc_bip32_context_create(&master_key, &context);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    uint32_t indices[] = {
+        BIP32_HARDENED_KEY_START | 44,
+        BIP32_HARDENED_KEY_START | 888,
+        BIP32_HARDENED_KEY_START | 0,
+        0,
+        7
+    };
+    err = neoc_bip32_context_derive(context, indices, 5, &derived);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    assert_hex_equal(PINNED_PRIVATE_KEY, derived.key, 33);
+    assert_hex_equal(PINNED_CHAIN_CODE, derived.chain_code, BIP32_CHAIN_CODE_SIZE);
+    neoc_bip32_context_free(context);
+}
+
 /* ===== MAIN TEST RUNNER ===== */
 
 int main(void) {
@@ -373,6 +618,12 @@ int main(void) {
     // RUN_TEST(test_bip32_to_ec_key_pair);
     RUN_TEST(test_bip32_parse_path);
     RUN_TEST(test_bip32_get_neo_path);
+    RUN_TEST(test_bip32_derive_range);
+    RUN_TEST(test_bip32_derive_range_public);
+    RUN_TEST(test_bip32_derive_range_invalid);
+    RUN_TEST(test_bip32_context_derive);
+    RUN_TEST(test_bip32_context_public);
+    RUN_TEST(test_bip32_pinned_vector);
     // RUN_TEST(test_bip32_serialize_deserialize);
     // RUN_TEST(test_bip32_get_fingerprint);
     // RUN_TEST(test_bip32_with_bip39);
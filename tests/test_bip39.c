@@ -3,6 +3,7 @@
 #include <neoc/crypto/neoc_hash.h>
 #include <string.h>
 #include <stdlib.h>
+#include <openssl/evp.h>
 
 void setUp(void) {
     // Initialize crypto system for BIP-39 operations
@@ -255,6 +256,119 @@ void test_bip39_entropy_roundtrip_all_strengths(void) {
     }
 }
 
+void test_bip39_find_word_whole_list(void) {
+    for (uint16_t i = 0; i < 2048; i++) {
+        const char *word = neoc_bip39_get_word(NEOC_BIP39_LANG_ENGLISH, i);
+        TEST_ASSERT_NOT_NULL(word);
+        TEST_ASSERT_EQUAL_INT(i, neoc_bip39_find_word(NEOC_BIP39_LANG_ENGLISH, word));
+    }
+
+    // Shared four-letter prefixes must not match
+    TEST_ASSERT_EQUAL_INT(-1, neoc_bip39_find_word(NEOC_BIP39_LANG_ENGLISH, "aban"));
+    TEST_ASSERT_EQUAL_INT(-1, neoc_bip39_find_word(NEOC_BIP39_LANG_ENGLISH, "abandonx"));
+    TEST_ASSERT_EQUAL_INT(-1, neoc_bip39_find_word(NEOC_BIP39_LANG_ENGLISH, "Abandon"));
+    TEST_ASSERT_EQUAL_INT(-1, neoc_bip39_find_word(NEOC_BIP39_LANG_ENGLISH, ""));
+}
+
+void test_bip39_validate_mnemonic_spacing(void) {
+    const char *padded = "  abandon abandon  abandon abandon abandon abandon abandon abandon "
+                         "abandon abandon abandon   about ";
+    TEST_ASSERT_TRUE(neoc_bip39_validate_mnemonic(padded, NEOC_BIP39_LANG_ENGLISH));
+
+    const char *tabbed = "abandon\tabandon abandon abandon abandon abandon abandon abandon "
+                         "abandon abandon abandon about";
+    TEST_ASSERT_FALSE(neoc_bip39_validate_mnemonic(tabbed, NEOC_BIP39_LANG_ENGLISH));
+
+    const char *too_many = "abandon abandon abandon abandon abandon abandon abandon abandon "
+                           "abandon abandon abandon abandon abandon abandon abandon abandon "
+                           "abandon abandon abandon abandon abandon abandon abandon art abandon";
+    TEST_ASSERT_FALSE(neoc_bip39_validate_mnemonic(too_many, NEOC_BIP39_LANG_ENGLISH));
+
+    const char *valid_24 = "abandon abandon abandon abandon abandon abandon abandon abandon "
+                           "abandon abandon abandon abandon abandon abandon abandon abandon "
+                           "abandon abandon abandon abandon abandon abandon abandon art";
+    TEST_ASSERT_TRUE(neoc_bip39_validate_mnemonic(valid_24, NEOC_BIP39_LANG_ENGLISH));
+    TEST_ASSERT_FALSE(neoc_bip39_validate_mnemonic("", NEOC_BIP39_LANG_ENGLISH));
+}
+
+void test_bip39_mnemonic_to_seed_matches_openssl(void) {
+    // Longer than one SHA-512 block, so the HMAC key is hashed first
+    const char *mnemonic = "void come effort suffer camp survey warrior heavy shoot primary "
+                           "clutch crush open amazing screen patrol group space point ten "
+                           "exist slush involve unfold";
+    const char *passphrases[] = {
+        NULL,
+        "TREZOR",
+        "a much longer passphrase that does not fit in a single block of SHA-512 input, "
+        "which is one hundred and twenty-eight bytes long"
+    };
+
+    for (size_t i = 0; i < sizeof(passphrases) / sizeof(passphrases[0]); i++) {
+        char salt[256] = "mnemonic";
+        if (passphrases[i]) {
+            strcat(salt, passphrases[i]);
+        }
+        uint8_t expected[100];
+        TEST_ASSERT_EQUAL_INT(1, PKCS5_PBKDF2_HMAC(mnemonic, (int)strlen(mnemonic),
+                                                   (const unsigned char *)salt, (int)strlen(salt),
+                                                   2048, EVP_sha512(), sizeof(expected), expected));
+
+        uint8_t seed[64];
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_bip39_mnemonic_to_seed(mnemonic, passphrases[i], seed));
+        TEST_ASSERT_EQUAL_MEMORY(expected, seed, sizeof(seed));
+
+        // Longer outputs take further PBKDF2 blocks
+        uint8_t long_seed[100];
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_bip39_mnemonic_to_seed(mnemonic, passphrases[i],
+                                                                        long_seed, sizeof(long_seed)));
+        TEST_ASSERT_EQUAL_MEMORY(expected, long_seed, sizeof(long_seed));
+    }
+}
+
+void test_bip39_mnemonic_to_seed_batch(void) {
+    const char *mnemonics[] = {
+        "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about",
+        "legal winner thank year wave sausage worth useful legal winner thank yellow",
+        NULL,
+        "letter advice cage absurd amount doctor acoustic avoid letter advice cage above",
+        "zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo wrong"
+    };
+    const char *passphrases[] = {"TREZOR", NULL, "x", "", "passphrase"};
+    enum { COUNT = sizeof(mnemonics) / sizeof(mnemonics[0]) };
+
+    uint8_t seeds[COUNT * 64];
+    neoc_error_t results[COUNT];
+    memset(seeds, 0xAA, sizeof(seeds));
+    neoc_error_t err = neoc_bip39_mnemonic_to_seed_batch(mnemonics, passphrases, COUNT, 3,
+                                                         seeds, results);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    uint8_t zero[64] = {0};
+    for (size_t i = 0; i < COUNT; i++) {
+        if (!mnemonics[i]) {
+            TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, results[i]);
+            TEST_ASSERT_EQUAL_MEMORY(zero, seeds + 64 * i, 64);
+            continue;
+        }
+        uint8_t expected[64];
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, results[i]);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              neoc_bip39_mnemonic_to_seed(mnemonics[i], passphrases[i], expected));
+        TEST_ASSERT_EQUAL_MEMORY(expected, seeds + 64 * i, 64);
+    }
+
+    // Without passphrases every seed matches the no-passphrase derivation
+    err = neoc_bip39_mnemonic_to_seed_batch(mnemonics, NULL, 2, 0, seeds, results);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    uint8_t expected[64];
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_bip39_mnemonic_to_seed(mnemonics[1], NULL, expected));
+    TEST_ASSERT_EQUAL_MEMORY(expected, seeds + 64, 64);
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_bip39_mnemonic_to_seed_batch(NULL, NULL, 0, 0, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT,
+                          neoc_bip39_mnemonic_to_seed_batch(mnemonics, NULL, 1, 0, NULL, results));
+}
+
 int main(void) {
     UNITY_BEGIN();
     
@@ -268,6 +382,10 @@ int main(void) {
     RUN_TEST(test_bip39_validate_mnemonic);
     RUN_TEST(test_bip39_entropy_roundtrip);
     RUN_TEST(test_bip39_entropy_roundtrip_all_strengths);
+    RUN_TEST(test_bip39_find_word_whole_list);
+    RUN_TEST(test_bip39_validate_mnemonic_spacing);
+    RUN_TEST(test_bip39_mnemonic_to_seed_matches_openssl);
+    RUN_TEST(test_bip39_mnemonic_to_seed_batch);
     
     return UnityEnd();
 }
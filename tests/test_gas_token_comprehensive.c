@@ -9,6 +9,9 @@
 #include <neoc/contract/native_contracts.h>
 #include <neoc/utils/neoc_hex.h>
 #include <neoc/types/neoc_hash160.h>
+#include <neoc/neo_constants.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -253,11 +256,191 @@ void test_gas_token_multi_transfer_script(void) {
     TEST_ASSERT_TRUE(script_len > 0);
     
     printf("  Generated multi-transfer script length: %zu bytes\n", script_len);
-    
+
+    // The combined script is the single-transfer scripts back to back
+    size_t offset = 0;
+    for (size_t i = 0; i < 3; i++) {
+        uint8_t* single;
+        size_t single_len;
+        err = neoc_gas_token_build_transfer_script(gas_token, &from_address, &transfers[i].to,
+                                                   transfers[i].amount, NULL, 0,
+                                                   &single, &single_len);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        TEST_ASSERT_TRUE(offset + single_len <= script_len);
+        TEST_ASSERT_EQUAL_MEMORY(single, script + offset, single_len);
+        offset += single_len;
+        neoc_free(single);
+    }
+    TEST_ASSERT_EQUAL_INT((int)script_len, (int)offset);
+
     neoc_free(script);
     neoc_gas_token_free(gas_token);
 }
 
+void test_gas_token_batch_transfer_split(void) {
+    printf("Testing NEP-17 batch transfer split plan\n");
+
+    enum { COUNT = 10 };
+    neoc_fungible_token_transfer_request_t transfers[COUNT];
+    memset(transfers, 0, sizeof(transfers));
+    const uint8_t memo[] = { 0x01, 0x02, 0x03 };
+    for (size_t i = 0; i < COUNT; i++) {
+        memset(transfers[i].to.data, (int)(0x10 + i), sizeof(transfers[i].to.data));
+        transfers[i].amount = 1000 + i * 100000;
+        if (i % 3 == 0) {
+            transfers[i].data = memo;
+            transfers[i].data_len = sizeof(memo);
+        }
+    }
+    neoc_hash160_t from;
+    memset(from.data, 0x77, sizeof(from.data));
+
+    // Reference: each transfer built on its own
+    uint8_t *singles[COUNT];
+    size_t single_lens[COUNT];
+    size_t largest = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        neoc_error_t err = neoc_script_create_nep17_transfer(&NEOC_GAS_TOKEN_HASH, &from, &transfers[i].to,
+                                                             transfers[i].amount, transfers[i].data,
+                                                             transfers[i].data_len,
+                                                             &singles[i], &single_lens[i]);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+        if (single_lens[i] > largest) {
+            largest = single_lens[i];
+        }
+    }
+
+    // A limit of roughly three transfers forces several chunks
+    size_t limit = largest * 3;
+    neoc_fungible_token_batch_t *batch = NULL;
+    neoc_error_t err = neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, &from, transfers,
+                                                                COUNT, limit, &batch);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_NOT_NULL(batch);
+    TEST_ASSERT_TRUE(batch->chunk_count >= COUNT / 3);
+
+    size_t next_transfer = 0;
+    size_t offset = 0;
+    for (size_t c = 0; c < batch->chunk_count; c++) {
+        const neoc_fungible_token_batch_chunk_t *chunk = &batch->chunks[c];
+        TEST_ASSERT_EQUAL_INT((int)next_transfer, (int)chunk->first_transfer);
+        TEST_ASSERT_EQUAL_INT((int)offset, (int)chunk->script_offset);
+        TEST_ASSERT_TRUE(chunk->transfer_count > 0);
+        TEST_ASSERT_TRUE(chunk->script_len <= limit);
+
+        size_t chunk_len = 0;
+        for (size_t i = chunk->first_transfer; i < chunk->first_transfer + chunk->transfer_count; i++) {
+            TEST_ASSERT_EQUAL_MEMORY(singles[i], batch->script + offset + chunk_len, single_lens[i]);
+            chunk_len += single_lens[i];
+        }
+        TEST_ASSERT_EQUAL_INT((int)chunk_len, (int)chunk->script_len);
+        // Greedy packing: the next transfer would not have fitted
+        size_t after = chunk->first_transfer + chunk->transfer_count;
+        if (after < COUNT) {
+            TEST_ASSERT_TRUE(chunk_len + single_lens[after] > limit);
+        }
+        next_transfer = after;
+        offset += chunk_len;
+    }
+    TEST_ASSERT_EQUAL_INT(COUNT, (int)next_transfer);
+    TEST_ASSERT_EQUAL_INT((int)offset, (int)batch->script_len);
+    neoc_fungible_token_batch_free(batch);
+
+    // Without a split the batch matches the GAS multi-transfer script
+    neoc_gas_token_t *gas_token;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_gas_token_create(&gas_token));
+    uint8_t *multi;
+    size_t multi_len;
+    err = neoc_gas_token_build_multi_transfer_script(gas_token, &from, transfers, COUNT, &multi, &multi_len);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, &from, transfers,
+                                                                   COUNT, SIZE_MAX, &batch));
+    TEST_ASSERT_EQUAL_INT(1, (int)batch->chunk_count);
+    TEST_ASSERT_EQUAL_INT((int)multi_len, (int)batch->script_len);
+    TEST_ASSERT_EQUAL_MEMORY(multi, batch->script, multi_len);
+    neoc_fungible_token_batch_free(batch);
+    neoc_free(multi);
+    neoc_gas_token_free(gas_token);
+
+    for (size_t i = 0; i < COUNT; i++) {
+        neoc_free(singles[i]);
+    }
+}
+
+void test_gas_token_batch_transfer_limits(void) {
+    printf("Testing NEP-17 batch transfer limits\n");
+
+    enum { COUNT = 1000 };
+    neoc_fungible_token_transfer_request_t *transfers = calloc(COUNT, sizeof(*transfers));
+    TEST_ASSERT_NOT_NULL(transfers);
+    for (size_t i = 0; i < COUNT; i++) {
+        memset(transfers[i].to.data, (int)(i & 0xFF), sizeof(transfers[i].to.data));
+        transfers[i].amount = 100000000 + i;
+    }
+    neoc_hash160_t from;
+    memset(from.data, 0x42, sizeof(from.data));
+
+    // The default limit keeps every chunk within the protocol's script size
+    neoc_fungible_token_batch_t *batch = NULL;
+    neoc_error_t err = neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, &from, transfers,
+                                                                COUNT, 0, &batch);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_TRUE(batch->script_len > NEOC_MAX_TRANSACTION_SCRIPT_SIZE);
+    TEST_ASSERT_TRUE(batch->chunk_count >= 2);
+    size_t total = 0;
+    for (size_t c = 0; c < batch->chunk_count; c++) {
+        TEST_ASSERT_TRUE(batch->chunks[c].script_len <= NEOC_MAX_TRANSACTION_SCRIPT_SIZE);
+        total += batch->chunks[c].transfer_count;
+    }
+    TEST_ASSERT_EQUAL_INT(COUNT, (int)total);
+    neoc_fungible_token_batch_free(batch);
+
+    // Exact boundary: a transfer of NEOC_MAX_TRANSACTION_SCRIPT_SIZE bytes fits, one more does not
+    size_t probe_len = 1000;
+    uint8_t *payload = calloc(NEOC_MAX_TRANSACTION_SCRIPT_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(payload);
+    uint8_t *probe;
+    size_t probe_script_len;
+    err = neoc_script_create_nep17_transfer(&NEOC_GAS_TOKEN_HASH, &from, &transfers[0].to,
+                                            transfers[0].amount, payload, probe_len,
+                                            &probe, &probe_script_len);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    neoc_free(probe);
+    // Payloads from 256 to 65535 bytes share one PUSHDATA2 header, so the overhead is fixed
+    size_t overhead = probe_script_len - probe_len;
+
+    neoc_fungible_token_transfer_request_t big = transfers[0];
+    big.data = payload;
+    big.data_len = NEOC_MAX_TRANSACTION_SCRIPT_SIZE - overhead;
+    err = neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, &from, &big, 1, 0, &batch);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_INT(1, (int)batch->chunk_count);
+    TEST_ASSERT_EQUAL_INT(NEOC_MAX_TRANSACTION_SCRIPT_SIZE, (int)batch->chunks[0].script_len);
+    neoc_fungible_token_batch_free(batch);
+
+    batch = NULL;
+    big.data_len++;
+    err = neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, &from, &big, 1, 0, &batch);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_SIZE, err);
+    TEST_ASSERT_NULL(batch);
+    free(payload);
+
+    // A transfer larger than the limit cannot be placed
+    batch = NULL;
+    err = neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, &from, transfers, COUNT, 16, &batch);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_SIZE, err);
+    TEST_ASSERT_NULL(batch);
+
+    // Zero amounts are rejected
+    transfers[COUNT - 1].amount = 0;
+    err = neoc_fungible_token_build_batch_transfer(&NEOC_GAS_TOKEN_HASH, &from, transfers, COUNT, 0, &batch);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, err);
+    TEST_ASSERT_NULL(batch);
+
+    free(transfers);
+}
+
 /* ===== GAS TOKEN VALIDATION TESTS ===== */
 
 void test_gas_token_invalid_inputs(void) {
@@ -476,6 +659,8 @@ int main(void) {
     // Transfer tests
     RUN_TEST(test_gas_token_transfer_script);
     RUN_TEST(test_gas_token_multi_transfer_script);
+    RUN_TEST(test_gas_token_batch_transfer_split);
+    RUN_TEST(test_gas_token_batch_transfer_limits);
     
     // Validation tests
     RUN_TEST(test_gas_token_invalid_inputs);
@@ -0,0 +1,127 @@
+/**
+ * @file test_hash_batch.c
+ * @brief Batched SHA256 / Hash160 against the one-shot functions on every backend
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/crypto/hash.h>
+#include <neoc/utils/neoc_cpu_features.h>
+#include <openssl/sha.h>
+#include <string.h>
+
+#define MAX_LEN 300
+
+static uint8_t message_bytes[MAX_LEN];
+
+static const neoc_hash_backend_t backends[] = {
+    NEOC_HASH_BACKEND_SCALAR,
+    NEOC_HASH_BACKEND_SSE2,
+    NEOC_HASH_BACKEND_AVX2,
+    NEOC_HASH_BACKEND_SHANI
+};
+
+void setUp(void) {
+    neoc_init();
+    uint32_t x = 0x12345678u;
+    for (size_t i = 0; i < MAX_LEN; i++) {
+        x = x * 1103515245u + 12345u;
+        message_bytes[i] = (uint8_t)(x >> 16);
+    }
+}
+
+void tearDown(void) {
+    neoc_hash_set_backend(NEOC_HASH_BACKEND_AUTO);
+    neoc_cleanup();
+}
+
+/* Every length up to MAX_LEN covers all padding cases, one or two tail blocks */
+void test_sha256_batch_matches_openssl(void) {
+    static const uint8_t *data[MAX_LEN + 1];
+    static size_t lens[MAX_LEN + 1];
+    static uint8_t hashes[(MAX_LEN + 1) * 32];
+
+    for (size_t i = 0; i <= MAX_LEN; i++) {
+        /* Vary the start as well so messages differ beyond their length */
+        data[i] = i == 0 ? NULL : message_bytes + (i % 7);
+        lens[i] = i < MAX_LEN - 7 ? i : MAX_LEN - 7;
+    }
+
+    size_t tested = 0;
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (!neoc_hash_backend_supported(backends[b])) {
+            TEST_ASSERT_EQUAL_INT(NEOC_ERROR_NOT_SUPPORTED, neoc_hash_set_backend(backends[b]));
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash_set_backend(backends[b]));
+        TEST_ASSERT_EQUAL_INT(backends[b], neoc_hash_get_backend());
+        memset(hashes, 0, sizeof(hashes));
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash_sha256_batch(data, lens, MAX_LEN + 1, hashes));
+
+        for (size_t i = 0; i <= MAX_LEN; i++) {
+            uint8_t expected[32];
+            SHA256(data[i] ? data[i] : message_bytes, lens[i], expected);
+            TEST_ASSERT_EQUAL_MEMORY(expected, hashes + 32 * i, 32);
+        }
+        tested++;
+    }
+    TEST_ASSERT_TRUE(tested >= 1);
+}
+
+/* Long and short messages interleaved so lanes are refilled out of order */
+void test_hash160_batch_with_mixed_lengths(void) {
+    const size_t count = 100;
+    const uint8_t *data[100];
+    size_t lens[100];
+    uint8_t hashes[100 * 20];
+    for (size_t i = 0; i < count; i++) {
+        data[i] = message_bytes + (i % 13);
+        lens[i] = (i % 5 == 0) ? MAX_LEN - 13 : (i * 7) % 70;
+    }
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (neoc_hash_set_backend(backends[b]) != NEOC_SUCCESS) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash_hash160_batch(data, lens, count, hashes));
+        for (size_t i = 0; i < count; i++) {
+            uint8_t expected[20];
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash_hash160(data[i], lens[i], expected));
+            TEST_ASSERT_EQUAL_MEMORY(expected, hashes + 20 * i, 20);
+        }
+    }
+}
+
+void test_batch_arguments(void) {
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash_set_backend(NEOC_HASH_BACKEND_AUTO));
+    TEST_ASSERT_TRUE(neoc_hash_get_backend() != NEOC_HASH_BACKEND_AUTO);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_NOT_SUPPORTED, neoc_hash_set_backend((neoc_hash_backend_t)42));
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash_sha256_batch(NULL, NULL, 0, NULL));
+
+    const uint8_t *data[2] = { message_bytes, NULL };
+    size_t lens[2] = { 10, 5 };
+    uint8_t hashes[64];
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, neoc_hash_sha256_batch(data, lens, 2, hashes));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, neoc_hash_sha256_batch(data, lens, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, neoc_hash_hash160_batch(data, lens, 2, hashes));
+}
+
+/* The hash dispatch and the hex codec read the same detected feature set */
+void test_backends_follow_cpu_features(void) {
+    unsigned int features = neoc_cpu_features();
+    TEST_ASSERT_EQUAL_UINT(features, neoc_cpu_features());
+    TEST_ASSERT_EQUAL_INT((features & NEOC_CPU_FEATURE_AVX2) != 0,
+                          neoc_hash_backend_supported(NEOC_HASH_BACKEND_AVX2));
+    TEST_ASSERT_EQUAL_INT((features & NEOC_CPU_FEATURE_SHANI) != 0,
+                          neoc_hash_backend_supported(NEOC_HASH_BACKEND_SHANI));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sha256_batch_matches_openssl);
+    RUN_TEST(test_hash160_batch_with_mixed_lengths);
+    RUN_TEST(test_batch_arguments);
+    RUN_TEST(test_backends_follow_cpu_features);
+    UNITY_END();
+}
@@ -0,0 +1,142 @@
+/**
+ * @file test_hex.c
+ * @brief Hex codec tests across the scalar and vector block sizes
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/utils/neoc_hex.h>
+#include <neoc/serialization/binary_writer.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_LEN 200
+
+static uint8_t data[MAX_LEN];
+
+void setUp(void) {
+    neoc_init();
+    for (size_t i = 0; i < MAX_LEN; i++) {
+        data[i] = (uint8_t)(i * 37 + 11);
+    }
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+static void reference_encode(const uint8_t *bytes, size_t len, char *out, bool uppercase) {
+    for (size_t i = 0; i < len; i++) {
+        snprintf(out + 2 * i, 3, uppercase ? "%02X" : "%02x", bytes[i]);
+    }
+    out[2 * len] = '\0';
+}
+
+/* Every length from 0 to MAX_LEN exercises the 32-, 16-byte and scalar paths */
+void test_encode_decode_all_lengths(void) {
+    char expected[2 * MAX_LEN + 3];
+    char hex[2 * MAX_LEN + 3];
+    uint8_t decoded[MAX_LEN];
+
+    for (size_t len = 0; len <= MAX_LEN; len++) {
+        for (int upper = 0; upper <= 1; upper++) {
+            reference_encode(data, len, expected, upper);
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_encode(data, len, hex, sizeof(hex), upper, false));
+            TEST_ASSERT_EQUAL_STRING(expected, hex);
+
+            size_t decoded_len = 0;
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_decode(hex, decoded, sizeof(decoded), &decoded_len));
+            TEST_ASSERT_EQUAL_UINT(len, decoded_len);
+            if (len > 0) {
+                TEST_ASSERT_EQUAL_MEMORY(data, decoded, len);
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_encode(data, 2, hex, sizeof(hex), false, true));
+    TEST_ASSERT_EQUAL_STRING("0x0b30", hex);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL, neoc_hex_encode(data, 2, hex, 6, false, true));
+}
+
+/* A bad character anywhere in a long string must be caught by whichever path covers it */
+void test_decode_rejects_invalid_characters(void) {
+    char hex[2 * MAX_LEN + 1];
+    uint8_t decoded[MAX_LEN];
+    const char bad[] = { 'g', 'G', '/', ':', '@', '`', ' ', (char)0xB0 };
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_encode(data, MAX_LEN, hex, sizeof(hex), false, false));
+    for (size_t pos = 0; pos < 2 * MAX_LEN; pos += 7) {
+        char saved = hex[pos];
+        hex[pos] = bad[pos % sizeof(bad)];
+        TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_hex_decode(hex, decoded, sizeof(decoded), NULL));
+        hex[pos] = saved;
+    }
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_decode("0XaBcD", decoded, sizeof(decoded), NULL));
+    TEST_ASSERT_EQUAL_HEX8(0xAB, decoded[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xCD, decoded[1]);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_hex_decode("abc", decoded, sizeof(decoded), NULL));
+}
+
+void test_in_place_round_trip(void) {
+    char expected[2 * MAX_LEN + 1];
+    for (size_t len = 0; len <= MAX_LEN; len += 13) {
+        char buffer[2 * MAX_LEN + 3];
+        memcpy(buffer, data, len);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_encode_in_place((uint8_t *)buffer, len, 2 * len + 1, false));
+        reference_encode(data, len, expected, false);
+        TEST_ASSERT_EQUAL_STRING(expected, buffer);
+
+        size_t decoded_len = 0;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_decode_in_place(buffer, &decoded_len));
+        TEST_ASSERT_EQUAL_UINT(len, decoded_len);
+        if (len > 0) {
+            TEST_ASSERT_EQUAL_MEMORY(data, buffer, len);
+        }
+    }
+
+    char prefixed[] = "0x00ff10";
+    size_t decoded_len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_decode_in_place(prefixed, &decoded_len));
+    TEST_ASSERT_EQUAL_UINT(3, decoded_len);
+    TEST_ASSERT_EQUAL_MEMORY("\x00\xff\x10", prefixed, 3);
+
+    uint8_t small[4] = { 1, 2 };
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL, neoc_hex_encode_in_place(small, 2, sizeof(small), false));
+}
+
+void test_writer_variants(void) {
+    neoc_binary_writer_t *writer = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_writer_create(256, true, &writer));
+
+    /* Longer than one internal chunk */
+    char expected[2 * MAX_LEN + 1];
+    reference_encode(data, MAX_LEN, expected, true);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_encode_to_writer(writer, data, MAX_LEN, true));
+    }
+    TEST_ASSERT_EQUAL_UINT(6 * MAX_LEN, writer->position);
+    TEST_ASSERT_EQUAL_MEMORY(expected, writer->data + 4 * MAX_LEN, 2 * MAX_LEN);
+
+    /* Decoding reads only hex_length characters, so no terminator is needed */
+    neoc_binary_writer_reset(writer);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_decode_to_writer(writer, expected, 2 * MAX_LEN));
+    TEST_ASSERT_EQUAL_UINT(MAX_LEN, writer->position);
+    TEST_ASSERT_EQUAL_MEMORY(data, writer->data, MAX_LEN);
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hex_decode_to_writer(writer, "0x0102zz", 6));
+    TEST_ASSERT_EQUAL_UINT(MAX_LEN + 2, writer->position);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_hex_decode_to_writer(writer, "01zz", 4));
+    TEST_ASSERT_EQUAL_UINT(MAX_LEN + 2, writer->position);
+
+    neoc_binary_writer_free(writer);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_encode_decode_all_lengths);
+    RUN_TEST(test_decode_rejects_invalid_characters);
+    RUN_TEST(test_in_place_round_trip);
+    RUN_TEST(test_writer_variants);
+    UNITY_END();
+}
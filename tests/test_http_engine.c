@@ -0,0 +1,282 @@
+/**
+ * @file test_http_engine.c
+ * @brief Asynchronous HTTP engine and async service calls against a loopback stub
+ */
+
+#define _GNU_SOURCE
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/protocol/service.h>
+#include <neoc/protocol/core/request.h>
+#include <neoc/protocol/core/response.h>
+#include <neoc/utils/http_engine.h>
+#include <cjson/cJSON.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "stub_http_server.h"
+
+#define CONCURRENT_CALLS 200
+
+static stub_http_server_t stub;
+static char stub_hang_url[80];
+
+/*
+ * Answers each POST with {"result": <request id>}. Requests to /hang are
+ * never answered; the connection is held until the client drops it.
+ */
+static char *stub_answer(const char *path, const char *body, void *user_data) {
+    (void)user_data;
+    if (strcmp(path, "/hang") == 0) {
+        return NULL;
+    }
+
+    cJSON *request = cJSON_Parse(body);
+    cJSON *id = request ? cJSON_GetObjectItem(request, "id") : NULL;
+    int request_id = cJSON_IsNumber(id) ? id->valueint : 0;
+    cJSON_Delete(request);
+
+    char *answer = malloc(128);
+    if (answer) {
+        snprintf(answer, 128, "{\"jsonrpc\":\"2.0\",\"id\":%d,\"result\":%d}", request_id, request_id);
+    }
+    return answer;
+}
+
+/* Waits up to five seconds for counter to reach target */
+static bool wait_for_count(atomic_int *counter, int target) {
+    for (int i = 0; i < 500 && atomic_load(counter) < target; i++) {
+        usleep(10000);
+    }
+    return atomic_load(counter) >= target;
+}
+
+static int post_call(neoc_http_engine_t *engine, const char *url, int id, long timeout_ms,
+                     neoc_http_engine_callback_t callback, void *user_data,
+                     neoc_http_call_id_t *call_id) {
+    char body[96];
+    int len = snprintf(body, sizeof(body),
+                       "{\"jsonrpc\":\"2.0\",\"method\":\"getblockcount\",\"params\":[],\"id\":%d}", id);
+    return neoc_http_engine_post(engine, url, (const uint8_t *)body, (size_t)len,
+                                 timeout_ms, callback, user_data, call_id);
+}
+
+static bool body_has_result(const neoc_byte_array_t *body, int id) {
+    char expected[32];
+    snprintf(expected, sizeof(expected), "\"result\":%d}", id);
+    return body && body->data &&
+           memmem(body->data, body->length, expected, strlen(expected)) != NULL;
+}
+
+void setUp(void) {
+    neoc_init();
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+/* ===== ENGINE TESTS ===== */
+
+static atomic_int callbacks_done;
+static atomic_int callbacks_matched;
+
+static void count_callback(neoc_http_completion_t *completion) {
+    int id = (int)(intptr_t)completion->user_data;
+    if (completion->error == NEOC_SUCCESS && completion->status_code == 200 &&
+        body_has_result(completion->body, id)) {
+        atomic_fetch_add(&callbacks_matched, 1);
+    }
+    neoc_byte_array_free(completion->body);
+    atomic_fetch_add(&callbacks_done, 1);
+}
+
+void test_http_engine_concurrent_callbacks(void) {
+    neoc_http_engine_t *engine = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_http_engine_create(NULL, &engine));
+
+    atomic_store(&callbacks_done, 0);
+    atomic_store(&callbacks_matched, 0);
+    for (int i = 1; i <= CONCURRENT_CALLS; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              post_call(engine, stub.url, i, 0, count_callback, (void *)(intptr_t)i, NULL));
+    }
+
+    TEST_ASSERT_TRUE(wait_for_count(&callbacks_done, CONCURRENT_CALLS));
+    TEST_ASSERT_EQUAL_INT(CONCURRENT_CALLS, atomic_load(&callbacks_matched));
+    TEST_ASSERT_EQUAL_INT(0, (int)neoc_http_engine_in_flight(engine));
+
+    neoc_http_engine_free(engine);
+}
+
+void test_http_engine_completion_queue(void) {
+    neoc_http_engine_t *engine = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_http_engine_create(NULL, &engine));
+
+    neoc_http_call_id_t ids[20];
+    for (int i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              post_call(engine, stub.url, 100 + i, 0, NULL, (void *)(intptr_t)(100 + i), &ids[i]));
+        TEST_ASSERT_TRUE(ids[i] != 0);
+        if (i > 0) {
+            TEST_ASSERT_TRUE(ids[i] != ids[i - 1]);
+        }
+    }
+
+    for (int i = 0; i < 20; i++) {
+        neoc_http_completion_t completion;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_http_engine_next_completion(engine, 5000, &completion));
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, completion.error);
+        TEST_ASSERT_TRUE(body_has_result(completion.body, (int)(intptr_t)completion.user_data));
+        neoc_byte_array_free(completion.body);
+    }
+
+    neoc_http_completion_t completion;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_TIMEOUT, neoc_http_engine_next_completion(engine, 0, &completion));
+
+    neoc_http_engine_free(engine);
+}
+
+static atomic_int cancelled_on_free;
+
+static void free_callback(neoc_http_completion_t *completion) {
+    if (completion->error == NEOC_ERROR_CANCELLED && completion->body == NULL) {
+        atomic_fetch_add(&cancelled_on_free, 1);
+    }
+}
+
+void test_http_engine_cancel_and_deadline(void) {
+    neoc_http_engine_t *engine = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_http_engine_create(NULL, &engine));
+    neoc_http_completion_t completion;
+
+    /* A call past its deadline completes with a timeout */
+    neoc_http_call_id_t deadline_id = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, post_call(engine, stub_hang_url, 1, 100, NULL, NULL, &deadline_id));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_http_engine_next_completion(engine, 5000, &completion));
+    TEST_ASSERT_TRUE(completion.call_id == deadline_id);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_TIMEOUT, completion.error);
+    TEST_ASSERT_NULL(completion.body);
+
+    /* Cancelling a pending call completes it as cancelled, once */
+    neoc_http_call_id_t cancel_id = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, post_call(engine, stub_hang_url, 2, 0, NULL, NULL, &cancel_id));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_http_engine_cancel(engine, cancel_id));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_http_engine_next_completion(engine, 5000, &completion));
+    TEST_ASSERT_TRUE(completion.call_id == cancel_id);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_CANCELLED, completion.error);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_NOT_FOUND, neoc_http_engine_cancel(engine, cancel_id));
+
+    /* Freeing the engine cancels whatever is still in flight */
+    atomic_store(&cancelled_on_free, 0);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, post_call(engine, stub_hang_url, 3 + i, 0, free_callback, NULL, NULL));
+    }
+    TEST_ASSERT_EQUAL_INT(3, (int)neoc_http_engine_in_flight(engine));
+    neoc_http_engine_free(engine);
+    TEST_ASSERT_EQUAL_INT(3, atomic_load(&cancelled_on_free));
+}
+
+/* ===== SERVICE TESTS ===== */
+
+static atomic_int responses_done;
+static atomic_int responses_matched;
+
+static void response_callback(neoc_response_t *response, neoc_error_t err, void *user_data) {
+    int id = (int)(intptr_t)user_data;
+    if (err == NEOC_SUCCESS && response && response->id == id && response->result) {
+        char expected[16];
+        snprintf(expected, sizeof(expected), "%d", id);
+        if (strcmp(response->result, expected) == 0) {
+            atomic_fetch_add(&responses_matched, 1);
+        }
+    }
+    neoc_response_free(response);
+    atomic_fetch_add(&responses_done, 1);
+}
+
+static atomic_int service_cancelled;
+
+static void cancelled_callback(neoc_response_t *response, neoc_error_t err, void *user_data) {
+    (void)user_data;
+    if (err == NEOC_ERROR_CANCELLED && response == NULL) {
+        atomic_fetch_add(&service_cancelled, 1);
+    }
+}
+
+static neoc_service_t *create_service(const char *url) {
+    neoc_service_config_t *config = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_config_create_default(url, &config));
+    neoc_service_t *service = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_create(NEOC_SERVICE_TYPE_HTTP, config, &service));
+    neoc_service_config_free(config);
+    return service;
+}
+
+void test_service_send_request_async(void) {
+    neoc_service_t *service = create_service(stub.url);
+    TEST_ASSERT_NULL(service->async_engine);
+
+    atomic_store(&responses_done, 0);
+    atomic_store(&responses_matched, 0);
+    for (int i = 0; i < 50; i++) {
+        neoc_request_t *request = neoc_request_create("getblockcount", "[]", service);
+        TEST_ASSERT_NOT_NULL(request);
+        /* The request is only needed until the call has been started */
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              neoc_service_send_request_async(service, request, response_callback,
+                                                              (void *)(intptr_t)request->id, NULL));
+        neoc_request_free(request);
+    }
+
+    TEST_ASSERT_TRUE(wait_for_count(&responses_done, 50));
+    TEST_ASSERT_EQUAL_INT(50, atomic_load(&responses_matched));
+    TEST_ASSERT_NOT_NULL(service->async_engine);
+
+    neoc_service_free(service);
+}
+
+void test_service_async_cancel(void) {
+    neoc_service_t *service = create_service(stub_hang_url);
+    atomic_store(&service_cancelled, 0);
+
+    neoc_request_t *request = neoc_request_create("getblockcount", "[]", service);
+    neoc_http_call_id_t call_id = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_service_send_request_async(service, request, cancelled_callback, NULL, &call_id));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_cancel_async(service, call_id));
+    TEST_ASSERT_TRUE(wait_for_count(&service_cancelled, 1));
+
+    /* Calls still pending when the service is freed are cancelled too */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_service_send_request_async(service, request, cancelled_callback, NULL, NULL));
+    neoc_request_free(request);
+    neoc_service_free(service);
+    TEST_ASSERT_EQUAL_INT(2, atomic_load(&service_cancelled));
+}
+
+/* ===== MAIN TEST RUNNER ===== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    if (stub_http_server_start(&stub, stub_answer, NULL) != 0) {
+        printf("Failed to start stub server\n");
+        return 1;
+    }
+    snprintf(stub_hang_url, sizeof(stub_hang_url), "%shang", stub.url);
+
+    printf("\n=== HTTP ENGINE TESTS ===\n");
+    RUN_TEST(test_http_engine_concurrent_callbacks);
+    RUN_TEST(test_http_engine_completion_queue);
+    RUN_TEST(test_http_engine_cancel_and_deadline);
+
+    printf("\n=== ASYNC SERVICE TESTS ===\n");
+    RUN_TEST(test_service_send_request_async);
+    RUN_TEST(test_service_async_cancel);
+
+    stub_http_server_stop(&stub);
+    UNITY_END();
+}
@@ -0,0 +1,408 @@
+/**
+ * @file test_json_stream.c
+ * @brief Streaming JSON parser, element splitter and incremental block decoder
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/utils/json.h>
+#include <neoc/protocol/core/response/neo_block.h>
+#include <neoc/protocol/core/response/neo_application_log.h>
+#include <cjson/cJSON.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    char text[1024];
+    size_t length;
+    size_t fail_after;      /* Fail on this event (1-based); 0 never fails */
+    size_t events;
+} event_log_t;
+
+static neoc_error_t log_event(const neoc_json_event_t *event, void *user_data) {
+    static const char *names[] = { "{", "}", "[", "]", "K:", "S:", "N:", "T", "F", "Z" };
+    event_log_t *log = user_data;
+
+    if (++log->events == log->fail_after) {
+        return NEOC_ERROR_INVALID_STATE;
+    }
+    log->length += (size_t)snprintf(log->text + log->length, sizeof(log->text) - log->length,
+                                    "%s%zu%s%s", log->length ? " " : "", event->depth,
+                                    names[event->type], event->text ? event->text : "");
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t ignore_event(const neoc_json_event_t *event, void *user_data) {
+    (void)event;
+    (void)user_data;
+    return NEOC_SUCCESS;
+}
+
+/* Feeds the document in chunks of chunk_size bytes */
+static neoc_error_t feed_in_chunks(neoc_json_stream_t *stream, const char *json, size_t chunk_size) {
+    size_t length = strlen(json);
+    for (size_t offset = 0; offset < length; offset += chunk_size) {
+        size_t n = length - offset < chunk_size ? length - offset : chunk_size;
+        neoc_error_t err = neoc_json_stream_feed(stream, json + offset, n);
+        if (err != NEOC_SUCCESS) {
+            return err;
+        }
+    }
+    return neoc_json_stream_finish(stream);
+}
+
+static neoc_error_t parse_logged(const char *json, size_t chunk_size, event_log_t *log) {
+    neoc_json_stream_t *stream = NULL;
+    memset(log, 0, sizeof(*log));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_stream_create(log_event, log, &stream));
+    neoc_error_t err = feed_in_chunks(stream, json, chunk_size);
+    neoc_json_stream_free(stream);
+    return err;
+}
+
+void setUp(void) {
+    neoc_init();
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+void test_stream_events_independent_of_chunking(void) {
+    const char *json =
+        "{\"a\" : [1, -2.5e3, true, false, null],\n"
+        " \"s\":\"x\\\"\\u00e9\\ud83d\\ude00\\/\", \"e\":{}, \"\":[]}";
+    const char *expected =
+        "0{ 1K:a 1[ 2N:1 2N:-2.5e3 2T 2F 2Z 1] "
+        "1K:s 1S:x\"\xc3\xa9\xf0\x9f\x98\x80/ 1K:e 1{ 1} 1K: 1[ 1] 0}";
+
+    event_log_t whole, split;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, parse_logged(json, strlen(json), &whole));
+    TEST_ASSERT_EQUAL_STRING(expected, whole.text);
+
+    /* Every token boundary, escape and surrogate pair gets cut somewhere */
+    for (size_t chunk = 1; chunk <= 7; chunk++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, parse_logged(json, chunk, &split));
+        TEST_ASSERT_EQUAL_STRING(expected, split.text);
+    }
+
+    /* A root-level number is only complete at the end of input */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, parse_logged(" 42 ", 1, &split));
+    TEST_ASSERT_EQUAL_STRING("0N:42", split.text);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, parse_logged("42", 1, &split));
+    TEST_ASSERT_EQUAL_STRING("0N:42", split.text);
+}
+
+void test_stream_rejects_malformed_input(void) {
+    static const char *bad[] = {
+        "", "{\"a\" 1}", "[1,]", "[01]", "[1.]", "[-]", "\"abc", "tru", "trux",
+        "{\"a\":1}}", "[1] 2", "{]", "[\"\\ud800x\"]", "[\"\\udc00\"]",
+        "[\"\\q\"]", "[\"a\nb\"]", "{1:2}", "[1 2]", "{\"a\":}"
+    };
+
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        event_log_t log;
+        TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, parse_logged(bad[i], 1, &log));
+        TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, parse_logged(bad[i], strlen(bad[i]) + 1, &log));
+    }
+}
+
+void test_stream_nesting_limit(void) {
+    size_t depth = NEOC_JSON_STREAM_MAX_DEPTH + 1;
+    char *json = malloc(depth + 1);
+    TEST_ASSERT_NOT_NULL(json);
+    memset(json, '[', depth);
+    json[depth] = '\0';
+
+    neoc_json_stream_t *stream = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_stream_create(ignore_event, NULL, &stream));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_stream_feed(stream, json, depth - 1));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_json_stream_feed(stream, json, 1));
+    neoc_json_stream_free(stream);
+    free(json);
+}
+
+void test_stream_handler_error_stops_parse(void) {
+    neoc_json_stream_t *stream = NULL;
+    event_log_t log;
+    memset(&log, 0, sizeof(log));
+    log.fail_after = 3;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_stream_create(log_event, &log, &stream));
+
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_json_stream_feed(stream, "[1,2,3", 6));
+    TEST_ASSERT_EQUAL_STRING("0[ 1N:1", log.text);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_json_stream_feed(stream, "]", 1));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_json_stream_finish(stream));
+    TEST_ASSERT_EQUAL_UINT(3, log.events);
+    neoc_json_stream_free(stream);
+}
+
+typedef struct {
+    char text[512];
+    size_t count;
+} element_log_t;
+
+static neoc_error_t log_element(size_t path_index, const neoc_json_t *element, void *user_data) {
+    element_log_t *log = user_data;
+    char *printed = cJSON_PrintUnformatted(element);
+    size_t length = strlen(log->text);
+    snprintf(log->text + length, sizeof(log->text) - length, "%s%zu=%s",
+             log->count++ ? " " : "", path_index, printed);
+    free(printed);
+    return NEOC_SUCCESS;
+}
+
+void test_splitter_hands_out_elements(void) {
+    const char *json =
+        "{\"id\":1,\"result\":{\"tx\":[{\"n\":1,\"a\":[true]},{\"n\":2},3],"
+        "\"other\":[{\"n\":9}],\"logs\":[[1],\"x\"]},\"tx\":[{\"n\":0}]}";
+    const char *paths[] = { "result.logs", "result.tx" };
+
+    for (size_t chunk = 1; chunk <= 5; chunk += 4) {
+        element_log_t log;
+        memset(&log, 0, sizeof(log));
+        neoc_json_splitter_t *splitter = NULL;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_splitter_create(paths, 2, log_element, &log, &splitter));
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, feed_in_chunks(neoc_json_splitter_stream(splitter), json, chunk));
+
+        TEST_ASSERT_EQUAL_STRING("1={\"n\":1,\"a\":[true]} 1={\"n\":2} 1=3 0=[1] 0=\"x\"", log.text);
+
+        const neoc_json_t *skeleton = NULL;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_splitter_finish(splitter, &skeleton));
+        char *printed = cJSON_PrintUnformatted(skeleton);
+        TEST_ASSERT_EQUAL_STRING(
+            "{\"id\":1,\"result\":{\"tx\":[],\"other\":[{\"n\":9}],\"logs\":[]},\"tx\":[{\"n\":0}]}", printed);
+        free(printed);
+        neoc_json_splitter_free(splitter);
+    }
+}
+
+void test_splitter_free_mid_element(void) {
+    const char *path = "tx";
+    element_log_t log;
+    memset(&log, 0, sizeof(log));
+    neoc_json_splitter_t *splitter = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_splitter_create(&path, 1, log_element, &log, &splitter));
+
+    const char *partial = "{\"tx\":[{\"n\":1},{\"deep\":{\"n\":[2";
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_json_stream_feed(neoc_json_splitter_stream(splitter), partial, strlen(partial)));
+    TEST_ASSERT_EQUAL_UINT(1, log.count);
+
+    const neoc_json_t *skeleton = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_json_splitter_finish(splitter, &skeleton));
+    neoc_json_splitter_free(splitter);
+}
+
+/* A getblock response with tx_count transactions */
+static char *build_getblock_response(int tx_count) {
+    static const char *header =
+        "{\"jsonrpc\":\"2.0\",\"id\":7,\"result\":{"
+        "\"hash\":\"0x1d5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f00\","
+        "\"size\":1024,\"version\":0,"
+        "\"previousblockhash\":\"0x2a5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f01\","
+        "\"merkleroot\":\"0x3b5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f02\","
+        "\"time\":1700000000000,\"nonce\":\"12345\",\"index\":4000000,"
+        "\"primary\":3,\"confirmations\":12,\"tx\":[";
+    static const char *tx_format =
+        "%s{\"hash\":\"0x%064x\",\"size\":252,\"version\":0,\"nonce\":%d,"
+        "\"sysfee\":\"997775\",\"netfee\":\"1234520\",\"validuntilblock\":4005760,"
+        "\"signers\":[],\"attributes\":[],\"script\":\"EQ==\",\"witnesses\":[]}";
+
+    size_t capacity = strlen(header) + (size_t)tx_count * 512 + 8;
+    char *json = malloc(capacity);
+    TEST_ASSERT_NOT_NULL(json);
+    size_t len = (size_t)snprintf(json, capacity, "%s", header);
+    for (int i = 0; i < tx_count; i++) {
+        len += (size_t)snprintf(json + len, capacity - len, tx_format,
+                                i == 0 ? "" : ",", (unsigned int)i, 1000 + i);
+    }
+    snprintf(json + len, capacity - len, "]}}");
+    return json;
+}
+
+void test_block_decoder_matches_dom_parser(void) {
+    char *response = build_getblock_response(40);
+    cJSON *root = cJSON_Parse(response);
+    char *result_text = cJSON_PrintUnformatted(cJSON_GetObjectItem(root, "result"));
+    neoc_neo_block_t *expected = neoc_neo_block_from_json(result_text);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_EQUAL_UINT(40, expected->transaction_count);
+
+    neoc_neo_block_decoder_t *decoder = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_decoder_create(true, &decoder));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, feed_in_chunks(neoc_neo_block_decoder_stream(decoder), response, 13));
+    neoc_neo_block_t *block = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_decoder_finish(decoder, &block));
+    neoc_neo_block_decoder_free(decoder);
+
+    TEST_ASSERT_EQUAL_MEMORY(&expected->hash, &block->hash, sizeof(block->hash));
+    TEST_ASSERT_EQUAL_MEMORY(&expected->header.prev_hash, &block->header.prev_hash,
+                             sizeof(block->header.prev_hash));
+    TEST_ASSERT_EQUAL_UINT32(4000000, block->header.index);
+    TEST_ASSERT_EQUAL_UINT32(expected->header.index, block->header.index);
+    TEST_ASSERT_EQUAL_UINT64(expected->header.timestamp, block->header.timestamp);
+    TEST_ASSERT_EQUAL_UINT64(12345, block->header.nonce);
+    TEST_ASSERT_EQUAL_UINT8(3, block->header.primary_index);
+    TEST_ASSERT_EQUAL_UINT32(12, block->confirmations);
+    TEST_ASSERT_EQUAL_UINT(expected->transaction_count, block->transaction_count);
+    for (size_t i = 0; i < block->transaction_count; i++) {
+        TEST_ASSERT_EQUAL_UINT32(1000 + i, block->transactions[i]->nonce);
+        TEST_ASSERT_EQUAL_UINT32(expected->transactions[i]->nonce, block->transactions[i]->nonce);
+    }
+
+    neoc_neo_block_free(block);
+    neoc_neo_block_free(expected);
+    free(result_text);
+    cJSON_Delete(root);
+    free(response);
+}
+
+void test_block_decoder_errors(void) {
+    const char *rpc_error =
+        "{\"jsonrpc\":\"2.0\",\"id\":1,\"error\":{\"code\":-100,\"message\":\"Unknown block\"}}";
+    neoc_neo_block_decoder_t *decoder = NULL;
+    neoc_neo_block_t *block = NULL;
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_decoder_create(true, &decoder));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, feed_in_chunks(neoc_neo_block_decoder_stream(decoder), rpc_error, 5));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_RPC, neoc_neo_block_decoder_finish(decoder, &block));
+    TEST_ASSERT_NULL(block);
+    neoc_neo_block_decoder_free(decoder);
+
+    /* Truncated transfer */
+    char *response = build_getblock_response(3);
+    response[strlen(response) / 2] = '\0';
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_decoder_create(true, &decoder));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT,
+                          feed_in_chunks(neoc_neo_block_decoder_stream(decoder), response, 64));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_neo_block_decoder_finish(decoder, &block));
+    TEST_ASSERT_NULL(block);
+    neoc_neo_block_decoder_free(decoder);
+    free(response);
+
+    /* Bare block without the envelope */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_decoder_create(false, &decoder));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          feed_in_chunks(neoc_neo_block_decoder_stream(decoder), "{\"index\":5,\"tx\":[]}", 3));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_decoder_finish(decoder, &block));
+    TEST_ASSERT_EQUAL_UINT32(5, block->header.index);
+    TEST_ASSERT_EQUAL_UINT(0, block->transaction_count);
+    neoc_neo_block_free(block);
+    neoc_neo_block_decoder_free(decoder);
+}
+
+/* A getapplicationlog response with execution_count executions */
+static char *build_application_log_response(int execution_count) {
+    static const char *header =
+        "{\"jsonrpc\":\"2.0\",\"id\":4,\"result\":{"
+        "\"txid\":\"0x4b5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f03\","
+        "\"executions\":[";
+    static const char *execution_format =
+        "%s{\"trigger\":\"Application\",\"vmstate\":\"%s\",\"exception\":%s,"
+        "\"gasconsumed\":\"%d\",\"stack\":[{\"type\":\"Integer\",\"value\":\"%d\"},"
+        "{\"type\":\"Array\",\"value\":[{\"type\":\"ByteString\",\"value\":\"aGVsbG8=\"},"
+        "{\"type\":\"Boolean\",\"value\":true}]}],"
+        "\"notifications\":[{\"contract\":\"0xd2a4cff31913016155e38e474a2c06d08be276cf\","
+        "\"eventname\":\"Transfer\",\"state\":{\"type\":\"Array\",\"value\":["
+        "{\"type\":\"Any\"},{\"type\":\"Integer\",\"value\":\"%d\"}]}}]}";
+
+    size_t capacity = strlen(header) + (size_t)execution_count * 768 + 8;
+    char *json = malloc(capacity);
+    TEST_ASSERT_NOT_NULL(json);
+    size_t len = (size_t)snprintf(json, capacity, "%s", header);
+    for (int i = 0; i < execution_count; i++) {
+        bool fault = i % 3 == 2;
+        len += (size_t)snprintf(json + len, capacity - len, execution_format,
+                                i == 0 ? "" : ",", fault ? "FAULT" : "HALT",
+                                fault ? "\"ABORT is executed\"" : "null",
+                                9977780 + i, i, 100 * i);
+    }
+    snprintf(json + len, capacity - len, "]}}");
+    return json;
+}
+
+void test_application_log_decoder_matches_dom_parser(void) {
+    char *response = build_application_log_response(12);
+    neoc_get_application_log_response_t *expected = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_get_application_log_response_from_json(response, &expected));
+    TEST_ASSERT_NOT_NULL(expected->result);
+    TEST_ASSERT_EQUAL_UINT(12, expected->result->executions_count);
+
+    neoc_application_log_decoder_t *decoder = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_application_log_decoder_create(&decoder));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          feed_in_chunks(neoc_application_log_decoder_stream(decoder), response, 7));
+    neoc_get_application_log_response_t *streamed = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_application_log_decoder_finish(decoder, &streamed));
+    neoc_application_log_decoder_free(decoder);
+
+    TEST_ASSERT_EQUAL_INT(expected->id, streamed->id);
+    TEST_ASSERT_EQUAL_STRING(expected->jsonrpc, streamed->jsonrpc);
+    const neoc_application_log_t *a = expected->result;
+    const neoc_application_log_t *b = streamed->result;
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL_MEMORY(a->transaction_id, b->transaction_id, sizeof(neoc_hash256_t));
+    TEST_ASSERT_EQUAL_UINT(a->executions_count, b->executions_count);
+    for (size_t i = 0; i < b->executions_count; i++) {
+        const neoc_application_execution_t *x = a->executions[i];
+        const neoc_application_execution_t *y = b->executions[i];
+        TEST_ASSERT_EQUAL_STRING(x->trigger, y->trigger);
+        TEST_ASSERT_EQUAL_INT(x->state, y->state);
+        TEST_ASSERT_EQUAL_STRING(x->gas_consumed, y->gas_consumed);
+        if (x->exception || y->exception) {
+            TEST_ASSERT_EQUAL_STRING(x->exception, y->exception);
+        }
+        TEST_ASSERT_EQUAL_UINT(2, y->stack_count);
+        TEST_ASSERT_EQUAL_UINT(x->stack_count, y->stack_count);
+        for (size_t j = 0; j < y->stack_count; j++) {
+            TEST_ASSERT_TRUE(neoc_stack_item_equals(x->stack[j], y->stack[j]));
+        }
+        TEST_ASSERT_EQUAL_UINT(1, y->notifications_count);
+        TEST_ASSERT_EQUAL_UINT(x->notifications_count, y->notifications_count);
+        TEST_ASSERT_EQUAL_STRING("Transfer", y->notifications[0]->event_name);
+        TEST_ASSERT_TRUE(neoc_notification_equals(x->notifications[0], y->notifications[0]));
+    }
+    TEST_ASSERT_NOT_NULL(b->executions[2]->exception);
+
+    /* Serializing the decoded log gives back the same stack items */
+    char *round_trip = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_get_application_log_response_to_json(streamed, &round_trip));
+    cJSON *original_json = cJSON_Parse(response);
+    cJSON *round_trip_json = cJSON_Parse(round_trip);
+    TEST_ASSERT_NOT_NULL(round_trip_json);
+    const cJSON *original_exec = cJSON_GetArrayItem(
+        cJSON_GetObjectItem(cJSON_GetObjectItem(original_json, "result"), "executions"), 4);
+    const cJSON *round_trip_exec = cJSON_GetArrayItem(
+        cJSON_GetObjectItem(cJSON_GetObjectItem(round_trip_json, "result"), "executions"), 4);
+    TEST_ASSERT_TRUE(cJSON_Compare(cJSON_GetObjectItem(original_exec, "stack"),
+                                   cJSON_GetObjectItem(round_trip_exec, "stack"), true));
+    const cJSON *original_note = cJSON_GetArrayItem(cJSON_GetObjectItem(original_exec, "notifications"), 0);
+    const cJSON *round_trip_note = cJSON_GetArrayItem(cJSON_GetObjectItem(round_trip_exec, "notifications"), 0);
+    TEST_ASSERT_TRUE(cJSON_Compare(cJSON_GetObjectItem(original_note, "state"),
+                                   cJSON_GetObjectItem(round_trip_note, "state"), true));
+    cJSON_Delete(round_trip_json);
+    cJSON_Delete(original_json);
+    cJSON_free(round_trip);
+
+    neoc_get_application_log_response_free(streamed);
+    neoc_get_application_log_response_free(expected);
+    free(response);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_stream_events_independent_of_chunking);
+    RUN_TEST(test_stream_rejects_malformed_input);
+    RUN_TEST(test_stream_nesting_limit);
+    RUN_TEST(test_stream_handler_error_stops_parse);
+    RUN_TEST(test_splitter_hands_out_elements);
+    RUN_TEST(test_splitter_free_mid_element);
+    RUN_TEST(test_block_decoder_matches_dom_parser);
+    RUN_TEST(test_block_decoder_errors);
+    RUN_TEST(test_application_log_decoder_matches_dom_parser);
+
+    UNITY_END();
+}
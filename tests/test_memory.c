@@ -8,6 +8,7 @@
 #include <string.h>
 #include <assert.h>
 #include <time.h>
+#include <pthread.h>
 #include "unity.h"
 #include "neoc/neoc.h"
 
@@ -315,6 +316,122 @@ void test_memory_fragmentation(void) {
     }
 }
 
+/**
+ * Test arena allocation and reset
+ */
+void test_arena_allocation(void) {
+    neoc_arena_t* arena = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_arena_create(128, &arena));
+    TEST_ASSERT_NOT_NULL(arena);
+    
+    /* Allocations larger than the first chunk must still succeed */
+    uint8_t* small = neoc_arena_alloc(arena, 24);
+    uint8_t* large = neoc_arena_alloc(arena, 4096);
+    char* copy = neoc_arena_strdup(arena, "arena string");
+    TEST_ASSERT_NOT_NULL(small);
+    TEST_ASSERT_NOT_NULL(large);
+    TEST_ASSERT_NOT_NULL(copy);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)small % sizeof(void*));
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)large % sizeof(void*));
+    TEST_ASSERT_EQUAL_STRING("arena string", copy);
+    memset(large, 0x5A, 4096);
+    TEST_ASSERT_TRUE(neoc_arena_bytes_used(arena) >= 4096 + 24);
+    
+    neoc_arena_reset(arena);
+    TEST_ASSERT_EQUAL_INT(0, neoc_arena_bytes_used(arena));
+    TEST_ASSERT_NOT_NULL(neoc_arena_alloc(arena, 64));
+    
+    neoc_arena_free(arena);
+}
+
+/**
+ * Test routing neoc_malloc through an active arena
+ */
+void test_arena_active_routing(void) {
+    neoc_arena_t* arena = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_arena_create(0, &arena));
+    
+    char* heap_str = neoc_strdup("heap");
+    TEST_ASSERT_NOT_NULL(heap_str);
+    
+    neoc_arena_t* previous = neoc_arena_set_active(arena);
+    TEST_ASSERT_NULL(previous);
+    TEST_ASSERT_EQUAL_PTR(arena, neoc_arena_get_active());
+    
+    size_t used_before = neoc_arena_bytes_used(arena);
+    char* arena_str = neoc_strdup("arena");
+    TEST_ASSERT_NOT_NULL(arena_str);
+    TEST_ASSERT_TRUE(neoc_arena_bytes_used(arena) > used_before);
+    
+    uint32_t* values = neoc_calloc(4, sizeof(uint32_t));
+    TEST_ASSERT_NOT_NULL(values);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, values[i]);
+        values[i] = (uint32_t)i + 1;
+    }
+    values = neoc_realloc(values, 64 * sizeof(uint32_t));
+    TEST_ASSERT_NOT_NULL(values);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)i + 1, values[i]);
+    }
+    
+    /* Freeing arena memory is a no-op; heap memory is still released */
+    neoc_free(arena_str);
+    neoc_free(values);
+    neoc_free(heap_str);
+    
+    neoc_arena_set_active(previous);
+    TEST_ASSERT_NULL(neoc_arena_get_active());
+    neoc_arena_free(arena);
+}
+
+static void* free_on_other_thread(void* ptr) {
+    neoc_free(ptr);
+    return NULL;
+}
+
+/**
+ * Test that memory from any live arena is never handed to the heap
+ */
+void test_arena_pointers_rejected_outside_scope(void) {
+    neoc_arena_t* first = NULL;
+    neoc_arena_t* second = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_arena_create(0, &first));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_arena_create(0, &second));
+    
+    char* owned = neoc_arena_strdup(first, "first arena");
+    TEST_ASSERT_NOT_NULL(owned);
+    
+    /* No arena active: free is ignored and realloc is refused */
+    neoc_free(owned);
+    TEST_ASSERT_NULL(neoc_realloc(owned, 256));
+    TEST_ASSERT_EQUAL_STRING("first arena", owned);
+    
+    /* Another arena active: the same holds for the first arena's memory */
+    neoc_arena_t* previous = neoc_arena_set_active(second);
+    neoc_free(owned);
+    TEST_ASSERT_NULL(neoc_realloc(owned, 256));
+    char* grown = neoc_realloc(neoc_strdup("second"), 256);
+    TEST_ASSERT_NOT_NULL(grown);
+    TEST_ASSERT_EQUAL_STRING("second", grown);
+    neoc_arena_set_active(previous);
+    
+    /* Other threads cannot free it either */
+    pthread_t thread;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, free_on_other_thread, owned));
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(thread, NULL));
+    TEST_ASSERT_EQUAL_STRING("first arena", owned);
+    
+    neoc_arena_free(second);
+    neoc_arena_free(first);
+    
+    /* With no live arena, heap memory goes through the normal path */
+    char* heap_str = neoc_realloc(neoc_strdup("heap"), 64);
+    TEST_ASSERT_NOT_NULL(heap_str);
+    TEST_ASSERT_EQUAL_STRING("heap", heap_str);
+    neoc_free(heap_str);
+}
+
 #ifdef NEOC_DEBUG_MEMORY
 /**
  * Test memory leak detection (only in debug builds)
@@ -381,6 +498,9 @@ int main(void) {
     RUN_TEST(test_base64_memory_usage);
     RUN_TEST(test_hash_memory_usage);
     RUN_TEST(test_memory_fragmentation);
+    RUN_TEST(test_arena_allocation);
+    RUN_TEST(test_arena_active_routing);
+    RUN_TEST(test_arena_pointers_rejected_outside_scope);
     
 #ifdef NEOC_DEBUG_MEMORY
     printf("\n=== DEBUG MEMORY TESTS ===\n");
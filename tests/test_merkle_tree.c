@@ -0,0 +1,165 @@
+/**
+ * @file test_merkle_tree.c
+ * @brief Merkle roots and inclusion proofs
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/crypto/merkle_tree.h>
+#include <neoc/crypto/neoc_hash.h>
+#include <neoc/protocol/core/response/neo_block.h>
+#include <stdlib.h>
+#include <string.h>
+
+void setUp(void) {
+    neoc_init();
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+static void make_leaves(neoc_hash256_t *leaves, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t seed[8];
+        for (size_t b = 0; b < sizeof(seed); b++) {
+            seed[b] = (uint8_t)(i >> (8 * b));
+        }
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_sha256(seed, sizeof(seed), leaves[i].data));
+    }
+}
+
+/* Straightforward level-by-level construction to compare against */
+static neoc_hash256_t reference_root(const neoc_hash256_t *leaves, size_t count) {
+    neoc_hash256_t *level = malloc(count * sizeof(neoc_hash256_t));
+    TEST_ASSERT_NOT_NULL(level);
+    memcpy(level, leaves, count * sizeof(neoc_hash256_t));
+    while (count > 1) {
+        size_t next = (count + 1) / 2;
+        neoc_hash256_t *parents = malloc(next * sizeof(neoc_hash256_t));
+        TEST_ASSERT_NOT_NULL(parents);
+        for (size_t i = 0; i < next; i++) {
+            uint8_t pair[64];
+            memcpy(pair, level[2 * i].data, 32);
+            memcpy(pair + 32, level[2 * i + 1 < count ? 2 * i + 1 : 2 * i].data, 32);
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_sha256_double(pair, sizeof(pair), parents[i].data));
+        }
+        free(level);
+        level = parents;
+        count = next;
+    }
+    neoc_hash256_t root = level[0];
+    free(level);
+    return root;
+}
+
+void test_root_matches_reference(void) {
+    const size_t counts[] = {1, 2, 3, 4, 5, 7, 8, 63, 64, 65, 512};
+    neoc_hash256_t leaves[512];
+    make_leaves(leaves, 512);
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        neoc_hash256_t expected = reference_root(leaves, counts[c]);
+        neoc_hash256_t root;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_merkle_compute_root(leaves, counts[c], &root));
+        TEST_ASSERT_EQUAL_MEMORY(expected.data, root.data, 32);
+    }
+
+    neoc_hash256_t root;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_merkle_compute_root(NULL, 0, &root));
+    TEST_ASSERT_TRUE(neoc_hash256_is_zero(&root));
+}
+
+void test_large_tree_uses_workers(void) {
+    /* Wide enough for the first levels to be split across threads */
+    const size_t count = 20001;
+    neoc_hash256_t *leaves = malloc(count * sizeof(neoc_hash256_t));
+    TEST_ASSERT_NOT_NULL(leaves);
+    make_leaves(leaves, count);
+    neoc_hash256_t expected = reference_root(leaves, count);
+
+    neoc_hash256_t root;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_merkle_root_in_place(leaves, count, &root));
+    TEST_ASSERT_EQUAL_MEMORY(expected.data, root.data, 32);
+    free(leaves);
+}
+
+void test_proofs_verify_for_every_leaf(void) {
+    neoc_hash256_t leaves[13];
+    make_leaves(leaves, 13);
+    neoc_hash256_t expected = reference_root(leaves, 13);
+    TEST_ASSERT_EQUAL_UINT(4, neoc_merkle_proof_length(13));
+
+    for (size_t i = 0; i < 13; i++) {
+        neoc_hash256_t path[4];
+        size_t path_len = 0;
+        neoc_hash256_t root;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_merkle_get_proof(leaves, 13, i, path, 4, &path_len, &root));
+        TEST_ASSERT_EQUAL_UINT(4, path_len);
+        TEST_ASSERT_EQUAL_MEMORY(expected.data, root.data, 32);
+        TEST_ASSERT_TRUE(neoc_merkle_verify_proof(&leaves[i], i, 13, path, path_len, &root));
+
+        /* Wrong position, wrong leaf or a tampered sibling must fail */
+        TEST_ASSERT_FALSE(neoc_merkle_verify_proof(&leaves[i], (i + 1) % 13, 13, path, path_len, &root));
+        TEST_ASSERT_FALSE(neoc_merkle_verify_proof(&leaves[(i + 1) % 13], i, 13, path, path_len, &root));
+        path[path_len - 1].data[0] ^= 1;
+        TEST_ASSERT_FALSE(neoc_merkle_verify_proof(&leaves[i], i, 13, path, path_len, &root));
+    }
+
+    neoc_hash256_t short_path[3];
+    size_t path_len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL,
+                          neoc_merkle_get_proof(leaves, 13, 0, short_path, 3, &path_len, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT,
+                          neoc_merkle_get_proof(leaves, 13, 13, short_path, 3, &path_len, NULL));
+}
+
+static neoc_transaction_t *make_transaction(uint32_t nonce) {
+    neoc_transaction_t *tx = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_create(&tx));
+    neoc_transaction_set_nonce(tx, nonce);
+    neoc_transaction_set_valid_until_block(tx, 1000);
+    const uint8_t script[] = {0x11, 0x40};
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_set_script(tx, script, sizeof(script)));
+    return tx;
+}
+
+void test_block_root_and_proof(void) {
+    neoc_neo_block_t *block = neoc_neo_block_create();
+    TEST_ASSERT_NOT_NULL(block);
+    neoc_hash256_t hashes[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        neoc_transaction_t *tx = make_transaction(i + 1);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_calculate_hash(tx, &hashes[i]));
+        neoc_neo_block_add_transaction(block, tx);
+    }
+
+    neoc_hash256_t expected = reference_root(hashes, 3);
+    neoc_hash256_t root = neoc_neo_block_calculate_merkle_root(block);
+    TEST_ASSERT_EQUAL_MEMORY(expected.data, root.data, 32);
+
+    neoc_hash256_t path[2];
+    size_t path_len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_get_merkle_proof(block, 2, path, 2, &path_len));
+    TEST_ASSERT_TRUE(neoc_merkle_verify_proof(&hashes[2], 2, 3, path, path_len, &root));
+
+    /* Changing a transaction drops its cached hash, so the root follows */
+    neoc_transaction_set_nonce(block->transactions[1], 99);
+    neoc_transaction_t *changed = make_transaction(99);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_calculate_hash(changed, &hashes[1]));
+    neoc_transaction_free(changed);
+    expected = reference_root(hashes, 3);
+    root = neoc_neo_block_calculate_merkle_root(block);
+    TEST_ASSERT_EQUAL_MEMORY(expected.data, root.data, 32);
+
+    neoc_neo_block_free(block);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_root_matches_reference);
+    RUN_TEST(test_large_tree_uses_workers);
+    RUN_TEST(test_proofs_verify_for_every_leaf);
+    RUN_TEST(test_block_root_and_proof);
+    UNITY_END();
+}
@@ -62,6 +62,10 @@ void test_neo_c_send_request_uses_service_io(void) {
     TEST_ASSERT_EQUAL_INT(1, response->id);
     TEST_ASSERT_NOT_NULL(response->result);
     TEST_ASSERT_NOT_NULL(strstr((char *)response->result, "\"ok\":true"));
+    TEST_ASSERT_NOT_NULL(response->result_json);
+    const char *result_text = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_response_get_result_text(response, &result_text));
+    TEST_ASSERT_TRUE(result_text == response->result);
 
     neoc_response_free(response);
     neoc_neo_c_free(client);
@@ -199,6 +199,74 @@ void test_round_trip_encryption(void) {
     neoc_ec_key_pair_free(key_pair);
 }
 
+typedef struct {
+    size_t calls;
+    size_t last_completed;
+    size_t total;
+    bool in_order;
+} batch_progress_t;
+
+static void record_progress(size_t completed, size_t total, void *user_data) {
+    batch_progress_t *progress = (batch_progress_t *)user_data;
+    progress->calls++;
+    progress->in_order = progress->in_order && completed == progress->last_completed + 1;
+    progress->last_completed = completed;
+    progress->total = total;
+}
+
+void test_decrypt_batch(void) {
+    enum { KEY_COUNT = 12 };
+    uint8_t expected[KEY_COUNT][32];
+    char encrypted[KEY_COUNT][100];
+    const char *keys[KEY_COUNT];
+
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        for (size_t j = 0; j < 32; j++) {
+            expected[i][j] = (uint8_t)(0x11 + i * 31 + j);
+        }
+        /* Key 4 was encrypted under another password */
+        const char *password = i == 4 ? "other" : DEFAULT_ACCOUNT_PASSWORD;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_nep2_encrypt(expected[i], password, &NEOC_NEP2_LIGHT_PARAMS,
+                                                              encrypted[i], sizeof(encrypted[i])));
+        keys[i] = encrypted[i];
+    }
+    keys[7] = "6PYM7jHL4GmS8Aw2iEFpuaHTCUKjhT4mwVqdoozGU6sUE25BjV4ePXDdLx";
+    keys[9] = NULL;
+
+    const size_t thread_counts[] = { 1, 3, 0 };
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        uint8_t private_keys[KEY_COUNT * 32];
+        neoc_error_t results[KEY_COUNT];
+        batch_progress_t progress = { .in_order = true };
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              neoc_nep2_decrypt_batch(keys, DEFAULT_ACCOUNT_PASSWORD, &NEOC_NEP2_LIGHT_PARAMS,
+                                                      KEY_COUNT, thread_counts[t], private_keys, results,
+                                                      record_progress, &progress));
+        TEST_ASSERT_EQUAL_UINT(KEY_COUNT, progress.calls);
+        TEST_ASSERT_EQUAL_UINT(KEY_COUNT, progress.total);
+        TEST_ASSERT_TRUE(progress.in_order);
+
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            if (i == 4) {
+                TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_PASSWORD, results[i]);
+            } else if (i == 7) {
+                TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, results[i]);
+            } else if (i == 9) {
+                TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, results[i]);
+            } else {
+                TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, results[i]);
+                TEST_ASSERT_EQUAL_MEMORY(expected[i], private_keys + 32 * i, 32);
+            }
+        }
+    }
+
+    uint8_t private_key[32];
+    neoc_error_t result;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_nep2_decrypt_batch(NULL, NULL, NULL, 0, 0, NULL, NULL, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT,
+                          neoc_nep2_decrypt_batch(keys, NULL, NULL, 1, 0, private_key, &result, NULL, NULL));
+}
+
 /* ===== MAIN TEST RUNNER ===== */
 
 int main(void) {
@@ -213,6 +281,7 @@ int main(void) {
     RUN_TEST(test_verify_password);
     RUN_TEST(test_is_valid_format);
     RUN_TEST(test_round_trip_encryption);
+    RUN_TEST(test_decrypt_batch);
     
     UNITY_END();
     return 0;
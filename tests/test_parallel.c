@@ -0,0 +1,105 @@
+/**
+ * @file test_parallel.c
+ * @brief neoc_parallel_for tests
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/utils/neoc_parallel.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PARALLEL_COUNT 10007u
+
+typedef struct {
+    atomic_uint visits[TEST_PARALLEL_COUNT];
+    atomic_size_t calls;
+    size_t fail_at;
+} visit_ctx_t;
+
+static visit_ctx_t visit_ctx;
+
+void setUp(void) {
+    neoc_init();
+    memset(&visit_ctx, 0, sizeof(visit_ctx));
+    visit_ctx.fail_at = SIZE_MAX;
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+static neoc_error_t visit_range(size_t begin, size_t end, void *ctx) {
+    visit_ctx_t *visits = (visit_ctx_t *)ctx;
+    atomic_fetch_add(&visits->calls, 1);
+    for (size_t i = begin; i < end; i++) {
+        if (i == visits->fail_at) {
+            return NEOC_ERROR_CRYPTO;
+        }
+        atomic_fetch_add(&visits->visits[i], 1);
+    }
+    return NEOC_SUCCESS;
+}
+
+/* ===== PARALLEL FOR TESTS ===== */
+
+void test_parallel_for_visits_every_item_once(void) {
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_parallel_for(TEST_PARALLEL_COUNT, 0, 64, visit_range, &visit_ctx));
+    for (size_t i = 0; i < TEST_PARALLEL_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT(1, atomic_load(&visit_ctx.visits[i]));
+    }
+    // 10007 / 64 rounds up to 157 chunks, the last one partial
+    TEST_ASSERT_EQUAL_INT(157, (int)atomic_load(&visit_ctx.calls));
+}
+
+void test_parallel_for_single_thread_and_zero_chunk(void) {
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_parallel_for(100, 1, 0, visit_range, &visit_ctx));
+    for (size_t i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_UINT(1, atomic_load(&visit_ctx.visits[i]));
+    }
+    TEST_ASSERT_EQUAL_UINT(0, atomic_load(&visit_ctx.visits[100]));
+    TEST_ASSERT_EQUAL_INT(100, (int)atomic_load(&visit_ctx.calls));
+}
+
+void test_parallel_for_empty_range(void) {
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_parallel_for(0, 4, 8, visit_range, &visit_ctx));
+    TEST_ASSERT_EQUAL_INT(0, (int)atomic_load(&visit_ctx.calls));
+}
+
+void test_parallel_for_returns_first_error(void) {
+    visit_ctx.fail_at = 5000;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_CRYPTO,
+                          neoc_parallel_for(TEST_PARALLEL_COUNT, 8, 16, visit_range, &visit_ctx));
+    TEST_ASSERT_EQUAL_UINT(0, atomic_load(&visit_ctx.visits[5000]));
+}
+
+void test_parallel_for_rejects_null_fn(void) {
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT,
+                          neoc_parallel_for(10, 1, 1, NULL, NULL));
+}
+
+void test_parallel_cpu_count_is_positive(void) {
+    TEST_ASSERT_TRUE(neoc_parallel_cpu_count() >= 1);
+}
+
+/* ===== MAIN TEST RUNNER ===== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    printf("\n=== PARALLEL FOR TESTS ===\n");
+
+    RUN_TEST(test_parallel_for_visits_every_item_once);
+    RUN_TEST(test_parallel_for_single_thread_and_zero_chunk);
+    RUN_TEST(test_parallel_for_empty_range);
+    RUN_TEST(test_parallel_for_returns_first_error);
+    RUN_TEST(test_parallel_for_rejects_null_fn);
+    RUN_TEST(test_parallel_cpu_count_is_positive);
+
+    UNITY_END();
+    return 0;
+}
@@ -0,0 +1,208 @@
+/**
+ * @file test_rpc_batch.c
+ * @brief Batched JSON-RPC calls against a loopback stub node
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/protocol/rpc_client.h>
+#include <cjson/cJSON.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "stub_http_server.h"
+
+/* The stub fails getblock 13 with an RPC error and drops the response for 17 */
+#define STUB_ERROR_BLOCK 13
+#define STUB_MISSING_BLOCK 17
+
+static stub_http_server_t stub;
+
+/* Answers one batch body, in reverse order so matching has to use ids */
+static char *stub_answer(const char *path, const char *body, void *user_data) {
+    (void)path;
+    (void)user_data;
+    cJSON *requests = cJSON_Parse(body);
+    cJSON *responses = cJSON_CreateArray();
+    int count = cJSON_GetArraySize(requests);
+
+    for (int i = count - 1; i >= 0; i--) {
+        cJSON *request = cJSON_GetArrayItem(requests, i);
+        const char *method = cJSON_GetObjectItem(request, "method")->valuestring;
+        cJSON *params = cJSON_GetObjectItem(request, "params");
+        cJSON *response = cJSON_CreateObject();
+        cJSON_AddStringToObject(response, "jsonrpc", "2.0");
+        cJSON_AddNumberToObject(response, "id", cJSON_GetObjectItem(request, "id")->valuedouble);
+
+        if (strcmp(method, "getblock") == 0) {
+            int index = cJSON_GetArrayItem(params, 0)->valueint;
+            if (index == STUB_MISSING_BLOCK) {
+                cJSON_Delete(response);
+                continue;
+            }
+            if (index == STUB_ERROR_BLOCK) {
+                cJSON *error = cJSON_CreateObject();
+                cJSON_AddItemToObject(response, "error", error);
+                cJSON_AddNumberToObject(error, "code", -100);
+                cJSON_AddStringToObject(error, "message", "Unknown block");
+            } else {
+                char hash[67];
+                snprintf(hash, sizeof(hash), "0x%064x", (unsigned int)index);
+                cJSON *result = cJSON_CreateObject();
+                cJSON_AddItemToObject(response, "result", result);
+                cJSON_AddStringToObject(result, "hash", hash);
+                cJSON_AddNumberToObject(result, "index", index);
+                cJSON_AddNumberToObject(result, "time", 1700000000000.0);
+                cJSON_AddItemToObject(result, "tx", cJSON_CreateArray());
+            }
+        } else {
+            cJSON *result = cJSON_CreateObject();
+            cJSON_AddItemToObject(response, "result", result);
+            cJSON_AddItemToObject(result, "txid",
+                                  cJSON_Duplicate(cJSON_GetArrayItem(params, 0), true));
+        }
+        cJSON_AddItemToArray(responses, response);
+    }
+
+    char *text = cJSON_PrintUnformatted(responses);
+    cJSON_Delete(responses);
+    cJSON_Delete(requests);
+    return text;
+}
+
+void setUp(void) {
+    neoc_init();
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+/* ===== BATCH TESTS ===== */
+
+void test_rpc_batch_blocks_matched_by_id(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+
+    neoc_rpc_batch_t *batch = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_create(client, 4, &batch));
+
+    for (uint32_t i = 0; i < 10; i++) {
+        size_t index = 0;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_add_get_block_by_index(batch, 10 + i, false, &index));
+        TEST_ASSERT_EQUAL_INT((int)i, (int)index);
+    }
+    TEST_ASSERT_EQUAL_INT(10, neoc_rpc_batch_count(batch));
+
+    int posts_before = atomic_load(&stub.requests);
+    size_t failed = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_send(batch, &failed));
+    TEST_ASSERT_EQUAL_INT(3, atomic_load(&stub.requests) - posts_before);
+    TEST_ASSERT_EQUAL_INT(2, failed);
+
+    for (uint32_t i = 0; i < 10; i++) {
+        uint32_t block_index = 10 + i;
+        const char *message = NULL;
+        neoc_error_t status = neoc_rpc_batch_get_status(batch, i, &message);
+        neoc_block_t *block = NULL;
+        neoc_error_t err = neoc_rpc_batch_get_block(batch, i, &block);
+
+        if (block_index == STUB_ERROR_BLOCK || block_index == STUB_MISSING_BLOCK) {
+            TEST_ASSERT_EQUAL_INT(NEOC_ERROR_RPC, status);
+            TEST_ASSERT_EQUAL_INT(NEOC_ERROR_RPC, err);
+            TEST_ASSERT_NOT_NULL(message);
+            TEST_ASSERT_NULL(block);
+            if (block_index == STUB_ERROR_BLOCK) {
+                TEST_ASSERT_EQUAL_STRING("Unknown block", message);
+            }
+        } else {
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, status);
+            TEST_ASSERT_NULL(message);
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+            TEST_ASSERT_EQUAL_INT((int)block_index, (int)block->index);
+            TEST_ASSERT_EQUAL_INT((int)block_index, block->hash.data[NEOC_HASH256_SIZE - 1]);
+            neoc_rpc_block_free(block);
+        }
+    }
+
+    neoc_rpc_batch_free(batch);
+    neoc_rpc_client_free(client);
+}
+
+void test_rpc_batch_application_logs_and_reuse(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+
+    neoc_rpc_batch_t *batch = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_create(client, 0, &batch));
+
+    neoc_hash256_t tx_hash;
+    memset(&tx_hash, 0xab, sizeof(tx_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_add_get_application_log(batch, &tx_hash, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_add(batch, "getblock", "[5]", NULL));
+
+    /* Results are unavailable until the batch is sent */
+    const char *result = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_rpc_batch_get_result(batch, 0, &result));
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_send(batch, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_rpc_batch_add(batch, "getblockcount", NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_rpc_batch_send(batch, NULL));
+
+    char *log = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_get_application_log(batch, 0, &log));
+    TEST_ASSERT_NOT_NULL(strstr(log, "0xabababab"));
+    neoc_free(log);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_OUT_OF_BOUNDS, neoc_rpc_batch_get_result(batch, 2, &result));
+
+    neoc_rpc_batch_reset(batch);
+    TEST_ASSERT_EQUAL_INT(0, neoc_rpc_batch_count(batch));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_add_get_block_by_index(batch, 42, true, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_send(batch, NULL));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_get_result(batch, 0, &result));
+    TEST_ASSERT_NOT_NULL(strstr(result, "\"index\":42"));
+
+    neoc_rpc_batch_free(batch);
+    neoc_rpc_client_free(client);
+}
+
+void test_rpc_batch_transport_failure(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create("http://127.0.0.1:1/", &client));
+
+    neoc_rpc_batch_t *batch = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_create(client, 2, &batch));
+    for (uint32_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_batch_add_get_block_by_index(batch, i, false, NULL));
+    }
+
+    size_t failed = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_NETWORK, neoc_rpc_batch_send(batch, &failed));
+    TEST_ASSERT_EQUAL_INT(3, failed);
+    const char *message = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_NETWORK, neoc_rpc_batch_get_status(batch, 2, &message));
+    TEST_ASSERT_NOT_NULL(message);
+
+    neoc_rpc_batch_free(batch);
+    neoc_rpc_client_free(client);
+}
+
+/* ===== MAIN TEST RUNNER ===== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    if (stub_http_server_start(&stub, stub_answer, NULL) != 0) {
+        printf("Failed to start stub server\n");
+        return 1;
+    }
+
+    printf("\n=== RPC BATCH TESTS ===\n");
+    RUN_TEST(test_rpc_batch_blocks_matched_by_id);
+    RUN_TEST(test_rpc_batch_application_logs_and_reuse);
+    RUN_TEST(test_rpc_batch_transport_failure);
+
+    stub_http_server_stop(&stub);
+    UNITY_END();
+}
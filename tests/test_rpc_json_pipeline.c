@@ -0,0 +1,417 @@
+/**
+ * @file test_rpc_json_pipeline.c
+ * @brief Structured JSON-RPC calls and response parsing against a loopback stub node
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/protocol/rpc_client.h>
+#include <neoc/protocol/service.h>
+#include <neoc/protocol/core/request.h>
+#include <neoc/protocol/core/response.h>
+#include <neoc/protocol/core/response/neo_block.h>
+#include <neoc/protocol/stack_item.h>
+#include <cjson/cJSON.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "stub_http_server.h"
+
+static stub_http_server_t stub;
+
+/*
+ * "echo" returns the exact request body as its result, "fail" returns an
+ * RPC error, "noresult" omits the result, "getblock" and "getapplicationlog"
+ * return canned results, anything else returns 4000000.
+ */
+static const char *stub_block =
+    "{\"hash\":\"0x1d5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f00\","
+    "\"size\":1024,\"version\":0,\"time\":1700000000000,\"nonce\":\"12345\",\"index\":77,"
+    "\"primary\":1,\"tx\":[{\"hash\":\"0x%064x\",\"size\":252,\"version\":0,\"nonce\":8,"
+    "\"sysfee\":\"997775\",\"netfee\":\"1234520\",\"validuntilblock\":4005760,"
+    "\"signers\":[],\"attributes\":[],\"script\":\"EQ==\",\"witnesses\":[]}]}";
+static const char *stub_application_log =
+    "{\"txid\":\"0x4b5ab5f9d7a3b2e7b9c84f6b1e4f1c7d6b7a0e5f0a8c1e2d3f4a5b6c7d8e9f03\","
+    "\"executions\":[{\"trigger\":\"Application\",\"vmstate\":\"HALT\",\"gasconsumed\":\"9977780\","
+    "\"stack\":[{\"type\":\"Integer\",\"value\":\"3\"}],\"notifications\":[]}]}";
+
+static char *stub_answer(const char *path, const char *body, void *user_data) {
+    (void)path;
+    (void)user_data;
+    cJSON *request = cJSON_Parse(body);
+    const cJSON *method = cJSON_GetObjectItem(request, "method");
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddStringToObject(response, "jsonrpc", "2.0");
+    cJSON_AddNumberToObject(response, "id", cJSON_GetObjectItem(request, "id")->valuedouble);
+
+    if (strcmp(method->valuestring, "echo") == 0) {
+        cJSON_AddStringToObject(response, "result", body);
+    } else if (strcmp(method->valuestring, "fail") == 0) {
+        cJSON *error = cJSON_CreateObject();
+        cJSON_AddItemToObject(response, "error", error);
+        cJSON_AddNumberToObject(error, "code", -32601);
+        cJSON_AddStringToObject(error, "message", "Method not found");
+    } else if (strcmp(method->valuestring, "getblock") == 0) {
+        char block[1024];
+        snprintf(block, sizeof(block), stub_block, 5u);
+        cJSON_AddItemToObject(response, "result", cJSON_Parse(block));
+    } else if (strcmp(method->valuestring, "getapplicationlog") == 0) {
+        cJSON_AddItemToObject(response, "result", cJSON_Parse(stub_application_log));
+    } else if (strcmp(method->valuestring, "noresult") != 0) {
+        cJSON_AddNumberToObject(response, "result", 4000000);
+    }
+
+    char *text = cJSON_PrintUnformatted(response);
+    cJSON_Delete(response);
+    cJSON_Delete(request);
+    return text;
+}
+
+void setUp(void) {
+    neoc_init();
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+/* ===== STRUCTURED CALL TESTS ===== */
+
+void test_rpc_call_json_writes_request_body(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+
+    cJSON *params = cJSON_CreateArray();
+    cJSON_AddItemToArray(params, cJSON_CreateString("0xd2a4cff31913016155e38e474a2c06d08be276cf"));
+    cJSON_AddItemToArray(params, cJSON_CreateNumber(7));
+
+    cJSON *result = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_json(client, "echo", params, &result));
+    TEST_ASSERT_TRUE(cJSON_IsString(result));
+    TEST_ASSERT_EQUAL_STRING("{\"jsonrpc\":\"2.0\",\"method\":\"echo\","
+                             "\"params\":[\"0xd2a4cff31913016155e38e474a2c06d08be276cf\",7],\"id\":1}",
+                             result->valuestring);
+    cJSON_Delete(result);
+
+    /* No parameters go out as an empty array, and ids keep counting */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_json(client, "echo", NULL, &result));
+    TEST_ASSERT_EQUAL_STRING("{\"jsonrpc\":\"2.0\",\"method\":\"echo\",\"params\":[],\"id\":2}",
+                             result->valuestring);
+    cJSON_Delete(result);
+
+    cJSON_Delete(params);
+    neoc_rpc_client_free(client);
+}
+
+void test_rpc_call_json_grows_request_buffer(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+
+    /* Larger than the initial request buffer, then small again */
+    char *script = malloc(20001);
+    memset(script, 'A', 20000);
+    script[20000] = '\0';
+    cJSON *params = cJSON_CreateArray();
+    cJSON_AddItemToArray(params, cJSON_CreateString(script));
+
+    for (int round = 0; round < 2; round++) {
+        cJSON *result = NULL;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_json(client, "echo", params, &result));
+        cJSON *echoed = cJSON_Parse(result->valuestring);
+        TEST_ASSERT_NOT_NULL(echoed);
+        TEST_ASSERT_TRUE(cJSON_Compare(params, cJSON_GetObjectItem(echoed, "params"), true));
+        cJSON_Delete(echoed);
+        cJSON_Delete(result);
+    }
+
+    uint32_t count = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_get_block_count(client, &count));
+    TEST_ASSERT_EQUAL_UINT32(4000000, count);
+
+    cJSON_Delete(params);
+    free(script);
+    neoc_rpc_client_free(client);
+}
+
+void test_rpc_call_json_prints_params_node(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+
+    cJSON *params = cJSON_Parse("[\"q\\\"b\\\\s\\n\\u0001\",-12,0.1,1e300,123456789012345678,"
+                                "true,false,null,{\"k\":[{}],\"e\":[]}]");
+    TEST_ASSERT_NOT_NULL(params);
+
+    cJSON *result = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_json(client, "echo", params, &result));
+    TEST_ASSERT_NOT_NULL(strstr(result->valuestring, "\"params\":[\"q\\\"b\\\\s\\n\\u0001\",-12,"));
+    TEST_ASSERT_NOT_NULL(strstr(result->valuestring, ",true,false,null,{\"k\":[{}],\"e\":[]}],"));
+    /* The node is written exactly as cJSON prints it */
+    char *printed = cJSON_PrintUnformatted(params);
+    TEST_ASSERT_NOT_NULL(printed);
+    TEST_ASSERT_NOT_NULL(strstr(result->valuestring, printed));
+    free(printed);
+    cJSON *echoed = cJSON_Parse(result->valuestring);
+    TEST_ASSERT_NOT_NULL(echoed);
+    TEST_ASSERT_TRUE(cJSON_Compare(params, cJSON_GetObjectItem(echoed, "params"), true));
+
+    cJSON_Delete(echoed);
+    cJSON_Delete(result);
+    cJSON_Delete(params);
+    neoc_rpc_client_free(client);
+}
+
+void test_rpc_call_json_errors(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+
+    cJSON *result = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_RPC, neoc_rpc_call_json(client, "fail", NULL, &result));
+    TEST_ASSERT_NULL(result);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT,
+                          neoc_rpc_call_json(client, "ec\"ho", NULL, &result));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, neoc_rpc_call_json(client, NULL, NULL, &result));
+
+    /* A reply without a result hands back a JSON null */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_json(client, "noresult", NULL, &result));
+    TEST_ASSERT_TRUE(cJSON_IsNull(result));
+    cJSON_Delete(result);
+
+    /* The text API still prints the result once */
+    char *text = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_raw(client, "getblockcount", "[]", &text));
+    TEST_ASSERT_EQUAL_STRING("4000000", text);
+    neoc_free(text);
+
+    neoc_rpc_client_free(client);
+}
+
+/* ===== STREAMED CALL TESTS ===== */
+
+static neoc_error_t ignore_element(size_t path_index, const neoc_json_t *element, void *user_data) {
+    (void)path_index;
+    (void)element;
+    (void)user_data;
+    return NEOC_SUCCESS;
+}
+
+static neoc_error_t reject_strings(const neoc_json_event_t *event, void *user_data) {
+    (void)user_data;
+    return event->type == NEOC_JSON_EVENT_STRING ? NEOC_ERROR_INVALID_STATE : NEOC_SUCCESS;
+}
+
+void test_rpc_call_streamed_feeds_parser(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+
+    /* A reply large enough to arrive in several chunks */
+    char *params = malloc(20005);
+    memcpy(params, "[\"", 2);
+    memset(params + 2, 'A', 20000);
+    memcpy(params + 20002, "\"]", 3);
+
+    neoc_json_splitter_t *splitter = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_splitter_create(NULL, 0, ignore_element, NULL, &splitter));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_streamed(client, "echo", params,
+                                                               neoc_json_splitter_stream(splitter)));
+    const neoc_json_t *response = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_splitter_finish(splitter, &response));
+    cJSON *echoed = cJSON_Parse(cJSON_GetObjectItem(response, "result")->valuestring);
+    TEST_ASSERT_NOT_NULL(echoed);
+    TEST_ASSERT_EQUAL_INT(20000, (int)strlen(cJSON_GetArrayItem(cJSON_GetObjectItem(echoed, "params"), 0)->valuestring));
+    cJSON_Delete(echoed);
+    neoc_json_splitter_free(splitter);
+
+    /* A consumer error aborts the transfer and is reported as is */
+    neoc_json_stream_t *stream = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_stream_create(reject_strings, NULL, &stream));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_rpc_call_streamed(client, "echo", params, stream));
+    neoc_json_stream_free(stream);
+
+    /* RPC errors in the envelope are the decoder's to report */
+    neoc_neo_block_decoder_t *decoder = NULL;
+    neoc_neo_block_t *block = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_neo_block_decoder_create(true, &decoder));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_call_streamed(client, "fail", "[1]",
+                                                               neoc_neo_block_decoder_stream(decoder)));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_RPC, neoc_neo_block_decoder_finish(decoder, &block));
+    TEST_ASSERT_NULL(block);
+    neoc_neo_block_decoder_free(decoder);
+
+    /* The client keeps working for buffered calls */
+    uint32_t count = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_get_block_count(client, &count));
+    TEST_ASSERT_EQUAL_UINT32(4000000, count);
+
+    free(params);
+    neoc_rpc_client_free(client);
+}
+
+void test_rpc_typed_getters_decode_streamed_responses(void) {
+    neoc_rpc_client_t *client = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_client_create(stub.url, &client));
+    neoc_hash256_t hash;
+    memset(&hash, 0xab, sizeof(hash));
+
+    neoc_neo_block_t *block = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_get_neo_block(client, &hash, &block));
+    TEST_ASSERT_EQUAL_UINT32(77, block->header.index);
+    TEST_ASSERT_EQUAL_UINT(1, block->transaction_count);
+    TEST_ASSERT_EQUAL_UINT32(8, block->transactions[0]->nonce);
+    neoc_neo_block_free(block);
+
+    neoc_get_application_log_response_t *log = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_rpc_get_application_log_decoded(client, &hash, &log));
+    TEST_ASSERT_NOT_NULL(log->result);
+    TEST_ASSERT_EQUAL_UINT(1, log->result->executions_count);
+    TEST_ASSERT_EQUAL_UINT(1, log->result->executions[0]->stack_count);
+    neoc_get_application_log_response_free(log);
+
+    neoc_rpc_client_free(client);
+}
+
+/* ===== SERVICE RESPONSE TESTS ===== */
+
+void test_service_parse_response_unterminated_buffer(void) {
+    neoc_service_t *service = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_create_from_url(stub.url, &service));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_set_include_raw_responses(service, true));
+
+    /* The reply is followed by bytes that must not be read */
+    static const char reply[] = "{\"jsonrpc\":\"2.0\",\"id\":9,\"result\":{\"a\":[1,2]}}garbage";
+    size_t reply_len = strlen(reply) - strlen("garbage");
+    neoc_byte_array_t bytes = { .data = (uint8_t *)reply, .length = reply_len, .capacity = 0 };
+
+    neoc_response_t *response = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_parse_response(service, 1, &bytes, &response));
+    TEST_ASSERT_EQUAL_INT(9, response->id);
+    TEST_ASSERT_FALSE(response->has_error);
+    /* Both the text and the parsed node are kept */
+    TEST_ASSERT_EQUAL_STRING("{\"a\":[1,2]}", (char *)response->result);
+    TEST_ASSERT_TRUE(cJSON_IsObject(response->result_json));
+    const char *text = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_response_get_result_text(response, &text));
+    TEST_ASSERT_TRUE(text == response->result);
+    TEST_ASSERT_EQUAL_INT((int)reply_len, (int)strlen(response->raw_response));
+    neoc_response_free(response);
+
+    static const char error_reply[] =
+        "{\"jsonrpc\":\"2.0\",\"id\":3,\"error\":{\"code\":-100,\"message\":\"Unknown block\"}}";
+    bytes.data = (uint8_t *)error_reply;
+    bytes.length = strlen(error_reply);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_parse_response(service, 1, &bytes, &response));
+    TEST_ASSERT_TRUE(response->has_error);
+    TEST_ASSERT_EQUAL_INT(-100, response->error->code);
+    TEST_ASSERT_EQUAL_STRING("Unknown block", response->error->message);
+    neoc_response_free(response);
+
+    bytes.length = 5;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT,
+                          neoc_service_parse_response(service, 1, &bytes, &response));
+
+    neoc_service_free(service);
+}
+
+void test_service_send_request_splices_params(void) {
+    neoc_service_t *service = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_create_from_url(stub.url, &service));
+
+    neoc_request_t *request = neoc_request_create("echo", " [\"x\",{\"k\":true}]", NULL);
+    TEST_ASSERT_NOT_NULL(request);
+    request->id = 5;
+
+    neoc_response_t *response = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_service_send_request(service, request, &response));
+    TEST_ASSERT_EQUAL_INT(5, response->id);
+    const char *text = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_response_get_result_text(response, &text));
+    TEST_ASSERT_EQUAL_STRING("\"{\\\"jsonrpc\\\":\\\"2.0\\\",\\\"method\\\":\\\"echo\\\","
+                             "\\\"params\\\":[\\\"x\\\",{\\\"k\\\":true}],\\\"id\\\":5}\"",
+                             text);
+    neoc_response_free(response);
+
+    neoc_request_free(request);
+    neoc_service_free(service);
+}
+
+/* ===== STACK ITEM DECODING TESTS ===== */
+
+void test_stack_item_from_json_node_decodes_invocation_stack(void) {
+    cJSON *stack = cJSON_Parse(
+        "[{\"type\":\"Integer\",\"value\":\"-42\"},"
+        "{\"type\":\"Integer\",\"value\":\"18446744073709551616\"},"
+        "{\"type\":\"ByteString\",\"value\":\"aGVsbG8=\"},"
+        "{\"type\":\"Boolean\",\"value\":true},"
+        "{\"type\":\"Array\",\"value\":[{\"type\":\"Integer\",\"value\":\"1\"},{\"type\":\"Any\"}]},"
+        "{\"type\":\"Map\",\"value\":[{\"key\":{\"type\":\"ByteString\",\"value\":\"aw==\"},"
+        "\"value\":{\"type\":\"Integer\",\"value\":\"7\"}}]}]");
+    TEST_ASSERT_NOT_NULL(stack);
+
+    stack_item_t *items[6] = {0};
+    for (int i = 0; i < 6; i++) {
+        items[i] = neoc_stack_item_from_json_node(cJSON_GetArrayItem(stack, i));
+        TEST_ASSERT_NOT_NULL(items[i]);
+    }
+    cJSON_Delete(stack);
+
+    int64_t integer = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, stack_item_to_integer(items[0], &integer));
+    TEST_ASSERT_EQUAL_INT64(-42, integer);
+
+    /* 2^64 does not fit in 64 bits and comes back as little-endian magnitude bytes */
+    uint8_t big[32];
+    size_t big_len = sizeof(big);
+    bool negative = true;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, stack_item_to_big_integer(items[1], big, &big_len, &negative));
+    TEST_ASSERT_FALSE(negative);
+    TEST_ASSERT_EQUAL_INT(9, (int)big_len);
+    TEST_ASSERT_EQUAL_HEX8(0x01, big[8]);
+
+    uint8_t bytes[16];
+    size_t bytes_len = sizeof(bytes);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, stack_item_to_byte_array(items[2], bytes, &bytes_len));
+    TEST_ASSERT_EQUAL_INT(5, (int)bytes_len);
+    TEST_ASSERT_EQUAL_MEMORY("hello", bytes, 5);
+
+    bool flag = false;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, stack_item_to_boolean(items[3], &flag));
+    TEST_ASSERT_TRUE(flag);
+
+    TEST_ASSERT_EQUAL_INT(STACK_ITEM_TYPE_ARRAY, stack_item_get_type(items[4]));
+    TEST_ASSERT_EQUAL_INT(2, (int)stack_item_array_count(items[4]));
+    TEST_ASSERT_TRUE(stack_item_is_null(stack_item_array_get(items[4], 1)));
+
+    TEST_ASSERT_EQUAL_INT(1, (int)stack_item_map_count(items[5]));
+    stack_item_t *key = stack_item_create_byte_string((const uint8_t *)"k", 1);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, stack_item_to_integer(stack_item_map_get(items[5], key), &integer));
+    TEST_ASSERT_EQUAL_INT64(7, integer);
+    stack_item_unref(key);
+
+    for (int i = 0; i < 6; i++) {
+        stack_item_unref(items[i]);
+    }
+}
+
+/* ===== MAIN TEST RUNNER ===== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    if (stub_http_server_start(&stub, stub_answer, NULL) != 0) {
+        printf("Failed to start stub server\n");
+        return 1;
+    }
+
+    printf("\n=== RPC JSON PIPELINE TESTS ===\n");
+    RUN_TEST(test_rpc_call_json_writes_request_body);
+    RUN_TEST(test_rpc_call_json_grows_request_buffer);
+    RUN_TEST(test_rpc_call_json_prints_params_node);
+    RUN_TEST(test_rpc_call_json_errors);
+    RUN_TEST(test_rpc_call_streamed_feeds_parser);
+    RUN_TEST(test_rpc_typed_getters_decode_streamed_responses);
+    RUN_TEST(test_service_parse_response_unterminated_buffer);
+    RUN_TEST(test_service_send_request_splices_params);
+    RUN_TEST(test_stack_item_from_json_node_decodes_invocation_stack);
+
+    stub_http_server_stop(&stub);
+    UNITY_END();
+}
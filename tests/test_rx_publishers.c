@@ -0,0 +1,349 @@
+/**
+ * @file test_rx_publishers.c
+ * @brief Reactive block publishers against a loopback stub node
+ */
+
+#define _GNU_SOURCE
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/protocol/neo_c.h>
+#include <neoc/protocol/service.h>
+#include <neoc/protocol/rx/json_rpc2_0_rx.h>
+#include <neoc/protocol/core/response/neo_block.h>
+#include <cjson/cJSON.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "stub_http_server.h"
+
+/* getblock for this index fails with an RPC error */
+#define STUB_ERROR_BLOCK 7
+
+static atomic_int stub_block_count;
+static atomic_int stub_block_requests;
+static atomic_int stub_concurrent;
+static atomic_int stub_max_concurrent;
+static stub_http_server_t stub;
+
+static char *stub_answer(const char *path, const char *body, void *user_data) {
+    (void)path;
+    (void)user_data;
+    cJSON *request = cJSON_Parse(body);
+    const char *method = cJSON_GetObjectItem(request, "method")->valuestring;
+    cJSON *params = cJSON_GetObjectItem(request, "params");
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddStringToObject(response, "jsonrpc", "2.0");
+    cJSON_AddNumberToObject(response, "id", cJSON_GetObjectItem(request, "id")->valuedouble);
+
+    if (strcmp(method, "getblockcount") == 0) {
+        cJSON_AddNumberToObject(response, "result", atomic_load(&stub_block_count));
+    } else {
+        int index = cJSON_GetArrayItem(params, 0)->valueint;
+        int concurrent = atomic_fetch_add(&stub_concurrent, 1) + 1;
+        int seen = atomic_load(&stub_max_concurrent);
+        while (concurrent > seen && !atomic_compare_exchange_weak(&stub_max_concurrent, &seen, concurrent)) {
+        }
+        atomic_fetch_add(&stub_block_requests, 1);
+        /* Uneven latency so responses complete out of order */
+        usleep((useconds_t)((index % 3) * 3000));
+        atomic_fetch_sub(&stub_concurrent, 1);
+
+        if (index == STUB_ERROR_BLOCK && strcmp(method, "getblock") == 0) {
+            cJSON *error = cJSON_CreateObject();
+            cJSON_AddItemToObject(response, "error", error);
+            cJSON_AddNumberToObject(error, "code", -100);
+            cJSON_AddStringToObject(error, "message", "Unknown block");
+        } else {
+            char hash[67];
+            snprintf(hash, sizeof(hash), "0x%064x", (unsigned int)index);
+            cJSON *result = cJSON_CreateObject();
+            cJSON_AddItemToObject(response, "result", result);
+            cJSON_AddStringToObject(result, "hash", hash);
+            cJSON_AddNumberToObject(result, "index", index);
+            cJSON_AddNumberToObject(result, "time", 1700000000000.0);
+        }
+    }
+
+    char *text = cJSON_PrintUnformatted(response);
+    cJSON_Delete(response);
+    cJSON_Delete(request);
+    return text;
+}
+
+/* ===== FIXTURE ===== */
+
+#define MAX_RECORDED 64
+
+typedef struct {
+    int indices[MAX_RECORDED];
+    neoc_error_t errors[MAX_RECORDED];
+    bool had_block[MAX_RECORDED];
+    atomic_int count;
+    int stop_after;             /* Return false after this many (0 = never) */
+    int delay_us;               /* Simulated slow consumer */
+    int prefetch;               /* Checked against the stub when non-zero */
+    atomic_int overrun;         /* Fetches observed beyond the prefetch window */
+} recorder_t;
+
+static neoc_neo_c_t *client;
+static neoc_json_rpc2_0_rx_t *rx;
+
+static bool record_block(const neoc_neo_get_block_t *block, neoc_error_t error, void *user_data) {
+    recorder_t *rec = (recorder_t *)user_data;
+    int n = atomic_load(&rec->count);
+    if (n >= MAX_RECORDED) {
+        return false;
+    }
+    if (rec->prefetch > 0 && atomic_load(&stub_block_requests) > n + 1 + rec->prefetch) {
+        atomic_fetch_add(&rec->overrun, 1);
+    }
+    rec->indices[n] = block ? block->index : -1;
+    rec->errors[n] = error;
+    rec->had_block[n] = block && block->block &&
+                        (int)block->block->header.index == block->index;
+    if (rec->delay_us > 0) {
+        usleep((useconds_t)rec->delay_us);
+    }
+    atomic_store(&rec->count, n + 1);
+    return rec->stop_after == 0 || n + 1 < rec->stop_after;
+}
+
+static bool record_index(int block_index, neoc_error_t error, void *user_data) {
+    recorder_t *rec = (recorder_t *)user_data;
+    int n = atomic_load(&rec->count);
+    if (n >= MAX_RECORDED) {
+        return false;
+    }
+    rec->indices[n] = block_index;
+    rec->errors[n] = error;
+    atomic_store(&rec->count, n + 1);
+    return rec->stop_after == 0 || n + 1 < rec->stop_after;
+}
+
+/* Waits up to five seconds for the recorder to reach target */
+static bool wait_for_count(recorder_t *rec, int target) {
+    for (int i = 0; i < 500 && atomic_load(&rec->count) < target; i++) {
+        usleep(10000);
+    }
+    return atomic_load(&rec->count) >= target;
+}
+
+static bool wait_inactive(neoc_subscription_t *subscription) {
+    for (int i = 0; i < 500 && neoc_subscription_is_active(subscription); i++) {
+        usleep(10000);
+    }
+    return !neoc_subscription_is_active(subscription);
+}
+
+void setUp(void) {
+    neoc_init();
+    atomic_store(&stub_block_count, 50);
+    atomic_store(&stub_block_requests, 0);
+    atomic_store(&stub_max_concurrent, 0);
+
+    neoc_service_config_t *config = NULL;
+    neoc_service_config_create_default(stub.url, &config);
+    neoc_service_t *service = NULL;
+    neoc_service_create(NEOC_SERVICE_TYPE_HTTP, config, &service);
+    neoc_service_config_free(config);
+    client = neoc_neo_c_create(neoc_neo_c_config_create(), service);
+    rx = neoc_json_rpc2_0_rx_create(client, NULL);
+}
+
+void tearDown(void) {
+    neoc_json_rpc2_0_rx_free(rx);
+    neoc_neo_c_free(client);
+    neoc_cleanup();
+}
+
+/* ===== PUBLISHER TESTS ===== */
+
+void test_rx_replay_delivers_in_order_with_parallel_fetches(void) {
+    static recorder_t rec;
+    memset(&rec, 0, sizeof(rec));
+    neoc_json_rpc2_0_rx_set_max_prefetch(rx, 4);
+
+    neoc_subscription_t *subscription = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_json_rpc2_0_rx_replay_blocks_publisher(rx, 10, 39, false, true,
+                                                                      record_block, &rec, &subscription));
+    TEST_ASSERT_TRUE(wait_for_count(&rec, 30));
+    TEST_ASSERT_TRUE(wait_inactive(subscription));
+
+    for (int i = 0; i < 30; i++) {
+        TEST_ASSERT_EQUAL_INT(10 + i, rec.indices[i]);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, rec.errors[i]);
+        TEST_ASSERT_TRUE(rec.had_block[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(30, atomic_load(&rec.count));
+    TEST_ASSERT_TRUE(atomic_load(&stub_max_concurrent) > 1);
+    TEST_ASSERT_TRUE(atomic_load(&stub_max_concurrent) <= 4);
+    neoc_subscription_free(subscription);
+}
+
+void test_rx_replay_descending_reports_failed_blocks(void) {
+    static recorder_t rec;
+    memset(&rec, 0, sizeof(rec));
+
+    neoc_subscription_t *subscription = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_json_rpc2_0_rx_replay_blocks_publisher(rx, 5, 9, true, false,
+                                                                      record_block, &rec, &subscription));
+    TEST_ASSERT_TRUE(wait_for_count(&rec, 5));
+    TEST_ASSERT_TRUE(wait_inactive(subscription));
+
+    for (int i = 0; i < 5; i++) {
+        int index = 9 - i;
+        TEST_ASSERT_EQUAL_INT(index, rec.indices[i]);
+        if (index == STUB_ERROR_BLOCK) {
+            TEST_ASSERT_EQUAL_INT(NEOC_ERROR_RPC, rec.errors[i]);
+            TEST_ASSERT_FALSE(rec.had_block[i]);
+        } else {
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, rec.errors[i]);
+            TEST_ASSERT_TRUE(rec.had_block[i]);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT,
+                          neoc_json_rpc2_0_rx_replay_blocks_publisher(rx, 9, 5, false, true,
+                                                                      record_block, &rec, &subscription));
+    TEST_ASSERT_NULL(subscription);
+}
+
+void test_rx_slow_consumer_bounds_prefetch(void) {
+    static recorder_t rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.delay_us = 10000;
+    rec.prefetch = 3;
+    neoc_json_rpc2_0_rx_set_max_prefetch(rx, 3);
+
+    neoc_subscription_t *subscription = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_json_rpc2_0_rx_replay_blocks_publisher(rx, 0, 19, false, true,
+                                                                      record_block, &rec, &subscription));
+    TEST_ASSERT_TRUE(wait_for_count(&rec, 20));
+    TEST_ASSERT_EQUAL_INT(0, atomic_load(&rec.overrun));
+    TEST_ASSERT_EQUAL_INT(20, atomic_load(&stub_block_requests));
+    neoc_subscription_free(subscription);
+}
+
+void test_rx_catch_up_then_follow_new_blocks(void) {
+    static recorder_t rec;
+    memset(&rec, 0, sizeof(rec));
+    atomic_store(&stub_block_count, 10);
+
+    neoc_subscription_t *subscription = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_json_rpc2_0_rx_catch_up_to_latest_and_subscribe(rx, 2, false, 20,
+                                                                               record_block, &rec,
+                                                                               &subscription));
+    TEST_ASSERT_TRUE(wait_for_count(&rec, 8));
+    atomic_store(&stub_block_count, 14);
+    TEST_ASSERT_TRUE(wait_for_count(&rec, 12));
+    TEST_ASSERT_TRUE(neoc_subscription_is_active(subscription));
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_subscription_cancel(subscription));
+    TEST_ASSERT_FALSE(neoc_subscription_is_active(subscription));
+    int delivered = atomic_load(&rec.count);
+    TEST_ASSERT_EQUAL_INT(12, delivered);
+    for (int i = 0; i < delivered; i++) {
+        TEST_ASSERT_EQUAL_INT(2 + i, rec.indices[i]);
+    }
+
+    /* No callback runs after cancel returns */
+    atomic_store(&stub_block_count, 20);
+    usleep(100000);
+    TEST_ASSERT_EQUAL_INT(delivered, atomic_load(&rec.count));
+    neoc_subscription_free(subscription);
+}
+
+void test_rx_block_index_publisher_reports_new_indices(void) {
+    static recorder_t rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.stop_after = 4;
+    atomic_store(&stub_block_count, 100);
+
+    neoc_subscription_t *subscription = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_json_rpc2_0_rx_block_index_publisher(rx, 20, record_index, &rec, &subscription));
+    TEST_ASSERT_TRUE(wait_for_count(&rec, 1));
+    atomic_store(&stub_block_count, 103);
+
+    /* Returning false from the callback ends the subscription */
+    TEST_ASSERT_TRUE(wait_inactive(subscription));
+    TEST_ASSERT_EQUAL_INT(4, atomic_load(&rec.count));
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(99 + i, rec.indices[i]);
+    }
+    /* Left registered; freeing the rx client releases it */
+}
+
+static atomic_int async_latest;
+
+static bool latest_index_callback(int block_index, neoc_error_t error, void *user_data) {
+    (void)user_data;
+    atomic_store(&async_latest, error == NEOC_SUCCESS ? block_index : -2);
+    return true;
+}
+
+void test_rx_latest_block_index(void) {
+    atomic_store(&stub_block_count, 321);
+    int latest = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_rpc2_0_rx_get_latest_block_index(rx, &latest));
+    TEST_ASSERT_EQUAL_INT(320, latest);
+
+    atomic_store(&async_latest, 0);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_json_rpc2_0_rx_get_latest_block_index_async(rx, latest_index_callback, NULL));
+    for (int i = 0; i < 500 && atomic_load(&async_latest) == 0; i++) {
+        usleep(10000);
+    }
+    TEST_ASSERT_EQUAL_INT(320, atomic_load(&async_latest));
+}
+
+void test_rx_cancel_all_subscriptions(void) {
+    static recorder_t first;
+    static recorder_t second;
+    memset(&first, 0, sizeof(first));
+    memset(&second, 0, sizeof(second));
+
+    neoc_subscription_t *a = NULL;
+    neoc_subscription_t *b = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_rpc2_0_rx_block_publisher(rx, false, 20, record_block, &first, &a));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_rpc2_0_rx_block_index_publisher(rx, 20, record_index, &second, &b));
+    TEST_ASSERT_EQUAL_INT(2, (int)rx->subscription_count);
+    TEST_ASSERT_TRUE(wait_for_count(&first, 1));
+    TEST_ASSERT_EQUAL_INT(49, first.indices[0]);
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_json_rpc2_0_rx_cancel_all_subscriptions(rx));
+    TEST_ASSERT_FALSE(neoc_subscription_is_active(a));
+    TEST_ASSERT_FALSE(neoc_subscription_is_active(b));
+
+    neoc_subscription_free(a);
+    TEST_ASSERT_EQUAL_INT(1, (int)rx->subscription_count);
+}
+
+/* ===== MAIN TEST RUNNER ===== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    if (stub_http_server_start(&stub, stub_answer, NULL) != 0) {
+        printf("Failed to start stub server\n");
+        return 1;
+    }
+
+    printf("\n=== RX PUBLISHER TESTS ===\n");
+    RUN_TEST(test_rx_replay_delivers_in_order_with_parallel_fetches);
+    RUN_TEST(test_rx_replay_descending_reports_failed_blocks);
+    RUN_TEST(test_rx_slow_consumer_bounds_prefetch);
+    RUN_TEST(test_rx_catch_up_then_follow_new_blocks);
+    RUN_TEST(test_rx_block_index_publisher_reports_new_indices);
+    RUN_TEST(test_rx_latest_block_index);
+    RUN_TEST(test_rx_cancel_all_subscriptions);
+
+    stub_http_server_stop(&stub);
+    UNITY_END();
+}
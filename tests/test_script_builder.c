@@ -9,6 +9,7 @@
 #include <neoc/script/opcode.h>
 #include <neoc/script/interop_service.h>
 #include <neoc/contract/contract_parameter.h>
+#include <neoc/script/script_template.h>
 /* Crypto include if needed */
 #include <neoc/utils/neoc_hex.h>
 #include <string.h>
@@ -338,6 +339,196 @@ void test_get_builder_output(void) {
     neoc_script_builder_free(builder);
 }
 
+/* ===== SCRIPT TEMPLATE TESTS ===== */
+
+static void fill_hash(neoc_hash160_t *hash, uint8_t seed) {
+    for (size_t i = 0; i < sizeof(hash->data); i++) {
+        hash->data[i] = (uint8_t)(seed + i);
+    }
+}
+
+void test_template_matches_builder_contract_call(void) {
+    static const int64_t integers[] = {
+        -1, 0, 16, 17, -2, 127, -128, 128, -129, 32767, -32768, 32768,
+        2147483647LL, -2147483647LL - 1, 2147483648LL, INT64_MAX, INT64_MIN
+    };
+    uint8_t payload[300];
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = (uint8_t)i;
+    }
+    const uint8_t *datas[] = { NULL, payload, payload, payload };
+    const size_t data_lens[] = { 0, 0, 20, sizeof(payload) };
+
+    neoc_hash160_t contract, account;
+    fill_hash(&contract, 0x40);
+    fill_hash(&account, 0x80);
+
+    const neoc_script_slot_type_t slots[] = {
+        NEOC_SCRIPT_SLOT_HASH160, NEOC_SCRIPT_SLOT_INTEGER, NEOC_SCRIPT_SLOT_BYTES
+    };
+    neoc_script_template_t *tmpl = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_script_template_create(&contract, "payout", slots, 3, NULL, &tmpl));
+    TEST_ASSERT_EQUAL_INT(3, (int)neoc_script_template_slot_count(tmpl));
+
+    for (size_t i = 0; i < sizeof(integers) / sizeof(integers[0]); i++) {
+        for (size_t d = 0; d < sizeof(datas) / sizeof(datas[0]); d++) {
+            neoc_script_builder_t *builder = NULL;
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_builder_create(&builder));
+            if (datas[d]) {
+                TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                                      neoc_script_builder_push_data(builder, datas[d], data_lens[d]));
+            } else {
+                TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_builder_emit(builder, NEOC_OP_PUSHNULL));
+            }
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_builder_push_integer(builder, integers[i]));
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                                  neoc_script_builder_push_data(builder, account.data, sizeof(account.data)));
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                                  neoc_script_builder_contract_call(builder, &contract, "payout", NULL, 3,
+                                                                    NEOC_CALL_FLAGS_ALL));
+            uint8_t *expected = NULL;
+            size_t expected_len = 0;
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                                  neoc_script_builder_to_array(builder, &expected, &expected_len));
+            neoc_script_builder_free(builder);
+
+            neoc_script_arg_t args[3] = {{0}};
+            args[0].hash160 = &account;
+            args[1].integer = integers[i];
+            args[2].data = datas[d];
+            args[2].data_len = data_lens[d];
+
+            size_t size = 0;
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_template_size(tmpl, args, &size));
+            TEST_ASSERT_EQUAL_INT((int)expected_len, (int)size);
+
+            uint8_t buffer[512];
+            size_t written = 0;
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                                  neoc_script_template_write(tmpl, args, buffer, sizeof(buffer), &written));
+            TEST_ASSERT_EQUAL_INT((int)expected_len, (int)written);
+            TEST_ASSERT_EQUAL_MEMORY(expected, buffer, expected_len);
+            neoc_free(expected);
+        }
+    }
+
+    neoc_script_template_free(tmpl);
+}
+
+void test_template_nep17_survives_arena_reset(void) {
+    neoc_hash160_t token, from, to;
+    fill_hash(&token, 0x11);
+    fill_hash(&from, 0x22);
+    fill_hash(&to, 0x33);
+
+    // First use of the shared NEP-17 template happens with an arena active
+    neoc_arena_t *arena = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_arena_create(4096, &arena));
+    neoc_arena_t *previous = neoc_arena_set_active(arena);
+    uint8_t *script = NULL;
+    size_t first_len = 0;
+    neoc_error_t err = neoc_script_create_nep17_transfer(&token, &from, &to, 42, NULL, 0,
+                                                         &script, &first_len);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    uint8_t first[128];
+    TEST_ASSERT_TRUE(first_len <= sizeof(first));
+    memcpy(first, script, first_len);
+
+    // Recycle the arena so anything it handed out is overwritten
+    neoc_arena_reset(arena);
+    uint8_t *junk = neoc_malloc(2048);
+    TEST_ASSERT_NOT_NULL(junk);
+    memset(junk, 0xA5, 2048);
+    neoc_arena_set_active(previous);
+
+    script = NULL;
+    size_t second_len = 0;
+    err = neoc_script_create_nep17_transfer(&token, &from, &to, 42, NULL, 0, &script, &second_len);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    TEST_ASSERT_EQUAL_INT((int)first_len, (int)second_len);
+    TEST_ASSERT_EQUAL_MEMORY(first, script, first_len);
+    neoc_free(script);
+    neoc_arena_free(arena);
+}
+
+void test_template_nep17_matches_legacy_layout(void) {
+    neoc_hash160_t token, from, to;
+    fill_hash(&token, 0x10);
+    fill_hash(&from, 0x30);
+    fill_hash(&to, 0x50);
+    const uint8_t data[] = { 0xde, 0xad, 0xbe, 0xef };
+
+    for (int with_data = 0; with_data < 2; with_data++) {
+        neoc_script_builder_t *builder = NULL;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_builder_create(&builder));
+        if (with_data) {
+            neoc_script_builder_push_data(builder, data, sizeof(data));
+        } else {
+            neoc_script_builder_emit(builder, NEOC_OP_PUSHNULL);
+        }
+        neoc_script_builder_push_integer(builder, 150000000);
+        neoc_script_builder_push_data(builder, to.data, sizeof(to.data));
+        neoc_script_builder_push_data(builder, from.data, sizeof(from.data));
+        neoc_script_builder_push_integer(builder, 4);
+        neoc_script_builder_emit(builder, NEOC_OP_PACK);
+        neoc_script_builder_push_string(builder, "transfer");
+        neoc_script_builder_push_data(builder, token.data, sizeof(token.data));
+        neoc_script_builder_emit_syscall(builder, NEOC_INTEROP_SYSTEM_CONTRACT_CALL);
+        neoc_script_builder_emit(builder, NEOC_OP_ASSERT);
+        uint8_t *expected = NULL;
+        size_t expected_len = 0;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_builder_to_array(builder, &expected, &expected_len));
+        neoc_script_builder_free(builder);
+
+        uint8_t *script = NULL;
+        size_t script_len = 0;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              neoc_script_create_nep17_transfer(&token, &from, &to, 150000000,
+                                                                with_data ? data : NULL,
+                                                                with_data ? sizeof(data) : 0,
+                                                                &script, &script_len));
+        TEST_ASSERT_EQUAL_INT((int)expected_len, (int)script_len);
+        TEST_ASSERT_EQUAL_MEMORY(expected, script, expected_len);
+        neoc_free(script);
+        neoc_free(expected);
+    }
+}
+
+void test_template_invalid_arguments(void) {
+    neoc_hash160_t contract, account;
+    fill_hash(&contract, 0x01);
+    fill_hash(&account, 0x02);
+    const neoc_script_slot_type_t slots[] = { NEOC_SCRIPT_SLOT_HASH160, NEOC_SCRIPT_SLOT_INTEGER };
+    neoc_script_slot_type_t too_many[NEOC_SCRIPT_TEMPLATE_MAX_SLOTS + 1] = {0};
+    neoc_script_template_t *tmpl = NULL;
+
+    TEST_ASSERT_TRUE(neoc_script_template_create(NULL, "m", slots, 2, NULL, &tmpl) != NEOC_SUCCESS);
+    TEST_ASSERT_TRUE(neoc_script_template_create(&contract, "m", too_many,
+                                                 NEOC_SCRIPT_TEMPLATE_MAX_SLOTS + 1,
+                                                 NULL, &tmpl) != NEOC_SUCCESS);
+    TEST_ASSERT_NULL(tmpl);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_template_create(&contract, "m", slots, 2, NULL, &tmpl));
+
+    neoc_script_arg_t args[2] = {{0}};
+    args[1].integer = 1000;
+    uint8_t buffer[64];
+    size_t written = 0;
+    TEST_ASSERT_TRUE(neoc_script_template_write(tmpl, args, buffer, sizeof(buffer),
+                                                &written) != NEOC_SUCCESS);
+
+    args[0].hash160 = &account;
+    size_t size = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_script_template_size(tmpl, args, &size));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL,
+                          neoc_script_template_write(tmpl, args, buffer, size - 1, &written));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_script_template_write(tmpl, args, buffer, size, &written));
+    TEST_ASSERT_EQUAL_INT((int)size, (int)written);
+
+    neoc_script_template_free(tmpl);
+}
+
 /* ===== MAIN TEST RUNNER ===== */
 
 int main(void) {
@@ -354,6 +545,10 @@ int main(void) {
     RUN_TEST(test_opcode_operations);
     RUN_TEST(test_syscall_operation);
     RUN_TEST(test_get_builder_output);
+    RUN_TEST(test_template_nep17_survives_arena_reset);
+    RUN_TEST(test_template_matches_builder_contract_call);
+    RUN_TEST(test_template_nep17_matches_legacy_layout);
+    RUN_TEST(test_template_invalid_arguments);
     
     UNITY_END();
     return 0;
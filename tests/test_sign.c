@@ -9,6 +9,7 @@
 #include <neoc/crypto/ec_key_pair.h>
 #include <neoc/crypto/ecdsa_signature.h>
 #include <neoc/utils/neoc_hex.h>
+#include <neoc/neo_constants.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -286,6 +287,89 @@ void test_verify_signature(void) {
     neoc_ec_key_pair_free(key_pair);
 }
 
+void test_verify_signatures_batch(void) {
+    enum { KEY_COUNT = 3, ENTRY_COUNT = 96 };
+    neoc_ec_key_pair_t* key_pairs[KEY_COUNT];
+    for (int i = 0; i < KEY_COUNT; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_ec_key_pair_create_random(&key_pairs[i]));
+    }
+    
+    char text[ENTRY_COUNT][16];
+    const uint8_t* messages[ENTRY_COUNT];
+    size_t message_lens[ENTRY_COUNT];
+    neoc_signature_data_t* sig_data[ENTRY_COUNT];
+    const neoc_signature_data_t* signatures[ENTRY_COUNT];
+    const neoc_ec_public_key_t* public_keys[ENTRY_COUNT];
+    bool results[ENTRY_COUNT];
+    
+    for (int i = 0; i < ENTRY_COUNT; i++) {
+        snprintf(text[i], sizeof(text[i]), "message %d", i);
+        messages[i] = (const uint8_t*)text[i];
+        message_lens[i] = strlen(text[i]);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              neoc_sign_message(messages[i], message_lens[i],
+                                                key_pairs[i % KEY_COUNT], &sig_data[i]));
+        signatures[i] = sig_data[i];
+        public_keys[i] = key_pairs[i % KEY_COUNT]->public_key;
+    }
+    
+    // Every fifth entry is checked against the wrong key
+    for (int i = 0; i < ENTRY_COUNT; i += 5) {
+        public_keys[i] = key_pairs[(i + 1) % KEY_COUNT]->public_key;
+    }
+    
+    neoc_error_t err = neoc_verify_signatures_batch(messages, message_lens, signatures,
+                                                    public_keys, ENTRY_COUNT, results);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    for (int i = 0; i < ENTRY_COUNT; i++) {
+        TEST_ASSERT_EQUAL_INT(i % 5 != 0, results[i]);
+        TEST_ASSERT_EQUAL_INT(neoc_verify_signature(messages[i], message_lens[i],
+                                                    signatures[i], public_keys[i]),
+                              results[i]);
+    }
+    
+    for (int i = 0; i < ENTRY_COUNT; i++) {
+        neoc_signature_data_free(sig_data[i]);
+    }
+    for (int i = 0; i < KEY_COUNT; i++) {
+        neoc_ec_key_pair_free(key_pairs[i]);
+    }
+}
+
+void test_sign_hash_fast(void) {
+    neoc_ec_key_pair_t* key_pair;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_ec_key_pair_create_random(&key_pair));
+    
+    const uint8_t* half_order = neoc_get_secp256r1_half_curve_order();
+    const uint8_t* key = key_pair->public_key->compressed;
+    size_t key_len = sizeof(key_pair->public_key->compressed);
+    
+    for (int i = 0; i < 16; i++) {
+        uint8_t hash[32];
+        memset(hash, i, sizeof(hash));
+        
+        uint8_t signature[64];
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_sign_hash_fast(hash, key_pair, signature));
+        
+        // Canonical: s is never above half the curve order
+        TEST_ASSERT_TRUE(memcmp(signature + 32, half_order, 32) <= 0);
+        
+        const uint8_t* digests[] = {hash};
+        const uint8_t* signatures[] = {signature};
+        bool valid = false;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                              neoc_verify_digests_batch(digests, signatures, &key, &key_len, 1, &valid));
+        TEST_ASSERT_TRUE(valid);
+    }
+    
+    uint8_t hash[32] = {0};
+    uint8_t signature[64];
+    TEST_ASSERT_TRUE(neoc_sign_hash_fast(NULL, key_pair, signature) != NEOC_SUCCESS);
+    TEST_ASSERT_TRUE(neoc_sign_hash_fast(hash, NULL, signature) != NEOC_SUCCESS);
+    
+    neoc_ec_key_pair_free(key_pair);
+}
+
 void test_invalid_signature_validation(void) {
     // Test creating signature data with invalid R size
     uint8_t short_r[31];  // Too short
@@ -332,6 +416,8 @@ int main(void) {
     RUN_TEST(test_public_key_from_signed_message);
     RUN_TEST(test_public_key_from_private_key);
     RUN_TEST(test_verify_signature);
+    RUN_TEST(test_verify_signatures_batch);
+    RUN_TEST(test_sign_hash_fast);
     RUN_TEST(test_invalid_signature_validation);
     
     UNITY_END();
@@ -2,6 +2,8 @@
 #include <neoc/neoc.h>
 #include <neoc/transaction/transaction_builder.h>
 #include <neoc/wallet/account.h>
+#include <neoc/protocol/rpc_client.h>
+#include <neoc/protocol/neo_c_config.h>
 #include <neoc/types/neoc_hash160.h>
 #include <neoc/types/neoc_hash256.h>
 #include <string.h>
@@ -195,11 +197,54 @@ void test_transaction_builder_build_and_sign(void) {
     // Check that transaction has witnesses
     TEST_ASSERT_EQUAL_INT(1, transaction->witness_count);
     
+    // Witness signature covers the network magic and transaction hash
+    TEST_ASSERT_TRUE(neoc_transaction_verify(transaction, NEOC_CONFIG_DEFAULT_NETWORK_MAGIC));
+    TEST_ASSERT_FALSE(neoc_transaction_verify(transaction, 0x3554334E));
+    transaction->nonce ^= 1;
+    TEST_ASSERT_FALSE(neoc_transaction_verify(transaction, NEOC_CONFIG_DEFAULT_NETWORK_MAGIC));
+    
     neoc_transaction_free(transaction);
     neoc_account_free(account);
     neoc_tx_builder_free(builder);
 }
 
+void test_transaction_builder_verify_binds_witnesses_to_signers(void) {
+    neoc_tx_builder_t *builder = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_tx_builder_create(&builder));
+    
+    neoc_account_t *first = NULL;
+    neoc_account_t *second = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_create("first", &first));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_create("second", &second));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_tx_builder_add_signer_from_account(builder, first,
+                                                                  NEOC_WITNESS_SCOPE_CALLED_BY_ENTRY));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_tx_builder_add_signer_from_account(builder, second,
+                                                                  NEOC_WITNESS_SCOPE_CALLED_BY_ENTRY));
+    
+    uint8_t script[] = {0x11, 0x40};
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_tx_builder_set_script(builder, script, sizeof(script)));
+    
+    neoc_account_t *accounts[] = {first, second};
+    neoc_transaction_t *transaction = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_tx_builder_build_and_sign(builder, accounts, 2, &transaction));
+    TEST_ASSERT_EQUAL_INT(2, transaction->witness_count);
+    TEST_ASSERT_TRUE(neoc_transaction_verify(transaction, NEOC_CONFIG_DEFAULT_NETWORK_MAGIC));
+    
+    // Valid signatures in the wrong order no longer match their signers
+    neoc_witness_t *witness = transaction->witnesses[0];
+    transaction->witnesses[0] = transaction->witnesses[1];
+    transaction->witnesses[1] = witness;
+    TEST_ASSERT_FALSE(neoc_transaction_verify(transaction, NEOC_CONFIG_DEFAULT_NETWORK_MAGIC));
+    
+    neoc_transaction_free(transaction);
+    neoc_account_free(first);
+    neoc_account_free(second);
+    neoc_tx_builder_free(builder);
+}
+
 void test_transaction_builder_get_hash(void) {
     neoc_tx_builder_t *builder = NULL;
     neoc_error_t err = neoc_tx_builder_create(&builder);
@@ -237,6 +282,48 @@ void test_transaction_builder_get_hash(void) {
     neoc_tx_builder_free(builder);
 }
 
+void test_transaction_builder_calculate_fees_sizes_unsigned_transaction(void) {
+    neoc_tx_builder_t *builder = NULL;
+    neoc_error_t err = neoc_tx_builder_create(&builder);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    err = neoc_tx_builder_set_valid_until_block(builder, 1000000);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    neoc_hash160_t account_hash;
+    neoc_hash160_init_zero(&account_hash);
+    neoc_signer_t *signer = NULL;
+    err = neoc_signer_create_global(&account_hash, &signer);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    err = neoc_tx_builder_add_signer(builder, signer);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    neoc_signer_free(signer);
+
+    // Long enough that the script length needs a 3-byte var int
+    uint8_t script[300];
+    memset(script, 0x21, sizeof(script));
+    err = neoc_tx_builder_set_script(builder, script, sizeof(script));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    // Fees are estimated locally; the client is never contacted
+    neoc_rpc_client_t *client = NULL;
+    err = neoc_rpc_client_create("http://127.0.0.1:1/", &client);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    uint64_t network_fee = 0;
+    uint64_t system_fee = 0;
+    err = neoc_tx_builder_calculate_fees(builder, client, &network_fee, &system_fee);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+
+    neoc_transaction_t *transaction = NULL;
+    err = neoc_tx_builder_build_unsigned(builder, &transaction);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, err);
+    uint64_t expected = (uint64_t)neoc_transaction_get_size(transaction) * 1000 + 1000000;
+    TEST_ASSERT_EQUAL_UINT64(expected, network_fee);
+
+    neoc_transaction_free(transaction);
+    neoc_rpc_client_free(client);
+    neoc_tx_builder_free(builder);
+}
+
 int main(void) {
     UNITY_BEGIN();
     
@@ -248,7 +335,9 @@ int main(void) {
     RUN_TEST(test_transaction_builder_with_account);
     RUN_TEST(test_transaction_builder_high_priority);
     RUN_TEST(test_transaction_builder_build_and_sign);
+    RUN_TEST(test_transaction_builder_verify_binds_witnesses_to_signers);
     RUN_TEST(test_transaction_builder_get_hash);
+    RUN_TEST(test_transaction_builder_calculate_fees_sizes_unsigned_transaction);
     
     return UnityEnd();
 }
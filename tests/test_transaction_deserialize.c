@@ -0,0 +1,568 @@
+/**
+ * @file test_transaction_deserialize.c
+ * @brief Binary transaction deserialization and zero-copy views
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/neoc_memory.h>
+#include <neoc/transaction/transaction.h>
+#include <neoc/crypto/sha256.h>
+#include <neoc/crypto/ec_key_pair.h>
+#include <neoc/protocol/neo_c_config.h>
+#include <neoc/protocol/core/witnessrule/witness_condition.h>
+#include <neoc/protocol/core/witnessrule/witness_rule.h>
+#include <string.h>
+
+static const char *SIGNER_HASH = "1234567890abcdef1234567890abcdef12345678";
+static const char *CONTRACT_HASH = "d2a4cff31913016155e38e474a2c06d08be276cf";
+
+static const uint8_t GROUP_KEY[33] = {
+    0x02, 0x1b, 0x84, 0x18, 0x5a, 0x5b, 0x4f, 0x72, 0x8a, 0x3d, 0x4e, 0x59, 0x0c, 0x33, 0x1c, 0x71,
+    0x2f, 0x3a, 0x36, 0x40, 0x5c, 0x4f, 0x2e, 0x0d, 0x2b, 0x6e, 0x5e, 0x2d, 0x68, 0x1a, 0x4b, 0x2c, 0x7e
+};
+
+/*
+ * N3 transaction assembled field by field from the N3 wire format,
+ * independently of neoc_transaction_serialize: a NEO transfer of 1 signed
+ * by the key for private key 1 (the secp256r1 generator point), with
+ * HighPriority and NotValidBefore(5760000) attributes. The expected hash is
+ * SHA-256 of the first KNOWN_TX_UNSIGNED_SIZE bytes; KNOWN_TX_ID is that
+ * digest in the byte-reversed form shown by explorers and RPC. The witness
+ * signature is over SHA-256(0x334F454E as LE uint32 || hash), produced and
+ * checked outside NeoC (openssl pkeyutl -verify).
+ */
+static const char *KNOWN_TX_HEX =
+    "00"                                       /* version */
+    "7d1c4f2a"                                 /* nonce 0x2a4f1c7d */
+    "94390f0000000000"                         /* system fee 997780 */
+    "d0c2120000000000"                         /* network fee 1229520 */
+    "7be45700"                                 /* valid until block 5760123 */
+    "01" "66de052617e55519358c3885e049e3d3e07efe7e" "01" /* signer, CalledByEntry */
+    "02" "01" "20" "00e45700"                  /* HighPriority, NotValidBefore */
+    "56"                                       /* 86-byte script */
+    "0b110c14cf76e28bd0062c4a478ee35561011319f3cfa4d20c1466de052617e55519358c3885e049e3d3e07efe7e"
+    "14c01f0c087472616e736665720c14f563ea40bc283d4d0e05c48ea305b3f2a07340ef41627d5b52"
+    "01"                                       /* one witness */
+    "420c408874451892402ce60c825129b24fccf08d4c4ce58d7479931419b906034d2cb9"
+    "10faa492873d8fc65b44da2dc83cf2772afeb143cb8a2d8f3ce99ae7d2b028aa"
+    "280c21036b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c2964156e7b327";
+static const char *KNOWN_TX_ID = "b05584b852b6257bfae6578b7e230eaa9d3cd260ca6a578f70d72f8e3620358c";
+static const char *KNOWN_TX_ACCOUNT = "7efe7ee0d3e349e085388c351955e5172605de66";
+static const char *KNOWN_TX_PUBLIC_KEY = "036b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296";
+#define KNOWN_TX_SIZE 250
+#define KNOWN_TX_UNSIGNED_SIZE 141
+#define KNOWN_TX_SCRIPT_SIZE 86
+#define KNOWN_TX_WITNESS_OFFSET (KNOWN_TX_UNSIGNED_SIZE + 1)
+#define KNOWN_TX_NETWORK_MAGIC 0x334F454E
+
+static uint8_t serialized[2048];
+static size_t serialized_len;
+
+static neoc_transaction_t *build_transaction(void) {
+    neoc_transaction_t *tx = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_create(&tx));
+    neoc_transaction_set_nonce(tx, 0x01020304);
+    neoc_transaction_set_system_fee(tx, 9007990);
+    neoc_transaction_set_network_fee(tx, 1230610);
+    neoc_transaction_set_valid_until_block(tx, 2106265);
+
+    neoc_hash160_t signer_hash;
+    neoc_hash160_t contract_hash;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash160_from_hex(&signer_hash, SIGNER_HASH));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash160_from_hex(&contract_hash, CONTRACT_HASH));
+
+    neoc_signer_t *entry = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_signer_create_called_by_entry(&signer_hash, &entry));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_add_signer(tx, entry));
+
+    /* Second signer exercises every optional signer section */
+    neoc_signer_t *custom = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_signer_create(&contract_hash, 0, &custom));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_signer_add_allowed_contract(custom, &signer_hash));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_signer_add_allowed_group(custom, GROUP_KEY, sizeof(GROUP_KEY)));
+
+    neoc_witness_condition_t *parts[2] = {NULL, NULL};
+    neoc_witness_condition_t *condition = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_witness_condition_create_called_by_entry(&parts[0]));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_witness_condition_create_script_hash(&contract_hash, &parts[1]));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_witness_condition_create_and(parts, 2, &condition));
+    custom->rules = neoc_calloc(1, sizeof(neoc_witness_rule_t *));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_witness_rule_create(NEOC_WITNESS_ACTION_ALLOW, condition, &custom->rules[0]));
+    custom->rules_count = 1;
+    custom->scopes |= NEOC_WITNESS_SCOPE_WITNESS_RULES;
+    neoc_witness_condition_free(condition);
+    neoc_witness_condition_free(parts[0]);
+    neoc_witness_condition_free(parts[1]);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_add_signer(tx, custom));
+
+    uint8_t height[4] = {0x10, 0x20, 0x00, 0x00};
+    uint8_t conflict[32];
+    memset(conflict, 0xab, sizeof(conflict));
+    neoc_tx_attribute_t *attribute = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_tx_attribute_create(NEOC_TX_ATTR_HIGH_PRIORITY, NULL, 0, &attribute));
+    neoc_transaction_add_attribute(tx, attribute);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_tx_attribute_create(NEOC_TX_ATTR_NOT_VALID_BEFORE, height, sizeof(height), &attribute));
+    neoc_transaction_add_attribute(tx, attribute);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_tx_attribute_create(NEOC_TX_ATTR_CONFLICTS, conflict, sizeof(conflict), &attribute));
+    neoc_transaction_add_attribute(tx, attribute);
+
+    const uint8_t script[] = {0x11, 0xc0, 0x1f, 0x0c, 0x06, 's', 'y', 'm', 'b', 'o', 'l', 0x41, 0x62, 0x7d, 0x5b, 0x52};
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_set_script(tx, script, sizeof(script)));
+
+    uint8_t invocation[66];
+    uint8_t verification[40];
+    memset(invocation, 0x0c, sizeof(invocation));
+    memset(verification, 0x21, sizeof(verification));
+    neoc_witness_t *witness = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_witness_create(invocation, sizeof(invocation), verification, sizeof(verification), &witness));
+    neoc_transaction_add_witness(tx, witness);
+    /* Contract witnesses carry an empty verification script */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_witness_create(invocation, 2, NULL, 0, &witness));
+    neoc_transaction_add_witness(tx, witness);
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_transaction_serialize(tx, serialized, sizeof(serialized), &serialized_len));
+    return tx;
+}
+
+void setUp(void) {
+    neoc_init();
+}
+
+void tearDown(void) {
+    neoc_cleanup();
+}
+
+void test_deserialize_round_trip(void) {
+    neoc_transaction_t *original = build_transaction();
+    TEST_ASSERT_EQUAL_INT((int)neoc_transaction_get_size(original), (int)serialized_len);
+
+    neoc_binary_reader_t *reader = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_create(serialized, serialized_len, &reader));
+    neoc_transaction_t *tx = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_deserialize(reader, &tx));
+    TEST_ASSERT_TRUE(neoc_binary_reader_is_at_end(reader));
+    neoc_binary_reader_free(reader);
+
+    TEST_ASSERT_EQUAL_UINT32(0x01020304, tx->nonce);
+    TEST_ASSERT_EQUAL_INT(9007990, (int)tx->system_fee);
+    TEST_ASSERT_EQUAL_INT(1230610, (int)tx->network_fee);
+    TEST_ASSERT_EQUAL_UINT32(2106265, tx->valid_until_block);
+    TEST_ASSERT_EQUAL_INT(2, (int)tx->signer_count);
+    TEST_ASSERT_EQUAL_INT(3, (int)tx->attribute_count);
+    TEST_ASSERT_EQUAL_INT(2, (int)tx->witness_count);
+
+    const neoc_signer_t *custom = tx->signers[1];
+    TEST_ASSERT_EQUAL_INT(1, (int)custom->allowed_contracts_count);
+    TEST_ASSERT_EQUAL_INT(1, (int)custom->allowed_groups_count);
+    TEST_ASSERT_EQUAL_MEMORY(GROUP_KEY, custom->allowed_groups[0], sizeof(GROUP_KEY));
+    TEST_ASSERT_EQUAL_INT(1, (int)custom->rules_count);
+    TEST_ASSERT_EQUAL_INT(NEOC_WITNESS_ACTION_ALLOW, custom->rules[0]->action);
+    TEST_ASSERT_EQUAL_INT(NEOC_TX_ATTR_CONFLICTS, tx->attributes[2]->type);
+    TEST_ASSERT_EQUAL_INT(32, (int)tx->attributes[2]->data_len);
+    TEST_ASSERT_EQUAL_INT(0, (int)tx->witnesses[1]->verification_script_len);
+
+    neoc_hash256_t expected;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_calculate_hash(original, &expected));
+    TEST_ASSERT_EQUAL_MEMORY(expected.data, tx->hash.data, sizeof(expected.data));
+
+    uint8_t again[2048];
+    size_t again_len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_serialize(tx, again, sizeof(again), &again_len));
+    TEST_ASSERT_EQUAL_INT((int)serialized_len, (int)again_len);
+    TEST_ASSERT_EQUAL_MEMORY(serialized, again, serialized_len);
+
+    neoc_transaction_free(tx);
+    neoc_transaction_free(original);
+}
+
+void test_serialize_and_hash_without_allocating(void) {
+    neoc_transaction_t *tx = build_transaction();
+    size_t size = neoc_transaction_get_size(tx);
+
+    uint8_t exact[2048];
+    size_t written = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_BUFFER_TOO_SMALL, neoc_transaction_serialize(tx, exact, size - 1, &written));
+
+    neoc_memory_stats_t before, after;
+    neoc_get_memory_stats(&before);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_serialize(tx, exact, size, &written));
+    neoc_hash256_t hash;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_calculate_hash(tx, &hash));
+    neoc_get_memory_stats(&after);
+    TEST_ASSERT_EQUAL_UINT(before.allocation_count, after.allocation_count);
+
+    TEST_ASSERT_EQUAL_UINT(size, written);
+    TEST_ASSERT_EQUAL_MEMORY(serialized, exact, size);
+
+    /* The streamed hash matches hashing the unsigned bytes of the view */
+    neoc_binary_reader_t reader;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&reader, exact, written));
+    neoc_transaction_view_t view;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_parse(&reader, &view));
+    neoc_hash256_t view_hash;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_get_hash(&view, &view_hash));
+    TEST_ASSERT_EQUAL_MEMORY(view_hash.data, hash.data, sizeof(hash.data));
+
+    neoc_transaction_free(tx);
+}
+
+void test_view_points_into_buffer(void) {
+    neoc_transaction_t *original = build_transaction();
+
+    neoc_binary_reader_t reader;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&reader, serialized, serialized_len));
+    neoc_transaction_view_t view;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_parse(&reader, &view));
+    TEST_ASSERT_EQUAL_INT((int)serialized_len, (int)view.size);
+    TEST_ASSERT_TRUE(view.data == serialized);
+
+    TEST_ASSERT_EQUAL_INT(2, (int)view.signer_count);
+    TEST_ASSERT_TRUE(view.signers[0].account == serialized + 25 + 1);
+    uint8_t account_le[20];
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS,
+                          neoc_hash160_to_little_endian_bytes(&original->signers[1]->account,
+                                                              account_le, sizeof(account_le)));
+    TEST_ASSERT_EQUAL_MEMORY(account_le, view.signers[1].account, 20);
+    TEST_ASSERT_EQUAL_INT(NEOC_TX_ATTR_NOT_VALID_BEFORE, view.attributes[1].type);
+    TEST_ASSERT_EQUAL_INT(4, (int)view.attributes[1].payload_len);
+    TEST_ASSERT_EQUAL_INT(0, (int)view.attributes[0].payload_len);
+
+    TEST_ASSERT_TRUE(view.script > serialized && view.script < serialized + serialized_len);
+    TEST_ASSERT_EQUAL_MEMORY(original->script, view.script, original->script_len);
+    TEST_ASSERT_TRUE(view.witnesses[0].invocation_script > view.script);
+    TEST_ASSERT_EQUAL_INT(66, (int)view.witnesses[0].invocation_script_len);
+    TEST_ASSERT_EQUAL_INT(40, (int)view.witnesses[0].verification_script_len);
+
+    neoc_hash256_t expected;
+    neoc_hash256_t hash;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_calculate_hash(original, &expected));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_get_hash(&view, &hash));
+    TEST_ASSERT_EQUAL_MEMORY(expected.data, hash.data, sizeof(hash.data));
+
+    neoc_transaction_free(original);
+}
+
+void test_deserialize_simple_walks_concatenated_transactions(void) {
+    neoc_transaction_t *original = build_transaction();
+    uint8_t pair[4096];
+    memcpy(pair, serialized, serialized_len);
+    memcpy(pair + serialized_len, serialized, serialized_len);
+
+    size_t offset = 0;
+    for (int i = 0; i < 2; i++) {
+        size_t consumed = 0;
+        neoc_transaction_t *tx = neoc_transaction_deserialize_simple(pair + offset, 2 * serialized_len - offset, &consumed);
+        TEST_ASSERT_NOT_NULL(tx);
+        TEST_ASSERT_EQUAL_INT((int)serialized_len, (int)consumed);
+        offset += consumed;
+        neoc_transaction_free(tx);
+    }
+    TEST_ASSERT_EQUAL_INT((int)(2 * serialized_len), (int)offset);
+    neoc_transaction_free(original);
+}
+
+void test_truncated_input_is_rejected(void) {
+    neoc_transaction_t *original = build_transaction();
+
+    for (size_t len = 0; len < serialized_len; len++) {
+        neoc_binary_reader_t reader;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&reader, serialized, len));
+        neoc_transaction_view_t view;
+        TEST_ASSERT_TRUE(neoc_transaction_view_parse(&reader, &view) != NEOC_SUCCESS);
+
+        size_t consumed = 99;
+        TEST_ASSERT_NULL(neoc_transaction_deserialize_simple(serialized, len, &consumed));
+        TEST_ASSERT_EQUAL_INT(0, (int)consumed);
+    }
+    neoc_transaction_free(original);
+}
+
+void test_malformed_transactions_are_rejected(void) {
+    neoc_transaction_t *original = build_transaction();
+    uint8_t copy[2048];
+    neoc_transaction_view_t view;
+
+    /* Unknown version */
+    memcpy(copy, serialized, serialized_len);
+    copy[0] = 1;
+    neoc_binary_reader_t reader;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&reader, copy, serialized_len));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_transaction_view_parse(&reader, &view));
+
+    /* Duplicate signer */
+    memcpy(copy, serialized, serialized_len);
+    memcpy(copy + 26 + 21, copy + 26, 20);
+    reader.position = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_transaction_view_parse(&reader, &view));
+
+    /* Witness count must match signer count */
+    memcpy(copy, serialized, serialized_len);
+    neoc_binary_reader_t valid;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&valid, serialized, serialized_len));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_parse(&valid, &view));
+    copy[view.unsigned_size] = 1;
+    reader.position = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_transaction_view_parse(&reader, &view));
+
+    /* Unknown attribute type */
+    memcpy(copy, serialized, serialized_len);
+    valid.position = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_parse(&valid, &view));
+    copy[(size_t)(view.attributes[0].payload - serialized) - 1] = 0x7f;
+    reader.position = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_FORMAT, neoc_transaction_view_parse(&reader, &view));
+
+    neoc_transaction_free(original);
+}
+
+void test_deserialize_known_transaction(void) {
+    neoc_bytes_t *raw = neoc_bytes_from_hex(KNOWN_TX_HEX);
+    TEST_ASSERT_NOT_NULL(raw);
+    TEST_ASSERT_EQUAL_INT(KNOWN_TX_SIZE, (int)raw->length);
+
+    neoc_binary_reader_t *reader = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_create(raw->data, raw->length, &reader));
+    neoc_transaction_t *tx = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_deserialize(reader, &tx));
+    TEST_ASSERT_TRUE(neoc_binary_reader_is_at_end(reader));
+    neoc_binary_reader_free(reader);
+
+    TEST_ASSERT_EQUAL_UINT8(0, tx->version);
+    TEST_ASSERT_EQUAL_UINT32(0x2a4f1c7d, tx->nonce);
+    TEST_ASSERT_EQUAL_INT(997780, (int)tx->system_fee);
+    TEST_ASSERT_EQUAL_INT(1229520, (int)tx->network_fee);
+    TEST_ASSERT_EQUAL_UINT32(5760123, tx->valid_until_block);
+
+    /* UInt160 is little-endian on the wire, big-endian in neoc_hash160_t */
+    neoc_bytes_t *account = neoc_bytes_from_hex(KNOWN_TX_ACCOUNT);
+    TEST_ASSERT_NOT_NULL(account);
+    TEST_ASSERT_EQUAL_INT(1, (int)tx->signer_count);
+    TEST_ASSERT_EQUAL_MEMORY(account->data, tx->signers[0]->account.data, 20);
+    for (size_t i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_HEX8(account->data[19 - i], raw->data[26 + i]);
+    }
+    TEST_ASSERT_EQUAL_UINT8(NEOC_WITNESS_SCOPE_CALLED_BY_ENTRY, tx->signers[0]->scopes);
+
+    TEST_ASSERT_EQUAL_INT(2, (int)tx->attribute_count);
+    TEST_ASSERT_EQUAL_INT(NEOC_TX_ATTR_HIGH_PRIORITY, tx->attributes[0]->type);
+    TEST_ASSERT_EQUAL_INT(0, (int)tx->attributes[0]->data_len);
+    TEST_ASSERT_EQUAL_INT(NEOC_TX_ATTR_NOT_VALID_BEFORE, tx->attributes[1]->type);
+    const uint8_t height[4] = {0x00, 0xe4, 0x57, 0x00};
+    TEST_ASSERT_EQUAL_INT(4, (int)tx->attributes[1]->data_len);
+    TEST_ASSERT_EQUAL_MEMORY(height, tx->attributes[1]->data, 4);
+
+    TEST_ASSERT_EQUAL_INT(KNOWN_TX_SCRIPT_SIZE, (int)tx->script_len);
+    TEST_ASSERT_EQUAL_MEMORY(raw->data + KNOWN_TX_UNSIGNED_SIZE - KNOWN_TX_SCRIPT_SIZE, tx->script, KNOWN_TX_SCRIPT_SIZE);
+
+    /* Single-signature witness: PUSHDATA1 sig / PUSHDATA1 key SYSCALL CheckSig */
+    neoc_bytes_t *public_key = neoc_bytes_from_hex(KNOWN_TX_PUBLIC_KEY);
+    TEST_ASSERT_NOT_NULL(public_key);
+    TEST_ASSERT_EQUAL_INT(1, (int)tx->witness_count);
+    const neoc_witness_t *witness = tx->witnesses[0];
+    TEST_ASSERT_EQUAL_INT(66, (int)witness->invocation_script_len);
+    TEST_ASSERT_EQUAL_HEX8(0x0c, witness->invocation_script[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x40, witness->invocation_script[1]);
+    TEST_ASSERT_EQUAL_HEX8(0xaa, witness->invocation_script[65]);
+    TEST_ASSERT_EQUAL_INT(40, (int)witness->verification_script_len);
+    TEST_ASSERT_EQUAL_MEMORY(public_key->data, witness->verification_script + 2, 33);
+    const uint8_t check_sig[5] = {0x41, 0x56, 0xe7, 0xb3, 0x27};
+    TEST_ASSERT_EQUAL_MEMORY(check_sig, witness->verification_script + 35, 5);
+
+    /* Hash covers only the unsigned part and is displayed byte-reversed */
+    char tx_id[65];
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < 32; i++) {
+        uint8_t byte = tx->hash.data[31 - i];
+        tx_id[2 * i] = digits[byte >> 4];
+        tx_id[2 * i + 1] = digits[byte & 0x0f];
+    }
+    tx_id[64] = '\0';
+    TEST_ASSERT_EQUAL_STRING(KNOWN_TX_ID, tx_id);
+
+    neoc_binary_reader_t view_reader;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&view_reader, raw->data, raw->length));
+    neoc_transaction_view_t view;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_parse(&view_reader, &view));
+    TEST_ASSERT_EQUAL_INT(KNOWN_TX_UNSIGNED_SIZE, (int)view.unsigned_size);
+    neoc_hash256_t view_hash;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_view_get_hash(&view, &view_hash));
+    TEST_ASSERT_EQUAL_MEMORY(tx->hash.data, view_hash.data, sizeof(view_hash.data));
+
+    /* Serializing again reproduces the original bytes */
+    uint8_t again[KNOWN_TX_SIZE];
+    size_t again_len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_serialize(tx, again, sizeof(again), &again_len));
+    TEST_ASSERT_EQUAL_INT(KNOWN_TX_SIZE, (int)again_len);
+    TEST_ASSERT_EQUAL_MEMORY(raw->data, again, KNOWN_TX_SIZE);
+
+    neoc_bytes_free(public_key);
+    neoc_bytes_free(account);
+    neoc_bytes_free(raw);
+    neoc_transaction_free(tx);
+}
+
+static neoc_transaction_t *parse_known_transaction(void) {
+    neoc_bytes_t *raw = neoc_bytes_from_hex(KNOWN_TX_HEX);
+    TEST_ASSERT_NOT_NULL(raw);
+    neoc_binary_reader_t reader;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_binary_reader_init_view(&reader, raw->data, raw->length));
+    neoc_transaction_t *tx = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_deserialize(&reader, &tx));
+    neoc_bytes_free(raw);
+    return tx;
+}
+
+static void known_sign_digest(neoc_transaction_t *tx, neoc_hash256_t *digest) {
+    neoc_hash256_t hash;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_calculate_hash(tx, &hash));
+    uint8_t sign_data[36] = {0x4e, 0x45, 0x4f, 0x33};
+    memcpy(sign_data + 4, hash.data, 32);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_sha256(sign_data, sizeof(sign_data), digest->data));
+}
+
+static void replace_witness(neoc_transaction_t *tx, const uint8_t *invocation, size_t invocation_len,
+                            const uint8_t *verification, size_t verification_len) {
+    neoc_witness_t *witness = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_witness_create(invocation, invocation_len,
+                                                            verification, verification_len, &witness));
+    neoc_witness_free(tx->witnesses[0]);
+    tx->witnesses[0] = witness;
+}
+
+void test_verify_known_transaction(void) {
+    neoc_transaction_t *tx = parse_known_transaction();
+    TEST_ASSERT_TRUE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+    TEST_ASSERT_TRUE(neoc_transaction_verify(tx, NEOC_CONFIG_DEFAULT_NETWORK_MAGIC));
+
+    /* Same signature, other network or bare transaction hash */
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, 0x3554334E));
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, 0));
+
+    tx->witnesses[0]->invocation_script[10] ^= 0x01;
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+    neoc_transaction_free(tx);
+}
+
+void test_verify_rejects_missing_witness(void) {
+    neoc_transaction_t *tx = parse_known_transaction();
+    tx->witness_count = 0;
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+    tx->witness_count = 1;
+
+    /* A second signer with no witness of its own */
+    neoc_hash160_t other;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash160_from_string(SIGNER_HASH, &other));
+    neoc_signer_t *signer = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_signer_create(&other, NEOC_WITNESS_SCOPE_CALLED_BY_ENTRY, &signer));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_add_signer(tx, signer));
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+    neoc_transaction_free(tx);
+}
+
+void test_verify_rejects_foreign_key_witness(void) {
+    neoc_transaction_t *tx = parse_known_transaction();
+
+    /* A correct signature over the right data, but by a key that is not the signer */
+    neoc_account_t *foreign = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_create("foreign", &foreign));
+    neoc_hash256_t digest;
+    known_sign_digest(tx, &digest);
+    neoc_witness_t *witness = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_sign_hash(foreign, &digest, &witness));
+    neoc_witness_free(tx->witnesses[0]);
+    tx->witnesses[0] = witness;
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+
+    /* Re-pointing the signer at the foreign account makes it verify */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash160_from_script(&tx->signers[0]->account,
+                                                                 witness->verification_script,
+                                                                 witness->verification_script_len));
+    neoc_witness_free(tx->witnesses[0]);
+    tx->witness_count = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_transaction_sign_for_network(tx, foreign, KNOWN_TX_NETWORK_MAGIC));
+    TEST_ASSERT_TRUE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+
+    neoc_account_free(foreign);
+    neoc_transaction_free(tx);
+}
+
+void test_verify_accepts_only_n3_scripts(void) {
+    neoc_bytes_t *raw = neoc_bytes_from_hex(KNOWN_TX_HEX);
+    TEST_ASSERT_NOT_NULL(raw);
+    const uint8_t *invocation = raw->data + KNOWN_TX_WITNESS_OFFSET + 1;
+    const uint8_t *verification = invocation + 66 + 1;
+
+    /* Bare 0x40 <signature> instead of PUSHDATA1 0x40 <signature> */
+    neoc_transaction_t *tx = parse_known_transaction();
+    replace_witness(tx, invocation + 1, 65, verification, 40);
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+    neoc_transaction_free(tx);
+
+    /* Legacy 0x21 <key> CHECKSIG, with the signer bound to that script */
+    uint8_t private_key[32] = {0};
+    private_key[31] = 1;
+    neoc_ec_key_pair_t *key_pair = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_ec_key_pair_create_from_private_key(private_key, &key_pair));
+    neoc_account_t *account = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_create_from_key_pair_with_label("known", key_pair, &account));
+
+    uint8_t legacy[35];
+    legacy[0] = 0x21;
+    memcpy(legacy + 1, verification + 2, 33);
+    legacy[34] = 0xAC;
+    tx = parse_known_transaction();
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash160_from_script(&tx->signers[0]->account, legacy, sizeof(legacy)));
+    neoc_hash256_t digest;
+    known_sign_digest(tx, &digest);
+    uint8_t *signature = NULL;
+    size_t signature_len = 0;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_sign(account, digest.data, sizeof(digest.data),
+                                                          &signature, &signature_len));
+    uint8_t pushed[66] = {0x0c, 0x40};
+    memcpy(pushed + 2, signature, 64);
+    replace_witness(tx, pushed, sizeof(pushed), legacy, sizeof(legacy));
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+
+    /* PUSHDATA1 <key> followed by a bare CHECKSIG */
+    uint8_t short_form[36];
+    memcpy(short_form, verification, 35);
+    short_form[35] = 0xAC;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash160_from_script(&tx->signers[0]->account, short_form, sizeof(short_form)));
+    known_sign_digest(tx, &digest);
+    neoc_free(signature);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_sign(account, digest.data, sizeof(digest.data),
+                                                          &signature, &signature_len));
+    memcpy(pushed + 2, signature, 64);
+    replace_witness(tx, pushed, sizeof(pushed), short_form, sizeof(short_form));
+    TEST_ASSERT_FALSE(neoc_transaction_verify(tx, KNOWN_TX_NETWORK_MAGIC));
+
+    neoc_free(signature);
+    neoc_transaction_free(tx);
+    neoc_account_free(account);
+    neoc_ec_key_pair_free(key_pair);
+    neoc_bytes_free(raw);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_deserialize_round_trip);
+    RUN_TEST(test_deserialize_known_transaction);
+    RUN_TEST(test_verify_known_transaction);
+    RUN_TEST(test_verify_rejects_missing_witness);
+    RUN_TEST(test_verify_rejects_foreign_key_witness);
+    RUN_TEST(test_verify_accepts_only_n3_scripts);
+    RUN_TEST(test_serialize_and_hash_without_allocating);
+    RUN_TEST(test_view_points_into_buffer);
+    RUN_TEST(test_deserialize_simple_walks_concatenated_transactions);
+    RUN_TEST(test_truncated_input_is_rejected);
+    RUN_TEST(test_malformed_transactions_are_rejected);
+
+    UNITY_END();
+}
@@ -0,0 +1,254 @@
+/**
+ * @file test_wallet.c
+ * @brief Wallet account index (lookups, duplicates, removal) and parallel unlock
+ */
+
+#include "unity.h"
+#include <neoc/neoc.h>
+#include <neoc/wallet/wallet.h>
+#include <neoc/wallet/account.h>
+#include <string.h>
+
+#define ACCOUNT_COUNT 2000
+
+static neoc_wallet_t *wallet;
+
+void setUp(void) {
+    neoc_init();
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_create("index", &wallet));
+}
+
+void tearDown(void) {
+    neoc_wallet_free(wallet);
+    neoc_cleanup();
+}
+
+static void make_hash(uint32_t seed, bool same_prefix, neoc_hash160_t *hash) {
+    uint32_t x = seed * 2654435761u + 1;
+    for (size_t i = 0; i < NEOC_HASH160_SIZE; i++) {
+        x = x * 1103515245u + 12345u;
+        hash->data[i] = (uint8_t)(x >> 16);
+    }
+    if (same_prefix) {
+        /* The index only hashes the first eight bytes, so these all collide */
+        memset(hash->data, 0x5A, 8);
+    }
+}
+
+static neoc_account_t *make_account(uint32_t seed, bool same_prefix) {
+    neoc_hash160_t hash;
+    char address[NEOC_ADDRESS_LENGTH];
+    make_hash(seed, same_prefix, &hash);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_hash160_to_address(&hash, address, sizeof(address)));
+    neoc_account_t *account = NULL;
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_create_from_address(address, &account));
+    return account;
+}
+
+/* Every account is findable by both keys, and an account is listed exactly once */
+static void check_consistent(const bool *present, size_t count, bool same_prefix) {
+    size_t listed = 0;
+    neoc_account_t **accounts = neoc_wallet_get_accounts(wallet, &listed);
+    size_t expected = 0;
+    for (size_t i = 0; i < count; i++) {
+        neoc_hash160_t hash;
+        make_hash((uint32_t)i, same_prefix, &hash);
+        neoc_account_t *by_hash = neoc_wallet_get_account_by_script_hash(wallet, &hash);
+        if (!present[i]) {
+            TEST_ASSERT_NULL(by_hash);
+            continue;
+        }
+        expected++;
+        TEST_ASSERT_NOT_NULL(by_hash);
+        TEST_ASSERT_EQUAL_PTR(by_hash, neoc_wallet_get_account_by_address(wallet, by_hash->address));
+        TEST_ASSERT_TRUE(neoc_wallet_contains(wallet, by_hash->address));
+    }
+    TEST_ASSERT_EQUAL_UINT(expected, listed);
+    for (size_t i = 0; i < listed; i++) {
+        TEST_ASSERT_EQUAL_PTR(accounts[i], neoc_wallet_get_account_by_script_hash(wallet, &accounts[i]->script_hash));
+    }
+}
+
+void test_add_and_lookup(void) {
+    static bool present[ACCOUNT_COUNT];
+    for (uint32_t i = 0; i < ACCOUNT_COUNT; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, make_account(i, false)));
+        present[i] = true;
+    }
+    check_consistent(present, ACCOUNT_COUNT, false);
+
+    /* Accounts keep their insertion order until something is removed */
+    neoc_hash160_t hash;
+    make_hash(1234, false, &hash);
+    TEST_ASSERT_EQUAL_PTR(neoc_wallet_get_account_by_index(wallet, 1234),
+                          neoc_wallet_get_account_by_script_hash(wallet, &hash));
+
+    neoc_account_t *duplicate = make_account(77, false);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE, neoc_wallet_add_account(wallet, duplicate));
+    neoc_account_free(duplicate);
+
+    TEST_ASSERT_NULL(neoc_wallet_get_account_by_address(wallet, "InvalidAddress"));
+    TEST_ASSERT_NULL(neoc_wallet_get_account_by_address(wallet, "NLnyLtep7jwyq1qhNPkwXbJpurC4jUT8ke"));
+    TEST_ASSERT_TRUE(neoc_wallet_remove_account(wallet, "InvalidAddress") != NEOC_SUCCESS);
+}
+
+void test_remove_moves_last_account(void) {
+    static bool present[ACCOUNT_COUNT];
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_reserve_accounts(wallet, ACCOUNT_COUNT));
+    for (uint32_t i = 0; i < ACCOUNT_COUNT; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, make_account(i, false)));
+        present[i] = true;
+    }
+
+    char address[NEOC_ADDRESS_LENGTH];
+    neoc_account_t *last = neoc_wallet_get_account_by_index(wallet, ACCOUNT_COUNT - 1);
+    strcpy(address, neoc_wallet_get_account_by_index(wallet, 10)->address);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_remove_account(wallet, address));
+    present[10] = false;
+    TEST_ASSERT_EQUAL_PTR(last, neoc_wallet_get_account_by_index(wallet, 10));
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, neoc_wallet_remove_account(wallet, address));
+
+    for (uint32_t i = 0; i < ACCOUNT_COUNT; i += 3) {
+        if (!present[i]) {
+            continue;
+        }
+        neoc_hash160_t hash;
+        make_hash(i, false, &hash);
+        strcpy(address, neoc_wallet_get_account_by_script_hash(wallet, &hash)->address);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_remove_account(wallet, address));
+        present[i] = false;
+    }
+    check_consistent(present, ACCOUNT_COUNT, false);
+
+    /* Removed accounts can be added back */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, make_account(3, false)));
+    present[3] = true;
+    check_consistent(present, ACCOUNT_COUNT, false);
+}
+
+/* One long probe run: removals from its middle must not cut off later entries */
+void test_colliding_script_hashes(void) {
+    static bool present[200];
+    for (uint32_t i = 0; i < 200; i++) {
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, make_account(i, i % 2 == 0)));
+        present[i] = true;
+    }
+    for (uint32_t i = 0; i < 200; i += 7) {
+        neoc_hash160_t hash;
+        make_hash(i, i % 2 == 0, &hash);
+        char address[NEOC_ADDRESS_LENGTH];
+        strcpy(address, neoc_wallet_get_account_by_script_hash(wallet, &hash)->address);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_remove_account(wallet, address));
+        present[i] = false;
+    }
+
+    for (uint32_t i = 0; i < 200; i++) {
+        neoc_hash160_t hash;
+        make_hash(i, i % 2 == 0, &hash);
+        neoc_account_t *account = neoc_wallet_get_account_by_script_hash(wallet, &hash);
+        TEST_ASSERT_EQUAL_INT(present[i], account != NULL);
+    }
+}
+
+void test_default_account_follows_removal(void) {
+    neoc_account_t *first = make_account(1, false);
+    neoc_account_t *second = make_account(2, false);
+    neoc_account_t *third = make_account(3, false);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, first));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, second));
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, third));
+    TEST_ASSERT_EQUAL_PTR(first, neoc_wallet_get_default_account_ptr(wallet));
+
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_set_default_account_hash(wallet, &third->script_hash));
+    TEST_ASSERT_TRUE(third->is_default);
+    TEST_ASSERT_FALSE(first->is_default);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_set_default_account_account(wallet, second));
+    TEST_ASSERT_EQUAL_PTR(second, neoc_wallet_get_default_account_ptr(wallet));
+
+    char address[NEOC_ADDRESS_LENGTH];
+    strcpy(address, second->address);
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_remove_account(wallet, address));
+    TEST_ASSERT_EQUAL_PTR(first, neoc_wallet_get_default_account_ptr(wallet));
+    TEST_ASSERT_EQUAL_UINT(2, neoc_wallet_get_account_count_value(wallet));
+
+    neoc_hash160_t missing;
+    make_hash(99, false, &missing);
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT, neoc_wallet_set_default_account_hash(wallet, &missing));
+}
+
+typedef struct {
+    size_t calls;
+    size_t last_completed;
+    size_t total;
+    bool in_order;
+} unlock_progress_t;
+
+/* Runs on worker threads, so only record; the test asserts afterwards */
+static void record_progress(size_t completed, size_t total, void *user_data) {
+    unlock_progress_t *progress = (unlock_progress_t *)user_data;
+    progress->calls++;
+    progress->in_order = progress->in_order && completed == progress->last_completed + 1;
+    progress->last_completed = completed;
+    progress->total = total;
+}
+
+void test_unlock_all_parallel(void) {
+    enum { KEYED = 6 };
+    const neoc_scrypt_params_t light = { .n = 1024, .r = 1, .p = 1, .dk_len = 64 };
+    uint8_t expected[KEYED][32];
+
+    /* Encrypted accounts as loaded from NEP-6: key pair dropped, key under a password */
+    for (size_t i = 0; i < KEYED; i++) {
+        neoc_account_t *account = NULL;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_create_random(&account));
+        size_t key_len = sizeof(expected[i]);
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_ec_key_pair_get_private_key(account->key_pair, expected[i], &key_len));
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_account_encrypt_private_key_with_params(
+            account, i == 2 ? "wrong" : "secret", &light));
+        neoc_ec_key_pair_free(account->key_pair);
+        account->key_pair = NULL;
+        TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, account));
+    }
+    /* Watch-only accounts are skipped */
+    TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_wallet_add_account(wallet, make_account(5, false)));
+
+    neoc_error_t results[KEYED + 1];
+    unlock_progress_t progress = { .in_order = true };
+    neoc_nep2_params_t params = { .n = light.n, .r = light.r, .p = light.p };
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_PASSWORD,
+                          neoc_wallet_unlock_all_parallel(wallet, "secret", &params, 0,
+                                                          record_progress, &progress, results));
+    TEST_ASSERT_EQUAL_UINT(KEYED, progress.calls);
+    TEST_ASSERT_EQUAL_UINT(KEYED, progress.total);
+    TEST_ASSERT_TRUE(progress.in_order);
+
+    for (size_t i = 0; i < KEYED + 1; i++) {
+        neoc_account_t *account = neoc_wallet_get_account_by_index(wallet, i);
+        if (i == 2) {
+            TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_PASSWORD, results[i]);
+            TEST_ASSERT_NULL(account->key_pair);
+            TEST_ASSERT_TRUE(account->is_locked);
+        } else if (i == KEYED) {
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, results[i]);
+            TEST_ASSERT_NULL(account->key_pair);
+        } else {
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, results[i]);
+            TEST_ASSERT_NOT_NULL(account->key_pair);
+            TEST_ASSERT_FALSE(account->is_locked);
+            uint8_t private_key[32];
+            size_t key_len = sizeof(private_key);
+            TEST_ASSERT_EQUAL_INT(NEOC_SUCCESS, neoc_ec_key_pair_get_private_key(account->key_pair, private_key, &key_len));
+            TEST_ASSERT_EQUAL_MEMORY(expected[i], private_key, 32);
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_add_and_lookup);
+    RUN_TEST(test_remove_moves_last_account);
+    RUN_TEST(test_colliding_script_hashes);
+    RUN_TEST(test_default_account_follows_removal);
+    RUN_TEST(test_unlock_all_parallel);
+    UNITY_END();
+}
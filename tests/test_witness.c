@@ -105,6 +105,17 @@ void test_create_witness_from_signature(void) {
     TEST_ASSERT_TRUE(witness->invocation_script_len > 0);
     TEST_ASSERT_TRUE(witness->verification_script_len > 0);
     
+    // N3 form: PUSHDATA1 <sig> / PUSHDATA1 <key> SYSCALL System.Crypto.CheckSig
+    TEST_ASSERT_EQUAL_INT(66, (int)witness->invocation_script_len);
+    TEST_ASSERT_EQUAL_HEX8(0x0c, witness->invocation_script[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x40, witness->invocation_script[1]);
+    TEST_ASSERT_EQUAL_INT(40, (int)witness->verification_script_len);
+    TEST_ASSERT_EQUAL_HEX8(0x0c, witness->verification_script[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x21, witness->verification_script[1]);
+    TEST_ASSERT_EQUAL_MEMORY(public_key, witness->verification_script + 2, sizeof(public_key));
+    const uint8_t check_sig[5] = {0x41, 0x56, 0xe7, 0xb3, 0x27};
+    TEST_ASSERT_EQUAL_MEMORY(check_sig, witness->verification_script + 35, 5);
+    
     neoc_witness_free(witness);
 }
 
@@ -18,7 +18,7 @@ void tearDown(void) {
 
 void test_rx_creation_and_simple_getter(void) {
     TEST_ASSERT_NULL(neoc_json_rpc2_0_rx_get_neo_c(rx));
-    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_NOT_IMPLEMENTED,
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_ARGUMENT,
                           neoc_json_rpc2_0_rx_get_latest_block_index(rx, NULL));
 }
 
@@ -28,9 +28,9 @@ static bool dummy_block_index_callback(int block_index, neoc_error_t error, void
     return error == NEOC_SUCCESS;
 }
 
-void test_rx_block_index_subscription_returns_not_implemented(void) {
+void test_rx_block_index_subscription_requires_client(void) {
     neoc_subscription_t *subscription = NULL;
-    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_NOT_IMPLEMENTED,
+    TEST_ASSERT_EQUAL_INT(NEOC_ERROR_INVALID_STATE,
                           neoc_json_rpc2_0_rx_block_index_publisher(rx,
                                                                     1000,
                                                                     dummy_block_index_callback,
@@ -42,6 +42,6 @@ void test_rx_block_index_subscription_returns_not_implemented(void) {
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_rx_creation_and_simple_getter);
-    RUN_TEST(test_rx_block_index_subscription_returns_not_implemented);
+    RUN_TEST(test_rx_block_index_subscription_requires_client);
     UNITY_END();
 }
@@ -524,7 +524,7 @@ static int print_quoted_string(const char *input, char **buffer, int *length, in
         unsigned char c = (unsigned char)*input++;
         switch (c) {
             case '"':
-                if (!append_string(buffer, length, offset, "\\""")) return 0;
+                if (!append_string(buffer, length, offset, "\\\"")) return 0;
                 break;
             case '\\':
                 if (!append_string(buffer, length, offset, "\\\\")) return 0;